@@ -182,6 +182,19 @@ set(MPIX_IALLGATHER_CODE
      }")
 El_check_c_source_compiles("${MPIX_IALLGATHER_CODE}" 
   EL_HAVE_MPIX_NONBLOCKING_COLLECTIVES)
+set(MPI_COMM_SPLIT_TYPE_CODE
+    "#include \"mpi.h\"
+     int main( int argc, char* argv[] )
+     {
+       MPI_Init( &argc, &argv );
+       MPI_Comm nodeComm;
+       MPI_Comm_split_type
+       ( MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL, &nodeComm );
+       MPI_Finalize();
+       return 0;
+     }")
+El_check_c_source_compiles("${MPI_COMM_SPLIT_TYPE_CODE}"
+  EL_HAVE_MPI_COMM_SPLIT_TYPE)
 set(MPI_INIT_THREAD_CODE
     "#include \"mpi.h\"
      int main( int argc, char* argv[] )
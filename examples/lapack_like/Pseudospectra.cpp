@@ -70,6 +70,8 @@ main( int argc, char* argv[] )
                   "switch to complex arithmetic for PS iter's",true);
         const bool arnoldi = Input("--arnoldi","use Arnoldi?",true);
         const Int basisSize = Input("--basisSize","num Arnoldi vectors",10);
+        const Int shiftBatchSize =
+            Input("--shiftBatchSize","local shifts per solve batch",0);
         const Int maxIts = Input("--maxIts","maximum pseudospec iter's",200);
         const Real psTol = Input("--psTol","tolerance for pseudospectra",1e-6);
         // Uniform options
@@ -113,6 +115,7 @@ main( int argc, char* argv[] )
         const Int imgFormatInt = Input("--imgFormat","image format",8);
         const Int colorMapInt = Input("--colorMap","color map",0);
         const bool itCounts = Input("--itCounts","display iter. counts?",true);
+        const bool shiftTimes = Input("--shiftTimes","save shift times?",false);
         ProcessInput();
         PrintInputReport();
 
@@ -246,6 +249,7 @@ main( int argc, char* argv[] )
         psCtrl.deflate = deflate;
         psCtrl.arnoldi = arnoldi;
         psCtrl.basisSize = basisSize;
+        psCtrl.shiftBatchSize = shiftBatchSize;
         psCtrl.progress = progress;
 #ifdef EL_HAVE_SCALAPACK
         psCtrl.schurCtrl.qrCtrl.blockHeight = nbDist;
@@ -270,6 +274,7 @@ main( int argc, char* argv[] )
         psCtrl.snapCtrl.imgBase = matName+"-"+imgBase;
         psCtrl.snapCtrl.numBase = matName+"-"+numBase;
         psCtrl.snapCtrl.itCounts = itCounts;
+        psCtrl.snapCtrl.shiftTimes = shiftTimes;
 
         // Visualize the pseudospectra by evaluating ||inv(A-sigma I)||_2 
         // for a grid of complex sigma's.
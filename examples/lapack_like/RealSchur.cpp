@@ -22,10 +22,14 @@ main( int argc, char* argv[] )
         const Int matType = Input("--matType","0: uniform, 1: Haar",0);
         const Int n = Input("--size","height of matrix",100);
         const bool fullTriangle = Input("--fullTriangle","full Schur?",true);
-#ifdef EL_HAVE_SCALAPACK
+        const bool sdc = Input("--sdc","spectral divide and conquer?",false);
         // QR algorithm options
-        const bool aed = Input("--aed","use Agg. Early Deflat.?",false);
-#else
+        const bool scalapack = Input("--scalapack","ScaLAPACK QR alg.?",false);
+        const bool aed = Input("--aed","distributed Agg. Early Deflat.?",false);
+        const Int numShifts = Input("--numShifts","shifts per sweep",0);
+        const Int deflationSize = Input("--deflationSize","AED window",0);
+        const Int minMultiBulgeSize =
+          Input("--minMultiBulgeSize","redundant QR cutoff",75);
         // Spectral Divide and Conquer options
         const Int cutoff = Input("--cutoff","cutoff for QR alg.",256);
         const Int maxInnerIts = Input("--maxInnerIts","maximum RURV its",2);
@@ -35,7 +39,6 @@ main( int argc, char* argv[] )
         const Real spreadFactor = Input("--spreadFactor","median pert.",1e-6);
         const bool random = Input("--random","random RRQR?",true);
         const bool progress = Input("--progress","output progress?",false);
-#endif
         const bool display = Input("--display","display matrices?",false);
         ProcessInput();
         PrintInputReport();
@@ -51,11 +54,12 @@ main( int argc, char* argv[] )
         DistMatrix<Real> T( A ), Q;
         DistMatrix<Complex<Real>,VR,STAR> w;
         SchurCtrl<Real> ctrl;
-#ifdef EL_HAVE_SCALAPACK
+        ctrl.useSDC = sdc;
+        ctrl.qrCtrl.scalapack = scalapack;
         ctrl.qrCtrl.distAED = aed;
-        // TODO: distribution block size
-#else
-        ctrl.useSDC = true;
+        ctrl.qrCtrl.numShifts = numShifts;
+        ctrl.qrCtrl.deflationSize = deflationSize;
+        ctrl.qrCtrl.minMultiBulgeSize = minMultiBulgeSize;
         ctrl.sdcCtrl.cutoff = cutoff;
         ctrl.sdcCtrl.maxInnerIts = maxInnerIts;
         ctrl.sdcCtrl.maxOuterIts = maxOuterIts;
@@ -65,7 +69,6 @@ main( int argc, char* argv[] )
         ctrl.sdcCtrl.progress = progress;
         ctrl.sdcCtrl.signCtrl.tol = signTol;
         ctrl.sdcCtrl.signCtrl.progress = progress;
-#endif
         Schur( T, w, Q, fullTriangle, ctrl );
         MakeTrapezoidal( UPPER, T, -1 );
         if( display )
@@ -24,6 +24,8 @@ main( int argc, char* argv[] )
         const Int m = Input("--height","height of matrix",100);
         const Int n = Input("--width","width of matrix",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
+        const bool distMRRR = Input
+          ("--distMRRR","distributed MRRR for the bidiagonal SVD?",true);
         const bool print = Input("--print","print matrices?",false);
         ProcessInput();
         PrintInputReport();
@@ -46,8 +48,10 @@ main( int argc, char* argv[] )
         // Compute the SVD of A 
         DistMatrix<C> V(g);
         DistMatrix<Real,VR,STAR> s(g);
+        SVDCtrl<Real> ctrl;
+        ctrl.distMRRR = distMRRR;
         U = A;
-        SVD( U, s, V );
+        SVD( U, s, V, ctrl );
         if( print )
         {
             Print( U, "U" );
@@ -64,6 +68,16 @@ main( int argc, char* argv[] )
         const Real infNormOfA = InfinityNorm( A );
         const Real frobNormOfA = FrobeniusNorm( A );
 
+        // Measure the departures of U and V from orthonormality
+        const Int k = Min(m,n);
+        DistMatrix<C> OrthErr(g);
+        Identity( OrthErr, k, k );
+        Herk( LOWER, ADJOINT, Real(-1), U, Real(1), OrthErr );
+        const Real UOrthErr = HermitianFrobeniusNorm( LOWER, OrthErr );
+        Identity( OrthErr, k, k );
+        Herk( LOWER, ADJOINT, Real(-1), V, Real(1), OrthErr );
+        const Real VOrthErr = HermitianFrobeniusNorm( LOWER, OrthErr );
+
         DiagonalScale( RIGHT, NORMAL, s, U );
         Gemm( NORMAL, ADJOINT, C(-1), U, V, C(1), A );
         const Real maxNormOfE = MaxNorm( A );
@@ -88,7 +102,9 @@ main( int argc, char* argv[] )
                  << "||A - U Sigma V_H||_F / (max(m,n) eps ||A||_2) = " 
                  << scaledResidual << "\n" 
                  << "\n"
-                 << "|| sError ||_2 = " << singValDiff << endl;
+                 << "|| sError ||_2 = " << singValDiff << "\n"
+                 << "|| I - U^H U ||_F = " << UOrthErr << "\n"
+                 << "|| I - V^H V ||_F = " << VOrthErr << endl;
         }
     }
     catch( exception& e ) { ReportException(e); }
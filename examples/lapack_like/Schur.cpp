@@ -23,11 +23,15 @@ main( int argc, char* argv[] )
         const Int matType = Input("--matType","0: uniform, 1: Haar",0);
         const Int n = Input("--size","height of matrix",100);
         const bool fullTriangle = Input("--fullTriangle","full Schur?",true);
-#ifdef EL_HAVE_SCALAPACK
-        // QR algorithm options (none so far)
-        // TODO: whether or not to use AED
-        // TODO: distribution block size
-#else
+        const bool sdc = Input("--sdc","spectral divide and conquer?",false);
+        // QR algorithm options
+        const bool scalapack = Input("--scalapack","ScaLAPACK QR alg.?",false);
+        const bool distAED = Input("--distAED","distributed AED?",false);
+        const Int numShifts = Input("--numShifts","shifts per sweep",0);
+        const Int deflationSize = Input("--deflationSize","AED window",0);
+        const Int minMultiBulgeSize =
+          Input("--minMultiBulgeSize","redundant QR cutoff",75);
+        const Int nbDist = Input("--nbDist","chase step/block size",32);
         // Spectral Divide and Conquer options
         const Int cutoff = Input("--cutoff","cutoff for QR alg.",256);
         const Int maxInnerIts = Input("--maxInnerIts","maximum RURV its",2);
@@ -37,7 +41,6 @@ main( int argc, char* argv[] )
         const Real spreadFactor = Input("--spreadFactor","median pert.",1e-6);
         const bool random = Input("--random","random RRQR?",true);
         const bool progress = Input("--progress","output progress?",false);
-#endif
         const bool display = Input("--display","display matrices?",false);
         ProcessInput();
         PrintInputReport();
@@ -54,12 +57,14 @@ main( int argc, char* argv[] )
         DistMatrix<C> T( A ), Q(g);
         DistMatrix<C,VR,STAR> w(g);
         SchurCtrl<Real> ctrl;
-#ifdef EL_HAVE_SCALAPACK
-        //ctrl.qrCtrl.blockHeight = nbDist;
-        //ctrl.qrCtrl.blockWidth = nbDist;
-        ctrl.qrCtrl.distAED = false;
-#else
-        ctrl.useSDC = true;
+        ctrl.useSDC = sdc;
+        ctrl.qrCtrl.scalapack = scalapack;
+        ctrl.qrCtrl.distAED = distAED;
+        ctrl.qrCtrl.numShifts = numShifts;
+        ctrl.qrCtrl.deflationSize = deflationSize;
+        ctrl.qrCtrl.minMultiBulgeSize = minMultiBulgeSize;
+        ctrl.qrCtrl.blockHeight = nbDist;
+        ctrl.qrCtrl.blockWidth = nbDist;
         ctrl.sdcCtrl.cutoff = cutoff;
         ctrl.sdcCtrl.maxInnerIts = maxInnerIts;
         ctrl.sdcCtrl.maxOuterIts = maxOuterIts;
@@ -69,7 +74,6 @@ main( int argc, char* argv[] )
         ctrl.sdcCtrl.progress = progress;
         ctrl.sdcCtrl.signCtrl.tol = signTol;
         ctrl.sdcCtrl.signCtrl.progress = progress;
-#endif
         Schur( T, w, Q, fullTriangle, ctrl );
         MakeTrapezoidal( UPPER, T );
 
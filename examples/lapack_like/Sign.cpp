@@ -24,6 +24,8 @@ main( int argc, char* argv[] )
         const Int n = Input("--width","width of matrix",100);
         const SignScaling scaling = 
             static_cast<SignScaling>(Input("--scaling","scaling strategy",0));
+        const SignMethod method =
+            static_cast<SignMethod>(Input("--method","sign iteration",0));
         const Int maxIts = Input("--maxIts","max number of iter's",100);
         const double tol = Input("--tol","convergence tolerance",1e-6);
         const bool progress = Input("--progress","print sign progress?",true);
@@ -44,6 +46,7 @@ main( int argc, char* argv[] )
         signCtrl.tol = tol;
         signCtrl.progress = progress;
         signCtrl.scaling = scaling;
+        signCtrl.method = method;
 
         // Compute sgn(A)
         Sign( A, signCtrl );
@@ -876,6 +876,8 @@ CReflect( const HermitianTridiagCtrl<F>& ctrl )
     ctrlC.approach = CReflect(ctrl.approach);
     ctrlC.order = CReflect(ctrl.order);
     ctrlC.symvCtrl = CReflect(ctrl.symvCtrl);
+    ctrlC.twoStage = ctrl.twoStage;
+    ctrlC.bandwidth = ctrl.bandwidth;
     return ctrlC;
 }
 
@@ -887,6 +889,8 @@ CReflect( const ElHermitianTridiagCtrl& ctrlC )
     ctrl.approach = CReflect(ctrlC.approach);
     ctrl.order = CReflect(ctrlC.order);
     ctrl.symvCtrl = CReflect<F>(ctrlC.symvCtrl);
+    ctrl.twoStage = ctrlC.twoStage;
+    ctrl.bandwidth = ctrlC.bandwidth;
     return ctrl;
 }
 
@@ -1096,6 +1100,7 @@ inline SVDCtrl<float> CReflect( const ElSVDCtrl_s& ctrlC )
 {
     SVDCtrl<float> ctrl;
     ctrl.seqQR = ctrlC.seqQR;
+    ctrl.distMRRR = ctrlC.distMRRR;
     ctrl.valChanRatio = ctrlC.valChanRatio;
     ctrl.fullChanRatio = ctrlC.fullChanRatio;
     ctrl.thresholded = ctrlC.thresholded;
@@ -1108,6 +1113,7 @@ inline SVDCtrl<double> CReflect( const ElSVDCtrl_d& ctrlC )
 {
     SVDCtrl<double> ctrl;
     ctrl.seqQR = ctrlC.seqQR;
+    ctrl.distMRRR = ctrlC.distMRRR;
     ctrl.valChanRatio = ctrlC.valChanRatio;
     ctrl.fullChanRatio = ctrlC.fullChanRatio;
     ctrl.thresholded = ctrlC.thresholded;
@@ -1120,6 +1126,7 @@ inline ElSVDCtrl_s CReflect( const SVDCtrl<float>& ctrl )
 {
     ElSVDCtrl_s ctrlC;
     ctrlC.seqQR = ctrl.seqQR;
+    ctrlC.distMRRR = ctrl.distMRRR;
     ctrlC.valChanRatio = ctrl.valChanRatio;
     ctrlC.fullChanRatio = ctrl.fullChanRatio;
     ctrlC.thresholded = ctrl.thresholded;
@@ -1132,6 +1139,7 @@ inline ElSVDCtrl_d CReflect( const SVDCtrl<double>& ctrl )
 {
     ElSVDCtrl_d ctrlC;
     ctrlC.seqQR = ctrl.seqQR;
+    ctrlC.distMRRR = ctrl.distMRRR;
     ctrlC.valChanRatio = ctrl.valChanRatio;
     ctrlC.fullChanRatio = ctrl.fullChanRatio;
     ctrlC.thresholded = ctrl.thresholded;
@@ -1147,6 +1155,11 @@ inline ElHessQRCtrl CReflect( const HessQRCtrl& ctrl )
     ctrlC.distAED = ctrl.distAED;
     ctrlC.blockHeight = ctrl.blockHeight;
     ctrlC.blockWidth = ctrl.blockWidth;
+    ctrlC.scalapack = ctrl.scalapack;
+    ctrlC.numShifts = ctrl.numShifts;
+    ctrlC.deflationSize = ctrl.deflationSize;
+    ctrlC.minMultiBulgeSize = ctrl.minMultiBulgeSize;
+    ctrlC.chaseAdvance = ctrl.chaseAdvance;
     return ctrlC;
 }
 
@@ -1156,6 +1169,11 @@ inline HessQRCtrl CReflect( const ElHessQRCtrl& ctrlC )
     ctrl.distAED = ctrlC.distAED;
     ctrl.blockHeight = ctrlC.blockHeight;
     ctrl.blockWidth = ctrlC.blockWidth;
+    ctrl.scalapack = ctrlC.scalapack;
+    ctrl.numShifts = ctrlC.numShifts;
+    ctrl.deflationSize = ctrlC.deflationSize;
+    ctrl.minMultiBulgeSize = ctrlC.minMultiBulgeSize;
+    ctrl.chaseAdvance = ctrlC.chaseAdvance;
     return ctrl;
 }
 
@@ -1506,6 +1524,7 @@ inline ElSnapshotCtrl CReflect( const SnapshotCtrl& ctrl )
     ctrlC.imgFormat = CReflect(ctrl.imgFormat);
     ctrlC.numFormat = CReflect(ctrl.numFormat);
     ctrlC.itCounts = ctrl.itCounts;
+    ctrlC.shiftTimes = ctrl.shiftTimes;
     return ctrlC;
 }
 inline SnapshotCtrl CReflect( const ElSnapshotCtrl& ctrlC )
@@ -1524,6 +1543,7 @@ inline SnapshotCtrl CReflect( const ElSnapshotCtrl& ctrlC )
     ctrl.imgFormat = CReflect(ctrlC.imgFormat);
     ctrl.numFormat = CReflect(ctrlC.numFormat);
     ctrl.itCounts = ctrlC.itCounts;
+    ctrl.shiftTimes = ctrlC.shiftTimes;
     return ctrl;
 }
 
@@ -1542,6 +1562,7 @@ inline ElPseudospecCtrl_s CReflect( const PseudospecCtrl<float>& ctrl )
     ctrlC.arnoldi = ctrl.arnoldi;
     ctrlC.basisSize = ctrl.basisSize;
     ctrlC.reorthog = ctrl.reorthog;
+    ctrlC.shiftBatchSize = ctrl.shiftBatchSize;
     ctrlC.progress = ctrl.progress;
     ctrlC.snapCtrl = CReflect(ctrl.snapCtrl);
     return ctrlC;
@@ -1561,6 +1582,7 @@ inline ElPseudospecCtrl_d CReflect( const PseudospecCtrl<double>& ctrl )
     ctrlC.arnoldi = ctrl.arnoldi;
     ctrlC.basisSize = ctrl.basisSize;
     ctrlC.reorthog = ctrl.reorthog;
+    ctrlC.shiftBatchSize = ctrl.shiftBatchSize;
     ctrlC.progress = ctrl.progress;
     ctrlC.snapCtrl = CReflect(ctrl.snapCtrl);
     return ctrlC;
@@ -1581,6 +1603,7 @@ inline PseudospecCtrl<float> CReflect( const ElPseudospecCtrl_s& ctrlC )
     ctrl.arnoldi = ctrlC.arnoldi;
     ctrl.basisSize = ctrlC.basisSize;
     ctrl.reorthog = ctrlC.reorthog;
+    ctrl.shiftBatchSize = ctrlC.shiftBatchSize;
     ctrl.progress = ctrlC.progress;
     ctrl.snapCtrl = CReflect(ctrlC.snapCtrl);
     return ctrl;
@@ -1600,6 +1623,7 @@ inline PseudospecCtrl<double> CReflect( const ElPseudospecCtrl_d& ctrlC )
     ctrl.arnoldi = ctrlC.arnoldi;
     ctrl.basisSize = ctrlC.basisSize;
     ctrl.reorthog = ctrlC.reorthog;
+    ctrl.shiftBatchSize = ctrlC.shiftBatchSize;
     ctrl.progress = ctrlC.progress;
     ctrl.snapCtrl = CReflect(ctrlC.snapCtrl);
     return ctrl;
@@ -53,6 +53,11 @@ template<> Int LocalTrr2kBlocksize<double>();
 template<> Int LocalTrr2kBlocksize<Complex<float>>();
 template<> Int LocalTrr2kBlocksize<Complex<double>>();
 
+// The number of layers of processes used by GEMM_SUMMA_25D, where zero (the
+// default) chooses the largest number allowed by the available memory
+void SetGemmNumLayers( Int numLayers );
+Int GemmNumLayers();
+
 template<typename T>
 struct SymvCtrl 
 {
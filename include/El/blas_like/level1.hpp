@@ -298,6 +298,56 @@ void Copy( const AbstractDistMatrix<S>& A, AbstractDistMatrix<T>& B );
 template<typename S,typename T>
 void Copy( const AbstractBlockDistMatrix<S>& A, AbstractBlockDistMatrix<T>& B );
 
+// Redistribution between arbitrary distributions over different grids
+// --------------------------------------------------------------------
+// The two grids must share (congruent) viewing communicators, over which the
+// redistribution is performed with a single AllToAll. Since a plan only 
+// depends upon the sizes, distributions, alignments, and grids of the two
+// matrices, it may be reused for any pair with the same layouts.
+struct TranslatePlan
+{
+    mpi::Comm comm;
+    Int height=0, width=0;
+
+    // The owners (within the destination distribution) of the local rows and
+    // columns of the source, with the column owners premultiplied by the
+    // destination's column stride, and the map from the destination's 
+    // (distribution rank,redundant rank) pairs to ranks in 'comm'
+    vector<int> sendRowOwners, sendColOwners, sendRanks;
+    int sendRedundantSize=1;
+
+    // The owners (within the source distribution) of the local rows and
+    // columns of the destination, with the column owners premultiplied by
+    // the source's column stride, and the map from the source's 
+    // distribution ranks to the ranks in 'comm' which send their data
+    vector<int> recvRowOwners, recvColOwners, recvRanks;
+
+    vector<int> sendCounts, sendOffs, recvCounts, recvOffs;
+};
+
+// NOTE: B must already have the same dimensions as A
+template<typename T>
+TranslatePlan MakeTranslatePlan
+( const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B );
+template<typename T>
+TranslatePlan MakeTranslatePlan
+( const AbstractBlockDistMatrix<T>& A, const AbstractBlockDistMatrix<T>& B );
+
+template<typename T>
+void TranslateBetweenGrids
+( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B );
+template<typename T>
+void TranslateBetweenGrids
+( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B,
+  const TranslatePlan& plan );
+template<typename T>
+void TranslateBetweenGrids
+( const AbstractBlockDistMatrix<T>& A, AbstractBlockDistMatrix<T>& B );
+template<typename T>
+void TranslateBetweenGrids
+( const AbstractBlockDistMatrix<T>& A, AbstractBlockDistMatrix<T>& B,
+  const TranslatePlan& plan );
+
 template<typename T>
 void CopyFromRoot
 ( const Matrix<T>& A, DistMatrix<T,CIRC,CIRC>& B, bool includingViewers=false );
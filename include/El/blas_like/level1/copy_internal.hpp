@@ -137,6 +137,41 @@ template<typename T>
 void PartialRowAllGather
 ( const AbstractBlockDistMatrix<T>& A, AbstractBlockDistMatrix<T>& B );
 
+// Non-blocking versions of PartialColAllGather and PartialRowAllGather. B is
+// resized and the communication started immediately, but B is only filled
+// by FinishAllGather, and it must not be resized or freed in the meantime.
+// Without non-blocking collectives the communication completes immediately.
+template<typename T>
+struct AllGatherRequest
+{
+    bool pending=false;
+    bool rowwise;
+    mpi::Request request;
+    vector<T> buffer;
+    Int portionSize;
+
+    // The arguments of the unpacking
+    Int height, width;
+    Int align, stride, strideUnion, stridePart, rankPart, shift;
+    T* BBuf;
+    Int BLDim;
+};
+
+template<typename T>
+void IPartialColAllGather
+( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B,
+  AllGatherRequest<T>& req );
+template<typename T>
+void IPartialRowAllGather
+( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B,
+  AllGatherRequest<T>& req );
+
+// Progress the communication, returning true if it has completed
+template<typename T>
+bool TestAllGather( AllGatherRequest<T>& req );
+template<typename T>
+void FinishAllGather( AllGatherRequest<T>& req );
+
 template<typename T,Dist U,Dist V>
 void ColAllToAllDemote
 ( const DistMatrix<T,Partial<U>(),PartialUnionRow<U,V>()>& A,
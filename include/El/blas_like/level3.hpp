@@ -21,11 +21,67 @@ enum GemmAlgorithm {
   GEMM_SUMMA_B,
   GEMM_SUMMA_C,
   GEMM_SUMMA_DOT,
-  GEMM_CANNON
+  GEMM_CANNON,
+  GEMM_SUMMA_25D
 };
 }
 using namespace GemmAlgorithmNS;
 
+// An alpha-beta-gamma model of the SUMMA variants over a particular shape of
+// process grid. Once a model is available for the shape of a grid, it replaces
+// the default heuristics for choosing the variant (and its blocksize) of a
+// GEMM_DEFAULT product over that grid.
+struct GemmCostModel
+{
+    double latency=0;          // seconds per message
+    double inverseBandwidth=0; // seconds per byte
+
+    // The candidate blocksizes and the corresponding local Gemm times per
+    // (real) flop
+    vector<Int> blocksizes;
+    vector<double> flopTimes;
+};
+
+// Measure (and register) the model for the shape of the grid g; this is
+// collective over g
+GemmCostModel CalibrateGemm( const Grid& g );
+
+void SetGemmCostModel
+( Int gridHeight, Int gridWidth, const GemmCostModel& model );
+bool HaveGemmCostModel( Int gridHeight, Int gridWidth );
+const GemmCostModel& GetGemmCostModel( Int gridHeight, Int gridWidth );
+void ClearGemmCostModels();
+
+// Read or write all of the registered models as plain text. If the
+// "--gemmCalibration" option of Initialize names a file, its models are
+// loaded (if it exists) and the registered models are written back to it
+// within Finalize, so that later runs start tuned. Loading and saving are
+// collective over mpi::COMM_WORLD (only its root touches the file), and so
+// any failure is thrown on every process. Loading returns whether the file
+// existed; a missing file is only an error if mustExist is true.
+bool LoadGemmCostModels( const string& filename, bool mustExist=true );
+void SaveGemmCostModels( const string& filename );
+
+namespace gemm {
+
+// Predict the fastest SUMMA variant and blocksize for forming an m x n
+// product with summation dimension k over the grid g, returning false if no
+// model is available for its shape
+bool PredictVariant
+( const Grid& g, Int m, Int n, Int k, Int entrySize, bool isComplex,
+  bool allowDot, GemmAlgorithm& alg, Int& blocksize );
+
+template<typename T>
+inline bool PredictVariant
+( const Grid& g, Int m, Int n, Int k, bool allowDot,
+  GemmAlgorithm& alg, Int& blocksize )
+{
+    return PredictVariant
+    ( g, m, n, k, sizeof(T), IsComplex<T>::val, allowDot, alg, blocksize );
+}
+
+} // namespace gemm
+
 template<typename T>
 void Gemm
 ( Orientation orientA, Orientation orientB,
@@ -398,6 +454,12 @@ void Trmm
 ( LeftOrRight side, UpperOrLower uplo,
   Orientation orientation, UnitOrNonUnit diag,
   T alpha, const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& X );
+// Executed as a DAG of tile kernels on a TaskGraph
+template<typename T>
+void Trmm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  T alpha, const TileMatrix<T>& A, TileMatrix<T>& B );
 
 template<typename T>
 void LocalTrmm
@@ -429,6 +491,12 @@ void Trsm
   Orientation orientation, UnitOrNonUnit diag,
   F alpha, const AbstractDistMatrix<F>& A, AbstractDistMatrix<F>& B,
   bool checkIfSingular=false, TrsmAlgorithm alg=TRSM_DEFAULT );
+// Executed as a DAG of tile kernels on a TaskGraph
+template<typename F>
+void Trsm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  F alpha, const TileMatrix<F>& A, TileMatrix<F>& B );
 
 template<typename F>
 void LocalTrsm
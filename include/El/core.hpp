@@ -126,6 +126,7 @@
 #include "El/core/environment/decl.hpp"
 
 #include "El/core/Timer.hpp"
+#include "El/core/Profile.hpp"
 #include "El/core/indexing/decl.hpp"
 #include "El/core/imports/blas.hpp"
 #include "El/core/imports/lapack.hpp"
@@ -166,6 +167,8 @@ template<typename T=double,Dist U=MC,Dist V=MR> class BlockDistMatrix;
 #include "El/core/random/decl.hpp"
 #include "El/core/random/impl.hpp"
 #include "El/core/AxpyInterface.hpp"
+#include "El/core/TaskGraph.hpp"
+#include "El/core/TileMatrix.hpp"
 
 #include "El/core/Graph.hpp"
 // TODO: Sequential map
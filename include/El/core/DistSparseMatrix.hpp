@@ -23,6 +23,16 @@ struct DistSparseMultMeta
                 recvSizes, recvOffs;
     vector<Int> sendInds, colOffs;
 
+    // The local entries are also split into a block whose columns correspond
+    // to locally-owned rows of X (which can be applied while the remote rows
+    // of X are in transit) and a block with the remaining entries. Each block
+    // is stored in CSR form over the local rows, with 'localEntries' and
+    // 'remoteEntries' indexing into the local entries of the matrix. 
+    // 'localCols' are relative to the first local row of X, and
+    // 'remoteColOffs' index into the received rows of X.
+    vector<Int> localRowOffs, localEntries, localCols;
+    vector<Int> remoteRowOffs, remoteEntries, remoteColOffs;
+
     DistSparseMultMeta() : ready(false), numRecvInds(0) { }
 
     void Clear()
@@ -35,6 +45,12 @@ struct DistSparseMultMeta
         SwapClear( recvOffs );
         SwapClear( sendInds );
         SwapClear( colOffs );
+        SwapClear( localRowOffs );
+        SwapClear( localEntries );
+        SwapClear( localCols );
+        SwapClear( remoteRowOffs );
+        SwapClear( remoteEntries );
+        SwapClear( remoteColOffs );
     }
 
     const DistSparseMultMeta& operator=( const DistSparseMultMeta& meta )
@@ -47,6 +63,12 @@ struct DistSparseMultMeta
         recvOffs = meta.recvOffs;
         sendInds = meta.sendInds;
         colOffs = meta.colOffs;
+        localRowOffs = meta.localRowOffs;
+        localEntries = meta.localEntries;
+        localCols = meta.localCols;
+        remoteRowOffs = meta.remoteRowOffs;
+        remoteEntries = meta.remoteEntries;
+        remoteColOffs = meta.remoteColOffs;
         return *this;
     }
 };
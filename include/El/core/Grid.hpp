@@ -11,6 +11,8 @@
 #ifndef EL_GRID_HPP
 #define EL_GRID_HPP
 
+#include <map>
+
 namespace El {
 
 class Grid
@@ -75,6 +77,12 @@ public:
       int distRank, int crossRank=0, int redundant=0 ) const;
     int VCToViewing( int VCRank ) const;
 
+    // The grid over the l'th of numLayers contiguous (in the VC ordering)
+    // subsets of our processes, viewed by all of our viewing processes. The
+    // layer grids are created (collectively) upon the first request for a
+    // given number of layers and are kept until this grid is destroyed.
+    const Grid& LayerGrid( int numLayers, int layer ) const;
+
     static int FindFactor( int p );
 
 private:
@@ -97,6 +105,9 @@ private:
               mdComm_, mdPerpComm_,
               vcComm_, vrComm_;
 
+    // The layer grids for each number of layers which has been requested
+    mutable std::map<int,vector<unique_ptr<Grid>>> layerGrids_;
+
     void SetUpGrid();
 
     // Disable copying this class due to MPI_Comm/MPI_Group ownership issues
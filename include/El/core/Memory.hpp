@@ -12,6 +12,44 @@
 
 namespace El {
 
+namespace MemoryModeNS {
+enum MemoryMode
+{
+  MEMORY_SYSTEM, // request each buffer directly from the system
+  MEMORY_POOLED  // recycle buffers through size-class pools
+};
+}
+using namespace MemoryModeNS;
+
+struct MemoryStats
+{
+    std::size_t numAllocs;      // number of buffers handed out
+    std::size_t numPoolHits;    // number of those which were recycled
+    std::size_t numSystemAllocs;
+    std::size_t currentBytes;   // bytes currently held by Memory objects
+    std::size_t highWaterBytes; // maximum of currentBytes since the reset
+    std::size_t pooledBytes;    // bytes cached in the pools
+};
+
+// The allocation mode and alignment may also be chosen at Initialize time via
+// the "--memoryPool" and "--memoryAlign" command-line options. Changing the
+// alignment releases all pooled buffers.
+void SetMemoryMode( MemoryMode mode );
+MemoryMode GetMemoryMode();
+void SetMemoryAlignment( std::size_t alignment );
+std::size_t MemoryAlignment();
+// The maximum number of bytes which may be cached across all pools
+void SetMemoryPoolLimit( std::size_t numBytes );
+std::size_t MemoryPoolLimit();
+
+// Return the shared pool and the calling thread's cache to the system (the
+// caches of other threads are returned when those threads exit)
+void ReleaseMemoryPools();
+
+MemoryStats GetMemoryStats();
+void ResetMemoryHighWater();
+void PrintMemoryStats( std::ostream& os=std::cout );
+
 template<typename G>
 class Memory
 {
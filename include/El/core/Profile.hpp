@@ -0,0 +1,92 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_PROFILE_HPP
+#define EL_PROFILE_HPP
+
+namespace El {
+
+// A hierarchical profiler of named regions
+// ========================================
+// Unlike the call stack, the profiler is available in release builds and is
+// toggled at runtime, either through EnableProfiling or the "--profile"
+// command-line option to Initialize. Each rank aggregates the inclusive and
+// exclusive time, number of calls, flops, and bytes communicated of every
+// distinct path of regions. When "--profileTrace" is also specified, each
+// region instance is additionally recorded as a Chrome trace event.
+//
+// If profiling was enabled, Finalize writes the reports using the basename
+// given by the "--profileFile" option (which defaults to "ElProfile"):
+//   <basename>.txt: a table of the min/avg/max over all ranks of each region,
+//   <basename>.json: the per-rank statistics of every region, and
+//   <basename>-<rank>.trace.json: the Chrome trace of each rank (if traced).
+//
+// Regions are only recorded from outside of OpenMP parallel regions (or from
+// the master thread) and must be properly nested.
+
+struct ProfileStats
+{
+    string path;      // the region names from the root, separated by '/'
+    Int depth;
+    Int numCalls;
+    double inclusive; // seconds
+    double exclusive; // seconds spent outside of any subregion
+    double flops;     // exclusive
+    double bytes;     // exclusive
+};
+
+void EnableProfiling( bool tracing=false );
+void DisableProfiling();
+bool Profiling();
+bool ProfileTracing();
+
+// The region names are expected to be string literals, as only the pointer
+// is stored
+void PushProfileRegion( const char* name );
+void PopProfileRegion();
+// The name of the innermost active region (or an empty string)
+const char* CurrentProfileRegion();
+
+// Attribute work to the innermost active region
+void AddProfileFlops( double flops );
+void AddProfileBytes( double bytes );
+
+// Clear all statistics and trace events (the active regions are kept)
+void ResetProfile();
+
+// The statistics of this rank in depth-first order
+vector<ProfileStats> GetProfileStats();
+
+// Print the min/avg/max over the ranks of 'comm' from its root process
+void PrintProfile( mpi::Comm comm=mpi::COMM_WORLD, ostream& os=cout );
+// Collectively write the reports described above
+void WriteProfile
+( const string& basename="ElProfile", mpi::Comm comm=mpi::COMM_WORLD );
+
+class ProfileRegion
+{
+public:
+    ProfileRegion( const char* name )
+    : active_(Profiling())
+    {
+        if( active_ )
+            PushProfileRegion( name );
+    }
+    ~ProfileRegion()
+    {
+        if( active_ )
+            PopProfileRegion();
+    }
+private:
+    bool active_;
+};
+
+} // namespace El
+
+#endif // ifndef EL_PROFILE_HPP
@@ -0,0 +1,75 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_CORE_TASKGRAPH_HPP
+#define EL_CORE_TASKGRAPH_HPP
+
+#include <map>
+
+namespace El {
+
+// A dependency-driven scheduler for a DAG of tasks, each of which accesses a
+// list of data items (identified by their addresses, e.g., those of tiles).
+// The dependencies are inferred from the order of insertion through the
+// read-after-write, write-after-read, and write-after-write hazards, so that
+// the result of Run is the same as executing the tasks in insertion order.
+//
+// With EL_HYBRID, the ready tasks are executed by a team of OpenMP threads
+// (highest priority first, then in order of insertion); otherwise they are
+// executed sequentially. The tasks themselves should not launch threads,
+// and so a sequential BLAS should be preferred.
+
+class TaskGraph
+{
+public:
+    TaskGraph();
+
+    // Queue a task which reads the items 'inputs' and modifies 'outputs'
+    void Insert
+    ( function<void()> kernel,
+      const vector<const void*>& inputs,
+      const vector<const void*>& outputs,
+      Int priority=0 );
+
+    // Execute all of the queued tasks using (at most) 'numThreads' threads,
+    // where zero requests the default OpenMP team size, and then empty the
+    // graph. If a task throws, the remaining tasks are abandoned and the
+    // first exception is rethrown.
+    void Run( Int numThreads=0 );
+
+    // Return to the empty state
+    void Empty();
+
+    Int NumTasks() const;
+    Int NumEdges() const;
+
+private:
+    struct Task
+    {
+        function<void()> kernel;
+        Int priority;
+        Int numDeps;
+        vector<Int> successors;
+    };
+    struct Access
+    {
+        Int lastWriter=-1;
+        vector<Int> readers;
+    };
+
+    vector<Task> tasks_;
+    std::map<const void*,Access> accesses_;
+    Int numEdges_;
+
+    void AddEdge( Int source, Int target );
+};
+
+} // namespace El
+
+#endif // ifndef EL_CORE_TASKGRAPH_HPP
@@ -0,0 +1,71 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_CORE_TILEMATRIX_HPP
+#define EL_CORE_TILEMATRIX_HPP
+
+namespace El {
+
+// A sequential matrix stored as a grid of square tiles (except along the
+// bottom and right edges), each of which is contiguous and column-major, so
+// that the tile kernels of the DAG-scheduled algorithms (see TaskGraph) work
+// on compact, independently-addressable blocks. The tiles are ordered
+// column-major within a single buffer.
+
+template<typename T>
+class TileMatrix
+{
+public:
+    // Constructors and destructors
+    // ============================
+    TileMatrix();
+    TileMatrix( Int height, Int width, Int tileSize=Blocksize() );
+    TileMatrix( const Matrix<T>& A, Int tileSize=Blocksize() );
+    ~TileMatrix();
+
+    // The tiles are views into the buffer, so copies are not supported
+    TileMatrix( const TileMatrix<T>& A ) = delete;
+    const TileMatrix<T>& operator=( const TileMatrix<T>& A ) = delete;
+
+    // Assignment and reconfiguration
+    // ==============================
+    void Empty();
+    void Resize( Int height, Int width );
+    void Resize( Int height, Int width, Int tileSize );
+
+    // Conversion from/to the standard column-major format
+    void Import( const Matrix<T>& A );
+    void Export( Matrix<T>& A ) const;
+
+    // Queries
+    // =======
+    Int Height() const;
+    Int Width() const;
+    Int TileSize() const;
+    Int TileRows() const;
+    Int TileCols() const;
+    // The dimensions of the tiles in a given tile row or column
+    Int TileHeight( Int i ) const;
+    Int TileWidth( Int j ) const;
+
+    Matrix<T>& Tile( Int i, Int j );
+    const Matrix<T>& Tile( Int i, Int j ) const;
+
+    T Get( Int i, Int j ) const;
+    void Set( Int i, Int j, T alpha );
+
+private:
+    Int height_, width_, tileSize_, tileRows_, tileCols_;
+    Memory<T> memory_;
+    vector<Matrix<T>> tiles_;
+};
+
+} // namespace El
+
+#endif // ifndef EL_CORE_TILEMATRIX_HPP
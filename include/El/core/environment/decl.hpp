@@ -84,6 +84,15 @@ void SetBlocksize( Int blocksize );
 void PushBlocksizeStack( Int blocksize );
 void PopBlocksizeStack();
 
+// Pushes a blocksize for the lifetime of the entry, so that the stack is
+// restored even if an exception is thrown
+class BlocksizeStackEntry
+{
+public:
+    BlocksizeStackEntry( Int blocksize ) { PushBlocksizeStack( blocksize ); }
+    ~BlocksizeStackEntry() { PopBlocksizeStack(); }
+};
+
 Int DefaultBlockHeight();
 Int DefaultBlockWidth();
 void SetDefaultBlockHeight( Int blockHeight );
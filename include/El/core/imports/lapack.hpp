@@ -370,6 +370,27 @@ void HessenbergSchur
 ( BlasInt n, dcomplex* H, BlasInt ldH, dcomplex* w, dcomplex* Q, BlasInt ldQ, 
   bool fullTriangle=false, bool multiplyQ=false );
 
+// Reorder a Schur factorization
+// =============================
+// Move the diagonal block of the (quasi-)triangular T which begins in row 
+// 'from' so that it begins in row 'to', and accumulate the unitary 
+// transformations into Q. False is returned if, in the real case, two 
+// adjacent blocks were too close to swap, in which case T is only partially
+// reordered (but remains in Schur form).
+
+bool SchurExchange
+( BlasInt n, float* T, BlasInt ldT, float* Q, BlasInt ldQ, 
+  BlasInt from, BlasInt to );
+bool SchurExchange
+( BlasInt n, double* T, BlasInt ldT, double* Q, BlasInt ldQ, 
+  BlasInt from, BlasInt to );
+bool SchurExchange
+( BlasInt n, scomplex* T, BlasInt ldT, scomplex* Q, BlasInt ldQ, 
+  BlasInt from, BlasInt to );
+bool SchurExchange
+( BlasInt n, dcomplex* T, BlasInt ldT, dcomplex* Q, BlasInt ldQ, 
+  BlasInt from, BlasInt to );
+
 // Compute the eigenvalues/pairs of an upper Hessenberg matrix
 // ===========================================================
 
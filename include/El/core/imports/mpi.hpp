@@ -18,6 +18,7 @@ namespace mpi {
 #if defined(EL_HAVE_MPI3_NONBLOCKING_COLLECTIVES) || \
     defined(EL_HAVE_MPIX_NONBLOCKING_COLLECTIVES)
 #define EL_HAVE_NONBLOCKING 1
+#define EL_HAVE_NONBLOCKING_COLLECTIVES
 #else
 #define EL_HAVE_NONBLOCKING 0
 #endif
@@ -60,9 +61,16 @@ inline bool operator==( const Op& a, const Op& b )
 inline bool operator!=( const Op& a, const Op& b )
 { return a.op != b.op; }
 
+struct File
+{
+    MPI_File file;
+    File( MPI_File mpiFile=MPI_FILE_NULL ) : file(mpiFile) { }
+};
+
 // Datatype definitions
 // TODO: Convert these to structs/classes
 typedef MPI_Aint Aint;
+typedef MPI_Offset Offset;
 typedef MPI_Datatype Datatype;
 typedef MPI_Errhandler ErrorHandler;
 typedef MPI_Request Request;
@@ -183,6 +191,35 @@ bool IProbe( int source, int tag, Comm comm, Status& status );
 template<typename T>
 int GetCount( Status& status );
 
+// Datatype construction
+void Commit( Datatype& type );
+void CreateVector
+( int count, int blocksize, int stride, Datatype oldType, Datatype& newType );
+void CreateIndexed
+( int count, const int* blocksizes, const int* displs, 
+  Datatype oldType, Datatype& newType );
+void CreateHIndexed
+( int count, const int* blocksizes, const Aint* displs, 
+  Datatype oldType, Datatype& newType );
+
+// Parallel I/O
+// ============
+// NOTE: Unlike most of the routines in this namespace, failures in Open are
+//       always reported (via a RuntimeError), as they are usually due to a 
+//       bad filename rather than a programming error
+void Open( Comm comm, const std::string& filename, bool write, File& file );
+void Close( File& file );
+Offset Size( File file );
+void SetSize( File file, Offset size );
+void SetView( File file, Offset disp, Datatype etype, Datatype fileType );
+// Independent access at an explicit (byte) offset from the start of the file
+void ReadAt( File file, Offset offset, void* buf, int count, Datatype type );
+void WriteAt
+( File file, Offset offset, const void* buf, int count, Datatype type );
+// Collective access through the current view
+void ReadAll( File file, void* buf, int count, Datatype type );
+void WriteAll( File file, const void* buf, int count, Datatype type );
+
 // Point-to-point communication
 // ============================
 
@@ -404,6 +441,17 @@ void AllGather
 ( const Complex<Real>* sbuf, int sc,
         Complex<Real>* rbuf, int rc, Comm comm );
 
+// Non-blocking AllGather
+// ----------------------
+template<typename Real>
+void IAllGather
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc, Comm comm, Request& request );
+template<typename Real>
+void IAllGather
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc, Comm comm, Request& request );
+
 // AllGather with variable recv sizes
 // ----------------------------------
 template<typename Real>
@@ -603,10 +651,134 @@ void SparseAllToAll
   const std::vector<int>& recvOffs,
         Comm comm );
 
+// Planned sparse all-to-alls
+// --------------------------
+// When the same irregular exchange is performed repeatedly (e.g., the
+// redistribution of child updates in each factorization and solve with a
+// fixed symbolic analysis), a plan can be formed once and then reused. The
+// plan stores the (nonzero) neighbors of this process so that each exchange
+// is a set of point-to-point messages and, when the communicator spans
+// several nodes, may route the messages through a two-level scheme:
+//   1. each process sends its data for another node to a gateway process
+//      on its own node (and its data for its own node directly),
+//   2. the gateways of each pair of nodes exchange a single aggregated
+//      message, and
+//   3. each receiving gateway forwards the data to its final destinations.
+// The aggregation is only used when it would at least halve the number of
+// messages which cross node boundaries. Note that the node-local phases are
+// ordinary point-to-point messages to and from the gateways (which MPI
+// implementations usually carry over shared memory) rather than copies
+// through a shared-memory window, so the savings are in the number of
+// inter-node messages rather than in on-node traffic.
+//
+// The nodes are the shared-memory domains of the communicator, unless
+// 'ranksPerNode' is positive, in which case each block of 'ranksPerNode'
+// consecutive ranks is treated as a node. The counts and offsets are in
+// arbitrary units, with each unit corresponding to 'width' contiguous entries
+// of the buffers passed to each exchange.
+
+struct SparseAllToAllPhase
+{
+    // The neighbors (possibly including ourselves) in increasing order and
+    // the number of units exchanged with each
+    std::vector<int> sendRanks, sendCounts, recvRanks, recvCounts;
+    // The contiguous pieces of the held data, in the order they are packed
+    std::vector<int> packOffs, packCounts;
+    int packSize=0, recvSize=0;
+};
+
+struct SparseAllToAllPlan
+{
+    bool ready=false;
+    Comm comm;
+    bool hierarchical=false;
+
+    // The direct exchange (with our own data handled by a local copy)
+    std::vector<int> sendRanks, sendCounts, sendOffs,
+                     recvRanks, recvCounts, recvOffs;
+    int selfCount=0, selfSendOff=0, selfRecvOff=0;
+
+    // The hierarchical exchange, where each piece of the final unpack is
+    // taken from either the send buffer (phase -1) or the receive buffer of
+    // one of the phases
+    std::vector<SparseAllToAllPhase> phases;
+    std::vector<int> unpackPhases, unpackOffs, unpackCounts, unpackDestOffs;
+};
+
+// The number of members of comm which share our node (one if this cannot be
+// determined)
+int NodeSize( Comm comm );
+
+SparseAllToAllPlan MakeSparseAllToAllPlan
+( const std::vector<int>& sendCounts,
+  const std::vector<int>& sendOffs,
+  const std::vector<int>& recvCounts,
+  const std::vector<int>& recvOffs,
+        Comm comm, int ranksPerNode=0 );
+
+template<typename T>
+void SparseAllToAll
+( const std::vector<T>& sendBuffer,
+        std::vector<T>& recvBuffer,
+  const SparseAllToAllPlan& plan, int width=1 );
+
+// Throws a LogicError unless the plan was formed from the given counts and
+// offsets (which is useful for checking that a cached plan is still valid)
+void VerifyPlan
+( const SparseAllToAllPlan& plan,
+  const std::vector<int>& sendCounts,
+  const std::vector<int>& sendOffs,
+  const std::vector<int>& recvCounts,
+  const std::vector<int>& recvOffs );
+
 void VerifySendsAndRecvs
 ( const std::vector<int>& sendCounts,
   const std::vector<int>& recvCounts, Comm comm );
 
+// Communication tracing
+// ---------------------
+// When enabled (either through EnableTracing or the "--mpiTrace" option to
+// Initialize), every communication routine of this namespace records its
+// number of calls, bytes sent and received, and the time spent within it,
+// keyed by the routine, the communicator, and the call site (the innermost
+// active profile region, if any). The bytes sent to each process are also 
+// accumulated into a communication matrix. Collectives are charged the
+// volumes of their logical data movement, e.g., an AllGather of n bytes per
+// process sends n bytes to each of the other members, while an AllReduce of
+// n bytes sends 2n/p bytes to each of them. Nested calls (such as the 
+// point-to-point messages of SparseAllToAll) are only counted once. The time
+// spent in Wait and WaitAll is charged to the communicators that the 
+// nonblocking requests were posted on.
+//
+// If tracing is enabled at Finalize, the reports are written using the
+// basename given by the "--mpiTraceFile" option (defaulting to "ElTrace"):
+//   <basename>.txt: the summary over all ranks and then that of each rank,
+//   <basename>-matrix.txt: the number of bytes sent from each process of the
+//     communicator (row) to each process of COMM_WORLD (column).
+
+struct TraceStats
+{
+    std::string routine, comm, site;
+    Int numCalls;
+    double sendBytes, recvBytes, time;
+};
+
+void EnableTracing();
+void DisableTracing();
+bool Tracing();
+void ResetTracing();
+
+// The statistics of this process
+std::vector<TraceStats> GetTraceStats();
+// The number of bytes sent by this process to each member of COMM_WORLD
+std::vector<double> GetTraceVolumes();
+
+// Print the summary over the ranks of 'comm' from its root
+void PrintTrace( Comm comm=COMM_WORLD, std::ostream& os=std::cout );
+// Collectively write the reports described above
+void WriteTrace
+( const std::string& basename="ElTrace", Comm comm=COMM_WORLD );
+
 void CreateCustom();
 void DestroyCustom();
 
@@ -496,6 +496,7 @@ enum FileFormat
     ASCII_MATLAB,
     BINARY,
     BINARY_FLAT,
+    BINARY_CSR,
     BMP,
     JPG,
     JPEG,
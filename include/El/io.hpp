@@ -164,6 +164,11 @@ template<typename T>
 void Read
 ( AbstractBlockDistMatrix<T>& A, 
   const string filename, FileFormat format=AUTO, bool sequential=false );
+// Each process reads its share of a MATRIX_MARKET or BINARY_CSR file
+template<typename T>
+void Read
+( DistSparseMatrix<T>& A, const string filename, FileFormat format=AUTO );
+void Read( DistGraph& graph, const string filename, FileFormat format=AUTO );
 
 // Spy
 // ===
@@ -191,6 +196,10 @@ template<typename T>
 void Write
 ( const AbstractBlockDistMatrix<T>& A, string basename="BlockDistMatrix",
   FileFormat format=BINARY, string title="" );
+template<typename T>
+void Write
+( const DistSparseMatrix<T>& A, string basename="DistSparseMatrix",
+  FileFormat format=BINARY_CSR );
 
 } // namespace El
 
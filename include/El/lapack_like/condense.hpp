@@ -84,6 +84,15 @@ struct HermitianTridiagCtrl
     HermitianTridiagApproach approach=HERMITIAN_TRIDIAG_SQUARE;
     GridOrder order=ROW_MAJOR;
     SymvCtrl<F> symvCtrl;
+
+    // Reduce to a band matrix with 'bandwidth' subdiagonals (where zero
+    // selects the algorithmic blocksize) using BLAS-3 updates, and then to
+    // tridiagonal form through bulge chasing. The resulting Q is not in the
+    // packed form of HermitianTridiag, and so this is only supported by
+    // herm_tridiag::ExplicitCondensed, herm_tridiag::TwoStage, and
+    // HermitianEig.
+    bool twoStage=false;
+    Int bandwidth=0;
 };
 
 template<typename F>
@@ -112,6 +121,39 @@ void ApplyQ
   const AbstractDistMatrix<F>& A, const AbstractDistMatrix<F>& t, 
         AbstractDistMatrix<F>& B );
 
+// The reflectors from the bulge-chasing stage of a two-stage reduction, which
+// are redundantly stored on every process. Reflector s of sweep j acts on
+// rows [j+1+s b,j+1+(s+1) b) (intersected with [0,height)), and its vector
+// (with an explicit unit first entry) and scalar are stored in
+// vectors[vectorOffsets[r]:vectorOffsets[r+1]) and taus[r], where
+// r = sweepOffsets[j]+s.
+template<typename F>
+struct BulgeReflectors
+{
+    Int height=0, bandwidth=0;
+    vector<Int> sweepOffsets, vectorOffsets;
+    vector<F> taus;
+    vector<F> vectors;
+};
+
+// Two-stage reduction to tridiagonal form, T = Q^H A Q, where Q = Q1 Q2.
+// The diagonal and (both) off-diagonals of A are overwritten with T, the
+// reflectors of Q1 are stored below the 'bandwidth' subdiagonal of A (in
+// either case of uplo), with their scalars in t, and Q2 is returned in
+// 'bulge'.
+template<typename F>
+void TwoStage
+( UpperOrLower uplo, AbstractDistMatrix<F>& A, AbstractDistMatrix<F>& t,
+  BulgeReflectors<F>& bulge,
+  const HermitianTridiagCtrl<F>& ctrl=HermitianTridiagCtrl<F>() );
+
+// B := Q B or B := Q^H B for the Q of a two-stage reduction
+template<typename F>
+void ApplyQ
+( Orientation orientation,
+  const AbstractDistMatrix<F>& A, const AbstractDistMatrix<F>& t,
+  const BulgeReflectors<F>& bulge, AbstractDistMatrix<F>& B );
+
 } // namespace herm_tridiag
 
 // Hessenberg
@@ -17,12 +17,29 @@ namespace El {
 
 // Cholesky
 // ========
+struct CholeskyCtrl
+{
+    // Factor (and begin redistributing) each panel as soon as it has been
+    // updated by its predecessor so that its communication can overlap with
+    // the rest of the trailing update
+    bool lookahead=false;
+    // The number of blocks of columns the rest of the trailing update is split
+    // into, with the outstanding communication progressed after each
+    Int numUpdateBlocks=4;
+};
+
 template<typename F>
 void Cholesky( UpperOrLower uplo, Matrix<F>& A );
 template<typename F>
 void Cholesky( UpperOrLower uplo, AbstractDistMatrix<F>& A );
 template<typename F>
+void Cholesky
+( UpperOrLower uplo, AbstractDistMatrix<F>& A, const CholeskyCtrl& ctrl );
+template<typename F>
 void Cholesky( UpperOrLower uplo, DistMatrix<F,STAR,STAR>& A );
+// Executed as a DAG of tile kernels on a TaskGraph
+template<typename F>
+void Cholesky( UpperOrLower uplo, TileMatrix<F>& A );
 
 template<typename F>
 void ReverseCholesky( UpperOrLower uplo, Matrix<F>& A );
@@ -364,10 +381,28 @@ void LU( DistMatrix<F,STAR,STAR>& A );
 
 // LU with partial pivoting
 // ------------------------
+struct LUCtrl
+{
+    // Factor (and begin redistributing) each panel as soon as it has been
+    // updated by its predecessor so that its communication can overlap with
+    // the rest of the trailing update
+    bool lookahead=false;
+    // The number of blocks of columns the rest of the trailing update is split
+    // into, with the outstanding communication progressed after each
+    Int numUpdateBlocks=4;
+};
+
 template<typename F>
 void LU( Matrix<F>& A, Matrix<Int>& p );
 template<typename F>
 void LU( AbstractDistMatrix<F>& A, AbstractDistMatrix<Int>& p );
+template<typename F>
+void LU
+( AbstractDistMatrix<F>& A, AbstractDistMatrix<Int>& p, const LUCtrl& ctrl );
+// With tournament pivoting (which selects the same kind of permutation),
+// executed as a DAG of tile kernels on a TaskGraph
+template<typename F>
+void LU( TileMatrix<F>& A, Matrix<Int>& p );
 
 // LU with full pivoting
 // ---------------------
@@ -519,6 +554,10 @@ template<typename F>
 void QR
 ( AbstractDistMatrix<F>& A, AbstractDistMatrix<F>& t, 
   AbstractDistMatrix<Base<F>>& d );
+// Tile QR executed as a DAG of tile kernels on a TaskGraph, where T is
+// overwritten with the triangular factors of the blocks of reflectors
+template<typename F>
+void QR( TileMatrix<F>& A, TileMatrix<F>& T );
 
 // Return an implicit representation of (Q,R,P) such that A P ~= Q R
 // -----------------------------------------------------------------
@@ -547,6 +586,11 @@ void ApplyQ
 ( LeftOrRight side, Orientation orientation,
   const AbstractDistMatrix<F>& A, const AbstractDistMatrix<F>& t,
   const AbstractDistMatrix<Base<F>>& d, AbstractDistMatrix<F>& B );
+// From the left using a tile QR factorization
+template<typename F>
+void ApplyQ
+( Orientation orientation,
+  const TileMatrix<F>& A, const TileMatrix<F>& T, TileMatrix<F>& B );
 
 // Solve a linear system with the implicit QR factorization
 // --------------------------------------------------------
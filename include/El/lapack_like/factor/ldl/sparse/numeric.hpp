@@ -198,6 +198,12 @@ struct Front
 
     Matrix<F> work;
 
+    // The positions within L of the entries pulled from the sparse matrix and
+    // their sources (the entry indices of a sequential matrix or the indices
+    // into the entries received by a distributed pull), so that the fronts
+    // can be refilled in place when only the values of the matrix change
+    vector<Int> pullSources, pullRows, pullCols;
+
     Front<F>* parent;
     vector<Front<F>*> children;
     DistFront<F>* duplicate;
@@ -215,6 +221,11 @@ struct Front
     ( SparseMatrix<F>& A, const vector<Int>& reordering, 
       const NodeInfo& rootInfo ) const;
 
+    // Overwrite the fronts with the entries of a matrix with the same
+    // sparsity pattern as the one most recently pulled, reusing the storage
+    // of the fronts and the map formed during the pull
+    void Refill( const SparseMatrix<F>& A );
+
     void Unpack( SparseMatrix<F>& A, const NodeInfo& rootInfo ) const;
 
     Int NumEntries() const;
@@ -242,6 +253,24 @@ struct FactorCommMeta
 };
 void ComputeFactRecvInds( const DistNodeInfo& info );
 
+// The entries of a distributed sparse matrix that were sent to each process
+// when pulling a tree of distributed fronts
+struct FrontPullMeta
+{
+    vector<Int> sendEntries;
+    vector<int> sendSizes, sendOffs,
+                recvSizes, recvOffs;
+
+    void Empty()
+    {
+        SwapClear( sendEntries );
+        SwapClear( sendSizes );
+        SwapClear( sendOffs );
+        SwapClear( recvSizes );
+        SwapClear( recvOffs );
+    }
+};
+
 template<typename F>
 struct DistFront
 {
@@ -264,6 +293,12 @@ struct DistFront
     DistMatrix<F> work;
     mutable FactorCommMeta commMeta;
 
+    // The local positions within L2D of the pulled entries and their indices
+    // within the received entries (see Front), as well as, for the root, the
+    // metadata of the exchange
+    vector<Int> pullSources, pullLocRows, pullLocCols;
+    FrontPullMeta pullMeta;
+
     DistFront<F>* parent;
     DistFront<F>* child;
     Front<F>* duplicate;
@@ -283,6 +318,10 @@ struct DistFront
       const DistSeparator& rootSep,
       const DistNodeInfo& info,
       bool conjugate=false );
+    // Overwrite the fronts with the entries of a matrix with the same
+    // sparsity pattern (and distribution) as the one most recently pulled
+    // into this (root) front, with a single exchange of the new values
+    void Refill( const DistSparseMatrix<F>& A );
     // NOTE: This routine is not yet functioning
     void Push
     ( DistSparseMatrix<F>& A, const DistMap& reordering, 
@@ -35,6 +35,27 @@ void Analysis
 ( const DistNode& rootNode, DistNodeInfo& rootInfo,
   bool storeFactRecvInds=true );
 
+// Statistics of the fronts produced by the symbolic analysis
+struct AnalysisStats
+{
+    Int numFronts;
+    Int maxFrontSize;      // the number of pivots plus the lower structure
+    double numEntries;     // in the lower triangle of the factor (its fill)
+    double numFactorFlops; // of a real LDL factorization
+    // The number of fronts whose size lies in [2^k,2^(k+1)), with empty
+    // fronts counted in the first bin
+    vector<Int> sizeHistogram;
+};
+AnalysisStats GetAnalysisStats( const NodeInfo& rootInfo );
+// NOTE: This is collective over rootInfo.comm
+AnalysisStats GetAnalysisStats( const DistNodeInfo& rootInfo );
+void PrintAnalysisStats( const AnalysisStats& stats, ostream& os=cout );
+
+// Merge the small supernodes of a sequential subtree of the elimination tree
+// (see BisectCtrl) and renumber the subtree and its separators accordingly
+void Amalgamate
+( Node& rootNode, Separator& rootSep, const BisectCtrl& ctrl=BisectCtrl() );
+
 void GetChildGridDims
 ( const DistNodeInfo& info, vector<int>& gridHeights, vector<int>& gridWidths );
 
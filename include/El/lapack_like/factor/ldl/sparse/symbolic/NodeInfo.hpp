@@ -83,6 +83,12 @@ struct DistNodeInfo
     // submatrices of the child updates.
     vector<vector<Int>> childRelInds;
 
+    // Plans for the exchanges of the child updates, formed upon first use so
+    // that they are reused by each subsequent factorization and solve with
+    // this analysis. The factorization plan is in units of entries, while
+    // the forward and backward solve plans are in units of rows.
+    mutable mpi::SparseAllToAllPlan factorPlan, forwardPlan, backwardPlan;
+
     DistNodeInfo( DistNodeInfo* parentNode=nullptr )
     : comm(mpi::COMM_WORLD), 
       parent(parentNode), child(nullptr), duplicate(nullptr)
@@ -22,11 +22,20 @@ typedef enum {
   EL_SIGN_SCALE_FROB
 } ElSignScaling;
 
+typedef enum {
+  EL_SIGN_NEWTON,
+  EL_SIGN_NEWTON_SCHULZ,
+  EL_SIGN_ZOLOTAREV
+} ElSignMethod;
+
 typedef struct {
   ElInt maxIts;
   float tol;
   float power;
   ElSignScaling scaling;
+  ElSignMethod method;
+  float newtonSchulzTol;
+  ElInt zolotarevDegree;
   bool progress;
 } ElSignCtrl_s;
 EL_EXPORT ElError ElSignCtrlDefault_s( ElSignCtrl_s* ctrl );
@@ -36,6 +45,9 @@ typedef struct {
   double tol;
   double power;
   ElSignScaling scaling;
+  ElSignMethod method;
+  double newtonSchulzTol;
+  ElInt zolotarevDegree;
   bool progress;
 } ElSignCtrl_d;
 EL_EXPORT ElError ElSignCtrlDefault_d( ElSignCtrl_d* ctrl );
@@ -24,6 +24,20 @@ enum SignScaling {
 }
 using namespace SignScalingNS;
 
+namespace SignMethodNS {
+enum SignMethod {
+    // Scaled Newton iteration, X := (mu X + inv(X)/mu)/2
+    SIGN_NEWTON,
+    // Scaled Newton until || I - X^2 ||_1 is small, then the inversion-free
+    // Newton-Schulz iteration, X := X (3I - X^2)/2
+    SIGN_NEWTON_SCHULZ,
+    // Rational iteration based upon Zolotarev's best approximations to sgn(x),
+    // which converges in a few steps that each require several shifted solves
+    SIGN_ZOLOTAREV
+};
+}
+using namespace SignMethodNS;
+
 template<typename Real>
 struct SignCtrl 
 {
@@ -31,6 +45,16 @@ struct SignCtrl
     Real tol=0;
     Real power=1;
     SignScaling scaling=SIGN_SCALE_FROB;
+    SignMethod method=SIGN_NEWTON;
+
+    // The Newton-Schulz phase of SIGN_NEWTON_SCHULZ begins once 
+    // || I - X^2 ||_1 is at most this value (which should be less than one)
+    Real newtonSchulzTol=Real(1)/Real(2);
+
+    // The number of shifted solves per SIGN_ZOLOTAREV iteration (zero selects 
+    // the smallest number which should converge within two iterations)
+    Int zolotarevDegree=0;
+
     bool progress=false;
 };
 
@@ -152,6 +176,45 @@ void Sign
 ( AbstractDistMatrix<F>& A, AbstractDistMatrix<F>& N, 
   const SignCtrl<Base<F>> ctrl=SignCtrl<Base<F>>() );
 
+namespace sign {
+
+// Returns the normalization, M, and fills the shifts, c, and weights, a, of 
+// the partial fraction expansion
+//
+//   f(x) = M x (1 + sum_{j=0}^{r-1} a(j) / (x^2 + c(j))),
+//
+// of the type (2r+1,2r) Zolotarev approximation to sgn(x) over 
+// [-1,-l] U [l,1], where M is chosen so that f(1)=1
+template<typename Real>
+Real ZolotarevCoefficients
+( Int r, Real l, vector<Real>& c, vector<Real>& a );
+
+template<typename Real>
+Real ZolotarevEvaluate
+( Real x, Real M, const vector<Real>& c, const vector<Real>& a );
+
+// The smallest degree (up to eight) for which two Zolotarev iterations should
+// map [l,1] to within the tolerance of one
+template<typename Real>
+Int ZolotarevDegree( Real l, Real tol );
+
+// Estimates the one-norm of the implicit n x n operator whose application to
+// (and whose adjoint's application to) a column vector is performed in-place
+// by 'apply' (and 'applyAdj') using Higham's refinement of Hager's method.
+// The estimate is a lower bound which is usually within a factor of three.
+template<typename F>
+Base<F> OneNormEstimate
+( Int n, 
+  function<void(Matrix<F>&)> apply, 
+  function<void(Matrix<F>&)> applyAdj );
+template<typename F>
+Base<F> OneNormEstimate
+( const Grid& g, Int n, 
+  function<void(DistMatrix<F>&)> apply, 
+  function<void(DistMatrix<F>&)> applyAdj );
+
+} // namespace sign
+
 template<typename F>
 void HermitianSign
 ( UpperOrLower uplo, Matrix<F>& A, 
@@ -15,6 +15,51 @@
 
 namespace El {
 
+// Mixed-precision iterative refinement
+// ====================================
+// The dense matrix is factored in single precision and the solution is
+// refined using residuals computed in the working (double) precision, either
+// through classical iterative refinement or with GMRES preconditioned by the
+// single-precision factorization. If the refinement stalls, the system is
+// instead solved with a working-precision factorization. These overloads
+// return the number of refinement iterations, or -1 if they fell back to
+// the working-precision solve.
+
+namespace MixedRefineAlgNS {
+enum MixedRefineAlg {
+  MIXED_REFINE_IR,
+  MIXED_REFINE_GMRES
+};
+}
+using namespace MixedRefineAlgNS;
+
+template<typename Real>
+struct MixedPrecisionCtrl
+{
+    MixedRefineAlg alg=MIXED_REFINE_IR;
+
+    // Each column has converged when 
+    //   || b - A x ||_2 <= sqrt(n) relTol || A ||_F || x ||_2
+    Real relTol;
+    Int maxRefineIts=30;
+
+    // The refinement is abandoned if the (largest) normwise backward error
+    // is not reduced by at least this factor in an iteration
+    Real stallRatio=Real(1)/Real(2);
+
+    Real relTolGMRES;
+    Int maxGMRESIts=20;
+
+    bool progress=false;
+
+    MixedPrecisionCtrl()
+    {
+        const Real eps = Epsilon<Real>();
+        relTol = eps;
+        relTolGMRES = Pow(eps,Real(0.25));
+    }
+};
+
 // Linear
 // ======
 template<typename F>
@@ -22,6 +67,15 @@ void LinearSolve( const Matrix<F>& A, Matrix<F>& B );
 template<typename F>
 void LinearSolve( const AbstractDistMatrix<F>& A, AbstractDistMatrix<F>& B );
 
+template<typename F>
+Int LinearSolve
+( const Matrix<F>& A, Matrix<F>& B,
+  const MixedPrecisionCtrl<Base<F>>& ctrl );
+template<typename F>
+Int LinearSolve
+( const AbstractDistMatrix<F>& A, AbstractDistMatrix<F>& B,
+  const MixedPrecisionCtrl<Base<F>>& ctrl );
+
 template<typename F>
 void LinearSolve
 ( const SparseMatrix<F>& A, Matrix<F>& B, 
@@ -133,6 +187,17 @@ void HPDSolve
 ( UpperOrLower uplo, Orientation orientation,
   const AbstractDistMatrix<F>& A, AbstractDistMatrix<F>& B );
 
+template<typename F>
+Int HPDSolve
+( UpperOrLower uplo, Orientation orientation, 
+  const Matrix<F>& A, Matrix<F>& B,
+  const MixedPrecisionCtrl<Base<F>>& ctrl );
+template<typename F>
+Int HPDSolve
+( UpperOrLower uplo, Orientation orientation,
+  const AbstractDistMatrix<F>& A, AbstractDistMatrix<F>& B,
+  const MixedPrecisionCtrl<Base<F>>& ctrl );
+
 template<typename F>
 void HPDSolve
 ( const SparseMatrix<F>& A, Matrix<F>& B, 
@@ -719,6 +719,11 @@ EL_EXPORT ElError ElHermitianPolarDecompDist_z
 typedef struct {
   bool distAED;
   ElInt blockHeight, blockWidth;
+  bool scalapack;
+  ElInt numShifts;
+  ElInt deflationSize;
+  ElInt minMultiBulgeSize;
+  ElInt chaseAdvance;
 } ElHessQRCtrl;
 EL_EXPORT ElError ElHessQRCtrlDefault( ElHessQRCtrl* ctrl );
 
@@ -804,6 +809,7 @@ EL_EXPORT ElError ElSchurDecompDist_z
 /* SVDCtrl */
 typedef struct {
   bool seqQR;
+  bool distMRRR;
   double valChanRatio;
   double fullChanRatio;
   bool thresholded;
@@ -814,6 +820,7 @@ EL_EXPORT ElError ElSVDCtrlDefault_s( ElSVDCtrl_s* ctrl );
 
 typedef struct {
   bool seqQR;
+  bool distMRRR;
   double valChanRatio;
   double fullChanRatio;
   bool thresholded;
@@ -949,6 +956,7 @@ typedef struct {
   const char *imgBase, *numBase;
   ElFileFormat imgFormat, numFormat;
   bool itCounts;
+  bool shiftTimes;
 } ElSnapshotCtrl;
 EL_EXPORT ElError ElSnapshotCtrlDefault( ElSnapshotCtrl* ctrl );
 /* NOTE: Since conversion from SnapshotCtrl involves deep copies of char* */
@@ -970,6 +978,7 @@ typedef struct {
   bool arnoldi;
   ElInt basisSize;
   bool reorthog;
+  ElInt shiftBatchSize;
 
   bool progress;
 
@@ -995,6 +1004,7 @@ typedef struct {
   bool arnoldi;
   ElInt basisSize;
   bool reorthog;
+  ElInt shiftBatchSize;
 
   bool progress;
 
@@ -238,6 +238,22 @@ struct HessQRCtrl
 {
     bool distAED=false;
     Int blockHeight=DefaultBlockHeight(), blockWidth=DefaultBlockWidth();
+
+    // Whether or not to run ScaLAPACK's Hessenberg QR algorithm (over a block
+    // distribution with the above blocksizes) rather than the native one
+    bool scalapack=false;
+
+    // The native implementation chases chains of small bulges through 
+    // diagonal windows which are redundantly updated on every process, and
+    // advances each chain by roughly chaseAdvance rows per window (by about
+    // the length of the chain, as in xLAQR5, when left as zero). The number
+    // of shifts per sweep and the size of the deflation window are chosen
+    // based upon the matrix height when left as zero, and active blocks with
+    // at most minMultiBulgeSize rows are solved redundantly.
+    Int numShifts=0;
+    Int deflationSize=0;
+    Int minMultiBulgeSize=75;
+    Int chaseAdvance=0;
 };
 
 template<typename Real>
@@ -371,6 +387,15 @@ struct SVDCtrl
     // algorithm is always run.
     bool seqQR=false;
 
+    // Whether or not distributed implementations should compute the SVD of
+    // the bidiagonal matrix using PMRRR on its Golub-Kahan tridiagonal, which
+    // leaves the singular vectors distributed over the grid, rather than
+    // redundantly running the QR algorithm on every process. The singular
+    // vectors from the Golub-Kahan eigenvectors can lose orthogonality, in
+    // which case the QR algorithm is run anyway (and the distributed SVD
+    // returns false).
+    bool distMRRR=true;
+
     // Chan's algorithm
     // ----------------
 
@@ -422,8 +447,10 @@ template<typename F>
 void SVD
 ( Matrix<F>& A, Matrix<Base<F>>& s, Matrix<F>& V, 
   const SVDCtrl<Base<F>>& ctrl=SVDCtrl<Base<F>>() );
+// Returns true if the bidiagonal SVD was computed with PMRRR (that is, if
+// ctrl.distMRRR was set and the QR algorithm fallback was not needed)
 template<typename F>
-void SVD
+bool SVD
 ( AbstractDistMatrix<F>& A, AbstractDistMatrix<Base<F>>& s, 
   AbstractDistMatrix<F>& V, const SVDCtrl<Base<F>>& ctrl=SVDCtrl<Base<F>>() );
 
@@ -498,6 +525,11 @@ struct SnapshotCtrl
     string imgBase="ps", numBase="ps";
     FileFormat imgFormat=PNG, numFormat=ASCII_MATLAB;
     bool itCounts=true;
+    // Save the time spent on each shift? Since all of the active shifts are
+    // advanced together, the wall-clock time of each sweep is split evenly
+    // among the shifts which were active during it, so these are estimates
+    // rather than measurements of the work for each individual shift.
+    bool shiftTimes=false;
 
     void ResetCounts()
     {
@@ -536,6 +568,14 @@ struct PseudospecCtrl
     Int basisSize=10;
     bool reorthog=true; // only matters for IRL, which isn't currently used
 
+    // The triangular multi-shift solves process the active shifts in batches.
+    // Sequentially, a positive value is the number of shifts per batch, and
+    // zero selects the largest batch which fits in the local cache (along
+    // with the triangular matrix). In the distributed case, a positive value
+    // is the number of local columns per process in each batch, and zero
+    // processes all of the active shifts at once.
+    Int shiftBatchSize=0;
+
     // Whether or not to print progress information at each iteration
     bool progress=false;
 
@@ -545,6 +585,21 @@ struct PseudospecCtrl
     mutable Real realWidth=0, imagWidth=0;
 };
 
+namespace pspec {
+
+// The number of shifts in each batch of the triangular multi-shift solves
+// (see PseudospecCtrl::shiftBatchSize). Sequentially, the triangular matrix
+// is n x n with entryBytes bytes per entry, each right-hand side has rowBytes
+// bytes per row, and cacheBytes is the size of the local cache. In the
+// distributed case, the right-hand sides are spread over gridWidth process
+// columns.
+Int SequentialBatchSize
+( Int batchSize, Int numShifts, Int n, Int entryBytes, Int rowBytes,
+  Int cacheBytes );
+Int DistBatchSize( Int batchSize, Int numShifts, Int gridWidth );
+
+} // namespace pspec
+
 template<typename Real>
 struct SpectralBox
 {
@@ -22,9 +22,25 @@ struct BisectCtrl
     Int cutoff;
     bool storeFactRecvInds;
 
+    // Use the built-in multilevel bisection even when (Par)METIS is available
+    // (it is always used otherwise)
+    bool native;
+    // Order the vertices of each leaf of the dissection with approximate
+    // minimum degree rather than treating the leaf as a single dense front
+    bool orderLeaves;
+
+    // Relaxed supernode amalgamation of the sequential subtrees: a child is
+    // merged into its parent whenever the merged front has at most 'relaxSize'
+    // pivots or at most a 'relaxFill' fraction of its entries are explicit
+    // zeros (including those introduced by previous merges)
+    bool amalgamate;
+    Int relaxSize;
+    double relaxFill;
+
     BisectCtrl()
     : sequential(true), numDistSeps(1), numSeqSeps(1), cutoff(128),
-      storeFactRecvInds(false)
+      storeFactRecvInds(false), native(false), orderLeaves(true),
+      amalgamate(true), relaxSize(16), relaxFill(0.1)
     { }
 };
 
@@ -58,6 +74,27 @@ Int NaturalBisect
   Int& nxChild, Int& nyChild, Int& nzChild,
   DistGraph& child, DistMap& perm, bool& onLeft );
 
+// A dependency-free multilevel (coarsen, partition, and refine) computation of
+// a vertex separator, which Bisect falls back to without (Par)METIS
+Int MultilevelBisect
+( const Graph& graph,
+        Graph& leftChild,
+        Graph& rightChild,
+        vector<Int>& perm,
+  const BisectCtrl& ctrl=BisectCtrl() );
+
+// NOTE: for two or more processes
+Int MultilevelBisect
+( const DistGraph& graph,
+        DistGraph& child,
+        DistMap& perm,
+        bool& onLeft,
+  const BisectCtrl& ctrl=BisectCtrl() );
+
+// Set perm[s] to the position of source s in an approximate minimum degree
+// ordering of the graph (ignoring the targets beyond the sources)
+void ApproximateMinimumDegree( const Graph& graph, vector<Int>& perm );
+
 void EnsurePermutation( const vector<Int>& map );
 void EnsurePermutation( const DistMap& map );
 
@@ -77,6 +114,15 @@ ValueInt<Real> Median( const Matrix<Real>& x );
 template<typename Real>
 ValueInt<Real> Median( const AbstractDistMatrix<Real>& x );
 
+// Select
+// ======
+// Return the k'th smallest entry (counting from zero) of a vector, with ties
+// broken by index
+template<typename Real>
+ValueInt<Real> Select( const Matrix<Real>& x, Int k );
+template<typename Real>
+ValueInt<Real> Select( const AbstractDistMatrix<Real>& x, Int k );
+
 // Sort
 // ====
 template<typename Real>
@@ -90,6 +136,13 @@ vector<ValueInt<Real>> TaggedSort
 template<typename Real>
 vector<ValueInt<Real>> TaggedSort
 ( const AbstractDistMatrix<Real>& x, SortType sort=ASCENDING );
+// Leave the sorted values, y, and their original indices, p, distributed, so
+// that y(i) = x(p(i))
+template<typename Real>
+void TaggedSort
+( const AbstractDistMatrix<Real>& x,
+        AbstractDistMatrix<Real>& y,
+        AbstractDistMatrix<Int>& p, SortType sort=ASCENDING );
 
 } // namespace El
 
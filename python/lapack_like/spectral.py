@@ -688,12 +688,19 @@ def HermitianPolar(uplo,A,fullDecomp=False):
 # Emulate an enum for the sign scaling
 (SIGN_SCALE_NONE,SIGN_SCALE_DET,SIGN_SCALE_FROB)=(0,1,2)
 
+# Emulate an enum for the sign iteration
+(SIGN_NEWTON,SIGN_NEWTON_SCHULZ,SIGN_ZOLOTAREV)=(0,1,2)
+
 lib.ElSignCtrlDefault_s.argtypes = [c_void_p]
 class SignCtrl_s(ctypes.Structure):
   _fields_ = [("maxIts",iType),
               ("tol",sType),
               ("power",sType),
-              ("scaling",c_uint)]
+              ("scaling",c_uint),
+              ("method",c_uint),
+              ("newtonSchulzTol",sType),
+              ("zolotarevDegree",iType),
+              ("progress",bType)]
   def __init__(self):
     lib.ElSignCtrlDefault_s(pointer(self))
 
@@ -702,14 +709,23 @@ class SignCtrl_d(ctypes.Structure):
   _fields_ = [("maxIts",iType),
               ("tol",dType),
               ("power",dType),
-              ("scaling",c_uint)]
+              ("scaling",c_uint),
+              ("method",c_uint),
+              ("newtonSchulzTol",dType),
+              ("zolotarevDegree",iType),
+              ("progress",bType)]
   def __init__(self):
     lib.ElSignCtrlDefault_d(pointer(self))
 
 lib.ElHessQRCtrlDefault.argtypes = [c_void_p]
 class HessQRCtrl(ctypes.Structure):
   _fields_ = [("distAED",bType),
-              ("blockHeight",iType),("blockWidth",iType)]
+              ("blockHeight",iType),("blockWidth",iType),
+              ("scalapack",bType),
+              ("numShifts",iType),
+              ("deflationSize",iType),
+              ("minMultiBulgeSize",iType),
+              ("chaseAdvance",iType)]
   def __init__(self):
     lib.ElHessQRCtrlDefault(pointer(self))
 
@@ -989,7 +1005,7 @@ class SnapshotCtrl(ctypes.Structure):
               ("imgDispCount",iType),
               ("imgBase",c_char_p),("numBase",c_char_p),
               ("imgFormat",c_uint),("numFormat",c_uint),
-              ("itCounts",bType)]
+              ("itCounts",bType),("shiftTimes",bType)]
   def __init__(self):
     lib.ElSnaphsotCtrlDefault(pointer(self))
   def Destroy(self):
@@ -1014,6 +1030,7 @@ class PseudospecCtrl_s(ctypes.Structure):
               ("arnoldi",bType),
               ("basisSize",iType),
               ("reorthog",bType),
+              ("shiftBatchSize",iType),
               ("progress",bType),
               ("snapCtrl",SnapshotCtrl),
               ("center",cType),
@@ -1040,6 +1057,7 @@ class PseudospecCtrl_d(ctypes.Structure):
               ("arnoldi",bType),
               ("basisSize",iType),
               ("reorthog",bType),
+              ("shiftBatchSize",iType),
               ("progress",bType),
               ("snapCtrl",SnapshotCtrl),
               ("center",zType),
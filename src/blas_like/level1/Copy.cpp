@@ -38,7 +38,10 @@ template<typename T,Dist U,Dist V>
 inline void Copy( const AbstractDistMatrix<T>& A, DistMatrix<T,U,V>& B )
 {
     DEBUG_ONLY(CSE cse("Copy"))
-    B = A;
+    if( A.Grid() != B.Grid() )
+        TranslateBetweenGrids( A, B );
+    else
+        B = A;
 }
 
 // Datatype conversions should not be very common, and so it is likely best to
@@ -75,7 +78,10 @@ inline void Copy
 ( const AbstractBlockDistMatrix<T>& A, BlockDistMatrix<T,U,V>& B )
 {
     DEBUG_ONLY(CSE cse("Copy"))
-    B = A;
+    if( A.Grid() != B.Grid() )
+        TranslateBetweenGrids( A, B );
+    else
+        B = A;
 }
 
 // Datatype conversions should not be very common, and so it is likely best to
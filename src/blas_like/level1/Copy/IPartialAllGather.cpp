@@ -0,0 +1,233 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+#include "El/blas_like/level1/copy_internal.hpp"
+
+namespace El {
+namespace copy {
+
+namespace {
+
+template<typename T>
+void StartAllGather( AllGatherRequest<T>& req, mpi::Comm unionComm )
+{
+    T* firstBuf = &req.buffer[0];
+    T* secondBuf = &req.buffer[req.portionSize];
+#if EL_HAVE_NONBLOCKING
+    mpi::IAllGather
+    ( firstBuf, req.portionSize, secondBuf, req.portionSize, unionComm,
+      req.request );
+#else
+    mpi::AllGather
+    ( firstBuf, req.portionSize, secondBuf, req.portionSize, unionComm );
+    req.request = mpi::REQUEST_NULL;
+#endif
+    req.pending = true;
+}
+
+} // anonymous namespace
+
+// (U,V) |-> (Partial(U),V)
+template<typename T>
+void IPartialColAllGather
+( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B,
+  AllGatherRequest<T>& req )
+{
+    DEBUG_ONLY(
+        CSE cse("copy::IPartialColAllGather");
+        if( B.ColDist() != Partial(A.ColDist()) ||
+            B.RowDist() != A.RowDist() )
+            LogicError("Incompatible distributions");
+        if( req.pending )
+            LogicError("The previous request was not finished");
+    )
+    AssertSameGrids( A, B );
+
+    const Int height = A.Height();
+    const Int width = A.Width();
+    B.AlignColsAndResize
+    ( A.ColAlign()%B.ColStride(), height, width, false, false );
+    if( !A.Participating() )
+        return;
+
+    DEBUG_ONLY(
+        if( A.LocalWidth() != A.Width() )
+            LogicError("This routine assumes rows are not distributed");
+    )
+    const Int colStride = A.ColStride();
+    const Int colStridePart = A.PartialColStride();
+    const Int colDiff = B.ColAlign() - (A.ColAlign()%colStridePart);
+
+    req.rowwise = false;
+    req.height = height;
+    req.width = width;
+    req.align = A.ColAlign()+colDiff;
+    req.stride = colStride;
+    req.strideUnion = A.PartialUnionColStride();
+    req.stridePart = colStridePart;
+    req.rankPart = A.PartialColRank();
+    req.shift = B.ColShift();
+    req.BBuf = B.Buffer();
+    req.BLDim = B.LDim();
+
+    const Int maxLocalHeight = MaxLength(height,colStride);
+    req.portionSize = mpi::Pad( maxLocalHeight*width );
+    req.buffer.resize( (req.strideUnion+1)*req.portionSize );
+    T* firstBuf = &req.buffer[0];
+    T* secondBuf = &req.buffer[req.portionSize];
+
+    if( colDiff == 0 )
+    {
+        util::InterleaveMatrix
+        ( A.LocalHeight(), width,
+          A.LockedBuffer(), 1, A.LDim(),
+          firstBuf,         1, A.LocalHeight() );
+    }
+    else
+    {
+        // Perform a SendRecv to match the column alignments
+        util::InterleaveMatrix
+        ( A.LocalHeight(), width,
+          A.LockedBuffer(), 1, A.LDim(),
+          secondBuf,        1, A.LocalHeight() );
+        const Int sendColRank = Mod( A.ColRank()+colDiff, colStride );
+        const Int recvColRank = Mod( A.ColRank()-colDiff, colStride );
+        mpi::SendRecv
+        ( secondBuf, req.portionSize, sendColRank,
+          firstBuf,  req.portionSize, recvColRank, A.ColComm() );
+    }
+    StartAllGather( req, A.PartialUnionColComm() );
+}
+
+// (U,V) |-> (U,Partial(V))
+template<typename T>
+void IPartialRowAllGather
+( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B,
+  AllGatherRequest<T>& req )
+{
+    DEBUG_ONLY(
+        CSE cse("copy::IPartialRowAllGather");
+        if( B.ColDist() != A.ColDist() ||
+            B.RowDist() != Partial(A.RowDist()) )
+            LogicError("Incompatible distributions");
+        if( req.pending )
+            LogicError("The previous request was not finished");
+    )
+    AssertSameGrids( A, B );
+
+    const Int height = A.Height();
+    const Int width = A.Width();
+    B.AlignRowsAndResize
+    ( A.RowAlign()%B.RowStride(), height, width, false, false );
+    if( !A.Participating() )
+        return;
+
+    DEBUG_ONLY(
+        if( A.LocalHeight() != height )
+            LogicError("This routine assumes columns are not distributed");
+    )
+    const Int rowStride = A.RowStride();
+    const Int rowStridePart = A.PartialRowStride();
+    const Int rowDiff = B.RowAlign() - (A.RowAlign()%rowStridePart);
+
+    req.rowwise = true;
+    req.height = height;
+    req.width = width;
+    req.align = A.RowAlign()+rowDiff;
+    req.stride = rowStride;
+    req.strideUnion = A.PartialUnionRowStride();
+    req.stridePart = rowStridePart;
+    req.rankPart = A.PartialRowRank();
+    req.shift = B.RowShift();
+    req.BBuf = B.Buffer();
+    req.BLDim = B.LDim();
+
+    const Int maxLocalWidth = MaxLength(width,rowStride);
+    req.portionSize = mpi::Pad( height*maxLocalWidth );
+    req.buffer.resize( (req.strideUnion+1)*req.portionSize );
+    T* firstBuf = &req.buffer[0];
+    T* secondBuf = &req.buffer[req.portionSize];
+
+    if( rowDiff == 0 )
+    {
+        util::InterleaveMatrix
+        ( height, A.LocalWidth(),
+          A.LockedBuffer(), 1, A.LDim(),
+          firstBuf,         1, height );
+    }
+    else
+    {
+        // Perform a SendRecv to match the row alignments
+        util::InterleaveMatrix
+        ( height, A.LocalWidth(),
+          A.LockedBuffer(), 1, A.LDim(),
+          secondBuf,        1, height );
+        const Int sendRowRank = Mod( A.RowRank()+rowDiff, rowStride );
+        const Int recvRowRank = Mod( A.RowRank()-rowDiff, rowStride );
+        mpi::SendRecv
+        ( secondBuf, req.portionSize, sendRowRank,
+          firstBuf,  req.portionSize, recvRowRank, A.RowComm() );
+    }
+    StartAllGather( req, A.PartialUnionRowComm() );
+}
+
+template<typename T>
+bool TestAllGather( AllGatherRequest<T>& req )
+{
+    DEBUG_ONLY(CSE cse("copy::TestAllGather"))
+    if( !req.pending )
+        return true;
+    return mpi::Test( req.request );
+}
+
+template<typename T>
+void FinishAllGather( AllGatherRequest<T>& req )
+{
+    DEBUG_ONLY(CSE cse("copy::FinishAllGather"))
+    if( !req.pending )
+        return;
+    mpi::Wait( req.request );
+
+    const T* secondBuf = &req.buffer[req.portionSize];
+    if( req.rowwise )
+        util::PartialRowStridedUnpack
+        ( req.height, req.width,
+          req.align, req.stride,
+          req.strideUnion, req.stridePart, req.rankPart,
+          req.shift,
+          secondBuf, req.portionSize,
+          req.BBuf, req.BLDim );
+    else
+        util::PartialColStridedUnpack
+        ( req.height, req.width,
+          req.align, req.stride,
+          req.strideUnion, req.stridePart, req.rankPart,
+          req.shift,
+          secondBuf, req.portionSize,
+          req.BBuf, req.BLDim );
+    req.pending = false;
+    SwapClear( req.buffer );
+}
+
+#define PROTO(T) \
+  template void IPartialColAllGather \
+  ( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B, \
+    AllGatherRequest<T>& req ); \
+  template void IPartialRowAllGather \
+  ( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B, \
+    AllGatherRequest<T>& req ); \
+  template bool TestAllGather( AllGatherRequest<T>& req ); \
+  template void FinishAllGather( AllGatherRequest<T>& req );
+
+#define EL_ENABLE_QUAD
+#include "El/macros/Instantiate.h"
+
+} // namespace copy
+} // namespace El
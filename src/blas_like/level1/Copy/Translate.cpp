@@ -117,6 +117,14 @@ template<typename T,Dist U,Dist V>
 void Translate( const BlockDistMatrix<T,U,V>& A, BlockDistMatrix<T,U,V>& B ) 
 {
     DEBUG_ONLY(CSE cse("copy::Translate"))
+    if( A.Grid() != B.Grid() )
+    {
+        El::TranslateBetweenGrids
+        ( static_cast<const AbstractBlockDistMatrix<T>&>(A),
+          static_cast<AbstractBlockDistMatrix<T>&>(B) );
+        return;
+    }
+
     const Int height = A.Height();
     const Int width = A.Width();
     const Int blockHeight = A.BlockHeight();
@@ -146,9 +154,6 @@ void Translate( const BlockDistMatrix<T,U,V>& A, BlockDistMatrix<T,U,V>& B )
     {
         // TODO: Implement this in a more efficient manner, perhaps through
         //       many rounds of point-to-point communication
-        // TODO: Turn this into a general routine for redistributing
-        //       between any matrix distributions supported by Elemental.
-        //       The key addition is mpi::Translate.
         const Int distSize = B.DistSize();
         const Int mLocal = A.LocalHeight();
         const Int nLocal = A.LocalWidth();
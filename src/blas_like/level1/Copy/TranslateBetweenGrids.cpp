@@ -9,15 +9,245 @@
 #include "El.hpp"
 
 namespace El {
+
+// The general redistribution between grids
+// ========================================
+// Every member of the first team of owners of A sends each of its entries to 
+// all of the redundant owners of the entry within B using a single AllToAll
+// over the (shared) viewing communicator. Since both sides traverse the 
+// entries in column-major order, the packed and unpacked orders coincide.
+
+namespace {
+
+template<typename T,template<typename> class DistType>
+TranslatePlan MakePlan( const DistType<T>& A, const DistType<T>& B )
+{
+    DEBUG_ONLY(
+      CSE cse("MakeTranslatePlan");
+      if( A.Height() != B.Height() || A.Width() != B.Width() )
+          LogicError("A and B must be the same size");
+    )
+    const Grid& gA = A.Grid();
+    const Grid& gB = B.Grid();
+    TranslatePlan plan;
+    plan.comm = gB.ViewingComm();
+    plan.height = A.Height();
+    plan.width = A.Width();
+    if( !mpi::Congruent( gA.ViewingComm(), plan.comm ) )
+        LogicError
+        ("Redistributing between nonmatching grids currently requires"
+         " the viewing communicators to match.");
+    const int commSize = mpi::Size( plan.comm );
+    plan.sendCounts.resize( commSize, 0 );
+    plan.recvCounts.resize( commSize, 0 );
+
+    if( A.Participating() && A.RedundantRank() == 0 )
+    {
+        const Int localHeight = A.LocalHeight();
+        const Int localWidth = A.LocalWidth();
+        const int colStrideB = B.ColStride();
+        const int rowStrideB = B.RowStride();
+        const int distSizeB = colStrideB*rowStrideB;
+        const int redundantSizeB = B.RedundantSize();
+
+        plan.sendRedundantSize = redundantSizeB;
+        plan.sendRanks.resize( distSizeB*redundantSizeB );
+        for( int distRank=0; distRank<distSizeB; ++distRank )
+            for( int r=0; r<redundantSizeB; ++r )
+                plan.sendRanks[distRank*redundantSizeB+r] =
+                  gB.VCToViewing
+                  ( gB.CoordsToVC
+                    (B.ColDist(),B.RowDist(),distRank,B.Root(),r) );
+
+        vector<int> rowHist(colStrideB,0), colHist(rowStrideB,0);
+        plan.sendRowOwners.resize( localHeight );
+        plan.sendColOwners.resize( localWidth );
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const int rowOwner = B.RowOwner( A.GlobalRow(iLoc) );
+            plan.sendRowOwners[iLoc] = rowOwner;
+            ++rowHist[rowOwner];
+        }
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            const int colOwner = B.ColOwner( A.GlobalCol(jLoc) );
+            plan.sendColOwners[jLoc] = colOwner*colStrideB;
+            ++colHist[colOwner];
+        }
+        for( int rowOwner=0; rowOwner<colStrideB; ++rowOwner )
+            for( int colOwner=0; colOwner<rowStrideB; ++colOwner )
+            {
+                const int distRank = rowOwner + colOwner*colStrideB;
+                const int count = rowHist[rowOwner]*colHist[colOwner];
+                for( int r=0; r<redundantSizeB; ++r )
+                    plan.sendCounts[plan.sendRanks[distRank*redundantSizeB+r]]
+                      += count;
+            }
+    }
+
+    if( B.Participating() )
+    {
+        const Int localHeight = B.LocalHeight();
+        const Int localWidth = B.LocalWidth();
+        const int colStrideA = A.ColStride();
+        const int rowStrideA = A.RowStride();
+        const int distSizeA = colStrideA*rowStrideA;
+
+        plan.recvRanks.resize( distSizeA );
+        for( int distRank=0; distRank<distSizeA; ++distRank )
+            plan.recvRanks[distRank] = 
+              gA.VCToViewing
+              ( gA.CoordsToVC(A.ColDist(),A.RowDist(),distRank,A.Root(),0) );
+
+        vector<int> rowHist(colStrideA,0), colHist(rowStrideA,0);
+        plan.recvRowOwners.resize( localHeight );
+        plan.recvColOwners.resize( localWidth );
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const int rowOwner = A.RowOwner( B.GlobalRow(iLoc) );
+            plan.recvRowOwners[iLoc] = rowOwner;
+            ++rowHist[rowOwner];
+        }
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            const int colOwner = A.ColOwner( B.GlobalCol(jLoc) );
+            plan.recvColOwners[jLoc] = colOwner*colStrideA;
+            ++colHist[colOwner];
+        }
+        for( int rowOwner=0; rowOwner<colStrideA; ++rowOwner )
+            for( int colOwner=0; colOwner<rowStrideA; ++colOwner )
+            {
+                const int distRank = rowOwner + colOwner*colStrideA;
+                plan.recvCounts[plan.recvRanks[distRank]] += 
+                  rowHist[rowOwner]*colHist[colOwner];
+            }
+    }
+
+    Scan( plan.sendCounts, plan.sendOffs );
+    Scan( plan.recvCounts, plan.recvOffs );
+    return plan;
+}
+
+template<typename T,template<typename> class DistType>
+void Translate
+( const DistType<T>& A, DistType<T>& B, const TranslatePlan& plan )
+{
+    DEBUG_ONLY(
+      CSE cse("TranslateBetweenGrids");
+      if( A.Height() != plan.height || A.Width() != plan.width ||
+          B.Height() != plan.height || B.Width() != plan.width )
+          LogicError("The plan does not match the matrix sizes");
+    )
+    const int commSize = mpi::Size( plan.comm );
+    const Int totalSend = 
+      ( commSize > 0 ? plan.sendOffs.back()+plan.sendCounts.back() : 0 );
+    const Int totalRecv = 
+      ( commSize > 0 ? plan.recvOffs.back()+plan.recvCounts.back() : 0 );
+
+    // Pack the entries of A for every redundant owner in B
+    vector<T> sendBuf( totalSend );
+    if( totalSend > 0 )
+    {
+        const Int localHeight = A.LocalHeight();
+        const Int localWidth = A.LocalWidth();
+        const int redundantSize = plan.sendRedundantSize;
+        const T* ABuf = A.LockedBuffer();
+        const Int ALDim = A.LDim();
+        auto offs = plan.sendOffs;
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            const int colOwner = plan.sendColOwners[jLoc];
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            {
+                const int distRank = plan.sendRowOwners[iLoc] + colOwner;
+                const T value = ABuf[iLoc+jLoc*ALDim];
+                const int* ranks = &plan.sendRanks[distRank*redundantSize];
+                for( int r=0; r<redundantSize; ++r )
+                    sendBuf[offs[ranks[r]]++] = value;
+            }
+        }
+    }
+
+    vector<T> recvBuf( totalRecv );
+    mpi::AllToAll
+    ( sendBuf.data(), plan.sendCounts.data(), plan.sendOffs.data(),
+      recvBuf.data(), plan.recvCounts.data(), plan.recvOffs.data(),
+      plan.comm );
+    SwapClear( sendBuf );
+
+    // Unpack the entries of B
+    if( totalRecv > 0 )
+    {
+        const Int localHeight = B.LocalHeight();
+        const Int localWidth = B.LocalWidth();
+        T* BBuf = B.Buffer();
+        const Int BLDim = B.LDim();
+        auto offs = plan.recvOffs;
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            const int colOwner = plan.recvColOwners[jLoc];
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            {
+                const int distRank = plan.recvRowOwners[iLoc] + colOwner;
+                BBuf[iLoc+jLoc*BLDim] = 
+                  recvBuf[offs[plan.recvRanks[distRank]]++];
+            }
+        }
+    }
+}
+
+} // anonymous namespace
+
+template<typename T>
+TranslatePlan MakeTranslatePlan
+( const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B )
+{ return MakePlan( A, B ); }
+
+template<typename T>
+TranslatePlan MakeTranslatePlan
+( const AbstractBlockDistMatrix<T>& A, const AbstractBlockDistMatrix<T>& B )
+{ return MakePlan( A, B ); }
+
+template<typename T>
+void TranslateBetweenGrids
+( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B, 
+  const TranslatePlan& plan )
+{ Translate( A, B, plan ); }
+
+template<typename T>
+void TranslateBetweenGrids
+( const AbstractBlockDistMatrix<T>& A, AbstractBlockDistMatrix<T>& B, 
+  const TranslatePlan& plan )
+{ Translate( A, B, plan ); }
+
+template<typename T>
+void TranslateBetweenGrids
+( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B )
+{
+    DEBUG_ONLY(CSE cse("TranslateBetweenGrids"))
+    B.Resize( A.Height(), A.Width() );
+    Translate( A, B, MakePlan( A, B ) );
+}
+
+template<typename T>
+void TranslateBetweenGrids
+( const AbstractBlockDistMatrix<T>& A, AbstractBlockDistMatrix<T>& B )
+{
+    DEBUG_ONLY(CSE cse("TranslateBetweenGrids"))
+    B.Resize( A.Height(), A.Width() );
+    Translate( A, B, MakePlan( A, B ) );
+}
+
 namespace copy {
 
-// TODO: Generalize to more distributions
 template<typename T,Dist U,Dist V>
 void TranslateBetweenGrids
 ( const DistMatrix<T,U,V>& A, DistMatrix<T,U,V>& B ) 
 {
     DEBUG_ONLY(CSE cse("copy::TranslateBetweenGrids"))
-    LogicError("General TranslateBetweenGrids not yet supported");
+    El::TranslateBetweenGrids
+    ( static_cast<const AbstractDistMatrix<T>&>(A),
+      static_cast<AbstractDistMatrix<T>&>(B) );
 }
 
 template<typename T>
@@ -277,11 +507,28 @@ void TranslateBetweenGrids
         mpi::Wait( sendRequest );
 }
 
+} // namespace copy
+
 #define PROTO_DIST(T,U,V) \
-  template void TranslateBetweenGrids \
+  template void copy::TranslateBetweenGrids \
   ( const DistMatrix<T,U,V>& A, DistMatrix<T,U,V>& B );
 
 #define PROTO(T) \
+  template TranslatePlan MakeTranslatePlan \
+  ( const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B ); \
+  template TranslatePlan MakeTranslatePlan \
+  ( const AbstractBlockDistMatrix<T>& A, \
+    const AbstractBlockDistMatrix<T>& B ); \
+  template void TranslateBetweenGrids \
+  ( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B ); \
+  template void TranslateBetweenGrids \
+  ( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B, \
+    const TranslatePlan& plan ); \
+  template void TranslateBetweenGrids \
+  ( const AbstractBlockDistMatrix<T>& A, AbstractBlockDistMatrix<T>& B ); \
+  template void TranslateBetweenGrids \
+  ( const AbstractBlockDistMatrix<T>& A, AbstractBlockDistMatrix<T>& B, \
+    const TranslatePlan& plan ); \
   PROTO_DIST(T,CIRC,CIRC) \
   PROTO_DIST(T,MC,MR) \
   PROTO_DIST(T,MC,STAR) \
@@ -300,5 +547,4 @@ void TranslateBetweenGrids
 #define EL_ENABLE_QUAD
 #include "El/macros/Instantiate.h"
 
-} // namespace copy
 } // namespace El
@@ -12,6 +12,7 @@
 #include "./Gemm/NT.hpp"
 #include "./Gemm/TN.hpp"
 #include "./Gemm/TT.hpp"
+#include "./Gemm/SUMMA25D.hpp"
 
 namespace El {
 
@@ -61,6 +62,7 @@ void Gemm
         ( transA, transB, m, n, k,
           alpha, A.LockedBuffer(), A.LDim(), B.LockedBuffer(), B.LDim(),
           beta,  C.Buffer(),       C.LDim() );
+        AddProfileFlops( (IsComplex<T>::val ? 8. : 2.)*m*n*k );
     }
     else
     {
@@ -89,7 +91,10 @@ void Gemm
   GemmAlgorithm alg )
 {
     DEBUG_ONLY(CSE cse("Gemm"))
-    if( orientA == NORMAL && orientB == NORMAL )
+    ProfileRegion profile("Gemm");
+    if( alg == GEMM_SUMMA_25D )
+        gemm::SUMMA25D( orientA, orientB, alpha, A, B, beta, C );
+    else if( orientA == NORMAL && orientB == NORMAL )
     {
         if( alg == GEMM_CANNON )
             gemm::Cannon_NN( alpha, A, B, beta, C );
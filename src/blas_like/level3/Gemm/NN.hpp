@@ -351,6 +351,16 @@ SUMMA_NN
     const double weightTowardsC = 2.;
     const double weightAwayFromDot = 10.;
 
+    // Defer to the calibrated cost model of the grid, if there is one
+    Int bsize;
+    if( alg == GEMM_DEFAULT &&
+        PredictVariant<T>( C.Grid(), m, n, sumDim, true, alg, bsize ) )
+    {
+        BlocksizeStackEntry bse( bsize );
+        SUMMA_NN( alpha, A, B, beta, C, alg );
+        return;
+    }
+
     switch( alg )
     {
     case GEMM_DEFAULT:
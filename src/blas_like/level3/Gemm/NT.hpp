@@ -186,6 +186,16 @@ SUMMA_NT
     const Int k = A.Width();
     const double weightTowardsC = 2.;
 
+    // Defer to the calibrated cost model of the grid, if there is one
+    Int bsize;
+    if( alg == GEMM_DEFAULT &&
+        PredictVariant<T>( C.Grid(), m, n, k, false, alg, bsize ) )
+    {
+        BlocksizeStackEntry bse( bsize );
+        SUMMA_NT( orientB, alpha, A, B, beta, C, alg );
+        return;
+    }
+
     switch( alg )
     {
     case GEMM_DEFAULT:
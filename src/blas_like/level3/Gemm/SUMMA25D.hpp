@@ -0,0 +1,203 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#if defined(__unix__) || defined(__APPLE__)
+# include <unistd.h>
+#endif
+
+namespace El {
+namespace gemm {
+
+// 2.5D matrix multiplication
+// ==========================
+// The p processes of the grid are split into c layers of p/c processes, each
+// of which is arranged as its own 2D grid. The l'th layer forms the
+// contribution of the l'th (contiguous) 1/c'th of the summation dimension
+// using 2D SUMMA, and the c partial products are then reduce-scattered over
+// the depth communicators, so that each layer only redistributes the sum of
+// 1/c'th of the columns of C back to the full grid. The SUMMA panels of each
+// layer are only broadcast within sqrt(p/c) processes over 1/c'th of the
+// summation dimension, which reduces the words moved per process by a factor
+// of sqrt(c), at the cost of storing c partial copies of C in total. The cost of redistributing the inputs and summing the results
+// is only of lower order when c^3 <= p, and so the automatically chosen
+// number of layers is a divisor of p no larger than p^(1/3).
+
+// A (conservative) estimate of the number of bytes available to each process,
+// namely, the minimum over the grid of the available physical memory of each
+// node divided evenly among the processes sharing it
+inline double AvailableMemory( const Grid& g )
+{
+    DEBUG_ONLY(CSE cse("gemm::AvailableMemory"))
+    double availMem = 0;
+#if defined(_SC_AVPHYS_PAGES) && defined(_SC_PAGESIZE)
+    const long numPages = sysconf( _SC_AVPHYS_PAGES );
+    const long pageSize = sysconf( _SC_PAGESIZE );
+    if( numPages > 0 && pageSize > 0 )
+        availMem = 
+          double(numPages)*double(pageSize) / mpi::NodeSize(g.Comm());
+#endif
+    return mpi::AllReduce( availMem, mpi::MIN, g.Comm() );
+}
+
+// Choose the number of layers for forming an m x n product with summation
+// dimension k from entries of the given size
+inline Int NumLayers25D( const Grid& g, Int m, Int n, Int k, Int entrySize )
+{
+    DEBUG_ONLY(CSE cse("gemm::NumLayers25D"))
+    const Int p = g.Size();
+    const Int numLayers = GemmNumLayers();
+    if( numLayers != 0 )
+    {
+        if( numLayers < 0 || p % numLayers != 0 )
+            LogicError
+            ("The number of layers, ",numLayers,
+             ", must be a positive divisor of ",p);
+        return numLayers;
+    }
+
+    // Only use up to half of the available memory for the copies of A and B
+    // on each layer and the partial products
+    const double memLimit = AvailableMemory( g ) / 2;
+    Int bestNumLayers = 1;
+    for( Int c=2; c*c*c<=p; ++c )
+    {
+        if( p % c != 0 || k < c )
+            continue;
+        const double memNeeded =
+          double(entrySize)*(double(m)*k + double(k)*n + double(c)*m*n) / p;
+        if( memNeeded <= memLimit )
+            bestNumLayers = c;
+    }
+    return bestNumLayers;
+}
+
+template<typename T>
+inline void
+SUMMA25D
+( Orientation orientA, Orientation orientB,
+  T alpha, const AbstractDistMatrix<T>& APre, const AbstractDistMatrix<T>& BPre,
+  T beta,        AbstractDistMatrix<T>& CPre )
+{
+    DEBUG_ONLY(
+      CSE cse("gemm::SUMMA25D");
+      AssertSameGrids( APre, BPre, CPre );
+    )
+    const Int m = CPre.Height();
+    const Int n = CPre.Width();
+    const Int k = ( orientA==NORMAL ? APre.Width() : APre.Height() );
+    const Grid& g = APre.Grid();
+
+    // The layers are formed over the viewing communicator of the grid, and
+    // so every viewing process must own a piece of it
+    const Int p = g.Size();
+    const Int numLayers =
+      ( mpi::Size(g.ViewingComm()) == p ?
+        NumLayers25D( g, m, n, k, sizeof(T) ) : 1 );
+    if( numLayers == 1 )
+    {
+        Gemm( orientA, orientB, alpha, APre, BPre, beta, CPre );
+        return;
+    }
+
+    auto APtr = ReadProxy<T,MC,MR>( &APre );      auto& A = *APtr;
+    auto BPtr = ReadProxy<T,MC,MR>( &BPre );      auto& B = *BPtr;
+    auto CPtr = ReadWriteProxy<T,MC,MR>( &CPre ); auto& C = *CPtr;
+
+    // The processes (in the VC ordering of the grid) are split into
+    // contiguous layers, each with as square of a grid as possible. The layer
+    // grids are cached by the parent grid for subsequent multiplications.
+    const Int layerSize = p / numLayers;
+    const Int layer = g.VCRank() / layerSize;
+    const Grid& layerGrid = g.LayerGrid( numLayers, layer );
+
+    // Send the l'th slices of op(A) and op(B) to the l'th layer
+    DistMatrix<T> ALayer(layerGrid), BLayer(layerGrid);
+    for( Int l=0; l<numLayers; ++l )
+    {
+        const Range<Int> indL( (l*k)/numLayers, ((l+1)*k)/numLayers );
+        auto AL = ( orientA==NORMAL ? A( ALL, indL ) : A( indL, ALL ) );
+        auto BL = ( orientB==NORMAL ? B( indL, ALL ) : B( ALL, indL ) );
+        if( l == layer )
+        {
+            Copy( AL, ALayer );
+            Copy( BL, BLayer );
+        }
+        else
+        {
+            const Grid& otherGrid = g.LayerGrid( numLayers, l );
+            DistMatrix<T> AOther(otherGrid), BOther(otherGrid);
+            Copy( AL, AOther );
+            Copy( BL, BOther );
+        }
+    }
+
+    // Form the partial products with 2D SUMMA within each layer
+    DistMatrix<T> CLayer(layerGrid);
+    Zeros( CLayer, m, n );
+    Gemm( orientA, orientB, alpha, ALayer, BLayer, T(0), CLayer );
+    ALayer.Empty();
+    BLayer.Empty();
+
+    // Sum the partial products over the depth communicator, which connects
+    // the processes owning the same local piece of C_l in each layer, so
+    // that the l'th layer is left with the sum over the l'th (contiguous)
+    // 1/c'th of the columns. The boundaries of the column slices are chosen
+    // as multiples of the row stride of the layer grids so that each slice
+    // is a contiguous set of local columns with a row alignment of zero.
+    mpi::Comm depthComm;
+    mpi::Split( g.VCComm(), layerGrid.VCRank(), layer, depthComm );
+    const Int rowStride = layerGrid.Width();
+    const Int numColBlocks = (n+rowStride-1) / rowStride;
+    vector<Int> sliceOffs(numLayers+1);
+    for( Int l=0; l<=numLayers; ++l )
+        sliceOffs[l] = Min( ((l*numColBlocks)/numLayers)*rowStride, n );
+    const Int localHeight = CLayer.LocalHeight();
+    vector<int> recvCounts(numLayers);
+    for( Int l=0; l<numLayers; ++l )
+        recvCounts[l] =
+          localHeight*(CLayer.LocalColOffset(sliceOffs[l+1])-
+                       CLayer.LocalColOffset(sliceOffs[l]));
+    // NOTE: CLayer was freshly allocated, so its local columns are contiguous
+    vector<T> recvBuf( recvCounts[layer] );
+    mpi::ReduceScatter
+    ( CLayer.LockedBuffer(), recvBuf.data(), recvCounts.data(), depthComm );
+    mpi::Free( depthComm );
+    if( recvCounts[layer] > 0 )
+        MemCopy
+        ( CLayer.Buffer(0,CLayer.LocalColOffset(sliceOffs[layer])),
+          recvBuf.data(), recvCounts[layer] );
+    SwapClear( recvBuf );
+
+    // C := beta C + sum_l C_l, where each slice is only redistributed from
+    // the layer which holds its sum
+    Scale( beta, C );
+    for( Int l=0; l<numLayers; ++l )
+    {
+        const Range<Int> indL( sliceOffs[l], sliceOffs[l+1] );
+        if( indL.end == indL.beg )
+            continue;
+        auto CL = C( ALL, indL );
+        DistMatrix<T> DL(g);
+        DL.AlignWith( CL );
+        if( l == layer )
+        {
+            auto CLayerL = CLayer( ALL, indL );
+            Copy( CLayerL, DL );
+        }
+        else
+        {
+            DistMatrix<T> COther(g.LayerGrid(numLayers,l));
+            COther.Resize( m, indL.end-indL.beg );
+            Copy( COther, DL );
+        }
+        Axpy( T(1), DL, CL );
+    }
+}
+
+} // namespace gemm
+} // namespace El
@@ -192,6 +192,16 @@ SUMMA_TT
     const Int sumDim = A.Height();
     const double weightTowardsC = 2.;
 
+    // Defer to the calibrated cost model of the grid, if there is one
+    Int bsize;
+    if( alg == GEMM_DEFAULT &&
+        PredictVariant<T>( C.Grid(), m, n, sumDim, false, alg, bsize ) )
+    {
+        BlocksizeStackEntry bse( bsize );
+        SUMMA_TT( orientA, orientB, alpha, A, B, beta, C, alg );
+        return;
+    }
+
     switch( alg )
     {
     case GEMM_DEFAULT:
@@ -0,0 +1,349 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+#include <fstream>
+#include <iomanip>
+#include <map>
+
+namespace El {
+
+namespace {
+
+// The registered models, keyed by the (height,width) of the process grid
+std::map<std::pair<Int,Int>,GemmCostModel> gemmCostModels;
+
+double Log2Ceil( Int p )
+{
+    double logP = 0;
+    for( Int q=1; q<p; q*=2 )
+        logP += 1;
+    return logP;
+}
+
+} // anonymous namespace
+
+// Calibration
+// ===========
+// The latency is measured from a sequence of (one-word) AllReduce's over the
+// grid, the inverse bandwidth from an AllGather whose volume dwarfs the
+// latency, and the time per flop of the local Gemm from rank-b updates of a
+// fixed-size matrix for each candidate blocksize b. Each measurement is the
+// maximum over the grid so that every process predicts the same variant.
+
+GemmCostModel CalibrateGemm( const Grid& g )
+{
+    DEBUG_ONLY(CSE cse("CalibrateGemm"))
+    mpi::Comm comm = g.Comm();
+    const Int p = g.Size();
+    const double logP = Log2Ceil( p );
+    GemmCostModel model;
+
+    if( p > 1 )
+    {
+        const Int numLatencyReps = 20;
+        double value = 1;
+        mpi::Barrier( comm );
+        double startTime = mpi::Time();
+        for( Int rep=0; rep<numLatencyReps; ++rep )
+            value = mpi::AllReduce( value, comm );
+        const double reduceTime = (mpi::Time()-startTime) / numLatencyReps;
+        model.latency =
+          mpi::AllReduce( reduceTime/logP, mpi::MAX, comm );
+
+        const Int numWords = 8192;
+        vector<double> sendBuf( numWords, value ), recvBuf( numWords*p );
+        mpi::Barrier( comm );
+        startTime = mpi::Time();
+        mpi::AllGather
+        ( sendBuf.data(), numWords, recvBuf.data(), numWords, comm );
+        const double gatherTime = mpi::Time() - startTime;
+        const double numBytes = double(sizeof(double))*numWords*(p-1);
+        model.inverseBandwidth =
+          mpi::AllReduce
+          ( Max(gatherTime-model.latency*logP,0.)/numBytes, mpi::MAX, comm );
+    }
+
+    const Int numFlopReps = 3;
+    const Int updateSize = 512;
+    model.blocksizes = { 32, 64, 128, 256 };
+    for( const Int bsize : model.blocksizes )
+    {
+        Matrix<double> A, B, C;
+        Uniform( A, updateSize, bsize );
+        Uniform( B, bsize, updateSize );
+        Zeros( C, updateSize, updateSize );
+        double minTime = std::numeric_limits<double>::infinity();
+        for( Int rep=0; rep<numFlopReps; ++rep )
+        {
+            const double startTime = mpi::Time();
+            Gemm( NORMAL, NORMAL, 1., A, B, 1., C );
+            minTime = Min( minTime, mpi::Time()-startTime );
+        }
+        const double numFlops = 2.*updateSize*updateSize*bsize;
+        model.flopTimes.push_back
+        ( mpi::AllReduce( minTime/numFlops, mpi::MAX, comm ) );
+    }
+
+    SetGemmCostModel( g.Height(), g.Width(), model );
+    return model;
+}
+
+// Registration
+// ============
+
+void SetGemmCostModel
+( Int gridHeight, Int gridWidth, const GemmCostModel& model )
+{
+    DEBUG_ONLY(CSE cse("SetGemmCostModel"))
+    if( model.blocksizes.size() == 0 ||
+        model.blocksizes.size() != model.flopTimes.size() )
+        LogicError("Each candidate blocksize requires a time per flop");
+    gemmCostModels[std::make_pair(gridHeight,gridWidth)] = model;
+}
+
+bool HaveGemmCostModel( Int gridHeight, Int gridWidth )
+{
+    return gemmCostModels.find(std::make_pair(gridHeight,gridWidth)) !=
+           gemmCostModels.end();
+}
+
+const GemmCostModel& GetGemmCostModel( Int gridHeight, Int gridWidth )
+{
+    DEBUG_ONLY(CSE cse("GetGemmCostModel"))
+    auto it = gemmCostModels.find( std::make_pair(gridHeight,gridWidth) );
+    if( it == gemmCostModels.end() )
+        LogicError
+        ("No Gemm cost model for a ",gridHeight," x ",gridWidth," grid");
+    return it->second;
+}
+
+void ClearGemmCostModels()
+{ gemmCostModels.clear(); }
+
+// Persistence
+// ===========
+// Each model is stored on a single line as
+//
+//   gridHeight gridWidth latency inverseBandwidth numBlocksizes
+//   blocksize_0 flopTime_0 ... blocksize_{numBlocksizes-1} ...
+//
+// The file is only read (and written) by the root of mpi::COMM_WORLD, which
+// broadcasts the outcome (and the parsed models) so that every process
+// predicts the same variants (even if the file is not visible to, or differs
+// between, nodes).
+
+bool LoadGemmCostModels( const string& filename, bool mustExist )
+{
+    DEBUG_ONLY(CSE cse("LoadGemmCostModels"))
+    enum { LOADED=0, MISSING=1, TRUNCATED=2, UNPARSEABLE=3 };
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    // The models are packed as the fields of each line, in order
+    Int status = LOADED;
+    vector<double> packed;
+    if( mpi::Rank(comm) == 0 )
+    {
+        std::ifstream file( filename.c_str() );
+        if( !file.is_open() )
+            status = MISSING;
+        Int gridHeight, gridWidth, numBlocksizes;
+        double latency, inverseBandwidth;
+        while( status == LOADED && 
+               file >> gridHeight >> gridWidth >> latency
+                    >> inverseBandwidth >> numBlocksizes )
+        {
+            packed.push_back( gridHeight );
+            packed.push_back( gridWidth );
+            packed.push_back( latency );
+            packed.push_back( inverseBandwidth );
+            packed.push_back( numBlocksizes );
+            for( Int j=0; j<numBlocksizes; ++j )
+            {
+                Int blocksize;
+                double flopTime;
+                if( !(file >> blocksize >> flopTime) )
+                {
+                    status = TRUNCATED;
+                    break;
+                }
+                packed.push_back( blocksize );
+                packed.push_back( flopTime );
+            }
+        }
+        if( status == LOADED && !file.eof() )
+            status = UNPARSEABLE;
+    }
+    mpi::Broadcast( status, 0, comm );
+    if( status == MISSING )
+    {
+        if( mustExist )
+            RuntimeError("Could not open ",filename);
+        return false;
+    }
+    else if( status == TRUNCATED )
+        RuntimeError("Truncated Gemm cost model in ",filename);
+    else if( status == UNPARSEABLE )
+        RuntimeError("Could not parse the Gemm cost models in ",filename);
+
+    Int packedSize = packed.size();
+    mpi::Broadcast( packedSize, 0, comm );
+    packed.resize( packedSize );
+    mpi::Broadcast( packed.data(), packedSize, 0, comm );
+    for( Int off=0; off<packedSize; )
+    {
+        const Int gridHeight = packed[off++];
+        const Int gridWidth = packed[off++];
+        GemmCostModel model;
+        model.latency = packed[off++];
+        model.inverseBandwidth = packed[off++];
+        const Int numBlocksizes = packed[off++];
+        model.blocksizes.resize( numBlocksizes );
+        model.flopTimes.resize( numBlocksizes );
+        for( Int j=0; j<numBlocksizes; ++j )
+        {
+            model.blocksizes[j] = packed[off++];
+            model.flopTimes[j] = packed[off++];
+        }
+        SetGemmCostModel( gridHeight, gridWidth, model );
+    }
+    return true;
+}
+
+void SaveGemmCostModels( const string& filename )
+{
+    DEBUG_ONLY(CSE cse("SaveGemmCostModels"))
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    // Only the root writes, but every process learns whether it succeeded so
+    // that a failure is thrown collectively
+    Int opened = 1;
+    if( mpi::Rank(comm) == 0 )
+    {
+        std::ofstream file( filename.c_str() );
+        if( file.is_open() )
+        {
+            file << std::setprecision(17);
+            for( const auto& entry : gemmCostModels )
+            {
+                const GemmCostModel& model = entry.second;
+                file << entry.first.first << " " << entry.first.second << " "
+                     << model.latency << " " << model.inverseBandwidth << " "
+                     << model.blocksizes.size();
+                for( size_t j=0; j<model.blocksizes.size(); ++j )
+                    file << " " << model.blocksizes[j] << " "
+                         << model.flopTimes[j];
+                file << "\n";
+            }
+            opened = file.good();
+        }
+        else
+            opened = 0;
+    }
+    mpi::Broadcast( opened, 0, comm );
+    if( !opened )
+        RuntimeError("Could not write the Gemm cost models to ",filename);
+}
+
+namespace gemm {
+
+// Prediction
+// ==========
+// Over an r x c grid with p=rc, with blocksize b, a latency of alpha, an
+// inverse bandwidth of beta (per entry) and a time per flop of gamma(b), the
+// variants of SUMMA are modeled as taking
+//
+//   A:   (n/b) (log p + log c) alpha + (n k/c + n m/r (c-1)/c) beta + F,
+//   B:   (m/b) (log p + log r) alpha + (m k/r + m n/c (r-1)/r) beta + F,
+//   C:   (k/b) (log r + log c) alpha +
+//        (k m/r (c-1)/c + k n/c (r-1)/r) beta + F,
+//   Dot: (m/b)(n/b) 3 log p alpha + (m/b)(n/b) (2 b k/p + b^2) beta + F,
+//
+// where F=(2mnk/p) gamma is the local computation. The stationary variants
+// perform local products whose summation dimension is k/c, k/r, or k/p,
+// whereas that of the SUMMA_C updates is only b, so gamma(b) only varies
+// with b for the latter.
+
+bool PredictVariant
+( const Grid& g, Int m, Int n, Int k, Int entrySize, bool isComplex,
+  bool allowDot, GemmAlgorithm& alg, Int& blocksize )
+{
+    DEBUG_ONLY(CSE cse("gemm::PredictVariant"))
+    const Int r = g.Height();
+    const Int c = g.Width();
+    if( !HaveGemmCostModel( r, c ) )
+        return false;
+    const GemmCostModel& model = GetGemmCostModel( r, c );
+
+    const double p = double(r)*c;
+    const double logP = Log2Ceil( r*c );
+    const double logR = Log2Ceil( r );
+    const double logC = Log2Ceil( c );
+    const double alpha = model.latency;
+    const double beta = entrySize*model.inverseBandwidth;
+    const double flops = (isComplex ? 8. : 2.)*m*n*k / p;
+    const double mLoc = double(m)/r, nLoc = double(n)/c;
+    const double fracR = double(r-1)/r, fracC = double(c-1)/c;
+
+    // The fastest rate measured is used for the stationary variants
+    const Int numBlocksizes = model.blocksizes.size();
+    double minFlopTime = model.flopTimes[0];
+    for( Int j=1; j<numBlocksizes; ++j )
+        minFlopTime = Min( minFlopTime, model.flopTimes[j] );
+
+    double bestCost = std::numeric_limits<double>::infinity();
+    auto consider = [&]( GemmAlgorithm candAlg, Int bsize, double cost )
+    {
+        if( cost < bestCost )
+        {
+            bestCost = cost;
+            alg = candAlg;
+            blocksize = bsize;
+        }
+    };
+    for( Int j=0; j<numBlocksizes; ++j )
+    {
+        const double b = model.blocksizes[j];
+        // Avoid blocksizes which exceed the blocked dimension (other than
+        // the smallest)
+        const bool fitsM = ( j == 0 || b <= m );
+        const bool fitsN = ( j == 0 || b <= n );
+        const bool fitsK = ( j == 0 || b <= k );
+
+        const double minFlopCost = flops*minFlopTime;
+        if( fitsN )
+            consider
+            ( GEMM_SUMMA_A, b,
+              (n/b)*(logP+logC)*alpha +
+              (double(n)*k/c + n*mLoc*fracC)*beta + minFlopCost );
+        if( fitsM )
+            consider
+            ( GEMM_SUMMA_B, b,
+              (m/b)*(logP+logR)*alpha +
+              (double(m)*k/r + m*nLoc*fracR)*beta + minFlopCost );
+        if( fitsK )
+            consider
+            ( GEMM_SUMMA_C, b,
+              (k/b)*(logR+logC)*alpha +
+              (k*mLoc*fracC + k*nLoc*fracR)*beta +
+              flops*model.flopTimes[j] );
+        if( allowDot && fitsM && fitsN )
+        {
+            const double numBlocks = Max(m/b,1.)*Max(n/b,1.);
+            consider
+            ( GEMM_SUMMA_DOT, b,
+              numBlocks*3*logP*alpha + numBlocks*(2*b*k/p + b*b)*beta +
+              minFlopCost );
+        }
+    }
+    return true;
+}
+
+} // namespace gemm
+
+} // namespace El
@@ -17,278 +17,272 @@ namespace El {
 // alternative.
 namespace {
 
-template<typename T>
-void MultiplyCSR
-( Orientation orientation, Int m, Int n,
-  T alpha,
-  const Int* rowOffsets,
-  const Int* colIndices,
-  const T*   values,
-  const T*   x,
-  T beta,
-        T*   y )
+// The number of right-hand sides whose partial sums are kept in registers
+// while traversing a row
+const Int rhsBlocksize = 4;
+
+// Return the bounds of the 'part'-th of 'numParts' contiguous row blocks
+// containing roughly equal numbers of nonzeros
+inline void RowBlock
+( Int m, const Int* rowOffsets, Int numParts, Int part,
+  Int& rowBeg, Int& rowEnd )
 {
-    DEBUG_ONLY(CSE cse("MultiplyCSR"))
-    if( orientation == NORMAL )
+    const Int firstOff = rowOffsets[0];
+    const double numNonzeros = rowOffsets[m] - firstOff;
+    auto PartitionRow = [&]( Int p ) 
     {
-        for( Int i=0; i<m; ++i )
-        {
-            T sum = 0;
-            for( Int e=rowOffsets[i]; e<rowOffsets[i+1]; ++e )
-                sum += values[e]*x[colIndices[e]];         
-            y[i] = alpha*sum + beta*y[i];
-        }
-    }
-    else
-    {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int j=0; j<n; ++j )
-            y[j] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
-                for( Int e=rowOffsets[i]; e<rowOffsets[i+1]; ++e )
-                    y[colIndices[e]] += alpha*Conj(values[e])*x[i];         
-        }
-        else
-        {
-            for( Int i=0; i<m; ++i )
-                for( Int e=rowOffsets[i]; e<rowOffsets[i+1]; ++e )
-                    y[colIndices[e]] += alpha*values[e]*x[i];         
-        }
-    }
+        if( p == 0 )
+            return Int(0);
+        if( p == numParts )
+            return m;
+        const Int target = firstOff + Int(numNonzeros*p/numParts);
+        return Int(std::lower_bound(rowOffsets,rowOffsets+m+1,target) - 
+                   rowOffsets);
+    };
+    rowBeg = Min(PartitionRow(part),m);
+    rowEnd = Min(PartitionRow(part+1),m);
 }
 
-template<typename T>
-void MultiplyCSR
-( Orientation orientation, Int m, Int n, Int numRHS,
+// Y[rowBeg:rowEnd,:] := alpha A[rowBeg:rowEnd,:] X + beta Y[rowBeg:rowEnd,:],
+// where entry (i,k) of Z (X or Y) is stored at Z[i*zRowStride+k*zColStride],
+// which covers both column-major and interleaved (row-major) storage.
+// If 'indirect' is true, the value of the e'th nonzero is
+// values[entryInds[e]], which allows for applying a subset of the entries of
+// a matrix without copying their values.
+template<typename T,bool indirect>
+void MultiplyCSRNormal
+( Int rowBeg, Int rowEnd, Int numRHS,
   T alpha,
-  const Int* rowOffsets,
-  const Int* colIndices,
-  const T*   values,
-  const T*   X, Int ldX,
+  const Int* EL_RESTRICT rowOffsets,
+  const Int* EL_RESTRICT colIndices,
+  const T*   EL_RESTRICT values,
+  const Int* EL_RESTRICT entryInds,
+  const T*   EL_RESTRICT X, Int xRowStride, Int xColStride,
   T beta,
-        T*   Y, Int ldY )
+        T*   EL_RESTRICT Y, Int yRowStride, Int yColStride )
 {
-    DEBUG_ONLY(CSE cse("MultiplyCSR"))
-    if( orientation == NORMAL )
-    {
-        for( Int i=0; i<m; ++i )
-        {
-            for( Int k=0; k<numRHS; ++k )
-            {
-                T sum = 0;
-                for( Int e=rowOffsets[i]; e<rowOffsets[i+1]; ++e )
-                    sum += values[e]*X[colIndices[e]+k*ldX];
-                Y[i+k*ldY] = alpha*sum + beta*Y[i+k*ldY];
-            }
-        }
-    }
-    else
+    T sums[rhsBlocksize];
+    for( Int i=rowBeg; i<rowEnd; ++i )
     {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int k=0; k<numRHS; ++k )
-            for( Int j=0; j<n; ++j )
-                Y[j+k*ldY] *= beta;
-        if( conj )
+        const Int eBeg = rowOffsets[i];
+        const Int eEnd = rowOffsets[i+1];
+        for( Int kBeg=0; kBeg<numRHS; kBeg+=rhsBlocksize )
         {
-            for( Int i=0; i<m; ++i )
+            const Int nb = Min(rhsBlocksize,numRHS-kBeg);
+            const T* XBlock = &X[kBeg*xColStride];
+                  T* YBlock = &Y[i*yRowStride+kBeg*yColStride];
+            if( nb == rhsBlocksize )
             {
-                for( Int e=rowOffsets[i]; e<rowOffsets[i+1]; ++e )
+                // Help the compiler keep the partial sums in registers
+                for( Int t=0; t<rhsBlocksize; ++t )
+                    sums[t] = 0;
+                for( Int e=eBeg; e<eEnd; ++e )
                 {
-                    T prod = alpha*Conj(values[e]);
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]+k*ldY] += prod*X[i+k*ldX];         
+                    const T value = values[indirect ? entryInds[e] : e];
+                    const T* xRow = &XBlock[colIndices[e]*xRowStride];
+                    for( Int t=0; t<rhsBlocksize; ++t )
+                        sums[t] += value*xRow[t*xColStride];
                 }
+                for( Int t=0; t<rhsBlocksize; ++t )
+                    YBlock[t*yColStride] = 
+                      alpha*sums[t] + beta*YBlock[t*yColStride];
             }
-        }
-        else
-        {
-            for( Int i=0; i<m; ++i )
+            else
             {
-                for( Int e=rowOffsets[i]; e<rowOffsets[i+1]; ++e )
+                for( Int t=0; t<nb; ++t )
+                    sums[t] = 0;
+                for( Int e=eBeg; e<eEnd; ++e )
                 {
-                    T prod = alpha*values[e];
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]+k*ldY] += prod*X[i+k*ldX];         
+                    const T value = values[indirect ? entryInds[e] : e];
+                    const T* xRow = &XBlock[colIndices[e]*xRowStride];
+                    for( Int t=0; t<nb; ++t )
+                        sums[t] += value*xRow[t*xColStride];
                 }
+                for( Int t=0; t<nb; ++t )
+                    YBlock[t*yColStride] = 
+                      alpha*sums[t] + beta*YBlock[t*yColStride];
             }
         }
     }
 }
 
-template<typename T>
-void MultiplyCSRInterX
+// Z += alpha A[rowBeg:rowEnd,:]^{T/H} X[rowBeg:rowEnd,:], with the same 
+// conventions as MultiplyCSRNormal
+template<typename T,bool indirect>
+void MultiplyCSRAdjoint
+( bool conjugate, Int rowBeg, Int rowEnd, Int numRHS,
+  T alpha,
+  const Int* EL_RESTRICT rowOffsets,
+  const Int* EL_RESTRICT colIndices,
+  const T*   EL_RESTRICT values,
+  const Int* EL_RESTRICT entryInds,
+  const T*   EL_RESTRICT X, Int xRowStride, Int xColStride,
+        T*   EL_RESTRICT Z, Int zRowStride, Int zColStride )
+{
+    for( Int i=rowBeg; i<rowEnd; ++i )
+    {
+        const T* xRow = &X[i*xRowStride];
+        for( Int e=rowOffsets[i]; e<rowOffsets[i+1]; ++e )
+        {
+            const T value = values[indirect ? entryInds[e] : e];
+            const T prod = alpha*( conjugate ? Conj(value) : value );
+            T* zRow = &Z[colIndices[e]*zRowStride];
+            for( Int k=0; k<numRHS; ++k )
+                zRow[k*zColStride] += prod*xRow[k*xColStride];
+        }
+    }
+}
+
+// Y := alpha A^{orientation} X + beta Y, where A is m x n. When Elemental is
+// built in hybrid mode, the rows of A are split into blocks containing equal
+// numbers of nonzeros, which are processed by separate threads. Products with
+// A^T or A^H are formed without write conflicts by having each thread 
+// accumulate into a private copy of Y, and the copies are then summed by
+// having each thread reduce a separate block of rows of Y. Since zeroing and
+// reducing the copies costs O(numThreads n) work per right-hand side, the 
+// number of threads used for such products is limited so that this does not
+// exceed the O(nnz) cost of the product itself.
+template<typename T,bool indirect>
+void MultiplyCSRImpl
 ( Orientation orientation, Int m, Int n, Int numRHS,
   T alpha,
   const Int* rowOffsets,
   const Int* colIndices,
   const T*   values,
-  const T*   X,
+  const Int* entryInds,
+  const T*   X, Int xRowStride, Int xColStride,
   T beta,
-        T*   Y, Int ldY )
+        T*   Y, Int yRowStride, Int yColStride )
 {
-    DEBUG_ONLY(CSE cse("MultiplyCSRInterX"))
+    DEBUG_ONLY(CSE cse("MultiplyCSR"))
+#ifdef EL_HYBRID
+    const Int numThreads = 
+      ( omp_in_parallel() ? 1 : Min(Int(omp_get_max_threads()),Max(m,1)) );
+#else
+    const Int numThreads = 1;
+#endif
     if( orientation == NORMAL )
     {
-        for( Int i=0; i<m; ++i )
+        if( numThreads == 1 )
         {
-            for( Int k=0; k<numRHS; ++k )
-            {
-                T sum = 0;
-                for( Int e=rowOffsets[i]; e<rowOffsets[i+1]; ++e )
-                    sum += values[e]*X[colIndices[e]*numRHS+k];
-                Y[i+k*ldY] = alpha*sum + beta*Y[i+k*ldY];
-            }
+            MultiplyCSRNormal<T,indirect>
+            ( 0, m, numRHS, 
+              alpha, rowOffsets, colIndices, values, entryInds,
+              X, xRowStride, xColStride,
+              beta, Y, yRowStride, yColStride );
+            return;
+        }
+#ifdef EL_HYBRID
+        #pragma omp parallel num_threads(numThreads)
+        {
+            // OpenMP may provide fewer threads than were requested
+            const Int numTeam = omp_get_num_threads();
+            Int rowBeg, rowEnd;
+            RowBlock
+            ( m, rowOffsets, numTeam, omp_get_thread_num(), 
+              rowBeg, rowEnd );
+            MultiplyCSRNormal<T,indirect>
+            ( rowBeg, rowEnd, numRHS, 
+              alpha, rowOffsets, colIndices, values, entryInds,
+              X, xRowStride, xColStride,
+              beta, Y, yRowStride, yColStride );
         }
+#endif
     }
     else
     {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int k=0; k<numRHS; ++k )
-            for( Int j=0; j<n; ++j )
-                Y[j+k*ldY] *= beta;
-        if( conj )
+        const bool conjugate = ( orientation == ADJOINT );
+        const Int numNonzeros = rowOffsets[m] - rowOffsets[0];
+        const Int numAccumThreads = 
+          Max( Min( numThreads, numNonzeros/Max(n,1) ), Int(1) );
+        if( numAccumThreads == 1 )
         {
-            for( Int i=0; i<m; ++i )
-            {
-                for( Int e=rowOffsets[i]; e<rowOffsets[i+1]; ++e )
-                {
-                    T prod = alpha*Conj(values[e]);
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]+k*ldY] += prod*X[i*numRHS+k];         
-                }
-            }
+            for( Int j=0; j<n; ++j )
+                for( Int k=0; k<numRHS; ++k )
+                    Y[j*yRowStride+k*yColStride] *= beta;
+            MultiplyCSRAdjoint<T,indirect>
+            ( conjugate, 0, m, numRHS, 
+              alpha, rowOffsets, colIndices, values, entryInds,
+              X, xRowStride, xColStride,
+              Y, yRowStride, yColStride );
+            return;
         }
-        else
+#ifdef EL_HYBRID
+        // Each private accumulator is stored in column-major order
+        vector<T> accum( numAccumThreads*n*numRHS );
+        #pragma omp parallel num_threads(numAccumThreads)
         {
-            for( Int i=0; i<m; ++i )
+            // OpenMP may provide fewer threads than were requested, so only
+            // the accumulators of the threads in the team are used
+            const Int numTeam = omp_get_num_threads();
+            const Int thread = omp_get_thread_num();
+            T* myAccum = &accum[thread*n*numRHS];
+            MemZero( myAccum, n*numRHS );
+            Int rowBeg, rowEnd;
+            RowBlock
+            ( m, rowOffsets, numTeam, thread, rowBeg, rowEnd );
+            MultiplyCSRAdjoint<T,indirect>
+            ( conjugate, rowBeg, rowEnd, numRHS, 
+              alpha, rowOffsets, colIndices, values, entryInds,
+              X, xRowStride, xColStride,
+              myAccum, 1, n );
+            #pragma omp barrier
+
+            const Int jBeg = (n*thread)/numTeam;
+            const Int jEnd = (n*(thread+1))/numTeam;
+            for( Int k=0; k<numRHS; ++k )
             {
-                for( Int e=rowOffsets[i]; e<rowOffsets[i+1]; ++e )
+                for( Int j=jBeg; j<jEnd; ++j )
                 {
-                    T prod = alpha*values[e];
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]+k*ldY] += prod*X[i*numRHS+k];         
+                    T sum = 0;
+                    for( Int t=0; t<numTeam; ++t )
+                        sum += accum[t*n*numRHS+j+k*n];
+                    T& y = Y[j*yRowStride+k*yColStride];
+                    y = beta*y + sum;
                 }
             }
         }
+#endif
     }
 }
 
 template<typename T>
-void MultiplyCSRInterY
+void MultiplyCSR
 ( Orientation orientation, Int m, Int n, Int numRHS,
   T alpha,
   const Int* rowOffsets,
   const Int* colIndices,
   const T*   values,
-  const T*   X, Int ldX,
+  const T*   X, Int xRowStride, Int xColStride,
   T beta,
-        T*   Y )
+        T*   Y, Int yRowStride, Int yColStride )
 {
-    DEBUG_ONLY(CSE cse("MultiplyCSRInterY"))
-    if( orientation == NORMAL )
-    {
-        for( Int i=0; i<m; ++i )
-        {
-            for( Int k=0; k<numRHS; ++k )
-            {
-                T sum = 0;
-                for( Int e=rowOffsets[i]; e<rowOffsets[i+1]; ++e )
-                    sum += values[e]*X[colIndices[e]+k*ldX];
-                Y[i*numRHS+k] = alpha*sum + beta*Y[i*numRHS+k];
-            }
-        }
-    }
-    else
-    {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int k=0; k<numRHS; ++k )
-            for( Int j=0; j<n; ++j )
-                Y[j*numRHS+k] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                for( Int e=rowOffsets[i]; e<rowOffsets[i+1]; ++e )
-                {
-                    T prod = alpha*Conj(values[e]);
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]*numRHS+k] += prod*X[i+k*ldX];         
-                }
-            }
-        }
-        else
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                for( Int e=rowOffsets[i]; e<rowOffsets[i+1]; ++e )
-                {
-                    T prod = alpha*values[e];
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]*numRHS+k] += prod*X[i+k*ldX];         
-                }
-            }
-        }
-    }
+    MultiplyCSRImpl<T,false>
+    ( orientation, m, n, numRHS, 
+      alpha, rowOffsets, colIndices, values, nullptr,
+             X, xRowStride, xColStride,
+      beta,  Y, yRowStride, yColStride );
 }
 
+// The same as above, but with the e'th nonzero having value 
+// values[entryInds[e]]
 template<typename T>
-void MultiplyCSRInter
+void MultiplyCSR
 ( Orientation orientation, Int m, Int n, Int numRHS,
   T alpha,
   const Int* rowOffsets,
   const Int* colIndices,
   const T*   values,
-  const T*   X,
+  const Int* entryInds,
+  const T*   X, Int xRowStride, Int xColStride,
   T beta,
-        T*   Y )
+        T*   Y, Int yRowStride, Int yColStride )
 {
-    DEBUG_ONLY(CSE cse("MultiplyCSRInter"))
-    if( orientation == NORMAL )
-    {
-        for( Int i=0; i<m; ++i )
-        {
-            for( Int k=0; k<numRHS; ++k )
-            {
-                T sum = 0;
-                for( Int e=rowOffsets[i]; e<rowOffsets[i+1]; ++e )
-                    sum += values[e]*X[colIndices[e]*numRHS+k];
-                Y[i*numRHS+k] = alpha*sum + beta*Y[i*numRHS+k];
-            }
-        }
-    }
-    else
-    {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int j=0; j<n; ++j )
-            for( Int k=0; k<numRHS; ++k )
-                Y[j*numRHS+k] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                for( Int e=rowOffsets[i]; e<rowOffsets[i+1]; ++e )
-                {
-                    T prod = alpha*Conj(values[e]);
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]*numRHS+k] += prod*X[i*numRHS+k];
-                }
-            }
-        }
-        else
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                for( Int e=rowOffsets[i]; e<rowOffsets[i+1]; ++e )
-                {
-                    T prod = alpha*values[e];
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]*numRHS+k] += prod*X[i*numRHS+k]; 
-                }
-            }
-        }
-    }
+    MultiplyCSRImpl<T,true>
+    ( orientation, m, n, numRHS, 
+      alpha, rowOffsets, colIndices, values, entryInds,
+             X, xRowStride, xColStride,
+      beta,  Y, yRowStride, yColStride );
 }
 
 } // anonymous namespace
@@ -309,8 +303,8 @@ void Multiply
       alpha, A.LockedOffsetBuffer(), 
              A.LockedTargetBuffer(), 
              A.LockedValueBuffer(),
-             X.LockedBuffer(), X.LDim(),
-      beta,  Y.Buffer(),       Y.LDim() );
+             X.LockedBuffer(), 1, X.LDim(),
+      beta,  Y.Buffer(),       1, Y.LDim() );
 }
 
 template<typename T>
@@ -329,7 +323,7 @@ void Multiply
     )
     mpi::Comm comm = A.Comm();
     const int commSize = mpi::Size( comm );
-    // TODO: Use sequential implementation if commSize = 1?
+    const int commRank = mpi::Rank( comm );
 
     // Y := beta Y
     Scale( beta, Y );
@@ -351,6 +345,14 @@ void Multiply
         sendOffs[q] *= b;
     }
 
+    // The local nonzeros of A are split into a block which only touches
+    // locally-owned rows of the vector and a block which requires
+    // communication, so that the former can be applied while the halo 
+    // exchange is in flight. Messages to ourselves are skipped, as they are
+    // covered by the local block.
+    vector<mpi::Request> requests;
+    requests.reserve( 2*(commSize-1) );
+
     if( orientation == NORMAL )
     {
         if( A.Height() != Y.Height() )
@@ -372,20 +374,51 @@ void Multiply
                 sendVals[s*b+t] = XBuffer[iLoc+t*ldX];
         }
 
-        // Now send them
+        // Start sending them
         vector<T> recvVals( meta.numRecvInds*b );
-        mpi::AllToAll
-        ( sendVals.data(), sendSizes.data(), sendOffs.data(),
-          recvVals.data(), recvSizes.data(), recvOffs.data(), comm );
-     
-        // Perform the local multiply-accumulate, y := alpha A x + y
-        MultiplyCSRInterX
-        ( NORMAL, A.LocalHeight(), A.Width(), X.Width(),
-          alpha, A.LockedOffsetBuffer(), 
-                 meta.colOffs.data(),
+        for( int q=0; q<commSize; ++q )
+        {
+            if( q == commRank )
+                continue;
+            if( recvSizes[q] > 0 )
+            {
+                requests.emplace_back();
+                mpi::IRecv
+                ( &recvVals[recvOffs[q]], recvSizes[q], q, comm, 
+                  requests.back() );
+            }
+            if( sendSizes[q] > 0 )
+            {
+                requests.emplace_back();
+                mpi::ISend
+                ( &sendVals[sendOffs[q]], sendSizes[q], q, comm, 
+                  requests.back() );
+            }
+        }
+
+        // Apply the local block while the messages are in flight
+        T* YBuffer = Y.Matrix().Buffer();
+        const Int ldY = Y.Matrix().LDim();
+        MultiplyCSR
+        ( NORMAL, A.LocalHeight(), X.LocalHeight(), b,
+          alpha, meta.localRowOffs.data(),
+                 meta.localCols.data(),
+                 A.LockedValueBuffer(),
+                 meta.localEntries.data(),
+                 XBuffer, 1, ldX,
+          T(1),  YBuffer, 1, ldY );
+
+        // Finish the exchange and apply the remote block
+        if( requests.size() > 0 )
+            mpi::WaitAll( requests.size(), requests.data() );
+        MultiplyCSR
+        ( NORMAL, A.LocalHeight(), meta.numRecvInds, b,
+          alpha, meta.remoteRowOffs.data(),
+                 meta.remoteColOffs.data(),
                  A.LockedValueBuffer(),
-                 recvVals.data(), 
-          T(1),  Y.Matrix().Buffer(), Y.Matrix().LDim() );
+                 meta.remoteEntries.data(),
+                 recvVals.data(), b, 1,
+          T(1),  YBuffer, 1, ldY );
     }
     else
     {
@@ -394,33 +427,71 @@ void Multiply
         if( A.Height() != X.Height() )
             LogicError("The height of A must match the height of X");
 
-        // Form and pack the updates to Y
+        // Form and pack the updates to the remote rows of Y
+        const T* XBuffer = X.LockedMatrix().LockedBuffer();
+        const Int ldX = X.LockedMatrix().LDim();
         vector<T> sendVals( meta.numRecvInds*b, 0 );
-        MultiplyCSRInterY
-        ( orientation, A.LocalHeight(), A.Width(), X.Width(),
-          alpha, A.LockedOffsetBuffer(),
-                 meta.colOffs.data(),
+        MultiplyCSR
+        ( orientation, A.LocalHeight(), meta.numRecvInds, b,
+          alpha, meta.remoteRowOffs.data(),
+                 meta.remoteColOffs.data(),
                  A.LockedValueBuffer(),
-                 X.LockedMatrix().LockedBuffer(), X.LockedMatrix().LDim(),
-          T(1),  sendVals.data() );
+                 meta.remoteEntries.data(),
+                 XBuffer, 1, ldX,
+          T(1),  sendVals.data(), b, 1 );
 
-        // Inject the updates to Y into the network
+        // Start injecting the updates to Y into the network
         const Int numRecvInds = meta.sendInds.size();
         vector<T> recvVals( numRecvInds*b );
-        mpi::AllToAll
-        ( sendVals.data(), recvSizes.data(), recvOffs.data(),
-          recvVals.data(), sendSizes.data(), sendOffs.data(), comm );
-     
-        // Accumulate the received indices onto Y
-        const Int firstLocalRow = Y.FirstLocalRow();
+        for( int q=0; q<commSize; ++q )
+        {
+            if( q == commRank )
+                continue;
+            if( sendSizes[q] > 0 )
+            {
+                requests.emplace_back();
+                mpi::IRecv
+                ( &recvVals[sendOffs[q]], sendSizes[q], q, comm, 
+                  requests.back() );
+            }
+            if( recvSizes[q] > 0 )
+            {
+                requests.emplace_back();
+                mpi::ISend
+                ( &sendVals[recvOffs[q]], recvSizes[q], q, comm, 
+                  requests.back() );
+            }
+        }
+
+        // Apply the local block while the messages are in flight
         T* YBuffer = Y.Matrix().Buffer(); 
         const Int ldY = Y.Matrix().LDim();
-        for( Int s=0; s<numRecvInds; ++s )
+        MultiplyCSR
+        ( orientation, A.LocalHeight(), Y.LocalHeight(), b,
+          alpha, meta.localRowOffs.data(),
+                 meta.localCols.data(),
+                 A.LockedValueBuffer(),
+                 meta.localEntries.data(),
+                 XBuffer, 1, ldX,
+          T(1),  YBuffer, 1, ldY );
+     
+        // Finish the exchange and accumulate the received updates onto Y
+        if( requests.size() > 0 )
+            mpi::WaitAll( requests.size(), requests.data() );
+        const Int firstLocalRow = Y.FirstLocalRow();
+        for( int q=0; q<commSize; ++q )
         {
-            const Int i = meta.sendInds[s];
-            const Int iLoc = i - firstLocalRow;
-            for( Int t=0; t<b; ++t )
-                YBuffer[iLoc+t*ldY] += recvVals[s*b+t];
+            if( q == commRank )
+                continue;
+            const Int sBeg = meta.sendOffs[q];
+            const Int sEnd = sBeg + meta.sendSizes[q];
+            for( Int s=sBeg; s<sEnd; ++s )
+            {
+                const Int i = meta.sendInds[s];
+                const Int iLoc = i - firstLocalRow;
+                for( Int t=0; t<b; ++t )
+                    YBuffer[iLoc+t*ldY] += recvVals[s*b+t];
+            }
         }
     }
 }
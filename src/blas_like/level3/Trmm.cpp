@@ -16,6 +16,7 @@
 #include "./Trmm/RLT.hpp"
 #include "./Trmm/RUN.hpp"
 #include "./Trmm/RUT.hpp"
+#include "./Trmm/Tiled.hpp"
 
 namespace El {
 
@@ -49,6 +50,24 @@ void Trmm
       alpha, A.LockedBuffer(), A.LDim(), B.Buffer(), B.LDim() );
 }
 
+template<typename T>
+void Trmm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  T alpha, const TileMatrix<T>& A, TileMatrix<T>& B )
+{
+    DEBUG_ONLY(
+      CSE cse("Trmm");
+      if( A.Height() != A.Width() )
+          LogicError("Triangular matrix must be square");
+      if( A.Height() != (side==LEFT ? B.Height() : B.Width()) )
+          LogicError("Nonconformal Trmm");
+      if( A.TileSize() != B.TileSize() )
+          LogicError("A and B must have the same tile size");
+    )
+    trmm::Tiled( side, uplo, orientation, diag, alpha, A, B );
+}
+
 template<typename T>
 void Trmm
 ( LeftOrRight side, UpperOrLower uplo, 
@@ -113,6 +132,10 @@ void LocalTrmm
   ( LeftOrRight side, UpperOrLower uplo, \
     Orientation orientation, UnitOrNonUnit diag, \
     T alpha, const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B ); \
+  template void Trmm \
+  ( LeftOrRight side, UpperOrLower uplo, \
+    Orientation orientation, UnitOrNonUnit diag, \
+    T alpha, const TileMatrix<T>& A, TileMatrix<T>& B ); \
   template void LocalTrmm \
   ( LeftOrRight side, UpperOrLower uplo, \
     Orientation orientation, UnitOrNonUnit diag, \
@@ -0,0 +1,78 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace trmm {
+
+// Tile Trmm executed as a DAG of tile kernels: each block row (or column) of
+// the product is formed in place from the diagonal tile and the blocks of X
+// which have not yet been overwritten, so that the blocks are visited
+// backwards when op(A) is lower-triangular (upper-triangular) for the left
+// (right) side, and forwards otherwise.
+template<typename T>
+inline void
+Tiled
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  T alpha, const TileMatrix<T>& A, TileMatrix<T>& X )
+{
+    DEBUG_ONLY(CSE cse("trmm::Tiled"))
+    const Int nt = A.TileRows();
+    const bool onLeft = ( side == LEFT );
+    const bool opLower = ( (uplo==LOWER) == (orientation==NORMAL) );
+    const bool forward = ( onLeft != opLower );
+    const Orientation aOrient = orientation;
+    const Int numOther = ( onLeft ? X.TileCols() : X.TileRows() );
+
+    // op(A)_{i,k} is stored in A_{i,k} or A_{k,i}
+    auto opTile = [&]( Int i, Int k ) -> const Matrix<T>&
+      { return orientation==NORMAL ? A.Tile(i,k) : A.Tile(k,i); };
+    auto XTile = [&]( Int k, Int r ) -> Matrix<T>&
+      { return onLeft ? X.Tile(k,r) : X.Tile(r,k); };
+
+    TaskGraph graph;
+    for( Int s=0; s<nt; ++s )
+    {
+        const Int k = ( forward ? s : nt-1-s );
+        const Matrix<T>& A11 = A.Tile(k,k);
+        for( Int r=0; r<numOther; ++r )
+        {
+            Matrix<T>& X1 = XTile(k,r);
+            graph.Insert
+            ( [=,&A11,&X1]()
+              { Trmm( side, uplo, orientation, diag, alpha, A11, X1 ); },
+              {&A11}, {&X1} );
+            for( Int t=s+1; t<nt; ++t )
+            {
+                const Int i = ( forward ? t : nt-1-t );
+                const Matrix<T>& X2 = XTile(i,r);
+                if( onLeft )
+                {
+                    const Matrix<T>& A12 = opTile(k,i);
+                    graph.Insert
+                    ( [=,&A12,&X1,&X2]()
+                      { Gemm( aOrient, NORMAL, alpha, A12, X2, T(1), X1 ); },
+                      {&A12,&X2}, {&X1} );
+                }
+                else
+                {
+                    const Matrix<T>& A21 = opTile(i,k);
+                    graph.Insert
+                    ( [=,&A21,&X1,&X2]()
+                      { Gemm( NORMAL, aOrient, alpha, X2, A21, T(1), X1 ); },
+                      {&A21,&X2}, {&X1} );
+                }
+            }
+        }
+    }
+    graph.Run();
+}
+
+} // namespace trmm
+} // namespace El
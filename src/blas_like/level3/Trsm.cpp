@@ -16,6 +16,7 @@
 #include "./Trsm/RLT.hpp"
 #include "./Trsm/RUN.hpp"
 #include "./Trsm/RUT.hpp"
+#include "./Trsm/Tiled.hpp"
 
 namespace El {
 
@@ -55,6 +56,26 @@ void Trsm
     blas::Trsm
     ( sideChar, uploChar, transChar, diagChar, B.Height(), B.Width(),
       alpha, A.LockedBuffer(), A.LDim(), B.Buffer(), B.LDim() );
+    AddProfileFlops
+    ( (IsComplex<F>::val ? 4. : 1.)*A.Height()*B.Height()*B.Width() );
+}
+
+template<typename F>
+void Trsm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  F alpha, const TileMatrix<F>& A, TileMatrix<F>& B )
+{
+    DEBUG_ONLY(
+      CSE cse("Trsm");
+      if( A.Height() != A.Width() )
+          LogicError("Triangular matrix must be square");
+      if( A.Height() != (side==LEFT ? B.Height() : B.Width()) )
+          LogicError("Nonconformal Trsm");
+      if( A.TileSize() != B.TileSize() )
+          LogicError("A and B must have the same tile size");
+    )
+    trsm::Tiled( side, uplo, orientation, diag, alpha, A, B );
 }
 
 // TODO: Make the TRSM_DEFAULT switching mechanism smarter (perhaps, empirical)
@@ -81,6 +102,7 @@ void Trsm
               LogicError("Nonconformal Trsm");
       }
     )
+    ProfileRegion profile("Trsm");
     Scale( alpha, B );
 
     // Call the single right-hand side algorithm if appropriate
@@ -364,6 +386,10 @@ void LocalTrsm
     Orientation orientation, UnitOrNonUnit diag, \
     F alpha, const AbstractDistMatrix<F>& A, AbstractDistMatrix<F>& B, \
     bool checkIfSingular, TrsmAlgorithm alg ); \
+  template void Trsm \
+  ( LeftOrRight side, UpperOrLower uplo, \
+    Orientation orientation, UnitOrNonUnit diag, \
+    F alpha, const TileMatrix<F>& A, TileMatrix<F>& B ); \
   template void LocalTrsm \
   ( LeftOrRight side, UpperOrLower uplo, \
     Orientation orientation, UnitOrNonUnit diag, \
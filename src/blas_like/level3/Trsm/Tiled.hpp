@@ -0,0 +1,84 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace trsm {
+
+// Tile Trsm executed as a DAG of tile kernels: each block row (or column) of
+// X is solved for once all of the updates from the previously solved ones
+// have been applied, where the blocks are visited forwards when op(A) is
+// lower-triangular (upper-triangular) for the left (right) side, and
+// backwards otherwise. The scaling by alpha is folded into the first kernel
+// which modifies each tile of X.
+template<typename F>
+inline void
+Tiled
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  F alpha, const TileMatrix<F>& A, TileMatrix<F>& X )
+{
+    DEBUG_ONLY(CSE cse("trsm::Tiled"))
+    const Int nt = A.TileRows();
+    const bool onLeft = ( side == LEFT );
+    const bool opLower = ( (uplo==LOWER) == (orientation==NORMAL) );
+    const bool forward = ( onLeft == opLower );
+    const Orientation aOrient = orientation;
+    const Int numOther = ( onLeft ? X.TileCols() : X.TileRows() );
+
+    // op(A)_{i,k} is stored in A_{i,k} or A_{k,i}
+    auto opTile = [&]( Int i, Int k ) -> const Matrix<F>&
+      { return orientation==NORMAL ? A.Tile(i,k) : A.Tile(k,i); };
+    auto XTile = [&]( Int k, Int r ) -> Matrix<F>&
+      { return onLeft ? X.Tile(k,r) : X.Tile(r,k); };
+
+    TaskGraph graph;
+    for( Int s=0; s<nt; ++s )
+    {
+        const Int k = ( forward ? s : nt-1-s );
+        const F scale = ( s==0 ? alpha : F(1) );
+        const Matrix<F>& A11 = A.Tile(k,k);
+        for( Int r=0; r<numOther; ++r )
+        {
+            Matrix<F>& X1 = XTile(k,r);
+            graph.Insert
+            ( [=,&A11,&X1]()
+              { Trsm( side, uplo, orientation, diag, scale, A11, X1 ); },
+              {&A11}, {&X1}, -s );
+        }
+        for( Int t=s+1; t<nt; ++t )
+        {
+            const Int i = ( forward ? t : nt-1-t );
+            for( Int r=0; r<numOther; ++r )
+            {
+                const Matrix<F>& X1 = XTile(k,r);
+                Matrix<F>& X2 = XTile(i,r);
+                if( onLeft )
+                {
+                    const Matrix<F>& A21 = opTile(i,k);
+                    graph.Insert
+                    ( [=,&A21,&X1,&X2]()
+                      { Gemm( aOrient, NORMAL, F(-1), A21, X1, scale, X2 ); },
+                      {&A21,&X1}, {&X2}, -t );
+                }
+                else
+                {
+                    const Matrix<F>& A12 = opTile(k,i);
+                    graph.Insert
+                    ( [=,&A12,&X1,&X2]()
+                      { Gemm( NORMAL, aOrient, F(-1), X1, A12, scale, X2 ); },
+                      {&A12,&X1}, {&X2}, -t );
+                }
+            }
+        }
+    }
+    graph.Run();
+}
+
+} // namespace trsm
+} // namespace El
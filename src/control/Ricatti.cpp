@@ -10,12 +10,368 @@
 
 namespace El {
 
+// The Hamiltonian matrix W = | A^H  L | satisfies W = -J H, where 
+//                            | K   -A |
+//
+//   J = |  0 I |  and  H = J W = |  K,   -A |
+//       | -I 0 |                 | -A^H, -L |
+//
+// is Hermitian. Since inv(W) = inv(H) J, each Newton iterate remains 
+// Hamiltonian, and the iteration can be carried out on the Hermitian matrix
+//
+//   H := (mu H + J inv(H) J / mu) / 2,
+//
+// which only requires a symmetric-indefinite (LDL^H) inversion rather than
+// an LU-based inversion of W. The Newton-Schulz phase instead uses
+//
+//   H := H (3 I - W^2) / 2,  where W^2 = J (H J) H.
+//
+// See Byers' "Solving the algebraic Riccati equation with the matrix sign 
+// function" and Section 5.1 of Higham's "Functions of Matrices".
+
+namespace ricatti {
+
+// B := J A
+template<typename F>
+inline void
+ApplyJLeft( const Matrix<F>& A, Matrix<F>& B )
+{
+    DEBUG_ONLY(CSE cse("ricatti::ApplyJLeft"))
+    const Int n = A.Height()/2;
+    const Int N = A.Width();
+    B.Resize( 2*n, N );
+    auto AT = A( IR(0,n),   IR(0,N) );
+    auto AB = A( IR(n,2*n), IR(0,N) );
+    auto BT = B( IR(0,n),   IR(0,N) );
+    auto BB = B( IR(n,2*n), IR(0,N) );
+    BT = AB;
+    BB = AT; Scale( F(-1), BB );
+}
+
+template<typename F>
+inline void
+ApplyJLeft( const DistMatrix<F>& A, DistMatrix<F>& B )
+{
+    DEBUG_ONLY(CSE cse("ricatti::ApplyJLeft"))
+    const Int n = A.Height()/2;
+    const Int N = A.Width();
+    B.Resize( 2*n, N );
+    auto AT = A( IR(0,n),   IR(0,N) );
+    auto AB = A( IR(n,2*n), IR(0,N) );
+    auto BT = B( IR(0,n),   IR(0,N) );
+    auto BB = B( IR(n,2*n), IR(0,N) );
+    BT = AB;
+    BB = AT; Scale( F(-1), BB );
+}
+
+// B := A J
+template<typename F>
+inline void
+ApplyJRight( const Matrix<F>& A, Matrix<F>& B )
+{
+    DEBUG_ONLY(CSE cse("ricatti::ApplyJRight"))
+    const Int N = A.Height();
+    const Int n = A.Width()/2;
+    B.Resize( N, 2*n );
+    auto AL = A( IR(0,N), IR(0,n)   );
+    auto AR = A( IR(0,N), IR(n,2*n) );
+    auto BL = B( IR(0,N), IR(0,n)   );
+    auto BR = B( IR(0,N), IR(n,2*n) );
+    BL = AR; Scale( F(-1), BL );
+    BR = AL;
+}
+
+template<typename F>
+inline void
+ApplyJRight( const DistMatrix<F>& A, DistMatrix<F>& B )
+{
+    DEBUG_ONLY(CSE cse("ricatti::ApplyJRight"))
+    const Int N = A.Height();
+    const Int n = A.Width()/2;
+    B.Resize( N, 2*n );
+    auto AL = A( IR(0,N), IR(0,n)   );
+    auto AR = A( IR(0,N), IR(n,2*n) );
+    auto BL = B( IR(0,N), IR(0,n)   );
+    auto BR = B( IR(0,N), IR(n,2*n) );
+    BL = AR; Scale( F(-1), BL );
+    BR = AL;
+}
+
+// Return log |det D| for the block-diagonal factor D of an LDL^H
+// factorization, with diagonal d and subdiagonal dSub (whose nonzeros mark
+// the 2x2 pivots). Since L is unit lower-triangular and the permutation is
+// orthogonal, this is also log |det H|.
+template<typename F>
+inline Base<F>
+LogAbsDetD( const Matrix<Base<F>>& d, const Matrix<F>& dSub )
+{
+    DEBUG_ONLY(CSE cse("ricatti::LogAbsDetD"))
+    typedef Base<F> Real;
+    const Int n = d.Height();
+    Real logDet = 0;
+    Int k=0;
+    while( k < n )
+    {
+        if( k < n-1 && dSub.Get(k,0) != F(0) )
+        {
+            const Real beta = Abs(dSub.Get(k,0));
+            logDet += Log(Abs(d.Get(k,0)*d.Get(k+1,0)-beta*beta));
+            k += 2;
+        }
+        else
+        {
+            logDet += Log(Abs(d.Get(k,0)));
+            ++k;
+        }
+    }
+    return logDet;
+}
+
+// HNew := (mu H + J inv(H) J / mu) / 2, where inv(H) is formed from a single
+// LDL^H factorization, whose D factor also provides |det H| when mu is chosen
+// by determinantal scaling
+template<typename F>
+inline void
+NewtonStep
+( const Matrix<F>& H, Matrix<F>& HNew, Matrix<F>& HTmp, SignScaling scaling )
+{
+    DEBUG_ONLY(CSE cse("ricatti::NewtonStep"))
+    typedef Base<F> Real;
+    const Int n = H.Height();
+
+    HTmp = H;
+    Matrix<Int> p;
+    Matrix<F> dSub;
+    LDL( HTmp, dSub, p, true );
+    Real mu=1;
+    if( scaling == SIGN_SCALE_DET && n > 0 )
+        mu = Exp( -LogAbsDetD( GetRealPartOfDiagonal(HTmp), dSub )/n );
+
+    // Overwrite HTmp with inv(H) (as in HermitianInverse)
+    TriangularInverse( LOWER, UNIT, HTmp );
+    Trdtrmm( LOWER, HTmp, dSub, true );
+    Matrix<Int> pInv;
+    InvertPermutation( p, pInv );
+    MakeHermitian( LOWER, HTmp );
+    PermuteRows( HTmp, pInv, p );
+    PermuteCols( HTmp, pInv, p );
+    if( scaling == SIGN_SCALE_FROB )
+        mu = Sqrt( FrobeniusNorm(HTmp)/FrobeniusNorm(H) );
+
+    // Overwrite HNew with the new iterate
+    ApplyJLeft( HTmp, HNew );
+    ApplyJRight( HNew, HTmp );
+    HNew = H;
+    Scale( mu/Real(2), HNew );
+    Axpy( Real(1)/(2*mu), HTmp, HNew );
+}
+
+template<typename F>
+inline void
+NewtonStep
+( const DistMatrix<F>& H, DistMatrix<F>& HNew, DistMatrix<F>& HTmp, 
+  SignScaling scaling )
+{
+    DEBUG_ONLY(CSE cse("ricatti::NewtonStep"))
+    typedef Base<F> Real;
+    const Grid& g = H.Grid();
+    const Int n = H.Height();
+
+    HTmp = H;
+    DistMatrix<Int,VC,STAR> p(g);
+    DistMatrix<F,MD,STAR> dSub(g);
+    LDL( HTmp, dSub, p, true );
+    Real mu=1;
+    if( scaling == SIGN_SCALE_DET && n > 0 )
+    {
+        DistMatrix<Real,STAR,STAR> d_STAR_STAR( GetRealPartOfDiagonal(HTmp) );
+        DistMatrix<F,STAR,STAR> dSub_STAR_STAR( dSub );
+        mu = Exp
+          ( -LogAbsDetD( d_STAR_STAR.Matrix(), dSub_STAR_STAR.Matrix() )/n );
+    }
+
+    // Overwrite HTmp with inv(H) (as in HermitianInverse)
+    TriangularInverse( LOWER, UNIT, HTmp );
+    Trdtrmm( LOWER, HTmp, dSub, true );
+    DistMatrix<Int,VC,STAR> pInv(g);
+    InvertPermutation( p, pInv );
+    MakeHermitian( LOWER, HTmp );
+    PermuteRows( HTmp, pInv, p );
+    PermuteCols( HTmp, pInv, p );
+    if( scaling == SIGN_SCALE_FROB )
+        mu = Sqrt( FrobeniusNorm(HTmp)/FrobeniusNorm(H) );
+
+    // Overwrite HNew with the new iterate
+    ApplyJLeft( HTmp, HNew );
+    ApplyJRight( HNew, HTmp );
+    HNew = H;
+    Scale( mu/Real(2), HNew );
+    Axpy( Real(1)/(2*mu), HTmp, HNew );
+}
+
+// HTmp := 3I - W^2, returning || I - W^2 ||_1
+template<typename F>
+inline Base<F>
+NewtonSchulzSquare( const Matrix<F>& H, Matrix<F>& HTmp )
+{
+    DEBUG_ONLY(CSE cse("ricatti::NewtonSchulzSquare"))
+    Matrix<F> T, U;
+    ApplyJRight( H, T );
+    Gemm( NORMAL, NORMAL, F(-1), T, H, U );
+    ApplyJLeft( U, HTmp );
+
+    ShiftDiagonal( HTmp, F(1) );
+    const Base<F> residual = OneNorm( HTmp );
+    ShiftDiagonal( HTmp, F(2) );
+    return residual;
+}
+
+template<typename F>
+inline Base<F>
+NewtonSchulzSquare( const DistMatrix<F>& H, DistMatrix<F>& HTmp )
+{
+    DEBUG_ONLY(CSE cse("ricatti::NewtonSchulzSquare"))
+    DistMatrix<F> T( H.Grid() ), U( H.Grid() );
+    ApplyJRight( H, T );
+    Gemm( NORMAL, NORMAL, F(-1), T, H, U );
+    ApplyJLeft( U, HTmp );
+
+    ShiftDiagonal( HTmp, F(1) );
+    const Base<F> residual = OneNorm( HTmp );
+    ShiftDiagonal( HTmp, F(2) );
+    return residual;
+}
+
+// Overwrite W with sgn(W) using the method requested by ctrl
+template<typename F>
+inline void
+Sign( Matrix<F>& W, const SignCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("ricatti::Sign"))
+    typedef Base<F> Real;
+    // The rational Zolotarev iteration does not preserve the Hamiltonian 
+    // structure in the above form, so fall back to the general routine
+    if( ctrl.method == SIGN_ZOLOTAREV )
+    {
+        El::Sign( W, ctrl );
+        return;
+    }
+
+    Real tol = ctrl.tol;
+    if( tol == Real(0) )
+        tol = W.Height()*Epsilon<Real>();
+
+    Int numIts=0;
+    bool schulz=false;
+    Matrix<F> H, B, HTmp;
+    ApplyJLeft( W, H );
+    Matrix<F> *X=&H, *XNew=&B;
+    while( numIts < ctrl.maxIts )
+    {
+        // Overwrite XNew with the new iterate
+        const bool schulzStep = schulz;
+        if( schulzStep )
+            Gemm( NORMAL, NORMAL, F(1)/F(2), *X, HTmp, *XNew );
+        else
+            NewtonStep( *X, *XNew, HTmp, ctrl.scaling );
+
+        // Use the difference in the iterates to test for convergence
+        // (multiplication by J does not change the one norm)
+        Axpy( Real(-1), *XNew, *X );
+        const Real oneDiff = OneNorm( *X );
+        const Real oneNew = OneNorm( *XNew );
+
+        // Ensure that X holds the current iterate and break if possible
+        ++numIts;
+        std::swap( X, XNew );
+        if( ctrl.progress )
+            cout << "after " << numIts << " " 
+                 << ( schulzStep ? "Newton-Schulz" : "Newton" )
+                 << " iter's: oneDiff=" << oneDiff << ", oneNew=" << oneNew 
+                 << ", oneDiff/oneNew=" << oneDiff/oneNew << ", tol=" 
+                 << tol << endl;
+        if( oneDiff/oneNew <= Pow(oneNew,ctrl.power)*tol )
+            break;
+
+        if( ctrl.method == SIGN_NEWTON_SCHULZ &&
+            (schulz || 2*oneNew*oneDiff <= ctrl.newtonSchulzTol) )
+            schulz = ( NewtonSchulzSquare( *X, HTmp ) <= ctrl.newtonSchulzTol );
+    }
+
+    // W := -J H
+    ApplyJLeft( *X, W );
+    Scale( F(-1), W );
+}
+
+template<typename F>
+inline void
+Sign( DistMatrix<F>& W, const SignCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("ricatti::Sign"))
+    typedef Base<F> Real;
+    // The rational Zolotarev iteration does not preserve the Hamiltonian 
+    // structure in the above form, so fall back to the general routine
+    if( ctrl.method == SIGN_ZOLOTAREV )
+    {
+        El::Sign( W, ctrl );
+        return;
+    }
+
+    Real tol = ctrl.tol;
+    if( tol == Real(0) )
+        tol = W.Height()*Epsilon<Real>();
+
+    const Grid& g = W.Grid();
+    Int numIts=0;
+    bool schulz=false;
+    DistMatrix<F> H(g), B(g), HTmp(g);
+    ApplyJLeft( W, H );
+    DistMatrix<F> *X=&H, *XNew=&B;
+    while( numIts < ctrl.maxIts )
+    {
+        // Overwrite XNew with the new iterate
+        const bool schulzStep = schulz;
+        if( schulzStep )
+            Gemm( NORMAL, NORMAL, F(1)/F(2), *X, HTmp, *XNew );
+        else
+            NewtonStep( *X, *XNew, HTmp, ctrl.scaling );
+
+        // Use the difference in the iterates to test for convergence
+        // (multiplication by J does not change the one norm)
+        Axpy( Real(-1), *XNew, *X );
+        const Real oneDiff = OneNorm( *X );
+        const Real oneNew = OneNorm( *XNew );
+
+        // Ensure that X holds the current iterate and break if possible
+        ++numIts;
+        std::swap( X, XNew );
+        if( ctrl.progress && g.Rank() == 0 )
+            cout << "after " << numIts << " " 
+                 << ( schulzStep ? "Newton-Schulz" : "Newton" )
+                 << " iter's: oneDiff=" << oneDiff << ", oneNew=" << oneNew 
+                 << ", oneDiff/oneNew=" << oneDiff/oneNew << ", tol=" 
+                 << tol << endl;
+        if( oneDiff/oneNew <= Pow(oneNew,ctrl.power)*tol )
+            break;
+
+        if( ctrl.method == SIGN_NEWTON_SCHULZ &&
+            (schulz || 2*oneNew*oneDiff <= ctrl.newtonSchulzTol) )
+            schulz = ( NewtonSchulzSquare( *X, HTmp ) <= ctrl.newtonSchulzTol );
+    }
+
+    // W := -J H
+    ApplyJLeft( *X, W );
+    Scale( F(-1), W );
+}
+
+} // namespace ricatti
+
 // W = | A^H  L |, where K and L are Hermitian.
 //     | K   -A |
 //
 // The solution, X, to the equation
 //   X K X - A^H X - X A = L
-// is returned, as well as the number of Newton iterations for computing sgn(W).
+// is returned, where sgn(W) is computed by the structured iteration above.
 //
 // See Chapter 2 of Nicholas J. Higham's "Functions of Matrices"
 
@@ -23,7 +379,7 @@ template<typename F>
 void Ricatti( Matrix<F>& W, Matrix<F>& X, SignCtrl<Base<F>> ctrl )
 {
     DEBUG_ONLY(CSE cse("Ricatti"))
-    Sign( W, ctrl );
+    ricatti::Sign( W, ctrl );
     const Int n = W.Height()/2;
     Matrix<F> WTL, WTR,
               WBL, WBR;
@@ -52,7 +408,7 @@ void Ricatti
     auto& W = *WPtr;
 
     const Grid& g = W.Grid();
-    Sign( W, ctrl );
+    ricatti::Sign( W, ctrl );
     const Int n = W.Height()/2;
     DistMatrix<F> WTL(g), WTR(g),
                   WBL(g), WBR(g);
@@ -10,12 +10,533 @@
 
 namespace El {
 
+// Since W = | A -C | is block upper-triangular, so is every iterate of the
+//           | 0 -B |
+// matrix sign function, X = | P Q |, and inv(X) = | inv(P), -inv(P) Q inv(R) |.
+//                           | 0 R |              | 0,      inv(R)          |
+// The iterations below therefore only invert (or factor) the diagonal blocks 
+// and update Q with products against them, which avoids the (m+n)^3 work of
+// treating W as a general matrix. This is the coupled iteration from Benner, 
+// Quintana-Orti, and Quintana-Orti's "Solving Stable Sylvester Equations via 
+// Rational Iterative Schemes".
+
+namespace sylvester {
+
+// WInv := inv(W), returning log(|det(W)|)/(m+n)
+template<typename F>
+inline Base<F>
+Invert( Int m, const Matrix<F>& W, Matrix<F>& WInv )
+{
+    DEBUG_ONLY(CSE cse("sylvester::Invert"))
+    typedef Base<F> Real;
+    const Int N = W.Height();
+    auto P = W( IR(0,m), IR(0,m) );
+    auto Q = W( IR(0,m), IR(m,N) );
+    auto R = W( IR(m,N), IR(m,N) );
+
+    Zeros( WInv, N, N );
+    auto PInv = WInv( IR(0,m), IR(0,m) );
+    auto QInv = WInv( IR(0,m), IR(m,N) );
+    auto RInv = WInv( IR(m,N), IR(m,N) );
+
+    Real kappa = 0;
+    Matrix<Int> p;
+    PInv = P;
+    LU( PInv, p );
+    if( m > 0 )
+        kappa += m*det::AfterLUPartialPiv( PInv, p ).kappa;
+    inverse::AfterLUPartialPiv( PInv, p );
+    RInv = R;
+    LU( RInv, p );
+    if( N > m )
+        kappa += (N-m)*det::AfterLUPartialPiv( RInv, p ).kappa;
+    inverse::AfterLUPartialPiv( RInv, p );
+
+    Matrix<F> T;
+    Gemm( NORMAL, NORMAL, F(1), PInv, Q, T );
+    Gemm( NORMAL, NORMAL, F(-1), T, RInv, F(0), QInv );
+    return kappa/N;
+}
+
+template<typename F>
+inline Base<F>
+Invert( Int m, const DistMatrix<F>& W, DistMatrix<F>& WInv )
+{
+    DEBUG_ONLY(CSE cse("sylvester::Invert"))
+    typedef Base<F> Real;
+    const Grid& g = W.Grid();
+    const Int N = W.Height();
+    auto P = W( IR(0,m), IR(0,m) );
+    auto Q = W( IR(0,m), IR(m,N) );
+    auto R = W( IR(m,N), IR(m,N) );
+
+    Zeros( WInv, N, N );
+    auto PInv = WInv( IR(0,m), IR(0,m) );
+    auto QInv = WInv( IR(0,m), IR(m,N) );
+    auto RInv = WInv( IR(m,N), IR(m,N) );
+
+    Real kappa = 0;
+    DistMatrix<Int,VC,STAR> p(g);
+    PInv = P;
+    LU( PInv, p );
+    if( m > 0 )
+        kappa += m*det::AfterLUPartialPiv( PInv, p ).kappa;
+    inverse::AfterLUPartialPiv( PInv, p );
+    RInv = R;
+    LU( RInv, p );
+    if( N > m )
+        kappa += (N-m)*det::AfterLUPartialPiv( RInv, p ).kappa;
+    inverse::AfterLUPartialPiv( RInv, p );
+
+    DistMatrix<F> T(g);
+    Gemm( NORMAL, NORMAL, F(1), PInv, Q, T );
+    Gemm( NORMAL, NORMAL, F(-1), T, RInv, F(0), QInv );
+    return kappa/N;
+}
+
+template<typename F>
+inline void
+NewtonStep
+( Int m, const Matrix<F>& W, Matrix<F>& WNew, SignScaling scaling )
+{
+    DEBUG_ONLY(CSE cse("sylvester::NewtonStep"))
+    typedef Base<F> Real;
+
+    // Calculate mu while forming WNew := inv(W)
+    Real mu=1;
+    const Real kappa = Invert( m, W, WNew );
+    if( scaling == SIGN_SCALE_DET )
+        mu = Real(1)/Exp(kappa);
+    else if( scaling == SIGN_SCALE_FROB )
+        mu = Sqrt( FrobeniusNorm(WNew)/FrobeniusNorm(W) );
+
+    // Overwrite WNew with the new iterate
+    Scale( Real(1)/(2*mu), WNew );
+    Axpy( mu/Real(2), W, WNew );
+}
+
+template<typename F>
+inline void
+NewtonStep
+( Int m, const DistMatrix<F>& W, DistMatrix<F>& WNew, SignScaling scaling )
+{
+    DEBUG_ONLY(CSE cse("sylvester::NewtonStep"))
+    typedef Base<F> Real;
+
+    // Calculate mu while forming WNew := inv(W)
+    Real mu=1;
+    const Real kappa = Invert( m, W, WNew );
+    if( scaling == SIGN_SCALE_DET )
+        mu = Real(1)/Exp(kappa);
+    else if( scaling == SIGN_SCALE_FROB )
+        mu = Sqrt( FrobeniusNorm(WNew)/FrobeniusNorm(W) );
+
+    // Overwrite WNew with the new iterate
+    Scale( Real(1)/(2*mu), WNew );
+    Axpy( mu/Real(2), W, WNew );
+}
+
+// WTmp := 3I - W^2, returning || I - W^2 ||_1
+template<typename F>
+inline Base<F>
+NewtonSchulzSquare( Int m, const Matrix<F>& W, Matrix<F>& WTmp )
+{
+    DEBUG_ONLY(CSE cse("sylvester::NewtonSchulzSquare"))
+    const Int N = W.Height();
+    auto P = W( IR(0,m), IR(0,m) );
+    auto Q = W( IR(0,m), IR(m,N) );
+    auto R = W( IR(m,N), IR(m,N) );
+
+    Zeros( WTmp, N, N );
+    auto PTmp = WTmp( IR(0,m), IR(0,m) );
+    auto QTmp = WTmp( IR(0,m), IR(m,N) );
+    auto RTmp = WTmp( IR(m,N), IR(m,N) );
+    Gemm( NORMAL, NORMAL, F(-1), P, P, F(0), PTmp );
+    Gemm( NORMAL, NORMAL, F(-1), P, Q, F(0), QTmp );
+    Gemm( NORMAL, NORMAL, F(-1), Q, R, F(1), QTmp );
+    Gemm( NORMAL, NORMAL, F(-1), R, R, F(0), RTmp );
+
+    ShiftDiagonal( WTmp, F(1) );
+    const Base<F> residual = OneNorm( WTmp );
+    ShiftDiagonal( WTmp, F(2) );
+    return residual;
+}
+
+template<typename F>
+inline Base<F>
+NewtonSchulzSquare( Int m, const DistMatrix<F>& W, DistMatrix<F>& WTmp )
+{
+    DEBUG_ONLY(CSE cse("sylvester::NewtonSchulzSquare"))
+    const Int N = W.Height();
+    auto P = W( IR(0,m), IR(0,m) );
+    auto Q = W( IR(0,m), IR(m,N) );
+    auto R = W( IR(m,N), IR(m,N) );
+
+    Zeros( WTmp, N, N );
+    auto PTmp = WTmp( IR(0,m), IR(0,m) );
+    auto QTmp = WTmp( IR(0,m), IR(m,N) );
+    auto RTmp = WTmp( IR(m,N), IR(m,N) );
+    Gemm( NORMAL, NORMAL, F(-1), P, P, F(0), PTmp );
+    Gemm( NORMAL, NORMAL, F(-1), P, Q, F(0), QTmp );
+    Gemm( NORMAL, NORMAL, F(-1), Q, R, F(1), QTmp );
+    Gemm( NORMAL, NORMAL, F(-1), R, R, F(0), RTmp );
+
+    ShiftDiagonal( WTmp, F(1) );
+    const Base<F> residual = OneNorm( WTmp );
+    ShiftDiagonal( WTmp, F(2) );
+    return residual;
+}
+
+// WNew := 1/2 W WTmp, where WTmp = 3I - W^2
+template<typename F>
+inline void
+NewtonSchulzStep
+( Int m, const Matrix<F>& W, const Matrix<F>& WTmp, Matrix<F>& WNew )
+{
+    DEBUG_ONLY(CSE cse("sylvester::NewtonSchulzStep"))
+    const Int N = W.Height();
+    auto P = W( IR(0,m), IR(0,m) );
+    auto Q = W( IR(0,m), IR(m,N) );
+    auto R = W( IR(m,N), IR(m,N) );
+    auto PTmp = WTmp( IR(0,m), IR(0,m) );
+    auto QTmp = WTmp( IR(0,m), IR(m,N) );
+    auto RTmp = WTmp( IR(m,N), IR(m,N) );
+
+    Zeros( WNew, N, N );
+    auto PNew = WNew( IR(0,m), IR(0,m) );
+    auto QNew = WNew( IR(0,m), IR(m,N) );
+    auto RNew = WNew( IR(m,N), IR(m,N) );
+    Gemm( NORMAL, NORMAL, F(1)/F(2), P, PTmp, F(0), PNew );
+    Gemm( NORMAL, NORMAL, F(1)/F(2), P, QTmp, F(0), QNew );
+    Gemm( NORMAL, NORMAL, F(1)/F(2), Q, RTmp, F(1), QNew );
+    Gemm( NORMAL, NORMAL, F(1)/F(2), R, RTmp, F(0), RNew );
+}
+
+template<typename F>
+inline void
+NewtonSchulzStep
+( Int m, const DistMatrix<F>& W, const DistMatrix<F>& WTmp, 
+  DistMatrix<F>& WNew )
+{
+    DEBUG_ONLY(CSE cse("sylvester::NewtonSchulzStep"))
+    const Int N = W.Height();
+    auto P = W( IR(0,m), IR(0,m) );
+    auto Q = W( IR(0,m), IR(m,N) );
+    auto R = W( IR(m,N), IR(m,N) );
+    auto PTmp = WTmp( IR(0,m), IR(0,m) );
+    auto QTmp = WTmp( IR(0,m), IR(m,N) );
+    auto RTmp = WTmp( IR(m,N), IR(m,N) );
+
+    Zeros( WNew, N, N );
+    auto PNew = WNew( IR(0,m), IR(0,m) );
+    auto QNew = WNew( IR(0,m), IR(m,N) );
+    auto RNew = WNew( IR(m,N), IR(m,N) );
+    Gemm( NORMAL, NORMAL, F(1)/F(2), P, PTmp, F(0), PNew );
+    Gemm( NORMAL, NORMAL, F(1)/F(2), P, QTmp, F(0), QNew );
+    Gemm( NORMAL, NORMAL, F(1)/F(2), Q, RTmp, F(1), QNew );
+    Gemm( NORMAL, NORMAL, F(1)/F(2), R, RTmp, F(0), RNew );
+}
+
+// See sign::ZolotarevStep. Each shifted solve against 
+//
+//   W^2 + s I = | P^2 + s I, P Q + Q R |
+//               | 0,         R^2 + s I |
+//
+// only requires the LU factorizations of the two diagonal blocks.
+template<typename F>
+inline void
+ZolotarevStep
+( Int m, const Matrix<F>& W, Matrix<F>& WNew, Int& degree, Base<F>& l,
+  Base<F> tol )
+{
+    DEBUG_ONLY(CSE cse("sylvester::ZolotarevStep"))
+    typedef Base<F> Real;
+    const Int N = W.Height();
+    auto P = W( IR(0,m), IR(0,m) );
+    auto Q = W( IR(0,m), IR(m,N) );
+    auto R = W( IR(m,N), IR(m,N) );
+
+    Real alpha = 1;
+    if( l == Real(0) )
+    {
+        // Bound the extremal singular values, estimating the norms of inv(W)
+        // with solves against the LU factorizations of P and R. Since the
+        // estimates are lower bounds, l may overshoot, which at worst costs
+        // an additional iteration.
+        Matrix<F> PLU( P ), RLU( R );
+        Matrix<Int> pPLU, pRLU;
+        LU( PLU, pPLU );
+        LU( RLU, pRLU );
+        auto solve = [&]( Matrix<F>& y )
+          { auto yT = y( IR(0,m), IR(0,1) );
+            auto yB = y( IR(m,N), IR(0,1) );
+            lu::SolveAfter( NORMAL, RLU, pRLU, yB );
+            Gemm( NORMAL, NORMAL, F(-1), Q, yB, F(1), yT );
+            lu::SolveAfter( NORMAL, PLU, pPLU, yT ); };
+        auto solveAdj = [&]( Matrix<F>& y )
+          { auto yT = y( IR(0,m), IR(0,1) );
+            auto yB = y( IR(m,N), IR(0,1) );
+            lu::SolveAfter( ADJOINT, PLU, pPLU, yT );
+            Gemm( ADJOINT, NORMAL, F(-1), Q, yT, F(1), yB );
+            lu::SolveAfter( ADJOINT, RLU, pRLU, yB ); };
+        const Real invOneNorm = sign::OneNormEstimate<F>( N, solve, solveAdj );
+        const Real invInfNorm = sign::OneNormEstimate<F>( N, solveAdj, solve );
+        alpha = Sqrt(OneNorm(W)*InfinityNorm(W));
+        const Real beta = Sqrt(invOneNorm*invInfNorm);
+        l = Min( Real(1)/(alpha*beta), Real(1) );
+    }
+    if( degree == 0 )
+        degree = sign::ZolotarevDegree( l, tol );
+    vector<Real> c, a;
+    const Real M = sign::ZolotarevCoefficients( degree, l, c, a );
+    l = Min( sign::ZolotarevEvaluate( l, M, c, a ), Real(1) );
+
+    // Form the blocks of W^2
+    Matrix<F> PSquared, QSquared, RSquared;
+    Gemm( NORMAL, NORMAL, F(1), P, P, PSquared );
+    Gemm( NORMAL, NORMAL, F(1), P, Q, QSquared );
+    Gemm( NORMAL, NORMAL, F(1), Q, R, F(1), QSquared );
+    Gemm( NORMAL, NORMAL, F(1), R, R, RSquared );
+
+    WNew = W;
+    Scale( M/alpha, WNew );
+    auto WNewT = WNew( IR(0,m), IR(0,N) );
+    auto RNew = WNew( IR(m,N), IR(m,N) );
+
+    Matrix<Int> pP, pR;
+    Matrix<F> TP, TR, YT, YR;
+    for( Int j=0; j<degree; ++j )
+    {
+        const F shift = alpha*alpha*c[j];
+        TP = PSquared;
+        ShiftDiagonal( TP, shift );
+        LU( TP, pP );
+        TR = RSquared;
+        ShiftDiagonal( TR, shift );
+        LU( TR, pR );
+
+        // Solve for the bottom-right block of the solution
+        YR = R;
+        lu::SolveAfter( NORMAL, TR, pR, YR );
+
+        // Solve for the top block row of the solution, [YP, YQ], where
+        // (P^2 + s I) [YP, YQ] = [P, Q - (P Q + Q R) YR]
+        YT = W( IR(0,m), IR(0,N) );
+        auto YQ = YT( IR(0,m), IR(m,N) );
+        Gemm( NORMAL, NORMAL, F(-1), QSquared, YR, F(1), YQ );
+        lu::SolveAfter( NORMAL, TP, pP, YT );
+
+        Axpy( M*alpha*a[j], YT, WNewT );
+        Axpy( M*alpha*a[j], YR, RNew );
+    }
+}
+
+template<typename F>
+inline void
+ZolotarevStep
+( Int m, const DistMatrix<F>& W, DistMatrix<F>& WNew, Int& degree, 
+  Base<F>& l, Base<F> tol )
+{
+    DEBUG_ONLY(CSE cse("sylvester::ZolotarevStep"))
+    typedef Base<F> Real;
+    const Grid& g = W.Grid();
+    const Int N = W.Height();
+    auto P = W( IR(0,m), IR(0,m) );
+    auto Q = W( IR(0,m), IR(m,N) );
+    auto R = W( IR(m,N), IR(m,N) );
+
+    Real alpha = 1;
+    if( l == Real(0) )
+    {
+        // Bound the extremal singular values, estimating the norms of inv(W)
+        // with solves against the LU factorizations of P and R. Since the
+        // estimates are lower bounds, l may overshoot, which at worst costs
+        // an additional iteration.
+        DistMatrix<F> PLU( P ), RLU( R );
+        DistMatrix<Int,VC,STAR> pPLU(g), pRLU(g);
+        LU( PLU, pPLU );
+        LU( RLU, pRLU );
+        auto solve = [&]( DistMatrix<F>& y )
+          { auto yT = y( IR(0,m), IR(0,1) );
+            auto yB = y( IR(m,N), IR(0,1) );
+            lu::SolveAfter( NORMAL, RLU, pRLU, yB );
+            Gemm( NORMAL, NORMAL, F(-1), Q, yB, F(1), yT );
+            lu::SolveAfter( NORMAL, PLU, pPLU, yT ); };
+        auto solveAdj = [&]( DistMatrix<F>& y )
+          { auto yT = y( IR(0,m), IR(0,1) );
+            auto yB = y( IR(m,N), IR(0,1) );
+            lu::SolveAfter( ADJOINT, PLU, pPLU, yT );
+            Gemm( ADJOINT, NORMAL, F(-1), Q, yT, F(1), yB );
+            lu::SolveAfter( ADJOINT, RLU, pRLU, yB ); };
+        const Real invOneNorm = sign::OneNormEstimate<F>
+          ( g, N, solve, solveAdj );
+        const Real invInfNorm = sign::OneNormEstimate<F>
+          ( g, N, solveAdj, solve );
+        alpha = Sqrt(OneNorm(W)*InfinityNorm(W));
+        const Real beta = Sqrt(invOneNorm*invInfNorm);
+        l = Min( Real(1)/(alpha*beta), Real(1) );
+    }
+    if( degree == 0 )
+        degree = sign::ZolotarevDegree( l, tol );
+    vector<Real> c, a;
+    const Real M = sign::ZolotarevCoefficients( degree, l, c, a );
+    l = Min( sign::ZolotarevEvaluate( l, M, c, a ), Real(1) );
+
+    // Form the blocks of W^2
+    DistMatrix<F> PSquared(g), QSquared(g), RSquared(g);
+    Gemm( NORMAL, NORMAL, F(1), P, P, PSquared );
+    Gemm( NORMAL, NORMAL, F(1), P, Q, QSquared );
+    Gemm( NORMAL, NORMAL, F(1), Q, R, F(1), QSquared );
+    Gemm( NORMAL, NORMAL, F(1), R, R, RSquared );
+
+    WNew = W;
+    Scale( M/alpha, WNew );
+    auto WNewT = WNew( IR(0,m), IR(0,N) );
+    auto RNew = WNew( IR(m,N), IR(m,N) );
+
+    DistMatrix<Int,VC,STAR> pP(g), pR(g);
+    DistMatrix<F> TP(g), TR(g), YT(g), YR(g);
+    for( Int j=0; j<degree; ++j )
+    {
+        const F shift = alpha*alpha*c[j];
+        TP = PSquared;
+        ShiftDiagonal( TP, shift );
+        LU( TP, pP );
+        TR = RSquared;
+        ShiftDiagonal( TR, shift );
+        LU( TR, pR );
+
+        // Solve for the bottom-right block of the solution
+        YR = R;
+        lu::SolveAfter( NORMAL, TR, pR, YR );
+
+        // Solve for the top block row of the solution, [YP, YQ], where
+        // (P^2 + s I) [YP, YQ] = [P, Q - (P Q + Q R) YR]
+        YT = W( IR(0,m), IR(0,N) );
+        auto YQ = YT( IR(0,m), IR(m,N) );
+        Gemm( NORMAL, NORMAL, F(-1), QSquared, YR, F(1), YQ );
+        lu::SolveAfter( NORMAL, TP, pP, YT );
+
+        Axpy( M*alpha*a[j], YT, WNewT );
+        Axpy( M*alpha*a[j], YR, RNew );
+    }
+}
+
+// Overwrite W with sgn(W) using the method requested by ctrl
+template<typename F>
+inline void
+Sign( Int m, Matrix<F>& W, const SignCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("sylvester::Sign"))
+    typedef Base<F> Real;
+    Real tol = ctrl.tol;
+    if( tol == Real(0) )
+        tol = W.Height()*Epsilon<Real>();
+
+    Int numIts=0, degree=ctrl.zolotarevDegree;
+    Real l=0;
+    bool schulz=false;
+    Matrix<F> B, WTmp;
+    Matrix<F> *X=&W, *XNew=&B;
+    while( numIts < ctrl.maxIts )
+    {
+        // Overwrite XNew with the new iterate
+        const bool schulzStep = schulz;
+        if( ctrl.method == SIGN_ZOLOTAREV )
+            ZolotarevStep( m, *X, *XNew, degree, l, tol );
+        else if( schulzStep )
+            NewtonSchulzStep( m, *X, WTmp, *XNew );
+        else
+            NewtonStep( m, *X, *XNew, ctrl.scaling );
+
+        // Use the difference in the iterates to test for convergence
+        Axpy( Real(-1), *XNew, *X );
+        const Real oneDiff = OneNorm( *X );
+        const Real oneNew = OneNorm( *XNew );
+
+        // Ensure that X holds the current iterate and break if possible
+        ++numIts;
+        std::swap( X, XNew );
+        if( ctrl.progress )
+            cout << "after " << numIts << " " 
+                 << ( ctrl.method == SIGN_ZOLOTAREV ? "Zolotarev" :
+                      ( schulzStep ? "Newton-Schulz" : "Newton" ) )
+                 << " iter's: oneDiff=" << oneDiff << ", oneNew=" << oneNew 
+                 << ", oneDiff/oneNew=" << oneDiff/oneNew << ", tol=" 
+                 << tol << endl;
+        if( oneDiff/oneNew <= Pow(oneNew,ctrl.power)*tol )
+            break;
+
+        if( ctrl.method == SIGN_NEWTON_SCHULZ &&
+            (schulz || 2*oneNew*oneDiff <= ctrl.newtonSchulzTol) )
+            schulz = 
+              ( NewtonSchulzSquare( m, *X, WTmp ) <= ctrl.newtonSchulzTol );
+    }
+    if( X != &W )
+        W = *X;
+}
+
+template<typename F>
+inline void
+Sign( Int m, DistMatrix<F>& W, const SignCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("sylvester::Sign"))
+    typedef Base<F> Real;
+    Real tol = ctrl.tol;
+    if( tol == Real(0) )
+        tol = W.Height()*Epsilon<Real>();
+
+    Int numIts=0, degree=ctrl.zolotarevDegree;
+    Real l=0;
+    bool schulz=false;
+    DistMatrix<F> B( W.Grid() ), WTmp( W.Grid() );
+    DistMatrix<F> *X=&W, *XNew=&B;
+    while( numIts < ctrl.maxIts )
+    {
+        // Overwrite XNew with the new iterate
+        const bool schulzStep = schulz;
+        if( ctrl.method == SIGN_ZOLOTAREV )
+            ZolotarevStep( m, *X, *XNew, degree, l, tol );
+        else if( schulzStep )
+            NewtonSchulzStep( m, *X, WTmp, *XNew );
+        else
+            NewtonStep( m, *X, *XNew, ctrl.scaling );
+
+        // Use the difference in the iterates to test for convergence
+        Axpy( Real(-1), *XNew, *X );
+        const Real oneDiff = OneNorm( *X );
+        const Real oneNew = OneNorm( *XNew );
+
+        // Ensure that X holds the current iterate and break if possible
+        ++numIts;
+        std::swap( X, XNew );
+        if( ctrl.progress && W.Grid().Rank() == 0 )
+            cout << "after " << numIts << " " 
+                 << ( ctrl.method == SIGN_ZOLOTAREV ? "Zolotarev" :
+                      ( schulzStep ? "Newton-Schulz" : "Newton" ) )
+                 << " iter's: oneDiff=" << oneDiff << ", oneNew=" << oneNew 
+                 << ", oneDiff/oneNew=" << oneDiff/oneNew << ", tol=" 
+                 << tol << endl;
+        if( oneDiff/oneNew <= Pow(oneNew,ctrl.power)*tol )
+            break;
+
+        if( ctrl.method == SIGN_NEWTON_SCHULZ &&
+            (schulz || 2*oneNew*oneDiff <= ctrl.newtonSchulzTol) )
+            schulz = 
+              ( NewtonSchulzSquare( m, *X, WTmp ) <= ctrl.newtonSchulzTol );
+    }
+    if( X != &W )
+        W = *X;
+}
+
+} // namespace sylvester
+
 // W = | A -C |, where A is m x m, B is n x n, and both are assumed to have 
 //     | 0 -B |  all of their eigenvalues in the open right-half plane.
 //
 // The solution, X, to the equation
 //   A X + X B = C
-// is returned, as well as the number of Newton iterations for computing sgn(W).
+// is returned, where sgn(W) is computed by the block iteration above.
 //
 // See Chapter 2 of Nicholas J. Higham's "Functions of Matrices"
 
@@ -23,7 +544,7 @@ template<typename F>
 void Sylvester( Int m, Matrix<F>& W, Matrix<F>& X, SignCtrl<Base<F>> ctrl )
 {
     DEBUG_ONLY(CSE cse("Sylvester"))
-    Sign( W, ctrl );
+    sylvester::Sign( m, W, ctrl );
     Matrix<F> WTL, WTR,
               WBL, WBR;
     PartitionDownDiagonal
@@ -57,7 +578,7 @@ void Sylvester
     auto& W = *WPtr;
 
     const Grid& g = W.Grid();
-    Sign( W, ctrl );
+    sylvester::Sign( m, W, ctrl );
     DistMatrix<F> WTL(g), WTR(g),
                   WBL(g), WBR(g);
     PartitionDownDiagonal
@@ -320,8 +320,15 @@ void DistMultiVec<T>::ProcessQueues()
     SwapClear( remoteUpdates_ );
     // Exchange and unpack
     // -------------------
-    auto recvEntries = 
-      mpi::AllToAll( sendEntries, sendCounts, sendOffs, comm_ );
+    vector<int> recvCounts(commSize);
+    mpi::AllToAll( sendCounts.data(), 1, recvCounts.data(), 1, comm_ );
+    vector<int> recvOffs;
+    const int totalRecv = Scan( recvCounts, recvOffs );
+    auto plan = 
+      mpi::MakeSparseAllToAllPlan
+      ( sendCounts, sendOffs, recvCounts, recvOffs, comm_ );
+    vector<Entry<T>> recvEntries(totalRecv);
+    mpi::SparseAllToAll( sendEntries, recvEntries, plan );
     for( auto entry : recvEntries )
         Update( entry );
 }
@@ -253,8 +253,16 @@ void DistSparseMatrix<T>::ProcessQueues()
         SwapClear( remoteVals_ );
         // Exchange and unpack
         // -------------------
-        auto recvBuf=
-          mpi::AllToAll( sendBuf, sendCounts, sendOffs, distGraph_.comm_ );
+        vector<int> recvCounts(commSize);
+        mpi::AllToAll
+        ( sendCounts.data(), 1, recvCounts.data(), 1, distGraph_.comm_ );
+        vector<int> recvOffs;
+        const int totalRecv = Scan( recvCounts, recvOffs );
+        auto plan = 
+          mpi::MakeSparseAllToAllPlan
+          ( sendCounts, sendOffs, recvCounts, recvOffs, distGraph_.comm_ );
+        vector<Entry<T>> recvBuf(totalRecv);
+        mpi::SparseAllToAll( sendBuf, recvBuf, plan );
         Reserve( NumLocalEntries()+recvBuf.size() );
         for( auto& entry : recvBuf )
             QueueUpdate( entry );
@@ -282,12 +290,19 @@ void DistSparseMatrix<T>::ProcessQueues()
             ++offs[owner];
         }
         SwapClear( distGraph_.remoteRemovals_ );
-        // Exchange and unpack
-        // -------------------
-        auto recvRows = 
-          mpi::AllToAll(sendRows,sendCounts,sendOffs,distGraph_.comm_);
-        auto recvCols = 
-          mpi::AllToAll(sendCols,sendCounts,sendOffs,distGraph_.comm_);
+        // Exchange and unpack (with one plan for both the rows and columns)
+        // -----------------------------------------------------------------
+        vector<int> recvCounts(commSize);
+        mpi::AllToAll
+        ( sendCounts.data(), 1, recvCounts.data(), 1, distGraph_.comm_ );
+        vector<int> recvOffs;
+        const int totalRecv = Scan( recvCounts, recvOffs );
+        auto plan = 
+          mpi::MakeSparseAllToAllPlan
+          ( sendCounts, sendOffs, recvCounts, recvOffs, distGraph_.comm_ );
+        vector<Int> recvRows(totalRecv), recvCols(totalRecv);
+        mpi::SparseAllToAll( sendRows, recvRows, plan );
+        mpi::SparseAllToAll( sendCols, recvCols, plan );
         for( Int i=0; i<recvRows.size(); ++i )
             QueueZero( recvRows[i], recvCols[i] );
     }
@@ -582,6 +597,41 @@ DistSparseMultMeta DistSparseMatrix<T>::InitializeMultMeta() const
     for( Int s=0; s<numLocalEntries; ++s )
         meta.colOffs[s] = Find( recvInds, Col(s) );
     meta.numRecvInds = numRecvInds;
+
+    // Split the local entries based upon whether their columns correspond to
+    // rows of X which we own
+    const int commRank = mpi::Rank( comm );
+    const Int firstLocalCol = commRank*vecBlocksize;
+    const Int localHeight = LocalHeight();
+    meta.localRowOffs.resize( localHeight+1 );
+    meta.remoteRowOffs.resize( localHeight+1 );
+    meta.localEntries.clear();
+    meta.localCols.clear();
+    meta.remoteEntries.clear();
+    meta.remoteColOffs.clear();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        meta.localRowOffs[iLoc] = meta.localEntries.size();
+        meta.remoteRowOffs[iLoc] = meta.remoteEntries.size();
+        const Int entryOff = EntryOffset( iLoc );
+        const Int numConn = NumConnections( iLoc );
+        for( Int e=entryOff; e<entryOff+numConn; ++e )
+        {
+            const Int j = Col(e);
+            if( RowToProcess( j, vecBlocksize, commSize ) == commRank )
+            {
+                meta.localEntries.push_back( e );
+                meta.localCols.push_back( j-firstLocalCol );
+            }
+            else
+            {
+                meta.remoteEntries.push_back( e );
+                meta.remoteColOffs.push_back( meta.colOffs[e] );
+            }
+        }
+    }
+    meta.localRowOffs[localHeight] = meta.localEntries.size();
+    meta.remoteRowOffs[localHeight] = meta.remoteEntries.size();
     meta.ready = true;
 
     return meta;
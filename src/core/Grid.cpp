@@ -177,6 +177,8 @@ void Grid::SetUpGrid()
 
 Grid::~Grid()
 {
+    // The layer grids are views of our viewing communicator
+    layerGrids_.clear();
     if( !mpi::Finalized() )
     {
         if( InGrid() )
@@ -298,13 +300,13 @@ int Grid::CoordsToVC
     else if( (colDist == MC && rowDist == STAR) || 
              (rowDist == MC && colDist == STAR) )
     {
-        return distRank + redundantRank*Width();
+        return distRank + redundantRank*Height();
     }
     else if( (colDist == MD && rowDist == STAR) ||
              (rowDist == MD && colDist == STAR) )
     {
-        const int row =         DiagRank()  % Height();
-        const int col = (Diag()+DiagRank()) % Width();
+        const int row =            distRank  % Height();
+        const int col = (crossRank+distRank) % Width();
         return row + col*Height();
     }
     else if( colDist == MR && rowDist == MC )
@@ -314,7 +316,7 @@ int Grid::CoordsToVC
     else if( (colDist == MR && rowDist == STAR) ||
              (rowDist == MR && colDist == STAR) )
     {
-        return redundantRank + distRank*Width();
+        return redundantRank + distRank*Height();
     }
     else if( colDist == STAR && rowDist == STAR )
     {
@@ -338,6 +340,39 @@ int Grid::CoordsToVC
 int Grid::VCToViewing( int vcRank ) const
 { return vcToViewing_[vcRank]; }
 
+const Grid& Grid::LayerGrid( int numLayers, int layer ) const
+{
+    DEBUG_ONLY(
+      CSE cse("Grid::LayerGrid");
+      if( numLayers <= 0 || size_ % numLayers != 0 )
+          LogicError
+          ("The number of layers, ",numLayers,
+           ", must be a positive divisor of ",size_);
+      if( layer < 0 || layer >= numLayers )
+          LogicError("Invalid layer index, ",layer);
+    )
+    auto& layers = layerGrids_[numLayers];
+    if( layers.empty() )
+    {
+        const int layerSize = size_ / numLayers;
+        layers.resize( numLayers );
+        vector<int> layerRanks( layerSize );
+        for( int l=0; l<numLayers; ++l )
+        {
+            for( int q=0; q<layerSize; ++q )
+                layerRanks[q] = VCToViewing( l*layerSize+q );
+            mpi::Group layerGroup;
+            mpi::Incl
+            ( viewingGroup_, layerSize, layerRanks.data(), layerGroup );
+            layers[l].reset
+            ( new Grid
+              ( viewingComm_, layerGroup, FindFactor(layerSize), order_ ) );
+            mpi::Free( layerGroup );
+        }
+    }
+    return *layers[layer];
+}
+
 mpi::Group Grid::OwningGroup() const { return owningGroup_; }
 mpi::Comm Grid::OwningComm()  const { return owningComm_; }
 mpi::Comm Grid::ViewingComm() const { return viewingComm_; }
@@ -8,6 +8,9 @@
 */
 #include "El.hpp"
 
+#include <atomic>
+#include <mutex>
+
 #if defined(EL_HAVE_VALGRIND)
 # include "valgrind.h"
 # define EL_RUNNING_ON_VALGRIND RUNNING_ON_VALGRIND
@@ -17,6 +20,316 @@
 
 namespace El {
 
+namespace {
+
+// Buffers are binned into size classes spaced by a quarter of a power of two
+// (above the minimum class) so that at most 25% of each buffer is wasted.
+// Every class size is a multiple of 32 bytes and hence of sizeof(G) for all
+// of the instantiated datatypes.
+const std::size_t minClassLog2 = 7;
+const std::size_t minClassBytes = std::size_t(1) << minClassLog2;
+const std::size_t numClasses = 4*(8*sizeof(std::size_t)-minClassLog2)+1;
+
+// Each thread caches a few buffers of each class before falling back to the
+// shared pool, which requires a lock
+const std::size_t maxThreadCacheBlocks = 4;
+const std::size_t maxThreadCacheBytes = std::size_t(1) << 25;
+
+MemoryMode memoryMode = MEMORY_SYSTEM;
+std::size_t memoryAlignment = 64;
+std::size_t memoryPoolLimit = std::size_t(1) << 30;
+
+std::atomic<std::size_t> numAllocs(0), numPoolHits(0), numSystemAllocs(0);
+std::atomic<std::size_t> currentBytes(0), highWaterBytes(0), pooledBytes(0);
+
+std::size_t SizeClass( std::size_t numBytes, std::size_t& classBytes )
+{
+    if( numBytes <= minClassBytes )
+    {
+        classBytes = minClassBytes;
+        return 0;
+    }
+    // Find k such that 2^k < numBytes <= 2^(k+1)
+    std::size_t k = 0;
+    while( (std::size_t(1) << (k+1)) < numBytes )
+        ++k;
+    const std::size_t quarter = std::size_t(1) << (k-2);
+    const std::size_t q = (numBytes-1-(std::size_t(1)<<k)) / quarter;
+    classBytes = (std::size_t(1) << k) + (q+1)*quarter;
+    return 1 + 4*(k-minClassLog2) + q;
+}
+
+void* SystemAllocate( std::size_t numBytes )
+{
+    ++numSystemAllocs;
+    void* ptr = nullptr;
+#if defined(_WIN32)
+    ptr = _aligned_malloc( numBytes, memoryAlignment );
+#else
+    if( posix_memalign( &ptr, memoryAlignment, numBytes ) != 0 )
+        ptr = nullptr;
+#endif
+    if( ptr == nullptr )
+        throw std::bad_alloc();
+    return ptr;
+}
+
+void SystemFree( void* ptr )
+{
+#if defined(_WIN32)
+    _aligned_free( ptr );
+#else
+    std::free( ptr );
+#endif
+}
+
+struct SharedPool
+{
+    std::mutex mutex;
+    vector<vector<void*>> blocks;
+    SharedPool() : blocks(numClasses) { }
+};
+
+// Intentionally never destroyed so that Memory objects with static storage
+// duration may still return their buffers during program exit
+SharedPool& GetSharedPool()
+{
+    static SharedPool* pool = new SharedPool;
+    return *pool;
+}
+
+struct ThreadCache
+{
+    vector<vector<void*>> blocks;
+    std::size_t numBytes;
+    ThreadCache() : blocks(numClasses), numBytes(0) { }
+};
+
+// The pointer is trivially destructible and therefore remains valid (and null)
+// after the guard below has flushed the cache at thread exit
+thread_local ThreadCache* threadCache = nullptr;
+
+// The inverse of SizeClass
+std::size_t ClassBytes( std::size_t c )
+{
+    if( c == 0 )
+        return minClassBytes;
+    const std::size_t k = minClassLog2 + (c-1)/4;
+    const std::size_t q = (c-1) % 4;
+    return (std::size_t(1) << k) + (q+1)*(std::size_t(1)<<(k-2));
+}
+
+void FlushCache( ThreadCache& cache )
+{
+    for( std::size_t c=0; c<numClasses; ++c )
+    {
+        const std::size_t classBytes = ClassBytes( c );
+        for( void* ptr : cache.blocks[c] )
+        {
+            SystemFree( ptr );
+            pooledBytes -= classBytes;
+        }
+        cache.blocks[c].clear();
+    }
+    cache.numBytes = 0;
+}
+
+struct ThreadCacheGuard
+{
+    ThreadCache cache;
+    ThreadCacheGuard() { threadCache = &cache; }
+    ~ThreadCacheGuard()
+    {
+        threadCache = nullptr;
+        FlushCache( cache );
+    }
+};
+
+ThreadCache* GetThreadCache()
+{
+    static thread_local ThreadCacheGuard guard;
+    return threadCache;
+}
+
+void* PoolAllocate( std::size_t& numBytes )
+{
+    std::size_t classBytes;
+    const std::size_t c = SizeClass( numBytes, classBytes );
+    numBytes = classBytes;
+
+    ThreadCache* cache = GetThreadCache();
+    if( cache != nullptr && !cache->blocks[c].empty() )
+    {
+        void* ptr = cache->blocks[c].back();
+        cache->blocks[c].pop_back();
+        cache->numBytes -= classBytes;
+        pooledBytes -= classBytes;
+        ++numPoolHits;
+        return ptr;
+    }
+    {
+        SharedPool& pool = GetSharedPool();
+        std::lock_guard<std::mutex> lock( pool.mutex );
+        if( !pool.blocks[c].empty() )
+        {
+            void* ptr = pool.blocks[c].back();
+            pool.blocks[c].pop_back();
+            pooledBytes -= classBytes;
+            ++numPoolHits;
+            return ptr;
+        }
+    }
+    return SystemAllocate( classBytes );
+}
+
+void PoolFree( void* ptr, std::size_t numBytes )
+{
+    std::size_t classBytes;
+    const std::size_t c = SizeClass( numBytes, classBytes );
+    // Buffers which were not allocated by the pool (e.g., before a mode 
+    // switch) are only recycled if they exactly fill their class and satisfy
+    // the current alignment
+    if( classBytes != numBytes ||
+        reinterpret_cast<std::uintptr_t>(ptr) % memoryAlignment != 0 ||
+        pooledBytes + classBytes > memoryPoolLimit )
+    {
+        SystemFree( ptr );
+        return;
+    }
+
+    ThreadCache* cache = GetThreadCache();
+    if( cache != nullptr &&
+        cache->blocks[c].size() < maxThreadCacheBlocks &&
+        cache->numBytes + classBytes <= maxThreadCacheBytes )
+    {
+        cache->blocks[c].push_back( ptr );
+        cache->numBytes += classBytes;
+        pooledBytes += classBytes;
+        return;
+    }
+    SharedPool& pool = GetSharedPool();
+    std::lock_guard<std::mutex> lock( pool.mutex );
+    pool.blocks[c].push_back( ptr );
+    pooledBytes += classBytes;
+}
+
+// On exit, numBytes is the capacity of the returned buffer
+void* Allocate( std::size_t& numBytes )
+{
+    void* ptr;
+    if( memoryMode == MEMORY_POOLED )
+        ptr = PoolAllocate( numBytes );
+    else
+        ptr = SystemAllocate( numBytes );
+
+    ++numAllocs;
+    const std::size_t newBytes = (currentBytes += numBytes);
+    std::size_t oldHighWater = highWaterBytes.load();
+    while( newBytes > oldHighWater &&
+           !highWaterBytes.compare_exchange_weak( oldHighWater, newBytes ) );
+    return ptr;
+}
+
+void Free( void* ptr, std::size_t numBytes )
+{
+    if( ptr == nullptr )
+        return;
+    currentBytes -= numBytes;
+    if( memoryMode == MEMORY_POOLED )
+        PoolFree( ptr, numBytes );
+    else
+        SystemFree( ptr );
+}
+
+} // anonymous namespace
+
+void SetMemoryMode( MemoryMode mode )
+{
+    if( mode != MEMORY_POOLED )
+        ReleaseMemoryPools();
+    memoryMode = mode;
+}
+
+MemoryMode GetMemoryMode() { return memoryMode; }
+
+void SetMemoryAlignment( std::size_t alignment )
+{
+    if( alignment < sizeof(void*) || (alignment & (alignment-1)) != 0 )
+        LogicError
+        ("Memory alignment must be a power of two which is at least ",
+         sizeof(void*));
+    if( alignment != memoryAlignment )
+    {
+        ReleaseMemoryPools();
+        memoryAlignment = alignment;
+    }
+}
+
+std::size_t MemoryAlignment() { return memoryAlignment; }
+
+void SetMemoryPoolLimit( std::size_t numBytes )
+{
+    if( numBytes < pooledBytes )
+        ReleaseMemoryPools();
+    memoryPoolLimit = numBytes;
+}
+
+std::size_t MemoryPoolLimit() { return memoryPoolLimit; }
+
+void ReleaseMemoryPools()
+{
+    ThreadCache* cache = GetThreadCache();
+    if( cache != nullptr )
+        FlushCache( *cache );
+
+    SharedPool& pool = GetSharedPool();
+    std::lock_guard<std::mutex> lock( pool.mutex );
+    for( std::size_t c=0; c<numClasses; ++c )
+    {
+        const std::size_t classBytes = ClassBytes( c );
+        for( void* ptr : pool.blocks[c] )
+        {
+            SystemFree( ptr );
+            pooledBytes -= classBytes;
+        }
+        SwapClear( pool.blocks[c] );
+    }
+    // Buffers cached by other threads remain counted until those threads
+    // exit and flush their caches
+}
+
+MemoryStats GetMemoryStats()
+{
+    MemoryStats stats;
+    stats.numAllocs = numAllocs;
+    stats.numPoolHits = numPoolHits;
+    stats.numSystemAllocs = numSystemAllocs;
+    stats.currentBytes = currentBytes;
+    stats.highWaterBytes = highWaterBytes;
+    stats.pooledBytes = pooledBytes;
+    return stats;
+}
+
+void ResetMemoryHighWater()
+{ highWaterBytes = currentBytes.load(); }
+
+void PrintMemoryStats( ostream& os )
+{
+    const MemoryStats stats = GetMemoryStats();
+    ostringstream msg;
+    msg << "Memory statistics on process " << mpi::WorldRank() << ":\n"
+        << "  mode:              "
+        << ( memoryMode == MEMORY_POOLED ? "pooled" : "system" ) << "\n"
+        << "  alignment:         " << memoryAlignment << " bytes\n"
+        << "  allocations:       " << stats.numAllocs << "\n"
+        << "  pool hits:         " << stats.numPoolHits << "\n"
+        << "  system allocs:     " << stats.numSystemAllocs << "\n"
+        << "  current bytes:     " << stats.currentBytes << "\n"
+        << "  high-water bytes:  " << stats.highWaterBytes << "\n"
+        << "  pooled bytes:      " << stats.pooledBytes << "\n";
+    os << msg.str();
+}
+
 template<typename G>
 Memory<G>::Memory()
 : size_(0), buffer_(nullptr)
@@ -44,7 +357,7 @@ void Memory<G>::ShallowSwap( Memory<G>& mem )
 }
 
 template<typename G>
-Memory<G>::~Memory() { delete[] buffer_; }
+Memory<G>::~Memory() { Free( buffer_, size_*sizeof(G) ); }
 
 template<typename G>
 G* Memory<G>::Buffer() const { return buffer_; }
@@ -57,11 +370,14 @@ G* Memory<G>::Require( size_t size )
 {
     if( size > size_ )
     {
-        delete[] buffer_;
+        Free( buffer_, size_*sizeof(G) );
+        buffer_ = nullptr;
+        size_ = 0;
+        std::size_t numBytes = size*sizeof(G);
 #ifndef EL_RELEASE
         try {
 #endif
-            buffer_ = new G[size];
+            buffer_ = static_cast<G*>(Allocate( numBytes ));
 #ifndef EL_RELEASE
         } 
         catch( std::bad_alloc& e )
@@ -73,7 +389,8 @@ G* Memory<G>::Require( size_t size )
             throw e;
         }
 #endif
-        size_ = size;
+        // The pools may round the request up to the size of its class
+        size_ = numBytes / sizeof(G);
 #ifdef EL_ZERO_INIT
         MemZero( buffer_, size_ );
 #elif defined(EL_HAVE_VALGRIND)
@@ -91,7 +408,7 @@ void Memory<G>::Release()
 template<typename G>
 void Memory<G>::Empty()
 {
-    delete[] buffer_;
+    Free( buffer_, size_*sizeof(G) );
     size_ = 0;
     buffer_ = nullptr;
 }
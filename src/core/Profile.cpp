@@ -0,0 +1,437 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+#include <iomanip>
+#include <map>
+#include <numeric>
+
+namespace {
+using namespace El;
+
+// Each node of the tree corresponds to a distinct path of region names
+struct ProfileNode
+{
+    const char* name;
+    Int parent, depth;
+    vector<Int> children;
+
+    Int numCalls=0;
+    double inclusive=0, childTime=0, flops=0, bytes=0;
+    Clock::time_point start;
+};
+
+struct TraceEvent
+{
+    const char* name;
+    Int depth;
+    double start, duration; // microseconds since the profiling epoch
+};
+
+bool profiling = false, tracing = false;
+// Avoid unbounded growth of the trace for long runs
+const Int maxTraceEvents = 1000000;
+bool truncatedTrace = false;
+
+vector<ProfileNode> nodes;
+Int current = 0;
+vector<TraceEvent> events;
+Clock::time_point epoch;
+
+inline bool IgnoreThread()
+{
+#ifdef EL_HYBRID
+    return omp_get_thread_num() != 0;
+#else
+    return false;
+#endif
+}
+
+void InitializeTree()
+{
+    nodes.clear();
+    nodes.resize( 1 );
+    nodes[0].name = "";
+    nodes[0].parent = -1;
+    nodes[0].depth = -1;
+    current = 0;
+    events.clear();
+    truncatedTrace = false;
+    epoch = Clock::now();
+}
+
+string Path( Int node )
+{
+    string path = nodes[node].name;
+    for( Int p=nodes[node].parent; p>0; p=nodes[p].parent )
+        path = string(nodes[p].name) + "/" + path;
+    return path;
+}
+
+void CollectStats( Int node, vector<ProfileStats>& stats )
+{
+    for( Int child : nodes[node].children )
+    {
+        const ProfileNode& n = nodes[child];
+        ProfileStats s;
+        s.path = Path( child );
+        s.depth = n.depth;
+        s.numCalls = n.numCalls;
+        s.inclusive = n.inclusive;
+        s.exclusive = n.inclusive - n.childTime;
+        s.flops = n.flops;
+        s.bytes = n.bytes;
+        stats.push_back( s );
+        CollectStats( child, stats );
+    }
+}
+
+// Escape a string for inclusion within JSON
+string Quote( const string& s )
+{
+    string quoted = "\"";
+    for( char c : s )
+    {
+        if( c == '"' || c == '\\' )
+            quoted += '\\';
+        quoted += c;
+    }
+    return quoted + "\"";
+}
+
+// The statistics of every rank for each distinct path (in the depth-first
+// order of the first rank containing the path)
+struct GlobalStats
+{
+    string path;
+    Int depth;
+    vector<double> numCalls, inclusive, exclusive, flops, bytes;
+};
+
+// Gather the statistics of every rank onto the root of 'comm'
+vector<GlobalStats> GatherStats( mpi::Comm comm )
+{
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+
+    // Serialize the local statistics, one region per line
+    ostringstream os;
+    os.precision( 17 );
+    for( const auto& s : GetProfileStats() )
+        os << s.depth << " " << s.numCalls << " " << s.inclusive << " "
+           << s.exclusive << " " << s.flops << " " << s.bytes << " "
+           << s.path << "\n";
+    const string local = os.str();
+    const int localSize = local.size();
+
+    vector<int> sizes(commSize), offs;
+    mpi::Gather( &localSize, 1, sizes.data(), 1, 0, comm );
+    Int totalSize = 0;
+    if( commRank == 0 )
+        totalSize = Scan( sizes, offs );
+    vector<byte> buf( totalSize );
+    mpi::Gather
+    ( (const byte*)local.data(), localSize,
+      buf.data(), sizes.data(), offs.data(), 0, comm );
+
+    vector<GlobalStats> stats;
+    if( commRank != 0 )
+        return stats;
+    std::map<string,Int> index;
+    for( int q=0; q<commSize; ++q )
+    {
+        std::istringstream is
+        ( string((const char*)&buf[offs[q]],sizes[q]) );
+        Int depth, numCalls;
+        double inclusive, exclusive, flops, bytes;
+        string path;
+        while( is >> depth >> numCalls >> inclusive >> exclusive
+                  >> flops >> bytes )
+        {
+            is.get();
+            std::getline( is, path );
+            auto it = index.find( path );
+            if( it == index.end() )
+            {
+                it = index.insert
+                     ( std::make_pair(path,Int(stats.size())) ).first;
+                GlobalStats g;
+                g.path = path;
+                g.depth = depth;
+                g.numCalls.resize( commSize, 0 );
+                g.inclusive.resize( commSize, 0 );
+                g.exclusive.resize( commSize, 0 );
+                g.flops.resize( commSize, 0 );
+                g.bytes.resize( commSize, 0 );
+                stats.push_back( g );
+            }
+            GlobalStats& g = stats[it->second];
+            g.numCalls[q] = numCalls;
+            g.inclusive[q] = inclusive;
+            g.exclusive[q] = exclusive;
+            g.flops[q] = flops;
+            g.bytes[q] = bytes;
+        }
+    }
+    return stats;
+}
+
+void MinAvgMax
+( const vector<double>& x, double& minVal, double& avgVal, double& maxVal )
+{
+    minVal = *std::min_element( x.begin(), x.end() );
+    maxVal = *std::max_element( x.begin(), x.end() );
+    avgVal = std::accumulate( x.begin(), x.end(), 0. ) / x.size();
+}
+
+void PrintTable( const vector<GlobalStats>& stats, ostream& os )
+{
+    const Int nameWidth = 40;
+    os << std::left << std::setw(nameWidth) << "Region" << std::right
+       << std::setw(10) << "calls"
+       << std::setw(12) << "incl min" << std::setw(12) << "incl avg"
+       << std::setw(12) << "incl max" << std::setw(12) << "excl avg"
+       << std::setw(12) << "GFlop/s" << std::setw(12) << "MB\n";
+    for( const auto& g : stats )
+    {
+        const auto slash = g.path.rfind( '/' );
+        const string name =
+          string(2*g.depth,' ') +
+          ( slash == string::npos ? g.path : g.path.substr(slash+1) );
+        double inclMin, inclAvg, inclMax, exclMin, exclAvg, exclMax;
+        MinAvgMax( g.inclusive, inclMin, inclAvg, inclMax );
+        MinAvgMax( g.exclusive, exclMin, exclAvg, exclMax );
+        const double numCalls =
+          std::accumulate( g.numCalls.begin(), g.numCalls.end(), 0. );
+        const double flops =
+          std::accumulate( g.flops.begin(), g.flops.end(), 0. );
+        const double bytes =
+          std::accumulate( g.bytes.begin(), g.bytes.end(), 0. );
+        // The rate of the exclusive work over the slowest rank
+        const double gflops =
+          ( exclMax > 0 ? flops/(exclMax*1.e9) : 0. );
+        os << std::left << std::setw(nameWidth) << name << std::right
+           << std::setw(10) << numCalls
+           << std::setw(12) << inclMin << std::setw(12) << inclAvg
+           << std::setw(12) << inclMax << std::setw(12) << exclAvg
+           << std::setw(12) << gflops << std::setw(12) << bytes/1.e6 << "\n";
+    }
+}
+
+void PrintArray( ostream& os, const string& label, const vector<double>& x )
+{
+    os << Quote(label) << ":[";
+    for( Int q=0; q<Int(x.size()); ++q )
+        os << ( q==0 ? "" : "," ) << x[q];
+    os << "]";
+}
+
+} // anonymous namespace
+
+namespace El {
+
+void EnableProfiling( bool trace )
+{
+    if( IgnoreThread() )
+        return;
+    if( !::profiling )
+        InitializeTree();
+    ::profiling = true;
+    ::tracing = trace;
+}
+
+void DisableProfiling()
+{
+    if( IgnoreThread() )
+        return;
+    ::profiling = false;
+    ::tracing = false;
+}
+
+bool Profiling() { return ::profiling; }
+bool ProfileTracing() { return ::tracing; }
+
+void PushProfileRegion( const char* name )
+{
+    if( !::profiling || IgnoreThread() )
+        return;
+    if( ::nodes.empty() )
+        InitializeTree();
+
+    // Search for an existing child of the same name, comparing the pointers
+    // before the contents since the names are typically string literals
+    Int child = -1;
+    for( Int c : ::nodes[::current].children )
+    {
+        const char* childName = ::nodes[c].name;
+        if( childName == name || std::strcmp(childName,name) == 0 )
+        {
+            child = c;
+            break;
+        }
+    }
+    if( child == -1 )
+    {
+        child = ::nodes.size();
+        ProfileNode node;
+        node.name = name;
+        node.parent = ::current;
+        node.depth = ::nodes[::current].depth + 1;
+        ::nodes.push_back( node );
+        ::nodes[::current].children.push_back( child );
+    }
+    ::current = child;
+    ::nodes[child].start = Clock::now();
+}
+
+void PopProfileRegion()
+{
+    if( ::nodes.empty() || ::current == 0 || IgnoreThread() )
+        return;
+    ProfileNode& node = ::nodes[::current];
+    auto now = Clock::now();
+    const double elapsed =
+      duration_cast<duration<double>>(now-node.start).count();
+    ++node.numCalls;
+    node.inclusive += elapsed;
+    ::nodes[node.parent].childTime += elapsed;
+
+    if( ::tracing )
+    {
+        if( Int(::events.size()) < ::maxTraceEvents )
+        {
+            TraceEvent event;
+            event.name = node.name;
+            event.depth = node.depth;
+            event.start = 1.e6*
+              duration_cast<duration<double>>(node.start-::epoch).count();
+            event.duration = 1.e6*elapsed;
+            ::events.push_back( event );
+        }
+        else
+            ::truncatedTrace = true;
+    }
+    ::current = node.parent;
+}
+
+const char* CurrentProfileRegion()
+{
+    if( !::profiling || ::nodes.empty() )
+        return "";
+    return ::nodes[::current].name;
+}
+
+void AddProfileFlops( double flops )
+{
+    if( ::profiling && !IgnoreThread() && !::nodes.empty() )
+        ::nodes[::current].flops += flops;
+}
+
+void AddProfileBytes( double bytes )
+{
+    if( ::profiling && !IgnoreThread() && !::nodes.empty() )
+        ::nodes[::current].bytes += bytes;
+}
+
+void ResetProfile()
+{
+    if( IgnoreThread() )
+        return;
+    for( auto& node : ::nodes )
+    {
+        node.numCalls = 0;
+        node.inclusive = node.childTime = node.flops = node.bytes = 0;
+    }
+    // Restart the active regions so that they are only partially counted
+    auto now = Clock::now();
+    for( Int n=::current; n>0; n=::nodes[n].parent )
+        ::nodes[n].start = now;
+    ::events.clear();
+    ::truncatedTrace = false;
+}
+
+vector<ProfileStats> GetProfileStats()
+{
+    vector<ProfileStats> stats;
+    if( !::nodes.empty() )
+        CollectStats( 0, stats );
+    return stats;
+}
+
+void PrintProfile( mpi::Comm comm, ostream& os )
+{
+    DEBUG_ONLY(CSE cse("PrintProfile"))
+    auto stats = GatherStats( comm );
+    if( mpi::Rank(comm) == 0 )
+    {
+        os << "Profile over " << mpi::Size(comm) << " processes "
+           << "(times in seconds)\n";
+        PrintTable( stats, os );
+        os.flush();
+    }
+}
+
+void WriteProfile( const string& basename, mpi::Comm comm )
+{
+    DEBUG_ONLY(CSE cse("WriteProfile"))
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+    auto stats = GatherStats( comm );
+    if( commRank == 0 )
+    {
+        ofstream text( (basename+".txt").c_str() );
+        if( !text.is_open() )
+            RuntimeError("Could not open ",basename,".txt");
+        text << "Profile over " << commSize << " processes "
+             << "(times in seconds)\n";
+        PrintTable( stats, text );
+
+        ofstream json( (basename+".json").c_str() );
+        if( !json.is_open() )
+            RuntimeError("Could not open ",basename,".json");
+        json.precision( 17 );
+        json << "{\"numProcesses\":" << commSize << ",\"regions\":[\n";
+        for( Int k=0; k<Int(stats.size()); ++k )
+        {
+            const auto& g = stats[k];
+            json << "{\"path\":" << Quote(g.path)
+                 << ",\"depth\":" << g.depth << ",";
+            PrintArray( json, "calls", g.numCalls ); json << ",";
+            PrintArray( json, "inclusive", g.inclusive ); json << ",";
+            PrintArray( json, "exclusive", g.exclusive ); json << ",";
+            PrintArray( json, "flops", g.flops ); json << ",";
+            PrintArray( json, "bytes", g.bytes );
+            json << "}" << ( k+1<Int(stats.size()) ? ",\n" : "\n" );
+        }
+        json << "]}\n";
+    }
+
+    if( ::tracing || !::events.empty() )
+    {
+        ostringstream name;
+        name << basename << "-" << commRank << ".trace.json";
+        ofstream trace( name.str().c_str() );
+        if( !trace.is_open() )
+            RuntimeError("Could not open ",name.str());
+        trace.precision( 15 );
+        trace << "{\"traceEvents\":[\n";
+        for( Int k=0; k<Int(::events.size()); ++k )
+        {
+            const auto& e = ::events[k];
+            trace << "{\"name\":" << Quote(e.name) << ",\"ph\":\"X\""
+                  << ",\"ts\":" << e.start << ",\"dur\":" << e.duration
+                  << ",\"pid\":" << commRank << ",\"tid\":0"
+                  << ",\"args\":{\"depth\":" << e.depth << "}}"
+                  << ( k+1<Int(::events.size()) ? ",\n" : "\n" );
+        }
+        trace << "],\"otherData\":{\"truncated\":"
+              << ( ::truncatedTrace ? "true" : "false" ) << "}}\n";
+    }
+}
+
+} // namespace El
@@ -0,0 +1,183 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <queue>
+
+namespace El {
+
+TaskGraph::TaskGraph() : numEdges_(0) { }
+
+void TaskGraph::AddEdge( Int source, Int target )
+{
+    // The edges into a task are all added during its insertion, so any
+    // duplicate would be the most recent successor of the source
+    auto& successors = tasks_[source].successors;
+    if( !successors.empty() && successors.back() == target )
+        return;
+    successors.push_back( target );
+    ++tasks_[target].numDeps;
+    ++numEdges_;
+}
+
+void TaskGraph::Insert
+( function<void()> kernel,
+  const vector<const void*>& inputs,
+  const vector<const void*>& outputs,
+  Int priority )
+{
+    DEBUG_ONLY(CSE cse("TaskGraph::Insert"))
+    const Int task = tasks_.size();
+    tasks_.resize( task+1 );
+    tasks_[task].kernel = kernel;
+    tasks_[task].priority = priority;
+    tasks_[task].numDeps = 0;
+
+    for( const void* item : inputs )
+    {
+        auto& access = accesses_[item];
+        if( access.lastWriter >= 0 )
+            AddEdge( access.lastWriter, task );
+        access.readers.push_back( task );
+    }
+    for( const void* item : outputs )
+    {
+        auto& access = accesses_[item];
+        if( access.lastWriter >= 0 )
+            AddEdge( access.lastWriter, task );
+        for( Int reader : access.readers )
+            if( reader != task )
+                AddEdge( reader, task );
+        access.lastWriter = task;
+        access.readers.clear();
+    }
+}
+
+void TaskGraph::Run( Int numThreads )
+{
+    DEBUG_ONLY(CSE cse("TaskGraph::Run"))
+    const Int numTasks = tasks_.size();
+
+    // Order the ready tasks by decreasing priority, then by insertion
+    typedef std::pair<Int,Int> Entry;
+    std::priority_queue<Entry> ready;
+    for( Int task=0; task<numTasks; ++task )
+        if( tasks_[task].numDeps == 0 )
+            ready.push( Entry(tasks_[task].priority,-task) );
+
+#ifdef EL_HYBRID
+    if( numThreads <= 0 )
+        numThreads = ( omp_in_parallel() ? 1 : omp_get_max_threads() );
+    numThreads = Max(Min(numThreads,numTasks),Int(1));
+#else
+    numThreads = 1;
+#endif
+
+    if( numThreads == 1 )
+    {
+        try
+        {
+            while( !ready.empty() )
+            {
+                const Int task = -ready.top().second;
+                ready.pop();
+                tasks_[task].kernel();
+                for( Int succ : tasks_[task].successors )
+                    if( --tasks_[succ].numDeps == 0 )
+                        ready.push( Entry(tasks_[succ].priority,-succ) );
+            }
+        }
+        catch( ... )
+        {
+            Empty();
+            throw;
+        }
+        Empty();
+        return;
+    }
+
+#ifdef EL_HYBRID
+    // Idle threads sleep on a condition variable until a task becomes ready
+    // (or the graph is finished) rather than spinning on the lock that the 
+    // busy threads need in order to retire their tasks
+    std::mutex mutex;
+    std::condition_variable wakeup;
+    Int numFinished = 0;
+    bool aborted = false;
+    std::exception_ptr error;
+    #pragma omp parallel num_threads(numThreads)
+    {
+        Int task = -1;
+        while( true )
+        {
+            // Retire the previous task (if any) and wait for a ready one
+            {
+                std::unique_lock<std::mutex> lock( mutex );
+                if( task >= 0 )
+                {
+                    Int numReleased = 0;
+                    for( Int succ : tasks_[task].successors )
+                    {
+                        if( --tasks_[succ].numDeps == 0 )
+                        {
+                            ready.push( Entry(tasks_[succ].priority,-succ) );
+                            ++numReleased;
+                        }
+                    }
+                    ++numFinished;
+                    task = -1;
+                    if( numFinished == numTasks || numReleased > 1 )
+                        wakeup.notify_all();
+                    else if( numReleased == 1 )
+                        wakeup.notify_one();
+                }
+                wakeup.wait
+                ( lock, [&]() 
+                  { return aborted || numFinished == numTasks || 
+                           !ready.empty(); } );
+                if( aborted || numFinished == numTasks )
+                    break;
+                task = -ready.top().second;
+                ready.pop();
+            }
+
+            try { tasks_[task].kernel(); }
+            catch( ... )
+            {
+                std::lock_guard<std::mutex> lock( mutex );
+                if( !aborted )
+                {
+                    aborted = true;
+                    error = std::current_exception();
+                }
+                wakeup.notify_all();
+                task = -1;
+            }
+        }
+    }
+    Empty();
+    if( aborted )
+        std::rethrow_exception( error );
+#endif
+}
+
+void TaskGraph::Empty()
+{
+    SwapClear( tasks_ );
+    accesses_.clear();
+    numEdges_ = 0;
+}
+
+Int TaskGraph::NumTasks() const { return tasks_.size(); }
+Int TaskGraph::NumEdges() const { return numEdges_; }
+
+} // namespace El
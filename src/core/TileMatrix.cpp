@@ -0,0 +1,189 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+namespace El {
+
+// Constructors and destructors
+// ============================
+
+template<typename T>
+TileMatrix<T>::TileMatrix()
+: height_(0), width_(0), tileSize_(Blocksize()), tileRows_(0), tileCols_(0)
+{ }
+
+template<typename T>
+TileMatrix<T>::TileMatrix( Int height, Int width, Int tileSize )
+: height_(0), width_(0), tileSize_(tileSize), tileRows_(0), tileCols_(0)
+{ Resize( height, width, tileSize ); }
+
+template<typename T>
+TileMatrix<T>::TileMatrix( const Matrix<T>& A, Int tileSize )
+: height_(0), width_(0), tileSize_(tileSize), tileRows_(0), tileCols_(0)
+{
+    Resize( A.Height(), A.Width(), tileSize );
+    Import( A );
+}
+
+template<typename T>
+TileMatrix<T>::~TileMatrix() { }
+
+// Assignment and reconfiguration
+// ==============================
+
+template<typename T>
+void TileMatrix<T>::Empty()
+{
+    height_ = width_ = tileRows_ = tileCols_ = 0;
+    SwapClear( tiles_ );
+    memory_.Empty();
+}
+
+template<typename T>
+void TileMatrix<T>::Resize( Int height, Int width )
+{ Resize( height, width, tileSize_ ); }
+
+template<typename T>
+void TileMatrix<T>::Resize( Int height, Int width, Int tileSize )
+{
+    DEBUG_ONLY(
+        CSE cse("TileMatrix::Resize");
+        if( height < 0 || width < 0 )
+            LogicError("Height and width must be non-negative");
+        if( tileSize <= 0 )
+            LogicError("Tile size must be positive");
+    )
+    height_ = height;
+    width_ = width;
+    tileSize_ = tileSize;
+    tileRows_ = (height+tileSize-1) / tileSize;
+    tileCols_ = (width+tileSize-1) / tileSize;
+
+    T* buffer = memory_.Require( height*width );
+    tiles_.resize( tileRows_*tileCols_ );
+    for( Int j=0; j<tileCols_; ++j )
+    {
+        const Int nb = TileWidth( j );
+        for( Int i=0; i<tileRows_; ++i )
+        {
+            const Int mb = TileHeight( i );
+            // Every preceding tile column has width tileSize, and every
+            // preceding tile within this column has height tileSize
+            T* tileBuf = &buffer[j*tileSize*height+i*tileSize*nb];
+            tiles_[i+j*tileRows_].Attach( mb, nb, tileBuf, Max(mb,1) );
+        }
+    }
+}
+
+template<typename T>
+void TileMatrix<T>::Import( const Matrix<T>& A )
+{
+    DEBUG_ONLY(CSE cse("TileMatrix::Import"))
+    if( A.Height() != height_ || A.Width() != width_ )
+        Resize( A.Height(), A.Width() );
+    const T* ABuf = A.LockedBuffer();
+    const Int ALDim = A.LDim();
+    for( Int j=0; j<tileCols_; ++j )
+    {
+        for( Int i=0; i<tileRows_; ++i )
+        {
+            Matrix<T>& tile = Tile( i, j );
+            const Int mb = tile.Height();
+            const Int nb = tile.Width();
+            const T* ABlock = &ABuf[i*tileSize_+j*tileSize_*ALDim];
+            for( Int t=0; t<nb; ++t )
+                MemCopy( tile.Buffer(0,t), &ABlock[t*ALDim], mb );
+        }
+    }
+}
+
+template<typename T>
+void TileMatrix<T>::Export( Matrix<T>& A ) const
+{
+    DEBUG_ONLY(CSE cse("TileMatrix::Export"))
+    A.Resize( height_, width_ );
+    T* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    for( Int j=0; j<tileCols_; ++j )
+    {
+        for( Int i=0; i<tileRows_; ++i )
+        {
+            const Matrix<T>& tile = Tile( i, j );
+            const Int mb = tile.Height();
+            const Int nb = tile.Width();
+            T* ABlock = &ABuf[i*tileSize_+j*tileSize_*ALDim];
+            for( Int t=0; t<nb; ++t )
+                MemCopy( &ABlock[t*ALDim], tile.LockedBuffer(0,t), mb );
+        }
+    }
+}
+
+// Queries
+// =======
+
+template<typename T>
+Int TileMatrix<T>::Height() const { return height_; }
+template<typename T>
+Int TileMatrix<T>::Width() const { return width_; }
+template<typename T>
+Int TileMatrix<T>::TileSize() const { return tileSize_; }
+template<typename T>
+Int TileMatrix<T>::TileRows() const { return tileRows_; }
+template<typename T>
+Int TileMatrix<T>::TileCols() const { return tileCols_; }
+
+template<typename T>
+Int TileMatrix<T>::TileHeight( Int i ) const
+{ return Min(tileSize_,height_-i*tileSize_); }
+
+template<typename T>
+Int TileMatrix<T>::TileWidth( Int j ) const
+{ return Min(tileSize_,width_-j*tileSize_); }
+
+template<typename T>
+Matrix<T>& TileMatrix<T>::Tile( Int i, Int j )
+{
+    DEBUG_ONLY(
+        CSE cse("TileMatrix::Tile");
+        if( i < 0 || i >= tileRows_ || j < 0 || j >= tileCols_ )
+            LogicError("Tile (",i,",",j,") is out of bounds");
+    )
+    return tiles_[i+j*tileRows_];
+}
+
+template<typename T>
+const Matrix<T>& TileMatrix<T>::Tile( Int i, Int j ) const
+{
+    DEBUG_ONLY(
+        CSE cse("TileMatrix::Tile");
+        if( i < 0 || i >= tileRows_ || j < 0 || j >= tileCols_ )
+            LogicError("Tile (",i,",",j,") is out of bounds");
+    )
+    return tiles_[i+j*tileRows_];
+}
+
+template<typename T>
+T TileMatrix<T>::Get( Int i, Int j ) const
+{
+    DEBUG_ONLY(CSE cse("TileMatrix::Get"))
+    return Tile(i/tileSize_,j/tileSize_).Get(i%tileSize_,j%tileSize_);
+}
+
+template<typename T>
+void TileMatrix<T>::Set( Int i, Int j, T alpha )
+{
+    DEBUG_ONLY(CSE cse("TileMatrix::Set"))
+    Tile(i/tileSize_,j/tileSize_).Set(i%tileSize_,j%tileSize_,alpha);
+}
+
+#define PROTO(T) template class TileMatrix<T>;
+#define EL_ENABLE_QUAD
+#include "El/macros/Instantiate.h"
+
+} // namespace El
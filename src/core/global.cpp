@@ -31,6 +31,10 @@ std::mt19937 generator;
 // Debugging
 DEBUG_ONLY(std::stack<string> callStack)
 
+// Profiling
+string profileBasename = "ElProfile";
+string traceBasename = "ElTrace";
+
 // Tuning parameters for basic routines
 Int localSymvIntBlocksize = 64;
 Int localSymvFloatBlocksize = 64;
@@ -54,6 +58,13 @@ Int localTrrkDoubleBlocksize = 64;
 Int localTrrkComplexFloatBlocksize = 64;
 Int localTrrkComplexDoubleBlocksize = 64;
 
+// The number of layers of GEMM_SUMMA_25D (zero selects it automatically)
+Int gemmNumLayers = 0;
+
+// The file from which the Gemm cost models are loaded and to which they are
+// saved upon finalization (empty if they are not persisted)
+string gemmCalibrationFile;
+
 // Qt5
 ColorMap colorMap=RED_BLACK_GREEN;
 Int numDiscreteColors = 15;
@@ -346,6 +357,39 @@ void Initialize( int& argc, char**& argv )
         ::blocksizeStack.pop();
     ::blocksizeStack.push( 128 );
 
+    // Configure the allocator behind the Memory class
+    const bool memoryPool =
+      Input("--memoryPool","recycle buffers through size-class pools?",false);
+    const Int memoryAlign =
+      Input("--memoryAlign","alignment of buffers in bytes",Int(64));
+    SetMemoryAlignment( memoryAlign );
+    SetMemoryMode( memoryPool ? MEMORY_POOLED : MEMORY_SYSTEM );
+
+    // Configure the profiler
+    const bool profile = Input("--profile","profile regions?",false);
+    const bool profileTrace =
+      Input("--profileTrace","record a trace of the profiled regions?",false);
+    ::profileBasename =
+      Input("--profileFile","basename of the profile reports",
+            string("ElProfile"));
+    if( profile || profileTrace )
+        EnableProfiling( profileTrace );
+
+    // Configure the tracing of communication
+    const bool mpiTrace = Input("--mpiTrace","trace communication?",false);
+    ::traceBasename =
+      Input("--mpiTraceFile","basename of the communication reports",
+            string("ElTrace"));
+    if( mpiTrace )
+        mpi::EnableTracing();
+
+    // Load any persisted Gemm cost models
+    ::gemmCalibrationFile =
+      Input("--gemmCalibration","file of calibrated Gemm cost models",
+            string(""));
+    if( ::gemmCalibrationFile != "" )
+        LoadGemmCostModels( ::gemmCalibrationFile, false );
+
     // Build the default grid
     defaultGrid = new Grid( mpi::COMM_WORLD );
 
@@ -375,6 +419,24 @@ void Finalize()
         cerr << "Warning: MPI was finalized before Elemental." << endl;
     if( ::numElemInits == 0 )
     {
+        // Write the communication and profile reports while MPI is still 
+        // available
+        if( mpi::Tracing() && !mpi::Finalized() )
+        {
+            mpi::WriteTrace( ::traceBasename, mpi::COMM_WORLD );
+            mpi::DisableTracing();
+        }
+        if( Profiling() && !mpi::Finalized() )
+        {
+            WriteProfile( ::profileBasename, mpi::COMM_WORLD );
+            DisableProfiling();
+        }
+        if( ::gemmCalibrationFile != "" && !mpi::Finalized() )
+        {
+            SaveGemmCostModels( ::gemmCalibrationFile );
+            ClearGemmCostModels();
+        }
+
         delete ::args;
         ::args = 0;
        
@@ -385,6 +447,9 @@ void Finalize()
         delete ::defaultGrid;
         ::defaultGrid = 0;
 
+        // Return any cached buffers to the system
+        ReleaseMemoryPools();
+
 #ifdef EL_HAVE_QT5
         if( ::elemInitializedQt )
         {
@@ -619,6 +684,12 @@ template<>
 Int LocalTrrkBlocksize<Complex<double>>()
 { return ::localTrrkComplexDoubleBlocksize; }
 
+void SetGemmNumLayers( Int numLayers )
+{ ::gemmNumLayers = numLayers; }
+
+Int GemmNumLayers()
+{ return ::gemmNumLayers; }
+
 template<typename T>
 bool IsSorted( const vector<T>& x )
 {
@@ -245,6 +245,24 @@ void EL_LAPACK(zhseqr)
   dcomplex* w, dcomplex* Z, const BlasInt* ldZ,
   dcomplex* work, const BlasInt* workSize, BlasInt* info );
 
+// Reorder a Schur factorization
+void EL_LAPACK(strexc)
+( const char* compQ, const BlasInt* n, float* T, const BlasInt* ldT,
+  float* Q, const BlasInt* ldQ, BlasInt* iFirst, BlasInt* iLast,
+  float* work, BlasInt* info );
+void EL_LAPACK(dtrexc)
+( const char* compQ, const BlasInt* n, double* T, const BlasInt* ldT,
+  double* Q, const BlasInt* ldQ, BlasInt* iFirst, BlasInt* iLast,
+  double* work, BlasInt* info );
+void EL_LAPACK(ctrexc)
+( const char* compQ, const BlasInt* n, scomplex* T, const BlasInt* ldT,
+  scomplex* Q, const BlasInt* ldQ, const BlasInt* iFirst, 
+  const BlasInt* iLast, BlasInt* info );
+void EL_LAPACK(ztrexc)
+( const char* compQ, const BlasInt* n, dcomplex* T, const BlasInt* ldT,
+  dcomplex* Q, const BlasInt* ldQ, const BlasInt* iFirst, 
+  const BlasInt* iLast, BlasInt* info );
+
 // Compute eigenpairs of a general matrix using the QR algorithm followed
 // by a sequence of careful triangular solves
 void EL_LAPACK(sgeev)
@@ -1762,6 +1780,67 @@ void HessenbergSchur
         RuntimeError("zhseqr's failed to compute all eigenvalues");
 }
 
+// Reorder a Schur factorization
+// =============================
+
+bool SchurExchange
+( BlasInt n, float* T, BlasInt ldT, float* Q, BlasInt ldQ, 
+  BlasInt from, BlasInt to )
+{
+    DEBUG_ONLY(CSE cse("lapack::SchurExchange"))
+    const char compQ='V';
+    BlasInt iFirst=from+1, iLast=to+1, info;
+    vector<float> work( n );
+    EL_LAPACK(strexc)
+    ( &compQ, &n, T, &ldT, Q, &ldQ, &iFirst, &iLast, work.data(), &info );
+    if( info < 0 )
+        RuntimeError("Argument ",-info," had an illegal value");
+    return info == 0;
+}
+
+bool SchurExchange
+( BlasInt n, double* T, BlasInt ldT, double* Q, BlasInt ldQ, 
+  BlasInt from, BlasInt to )
+{
+    DEBUG_ONLY(CSE cse("lapack::SchurExchange"))
+    const char compQ='V';
+    BlasInt iFirst=from+1, iLast=to+1, info;
+    vector<double> work( n );
+    EL_LAPACK(dtrexc)
+    ( &compQ, &n, T, &ldT, Q, &ldQ, &iFirst, &iLast, work.data(), &info );
+    if( info < 0 )
+        RuntimeError("Argument ",-info," had an illegal value");
+    return info == 0;
+}
+
+bool SchurExchange
+( BlasInt n, scomplex* T, BlasInt ldT, scomplex* Q, BlasInt ldQ, 
+  BlasInt from, BlasInt to )
+{
+    DEBUG_ONLY(CSE cse("lapack::SchurExchange"))
+    const char compQ='V';
+    const BlasInt iFirst=from+1, iLast=to+1;
+    BlasInt info;
+    EL_LAPACK(ctrexc)( &compQ, &n, T, &ldT, Q, &ldQ, &iFirst, &iLast, &info );
+    if( info < 0 )
+        RuntimeError("Argument ",-info," had an illegal value");
+    return info == 0;
+}
+
+bool SchurExchange
+( BlasInt n, dcomplex* T, BlasInt ldT, dcomplex* Q, BlasInt ldQ, 
+  BlasInt from, BlasInt to )
+{
+    DEBUG_ONLY(CSE cse("lapack::SchurExchange"))
+    const char compQ='V';
+    const BlasInt iFirst=from+1, iLast=to+1;
+    BlasInt info;
+    EL_LAPACK(ztrexc)( &compQ, &n, T, &ldT, Q, &ldQ, &iFirst, &iLast, &info );
+    if( info < 0 )
+        RuntimeError("Argument ",-info," had an illegal value");
+    return info == 0;
+}
+
 // Compute eigenvalues/pairs of an upper Hessenberg matrix
 // =======================================================
 
@@ -9,6 +9,9 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include "El.hpp"
+#include <iomanip>
+#include <map>
+#include <numeric>
 
 // TODO: Introduce macros to shorten the explicit instantiation code
 
@@ -30,6 +33,291 @@ SafeMpi( int mpiError )
     )
 }
 
+// Communication tracing
+// =====================
+
+struct TraceComm
+{
+    std::string label;
+    int rank, size;
+    std::vector<int> worldRanks;
+};
+
+// The routine and site names are string literals, and so the pointers are
+// compared (the records are merged by their contents when reported)
+struct TraceKey
+{
+    const char* routine;
+    int comm;
+    const char* site;
+};
+
+struct TraceKeyLess
+{
+    bool operator()( const TraceKey& a, const TraceKey& b ) const
+    {
+        std::less<const char*> less;
+        if( a.routine != b.routine )
+            return less( a.routine, b.routine );
+        if( a.comm != b.comm )
+            return a.comm < b.comm;
+        return less( a.site, b.site );
+    }
+};
+
+struct TraceRecord
+{
+    El::Int numCalls=0;
+    double sendBytes=0, recvBytes=0, time=0;
+};
+
+bool tracing = false;
+int traceDepth = 0;
+std::map<MPI_Comm,int> traceCommIds;
+std::vector<TraceComm> traceComms;
+std::map<TraceKey,TraceRecord,TraceKeyLess> traceRecords;
+std::vector<double> traceVolumes;
+// The communicators that pending traced nonblocking requests were posted on,
+// so that the time spent waiting for them can be charged accordingly
+std::map<MPI_Request,int> traceRequestComms;
+
+// Return the index of the description of the communicator, forming it upon
+// its first use
+int TraceCommId( MPI_Comm comm )
+{
+    if( comm == MPI_COMM_NULL )
+        return -1;
+    auto it = traceCommIds.find( comm );
+    if( it != traceCommIds.end() )
+        return it->second;
+
+    TraceComm info;
+    MPI_Comm_rank( comm, &info.rank );
+    MPI_Comm_size( comm, &info.size );
+    MPI_Group group, worldGroup;
+    MPI_Comm_group( comm, &group );
+    MPI_Comm_group( MPI_COMM_WORLD, &worldGroup );
+    std::vector<int> ranks( info.size );
+    for( int q=0; q<info.size; ++q )
+        ranks[q] = q;
+    info.worldRanks.resize( info.size );
+    MPI_Group_translate_ranks
+    ( group, info.size, ranks.data(), worldGroup, info.worldRanks.data() );
+    MPI_Group_free( &group );
+    MPI_Group_free( &worldGroup );
+
+    // Label the communicator by its size and (first few) members
+    std::ostringstream os;
+    os << "p=" << info.size << " {";
+    const int numShown = std::min( info.size, 4 );
+    for( int q=0; q<numShown; ++q )
+        os << ( q==0 ? "" : "," ) << info.worldRanks[q];
+    os << ( numShown < info.size ? ",...}" : "}" );
+    info.label = os.str();
+
+    const int id = traceComms.size();
+    traceComms.push_back( info );
+    traceCommIds[comm] = id;
+    return id;
+}
+
+// The sum of the counts of all but the given rank
+inline double SumOthers( const int* counts, int size, int rank )
+{
+    double sum = 0;
+    for( int q=0; q<size; ++q )
+        if( q != rank )
+            sum += counts[q];
+    return sum;
+}
+
+// Record a call of a communication routine over its lifetime. Only the
+// outermost traced call (of the master thread) is recorded.
+class CallTrace
+{
+public:
+    CallTrace( const char* routine, El::mpi::Comm comm )
+    {
+        if( !tracing )
+            return;
+#ifdef EL_HYBRID
+        if( omp_get_thread_num() != 0 )
+            return;
+#endif
+        if( traceDepth++ > 0 )
+        {
+            nested_ = true;
+            return;
+        }
+        active_ = true;
+        routine_ = routine;
+        commId_ = TraceCommId( comm.comm );
+        if( commId_ >= 0 )
+        {
+            rank_ = traceComms[commId_].rank;
+            size_ = traceComms[commId_].size;
+        }
+        start_ = El::Clock::now();
+    }
+
+    ~CallTrace()
+    {
+        if( nested_ )
+            --traceDepth;
+        if( !active_ )
+            return;
+        --traceDepth;
+        const double elapsed =
+          std::chrono::duration_cast<std::chrono::duration<double>>
+          (El::Clock::now()-start_).count();
+        TraceKey key;
+        key.routine = routine_;
+        key.comm = commId_;
+        key.site = El::CurrentProfileRegion();
+        TraceRecord& record = traceRecords[key];
+        ++record.numCalls;
+        record.sendBytes += sendBytes_;
+        record.recvBytes += recvBytes_;
+        record.time += elapsed;
+        El::AddProfileBytes( sendBytes_ );
+        if( request_ != nullptr && *request_ != MPI_REQUEST_NULL )
+            traceRequestComms[*request_] = commId_;
+    }
+
+    bool Active() const { return active_; }
+    // Remember the communicator of the nonblocking request posted by this 
+    // call so that waiting for it is charged to the same communicator
+    void Post( MPI_Request& request ) { request_ = &request; }
+    int Rank() const { return rank_; }
+    int Size() const { return size_; }
+
+    // Charge a message to the given rank of the communicator
+    void SendTo( int rank, double bytes )
+    {
+        sendBytes_ += bytes;
+        if( commId_ >= 0 && rank >= 0 && rank < size_ )
+        {
+            const int worldRank = traceComms[commId_].worldRanks[rank];
+            if( worldRank >= 0 && worldRank < int(traceVolumes.size()) )
+                traceVolumes[worldRank] += bytes;
+        }
+    }
+    // Charge a message of the given size to each of the other members
+    void SendToOthers( double bytes )
+    {
+        for( int q=0; q<size_; ++q )
+            if( q != rank_ )
+                SendTo( q, bytes );
+    }
+    // Charge the given numbers of entries to each of the other members
+    void SendToEach( const int* counts, double entrySize )
+    {
+        for( int q=0; q<size_; ++q )
+            if( q != rank_ )
+                SendTo( q, counts[q]*entrySize );
+    }
+    void Recv( double bytes ) { recvBytes_ += bytes; }
+    // Charge the given number of bytes from each of the other members
+    void RecvFromOthers( double bytes ) { recvBytes_ += bytes*(size_-1); }
+
+private:
+    bool active_=false, nested_=false;
+    const char* routine_=nullptr;
+    int commId_=-1, rank_=0, size_=1;
+    double sendBytes_=0, recvBytes_=0;
+    MPI_Request* request_=nullptr;
+    El::Clock::time_point start_;
+};
+
+// Stop tracking a traced nonblocking request that completed (whether or not
+// tracing is still enabled, as the handle may be reused by MPI)
+inline void ForgetRequest( MPI_Request request )
+{
+#ifdef EL_HYBRID
+    if( omp_get_thread_num() != 0 )
+        return;
+#endif
+    if( !traceRequestComms.empty() )
+        traceRequestComms.erase( request );
+}
+
+// Record a wait for traced nonblocking requests, charging the time to the
+// communicators that the requests were posted on (in proportion to the
+// number of requests from each when they were posted on several)
+class WaitTrace
+{
+public:
+    WaitTrace
+    ( const char* routine, const MPI_Request* requests, int numRequests )
+    {
+#ifdef EL_HYBRID
+        if( omp_get_thread_num() != 0 )
+            return;
+#endif
+        // The requests are complete once the wait returns, and so they are
+        // forgotten even if the wait itself is not traced
+        const bool traced = tracing && traceDepth == 0;
+        for( int j=0; j<numRequests; ++j )
+        {
+            int commId = -1;
+            if( !traceRequestComms.empty() )
+            {
+                auto it = traceRequestComms.find( requests[j] );
+                if( it != traceRequestComms.end() )
+                {
+                    commId = it->second;
+                    traceRequestComms.erase( it );
+                }
+            }
+            if( traced )
+                ++commCounts_[commId];
+        }
+        if( !tracing )
+            return;
+        if( traceDepth++ > 0 )
+        {
+            nested_ = true;
+            return;
+        }
+        active_ = true;
+        routine_ = routine;
+        if( numRequests == 0 )
+            commCounts_[-1] = 1;
+        start_ = El::Clock::now();
+    }
+
+    ~WaitTrace()
+    {
+        if( nested_ )
+            --traceDepth;
+        if( !active_ )
+            return;
+        --traceDepth;
+        const double elapsed =
+          std::chrono::duration_cast<std::chrono::duration<double>>
+          (El::Clock::now()-start_).count();
+        int total = 0;
+        for( const auto& entry : commCounts_ )
+            total += entry.second;
+        TraceKey key;
+        key.routine = routine_;
+        key.site = El::CurrentProfileRegion();
+        for( const auto& entry : commCounts_ )
+        {
+            key.comm = entry.first;
+            TraceRecord& record = traceRecords[key];
+            ++record.numCalls;
+            record.time += elapsed*entry.second/total;
+        }
+    }
+
+private:
+    bool active_=false, nested_=false;
+    const char* routine_=nullptr;
+    std::map<int,int> commCounts_;
+    El::Clock::time_point start_;
+};
+
 } // anonymous namespace
 
 namespace El {
@@ -173,6 +461,8 @@ void Split( Comm comm, int color, int key, Comm& newComm )
 void Free( Comm& comm )
 {
     DEBUG_ONLY(CSE cse("mpi::Free"))
+    // The handle may be reused for a different communicator
+    traceCommIds.erase( comm.comm );
     SafeMpi( MPI_Comm_free( &comm.comm ) );
 }
 
@@ -375,6 +665,7 @@ void Translate
 void Barrier( Comm comm )
 {
     DEBUG_ONLY(CSE cse("mpi::Barrier"))
+    CallTrace trace("Barrier",comm);
     SafeMpi( MPI_Barrier( comm.comm ) );
 }
 
@@ -382,9 +673,12 @@ void Barrier( Comm comm )
 bool Test( Request& request )
 {
     DEBUG_ONLY(CSE cse("mpi::Test"))
+    const Request posted = request;
     Status status;
     int flag;
     SafeMpi( MPI_Test( &request, &flag, &status ) );
+    if( flag )
+        ForgetRequest( posted );
     return flag;
 }
 
@@ -392,6 +686,7 @@ bool Test( Request& request )
 void Wait( Request& request )
 {
     DEBUG_ONLY(CSE cse("mpi::Wait"))
+    WaitTrace trace("Wait",&request,1);
     Status status;
     SafeMpi( MPI_Wait( &request, &status ) );
 }
@@ -400,6 +695,7 @@ void Wait( Request& request )
 void Wait( Request& request, Status& status )
 {
     DEBUG_ONLY(CSE cse("mpi::Wait"))
+    WaitTrace trace("Wait",&request,1);
     SafeMpi( MPI_Wait( &request, &status ) );
 }
 
@@ -407,6 +703,7 @@ void Wait( Request& request, Status& status )
 void WaitAll( int numRequests, Request* requests )
 {
     DEBUG_ONLY(CSE cse("mpi::WaitAll"))
+    WaitTrace trace("WaitAll",requests,numRequests);
     vector<Status> statuses( numRequests );
     SafeMpi( MPI_Waitall( numRequests, requests, statuses.data() ) );
 }
@@ -415,6 +712,7 @@ void WaitAll( int numRequests, Request* requests )
 void WaitAll( int numRequests, Request* requests, Status* statuses )
 {
     DEBUG_ONLY(CSE cse("mpi::WaitAll"))
+    WaitTrace trace("WaitAll",requests,numRequests);
     SafeMpi( MPI_Waitall( numRequests, requests, statuses ) );
 }
 
@@ -429,6 +727,123 @@ bool IProbe( int source, int tag, Comm comm, Status& status )
 bool IProbe( int source, Comm comm, Status& status )
 { return IProbe( source, 0, comm, status ); }
 
+// Datatype construction
+// =====================
+
+void Commit( Datatype& type )
+{
+    DEBUG_ONLY(CSE cse("mpi::Commit"))
+    SafeMpi( MPI_Type_commit( &type ) );
+}
+
+void CreateVector
+( int count, int blocksize, int stride, Datatype oldType, Datatype& newType )
+{
+    DEBUG_ONLY(CSE cse("mpi::CreateVector"))
+    SafeMpi( MPI_Type_vector( count, blocksize, stride, oldType, &newType ) );
+}
+
+void CreateIndexed
+( int count, const int* blocksizes, const int* displs, 
+  Datatype oldType, Datatype& newType )
+{
+    DEBUG_ONLY(CSE cse("mpi::CreateIndexed"))
+    SafeMpi
+    ( MPI_Type_indexed
+      ( count, const_cast<int*>(blocksizes), const_cast<int*>(displs), 
+        oldType, &newType ) );
+}
+
+void CreateHIndexed
+( int count, const int* blocksizes, const Aint* displs, 
+  Datatype oldType, Datatype& newType )
+{
+    DEBUG_ONLY(CSE cse("mpi::CreateHIndexed"))
+    SafeMpi
+    ( MPI_Type_create_hindexed
+      ( count, const_cast<int*>(blocksizes), const_cast<Aint*>(displs), 
+        oldType, &newType ) );
+}
+
+// Parallel I/O
+// ============
+
+void Open( Comm comm, const std::string& filename, bool write, File& file )
+{
+    DEBUG_ONLY(CSE cse("mpi::Open"))
+    const int amode = 
+      ( write ? MPI_MODE_CREATE | MPI_MODE_WRONLY : MPI_MODE_RDONLY );
+    const int error = 
+      MPI_File_open
+      ( comm.comm, const_cast<char*>(filename.c_str()), amode, 
+        MPI_INFO_NULL, &file.file );
+    if( error != MPI_SUCCESS )
+        RuntimeError("Could not open ",filename);
+}
+
+void Close( File& file )
+{
+    DEBUG_ONLY(CSE cse("mpi::Close"))
+    SafeMpi( MPI_File_close( &file.file ) );
+}
+
+Offset Size( File file )
+{
+    DEBUG_ONLY(CSE cse("mpi::Size"))
+    Offset size;
+    SafeMpi( MPI_File_get_size( file.file, &size ) );
+    return size;
+}
+
+void SetSize( File file, Offset size )
+{
+    DEBUG_ONLY(CSE cse("mpi::SetSize"))
+    SafeMpi( MPI_File_set_size( file.file, size ) );
+}
+
+void SetView( File file, Offset disp, Datatype etype, Datatype fileType )
+{
+    DEBUG_ONLY(CSE cse("mpi::SetView"))
+    SafeMpi
+    ( MPI_File_set_view
+      ( file.file, disp, etype, fileType, const_cast<char*>("native"),
+        MPI_INFO_NULL ) );
+}
+
+void ReadAt( File file, Offset offset, void* buf, int count, Datatype type )
+{
+    DEBUG_ONLY(CSE cse("mpi::ReadAt"))
+    Status status;
+    SafeMpi
+    ( MPI_File_read_at( file.file, offset, buf, count, type, &status ) );
+}
+
+void WriteAt
+( File file, Offset offset, const void* buf, int count, Datatype type )
+{
+    DEBUG_ONLY(CSE cse("mpi::WriteAt"))
+    Status status;
+    SafeMpi
+    ( MPI_File_write_at
+      ( file.file, offset, const_cast<void*>(buf), count, type, &status ) );
+}
+
+void ReadAll( File file, void* buf, int count, Datatype type )
+{
+    DEBUG_ONLY(CSE cse("mpi::ReadAll"))
+    Status status;
+    SafeMpi( MPI_File_read_all( file.file, buf, count, type, &status ) );
+}
+
+void WriteAll( File file, const void* buf, int count, Datatype type )
+{
+    DEBUG_ONLY(CSE cse("mpi::WriteAll"))
+    Status status;
+    SafeMpi
+    ( MPI_File_write_all
+      ( file.file, const_cast<void*>(buf), count, type, &status ) );
+}
+
 template<typename T>
 int GetCount( Status& status )
 {
@@ -442,6 +857,9 @@ template<typename Real>
 void TaggedSend( const Real* buf, int count, int to, int tag, Comm comm )
 { 
     DEBUG_ONLY(CSE cse("mpi::Send"))
+    CallTrace trace("Send",comm);
+    if( trace.Active() )
+        trace.SendTo( to, double(count)*sizeof(*buf) );
     SafeMpi( 
         MPI_Send
         ( const_cast<Real*>(buf), count, TypeMap<Real>(), to, tag, comm.comm )
@@ -453,6 +871,9 @@ void TaggedSend
 ( const Complex<Real>* buf, int count, int to, int tag, Comm comm )
 {
     DEBUG_ONLY(CSE cse("mpi::Send"))
+    CallTrace trace("Send",comm);
+    if( trace.Active() )
+        trace.SendTo( to, double(count)*sizeof(*buf) );
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Send
@@ -483,6 +904,10 @@ void TaggedISend
 ( const Real* buf, int count, int to, int tag, Comm comm, Request& request )
 { 
     DEBUG_ONLY(CSE cse("mpi::ISend"))
+    CallTrace trace("ISend",comm);
+    trace.Post( request );
+    if( trace.Active() )
+        trace.SendTo( to, double(count)*sizeof(*buf) );
     SafeMpi
     ( MPI_Isend
       ( const_cast<Real*>(buf), count, TypeMap<Real>(), to, 
@@ -495,6 +920,10 @@ void TaggedISend
   Request& request )
 {
     DEBUG_ONLY(CSE cse("mpi::ISend"))
+    CallTrace trace("ISend",comm);
+    trace.Post( request );
+    if( trace.Active() )
+        trace.SendTo( to, double(count)*sizeof(*buf) );
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Isend
@@ -526,6 +955,10 @@ void TaggedISSend
 ( const Real* buf, int count, int to, int tag, Comm comm, Request& request )
 {
     DEBUG_ONLY(CSE cse("mpi::ISSend"))
+    CallTrace trace("ISSend",comm);
+    trace.Post( request );
+    if( trace.Active() )
+        trace.SendTo( to, double(count)*sizeof(*buf) );
     SafeMpi
     ( MPI_Issend
       ( const_cast<Real*>(buf), count, TypeMap<Real>(), to, 
@@ -538,6 +971,10 @@ void TaggedISSend
   Request& request )
 {
     DEBUG_ONLY(CSE cse("mpi::ISSend"))
+    CallTrace trace("ISSend",comm);
+    trace.Post( request );
+    if( trace.Active() )
+        trace.SendTo( to, double(count)*sizeof(*buf) );
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Issend
@@ -563,6 +1000,9 @@ template<typename Real>
 void TaggedRecv( Real* buf, int count, int from, int tag, Comm comm )
 {
     DEBUG_ONLY(CSE cse("mpi::Recv"))
+    CallTrace trace("Recv",comm);
+    if( trace.Active() )
+        trace.Recv( double(count)*sizeof(*buf) );
     Status status;
     SafeMpi
     ( MPI_Recv( buf, count, TypeMap<Real>(), from, tag, comm.comm, &status ) );
@@ -572,6 +1012,9 @@ template<typename Real>
 void TaggedRecv( Complex<Real>* buf, int count, int from, int tag, Comm comm )
 {
     DEBUG_ONLY(CSE cse("mpi::Recv"))
+    CallTrace trace("Recv",comm);
+    if( trace.Active() )
+        trace.Recv( double(count)*sizeof(*buf) );
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
@@ -600,6 +1043,10 @@ void TaggedIRecv
 ( Real* buf, int count, int from, int tag, Comm comm, Request& request )
 {
     DEBUG_ONLY(CSE cse("mpi::IRecv"))
+    CallTrace trace("IRecv",comm);
+    trace.Post( request );
+    if( trace.Active() )
+        trace.Recv( double(count)*sizeof(*buf) );
     SafeMpi
     ( MPI_Irecv
       ( buf, count, TypeMap<Real>(), from, tag, comm.comm, &request ) );
@@ -611,6 +1058,10 @@ void TaggedIRecv
   Comm comm, Request& request )
 {
     DEBUG_ONLY(CSE cse("mpi::IRecv"))
+    CallTrace trace("IRecv",comm);
+    trace.Post( request );
+    if( trace.Active() )
+        trace.Recv( double(count)*sizeof(*buf) );
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Irecv( buf, 2*count, TypeMap<Real>(), from, tag, comm.comm, &request ) );
@@ -639,6 +1090,12 @@ void TaggedSendRecv
         Real* rbuf, int rc, int from, int rtag, Comm comm )
 {
     DEBUG_ONLY(CSE cse("mpi::SendRecv"))
+    CallTrace trace("SendRecv",comm);
+    if( trace.Active() )
+    {
+        trace.SendTo( to, double(sc)*sizeof(*sbuf) );
+        trace.Recv( double(rc)*sizeof(*rbuf) );
+    }
     Status status;
     SafeMpi
     ( MPI_Sendrecv
@@ -653,6 +1110,12 @@ void TaggedSendRecv
         Complex<Real>* rbuf, int rc, int from, int rtag, Comm comm )
 {
     DEBUG_ONLY(CSE cse("mpi::SendRecv"))
+    CallTrace trace("SendRecv",comm);
+    if( trace.Active() )
+    {
+        trace.SendTo( to, double(sc)*sizeof(*sbuf) );
+        trace.Recv( double(rc)*sizeof(*rbuf) );
+    }
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
@@ -693,6 +1156,12 @@ void TaggedSendRecv
 ( Real* buf, int count, int to, int stag, int from, int rtag, Comm comm )
 {
     DEBUG_ONLY(CSE cse("mpi::SendRecv"))
+    CallTrace trace("SendRecv",comm);
+    if( trace.Active() )
+    {
+        trace.SendTo( to, double(count)*sizeof(*buf) );
+        trace.Recv( double(count)*sizeof(*buf) );
+    }
     Status status;
     SafeMpi
     ( MPI_Sendrecv_replace
@@ -704,6 +1173,12 @@ void TaggedSendRecv
 ( Complex<Real>* buf, int count, int to, int stag, int from, int rtag, Comm comm )
 {
     DEBUG_ONLY(CSE cse("mpi::SendRecv"))
+    CallTrace trace("SendRecv",comm);
+    if( trace.Active() )
+    {
+        trace.SendTo( to, double(count)*sizeof(*buf) );
+        trace.Recv( double(count)*sizeof(*buf) );
+    }
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
@@ -726,6 +1201,15 @@ template<typename Real>
 void Broadcast( Real* buf, int count, int root, Comm comm )
 {
     DEBUG_ONLY(CSE cse("mpi::Broadcast"))
+    CallTrace trace("Broadcast",comm);
+    if( trace.Active() )
+    {
+        const double bytes = double(count)*sizeof(*buf);
+        if( trace.Rank() == root )
+            trace.SendToOthers( bytes );
+        else
+            trace.Recv( bytes );
+    }
     SafeMpi( MPI_Bcast( buf, count, TypeMap<Real>(), root, comm.comm ) );
 }
 
@@ -733,6 +1217,15 @@ template<typename Real>
 void Broadcast( Complex<Real>* buf, int count, int root, Comm comm )
 {
     DEBUG_ONLY(CSE cse("mpi::Broadcast"))
+    CallTrace trace("Broadcast",comm);
+    if( trace.Active() )
+    {
+        const double bytes = double(count)*sizeof(*buf);
+        if( trace.Rank() == root )
+            trace.SendToOthers( bytes );
+        else
+            trace.Recv( bytes );
+    }
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi( MPI_Bcast( buf, 2*count, TypeMap<Real>(), root, comm.comm ) );
 #else
@@ -748,9 +1241,20 @@ template<typename Real>
 void IBroadcast( Real* buf, int count, int root, Comm comm, Request& request )
 {
     DEBUG_ONLY(CSE cse("mpi::IBroadcast"))
+    CallTrace trace("IBroadcast",comm);
+    trace.Post( request );
+    if( trace.Active() )
+    {
+        const double bytes = double(count)*sizeof(*buf);
+        if( trace.Rank() == root )
+            trace.SendToOthers( bytes );
+        else
+            trace.Recv( bytes );
+    }
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
     SafeMpi
-    ( MPI_Ibcast( buf, count, TypeMap<Real>(), root, comm.comm, &request ) );
+    ( EL_NONBLOCKING_COLL(Ibcast)
+      ( buf, count, TypeMap<Real>(), root, comm.comm, &request ) );
 #else
     LogicError("Elemental was not configured with non-blocking support");
 #endif
@@ -761,13 +1265,24 @@ void IBroadcast
 ( Complex<Real>* buf, int count, int root, Comm comm, Request& request )
 {
     DEBUG_ONLY(CSE cse("mpi::IBroadcast"))
+    CallTrace trace("IBroadcast",comm);
+    trace.Post( request );
+    if( trace.Active() )
+    {
+        const double bytes = double(count)*sizeof(*buf);
+        if( trace.Rank() == root )
+            trace.SendToOthers( bytes );
+        else
+            trace.Recv( bytes );
+    }
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Ibcast( buf, 2*count, TypeMap<Real>(), root, comm.comm, &request ) );
+    ( EL_NONBLOCKING_COLL(Ibcast)
+      ( buf, 2*count, TypeMap<Real>(), root, comm.comm, &request ) );
 #else
     SafeMpi
-    ( MPI_Ibcast
+    ( EL_NONBLOCKING_COLL(Ibcast)
       ( buf, count, TypeMap<Complex<Real>>(), root, comm.comm, &request ) );
 #endif
 #else
@@ -785,6 +1300,14 @@ void Gather
         Real* rbuf, int rc, int root, Comm comm )
 {
     DEBUG_ONLY(CSE cse("mpi::Gather"))
+    CallTrace trace("Gather",comm);
+    if( trace.Active() )
+    {
+        if( trace.Rank() != root )
+            trace.SendTo( root, double(sc)*sizeof(*sbuf) );
+        else
+            trace.RecvFromOthers( double(rc)*sizeof(*rbuf) );
+    }
     SafeMpi
     ( MPI_Gather
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
@@ -797,6 +1320,14 @@ void Gather
         Complex<Real>* rbuf, int rc, int root, Comm comm )
 {
     DEBUG_ONLY(CSE cse("mpi::Gather"))
+    CallTrace trace("Gather",comm);
+    if( trace.Active() )
+    {
+        if( trace.Rank() != root )
+            trace.SendTo( root, double(sc)*sizeof(*sbuf) );
+        else
+            trace.RecvFromOthers( double(rc)*sizeof(*rbuf) );
+    }
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Gather
@@ -817,9 +1348,18 @@ void IGather
         Real* rbuf, int rc, int root, Comm comm, Request& request )
 {
     DEBUG_ONLY(CSE cse("mpi::IGather"))
+    CallTrace trace("IGather",comm);
+    trace.Post( request );
+    if( trace.Active() )
+    {
+        if( trace.Rank() != root )
+            trace.SendTo( root, double(sc)*sizeof(*sbuf) );
+        else
+            trace.RecvFromOthers( double(rc)*sizeof(*rbuf) );
+    }
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
     SafeMpi
-    ( MPI_Igather
+    ( EL_NONBLOCKING_COLL(Igather)
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
         rbuf,                    rc, TypeMap<Real>(), root, comm.comm, &request ) );
 #else
@@ -833,16 +1373,25 @@ void IGather
         Complex<Real>* rbuf, int rc, int root, Comm comm, Request& request )
 {
     DEBUG_ONLY(CSE cse("mpi::IGather"))
+    CallTrace trace("IGather",comm);
+    trace.Post( request );
+    if( trace.Active() )
+    {
+        if( trace.Rank() != root )
+            trace.SendTo( root, double(sc)*sizeof(*sbuf) );
+        else
+            trace.RecvFromOthers( double(rc)*sizeof(*rbuf) );
+    }
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Igather
+    ( EL_NONBLOCKING_COLL(Igather)
       ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
         rbuf,                             2*rc, TypeMap<Real>(), 
         root, comm.comm, &request ) );
 #else
     SafeMpi
-    ( MPI_Igather
+    ( EL_NONBLOCKING_COLL(Igather)
       ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
         rbuf,                             rc, TypeMap<Complex<Real>>(), 
         root, comm.comm, &request ) );
@@ -858,6 +1407,14 @@ void Gather
         Real* rbuf, const int* rcs, const int* rds, int root, Comm comm )
 {
     DEBUG_ONLY(CSE cse("mpi::Gather"))
+    CallTrace trace("Gather",comm);
+    if( trace.Active() )
+    {
+        if( trace.Rank() != root )
+            trace.SendTo( root, double(sc)*sizeof(*sbuf) );
+        else
+            trace.Recv( SumOthers(rcs,trace.Size(),root)*sizeof(*rbuf) );
+    }
     SafeMpi
     ( MPI_Gatherv
       ( const_cast<Real*>(sbuf), 
@@ -877,6 +1434,14 @@ void Gather
         Complex<Real>* rbuf, const int* rcs, const int* rds, int root, Comm comm )
 {
     DEBUG_ONLY(CSE cse("mpi::Gather"))
+    CallTrace trace("Gather",comm);
+    if( trace.Active() )
+    {
+        if( trace.Rank() != root )
+            trace.SendTo( root, double(sc)*sizeof(*sbuf) );
+        else
+            trace.Recv( SumOthers(rcs,trace.Size(),root)*sizeof(*rbuf) );
+    }
 #ifdef EL_AVOID_COMPLEX_MPI
     const int commRank = Rank( comm );
     const int commSize = Size( comm );
@@ -917,6 +1482,12 @@ void AllGather
         Real* rbuf, int rc, Comm comm )
 {
     DEBUG_ONLY(CSE cse("mpi::AllGather"))
+    CallTrace trace("AllGather",comm);
+    if( trace.Active() )
+    {
+        trace.SendToOthers( double(sc)*sizeof(*sbuf) );
+        trace.RecvFromOthers( double(rc)*sizeof(*rbuf) );
+    }
 #ifdef EL_USE_BYTE_ALLGATHERS
     SafeMpi
     ( MPI_Allgather
@@ -937,6 +1508,12 @@ void AllGather
         Complex<Real>* rbuf, int rc, Comm comm )
 {
     DEBUG_ONLY(CSE cse("mpi::AllGather"))
+    CallTrace trace("AllGather",comm);
+    if( trace.Active() )
+    {
+        trace.SendToOthers( double(sc)*sizeof(*sbuf) );
+        trace.RecvFromOthers( double(rc)*sizeof(*rbuf) );
+    }
 #ifdef EL_USE_BYTE_ALLGATHERS
     SafeMpi
     ( MPI_Allgather
@@ -958,12 +1535,73 @@ void AllGather
 #endif
 }
 
+template<typename Real>
+void IAllGather
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc, Comm comm, Request& request )
+{
+    DEBUG_ONLY(CSE cse("mpi::IAllGather"))
+    CallTrace trace("IAllGather",comm);
+    trace.Post( request );
+    if( trace.Active() )
+    {
+        trace.SendToOthers( double(sc)*sizeof(*sbuf) );
+        trace.RecvFromOthers( double(rc)*sizeof(*rbuf) );
+    }
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Iallgather)
+      ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
+        rbuf,                    rc, TypeMap<Real>(), comm.comm, &request ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename Real>
+void IAllGather
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc, Comm comm, Request& request )
+{
+    DEBUG_ONLY(CSE cse("mpi::IAllGather"))
+    CallTrace trace("IAllGather",comm);
+    trace.Post( request );
+    if( trace.Active() )
+    {
+        trace.SendToOthers( double(sc)*sizeof(*sbuf) );
+        trace.RecvFromOthers( double(rc)*sizeof(*rbuf) );
+    }
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+#ifdef EL_AVOID_COMPLEX_MPI
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Iallgather)
+      ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
+        rbuf,                             2*rc, TypeMap<Real>(),
+        comm.comm, &request ) );
+#else
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Iallgather)
+      ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
+        rbuf,                             rc, TypeMap<Complex<Real>>(),
+        comm.comm, &request ) );
+#endif
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
 template<typename Real>
 void AllGather
 ( const Real* sbuf, int sc,
         Real* rbuf, const int* rcs, const int* rds, Comm comm )
 {
     DEBUG_ONLY(CSE cse("mpi::AllGather"))
+    CallTrace trace("AllGather",comm);
+    if( trace.Active() )
+    {
+        trace.SendToOthers( double(sc)*sizeof(*sbuf) );
+        trace.Recv( SumOthers(rcs,trace.Size(),trace.Rank())*sizeof(*rbuf) );
+    }
 #ifdef EL_USE_BYTE_ALLGATHERS
     const int commSize = Size( comm );
     vector<int> byteRcs( commSize ), byteRds( commSize );
@@ -997,6 +1635,12 @@ void AllGather
         Complex<Real>* rbuf, const int* rcs, const int* rds, Comm comm )
 {
     DEBUG_ONLY(CSE cse("mpi::AllGather"))
+    CallTrace trace("AllGather",comm);
+    if( trace.Active() )
+    {
+        trace.SendToOthers( double(sc)*sizeof(*sbuf) );
+        trace.Recv( SumOthers(rcs,trace.Size(),trace.Rank())*sizeof(*rbuf) );
+    }
 #ifdef EL_USE_BYTE_ALLGATHERS
     const int commSize = Size( comm );
     vector<int> byteRcs( commSize ), byteRds( commSize );
@@ -1044,6 +1688,14 @@ void Scatter
         Real* rbuf, int rc, int root, Comm comm )
 {
     DEBUG_ONLY(CSE cse("mpi::Scatter"))
+    CallTrace trace("Scatter",comm);
+    if( trace.Active() )
+    {
+        if( trace.Rank() == root )
+            trace.SendToOthers( double(sc)*sizeof(*sbuf) );
+        else
+            trace.Recv( double(rc)*sizeof(*rbuf) );
+    }
     SafeMpi
     ( MPI_Scatter
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
@@ -1056,6 +1708,14 @@ void Scatter
         Complex<Real>* rbuf, int rc, int root, Comm comm )
 {
     DEBUG_ONLY(CSE cse("mpi::Scatter"))
+    CallTrace trace("Scatter",comm);
+    if( trace.Active() )
+    {
+        if( trace.Rank() == root )
+            trace.SendToOthers( double(sc)*sizeof(*sbuf) );
+        else
+            trace.Recv( double(rc)*sizeof(*rbuf) );
+    }
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Scatter
@@ -1074,6 +1734,14 @@ template<typename Real>
 void Scatter( Real* buf, int sc, int rc, int root, Comm comm )
 {
     DEBUG_ONLY(CSE cse("mpi::Scatter"))
+    CallTrace trace("Scatter",comm);
+    if( trace.Active() )
+    {
+        if( trace.Rank() == root )
+            trace.SendToOthers( double(sc)*sizeof(*buf) );
+        else
+            trace.Recv( double(rc)*sizeof(*buf) );
+    }
     const int commRank = Rank( comm );
     if( commRank == root )
     {
@@ -1105,6 +1773,14 @@ template<typename Real>
 void Scatter( Complex<Real>* buf, int sc, int rc, int root, Comm comm )
 {
     DEBUG_ONLY(CSE cse("mpi::Scatter"))
+    CallTrace trace("Scatter",comm);
+    if( trace.Active() )
+    {
+        if( trace.Rank() == root )
+            trace.SendToOthers( double(sc)*sizeof(*buf) );
+        else
+            trace.Recv( double(rc)*sizeof(*buf) );
+    }
     const int commRank = Rank( comm );
     if( commRank == root )
     {
@@ -1162,6 +1838,12 @@ void AllToAll
         Real* rbuf, int rc, Comm comm )
 {
     DEBUG_ONLY(CSE cse("mpi::AllToAll"))
+    CallTrace trace("AllToAll",comm);
+    if( trace.Active() )
+    {
+        trace.SendToOthers( double(sc)*sizeof(*sbuf) );
+        trace.RecvFromOthers( double(rc)*sizeof(*rbuf) );
+    }
     SafeMpi
     ( MPI_Alltoall
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
@@ -1174,6 +1856,12 @@ void AllToAll
         Complex<Real>* rbuf, int rc, Comm comm )
 {
     DEBUG_ONLY(CSE cse("mpi::AllToAll"))
+    CallTrace trace("AllToAll",comm);
+    if( trace.Active() )
+    {
+        trace.SendToOthers( double(sc)*sizeof(*sbuf) );
+        trace.RecvFromOthers( double(rc)*sizeof(*rbuf) );
+    }
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Alltoall
@@ -1193,6 +1881,12 @@ void AllToAll
         Real* rbuf, const int* rcs, const int* rds, Comm comm )
 {
     DEBUG_ONLY(CSE cse("mpi::AllToAll"))
+    CallTrace trace("AllToAll",comm);
+    if( trace.Active() )
+    {
+        trace.SendToEach( scs, sizeof(*sbuf) );
+        trace.Recv( SumOthers(rcs,trace.Size(),trace.Rank())*sizeof(*rbuf) );
+    }
     SafeMpi
     ( MPI_Alltoallv
       ( const_cast<Real*>(sbuf), 
@@ -1212,6 +1906,12 @@ void AllToAll
         Complex<Real>* rbuf, const int* rcs, const int* rds, Comm comm )
 {
     DEBUG_ONLY(CSE cse("mpi::AllToAll"))
+    CallTrace trace("AllToAll",comm);
+    if( trace.Active() )
+    {
+        trace.SendToEach( scs, sizeof(*sbuf) );
+        trace.Recv( SumOthers(rcs,trace.Size(),trace.Rank())*sizeof(*rbuf) );
+    }
 #ifdef EL_AVOID_COMPLEX_MPI
     int p;
     MPI_Comm_size( comm.comm, &p );
@@ -1268,6 +1968,15 @@ void Reduce
 ( const Real* sbuf, Real* rbuf, int count, Op op, int root, Comm comm )
 {
     DEBUG_ONLY(CSE cse("mpi::Reduce"))
+    CallTrace trace("Reduce",comm);
+    if( trace.Active() )
+    {
+        const double bytes = double(count)*sizeof(*sbuf);
+        if( trace.Rank() != root )
+            trace.SendTo( root, bytes );
+        else
+            trace.RecvFromOthers( bytes );
+    }
     if( count != 0 )
     {
         MPI_Op opC;
@@ -1293,6 +2002,15 @@ void Reduce
         Complex<Real>* rbuf, int count, Op op, int root, Comm comm )
 {
     DEBUG_ONLY(CSE cse("mpi::Reduce"))
+    CallTrace trace("Reduce",comm);
+    if( trace.Active() )
+    {
+        const double bytes = double(count)*sizeof(*sbuf);
+        if( trace.Rank() != root )
+            trace.SendTo( root, bytes );
+        else
+            trace.RecvFromOthers( bytes );
+    }
     if( count != 0 )
     {
         MPI_Op opC;
@@ -1350,6 +2068,15 @@ template<typename Real>
 void Reduce( Real* buf, int count, Op op, int root, Comm comm )
 {
     DEBUG_ONLY(CSE cse("mpi::Reduce"))
+    CallTrace trace("Reduce",comm);
+    if( trace.Active() )
+    {
+        const double bytes = double(count)*sizeof(*buf);
+        if( trace.Rank() != root )
+            trace.SendTo( root, bytes );
+        else
+            trace.RecvFromOthers( bytes );
+    }
     if( count != 0 )
     {
         MPI_Op opC;
@@ -1390,6 +2117,15 @@ template<typename Real>
 void Reduce( Complex<Real>* buf, int count, Op op, int root, Comm comm )
 {
     DEBUG_ONLY(CSE cse("mpi::Reduce"))
+    CallTrace trace("Reduce",comm);
+    if( trace.Active() )
+    {
+        const double bytes = double(count)*sizeof(*buf);
+        if( trace.Rank() != root )
+            trace.SendTo( root, bytes );
+        else
+            trace.RecvFromOthers( bytes );
+    }
     if( count != 0 )
     {
         MPI_Op opC;
@@ -1481,6 +2217,14 @@ template<typename Real>
 void AllReduce( const Real* sbuf, Real* rbuf, int count, Op op, Comm comm )
 {
     DEBUG_ONLY(CSE cse("mpi::AllReduce"))
+    CallTrace trace("AllReduce",comm);
+    if( trace.Active() )
+    {
+        // Charge a bandwidth-optimal reduce-scatter/allgather pair
+        const double bytes = 2*double(count)*sizeof(*sbuf)/trace.Size();
+        trace.SendToOthers( bytes );
+        trace.RecvFromOthers( bytes );
+    }
     if( count != 0 )
     {
         MPI_Op opC;
@@ -1505,6 +2249,14 @@ void AllReduce
 ( const Complex<Real>* sbuf, Complex<Real>* rbuf, int count, Op op, Comm comm )
 {
     DEBUG_ONLY(CSE cse("mpi::AllReduce"))
+    CallTrace trace("AllReduce",comm);
+    if( trace.Active() )
+    {
+        // Charge a bandwidth-optimal reduce-scatter/allgather pair
+        const double bytes = 2*double(count)*sizeof(*sbuf)/trace.Size();
+        trace.SendToOthers( bytes );
+        trace.RecvFromOthers( bytes );
+    }
     if( count != 0 )
     {
         MPI_Op opC;
@@ -1553,6 +2305,14 @@ template<typename Real>
 void AllReduce( Real* buf, int count, Op op, Comm comm )
 {
     DEBUG_ONLY(CSE cse("mpi::AllReduce"))
+    CallTrace trace("AllReduce",comm);
+    if( trace.Active() )
+    {
+        // Charge a bandwidth-optimal reduce-scatter/allgather pair
+        const double bytes = 2*double(count)*sizeof(*buf)/trace.Size();
+        trace.SendToOthers( bytes );
+        trace.RecvFromOthers( bytes );
+    }
     if( count != 0 )
     {
         MPI_Op opC;
@@ -1583,6 +2343,14 @@ template<typename Real>
 void AllReduce( Complex<Real>* buf, int count, Op op, Comm comm )
 {
     DEBUG_ONLY(CSE cse("mpi::AllReduce"))
+    CallTrace trace("AllReduce",comm);
+    if( trace.Active() )
+    {
+        // Charge a bandwidth-optimal reduce-scatter/allgather pair
+        const double bytes = 2*double(count)*sizeof(*buf)/trace.Size();
+        trace.SendToOthers( bytes );
+        trace.RecvFromOthers( bytes );
+    }
     if( count != 0 )
     {
         MPI_Op opC;
@@ -1649,6 +2417,12 @@ template<typename Real>
 void ReduceScatter( Real* sbuf, Real* rbuf, int rc, Op op, Comm comm )
 {
     DEBUG_ONLY(CSE cse("mpi::ReduceScatter"))
+    CallTrace trace("ReduceScatter",comm);
+    if( trace.Active() )
+    {
+        trace.SendToOthers( double(rc)*sizeof(*sbuf) );
+        trace.RecvFromOthers( double(rc)*sizeof(*sbuf) );
+    }
 #ifdef EL_REDUCE_SCATTER_BLOCK_VIA_ALLREDUCE
     const int commSize = Size( comm );
     const int commRank = Rank( comm );
@@ -1679,6 +2453,12 @@ void ReduceScatter
 ( Complex<Real>* sbuf, Complex<Real>* rbuf, int rc, Op op, Comm comm )
 {
     DEBUG_ONLY(CSE cse("mpi::ReduceScatter"))
+    CallTrace trace("ReduceScatter",comm);
+    if( trace.Active() )
+    {
+        trace.SendToOthers( double(rc)*sizeof(*sbuf) );
+        trace.RecvFromOthers( double(rc)*sizeof(*sbuf) );
+    }
     MPI_Op opC;
     if( op == SUM )
         opC = SumOp<Complex<Real>>().op; 
@@ -1723,6 +2503,12 @@ template<typename Real>
 void ReduceScatter( Real* buf, int rc, Op op, Comm comm )
 {
     DEBUG_ONLY(CSE cse("mpi::ReduceScatter"))
+    CallTrace trace("ReduceScatter",comm);
+    if( trace.Active() )
+    {
+        trace.SendToOthers( double(rc)*sizeof(*buf) );
+        trace.RecvFromOthers( double(rc)*sizeof(*buf) );
+    }
 #ifdef EL_REDUCE_SCATTER_BLOCK_VIA_ALLREDUCE
     const int commSize = Size( comm );
     const int commRank = Rank( comm );
@@ -1763,6 +2549,12 @@ template<typename Real>
 void ReduceScatter( Complex<Real>* buf, int rc, Op op, Comm comm )
 {
     DEBUG_ONLY(CSE cse("mpi::ReduceScatter"))
+    CallTrace trace("ReduceScatter",comm);
+    if( trace.Active() )
+    {
+        trace.SendToOthers( double(rc)*sizeof(*buf) );
+        trace.RecvFromOthers( double(rc)*sizeof(*buf) );
+    }
 #ifdef EL_REDUCE_SCATTER_BLOCK_VIA_ALLREDUCE
     const int commSize = Size( comm );
     const int commRank = Rank( comm );
@@ -1818,6 +2610,12 @@ void ReduceScatter
 ( const Real* sbuf, Real* rbuf, const int* rcs, Op op, Comm comm )
 {
     DEBUG_ONLY(CSE cse("mpi::ReduceScatter"))
+    CallTrace trace("ReduceScatter",comm);
+    if( trace.Active() )
+    {
+        trace.SendToEach( rcs, sizeof(*sbuf) );
+        trace.RecvFromOthers( double(rcs[trace.Rank()])*sizeof(*sbuf) );
+    }
     MPI_Op opC;
     if( op == SUM )
         opC = SumOp<Real>().op; 
@@ -1839,6 +2637,12 @@ void ReduceScatter
 ( const Complex<Real>* sbuf, Complex<Real>* rbuf, const int* rcs, Op op, Comm comm )
 {
     DEBUG_ONLY(CSE cse("mpi::ReduceScatter"))
+    CallTrace trace("ReduceScatter",comm);
+    if( trace.Active() )
+    {
+        trace.SendToEach( rcs, sizeof(*sbuf) );
+        trace.RecvFromOthers( double(rcs[trace.Rank()])*sizeof(*sbuf) );
+    }
     MPI_Op opC;
     if( op == SUM )
         opC = SumOp<Complex<Real>>().op; 
@@ -1896,10 +2700,612 @@ void VerifySendsAndRecvs
              " but recv'd ",actualRecvCounts[q]," from process ",q);
 }
 
+// Planned sparse all-to-alls
+// ==========================
+
+namespace {
+
+// Determine the node of each rank of 'comm' and the (increasing) ranks of
+// each node, where the nodes are numbered by their smallest member
+void NodeLayout
+( Comm comm, int ranksPerNode,
+  vector<int>& nodeOfRank, vector<vector<int>>& nodeRanks )
+{
+    DEBUG_ONLY(CSE cse("mpi::NodeLayout"))
+    const int commSize = Size( comm );
+    const int commRank = Rank( comm );
+    vector<int> leaders( commSize );
+    if( ranksPerNode > 0 )
+    {
+        for( int q=0; q<commSize; ++q )
+            leaders[q] = (q/ranksPerNode)*ranksPerNode;
+    }
+    else
+    {
+        int leader = commRank;
+#ifdef EL_HAVE_MPI_COMM_SPLIT_TYPE
+        MPI_Comm nodeMpiComm;
+        SafeMpi
+        ( MPI_Comm_split_type
+          ( comm.comm, MPI_COMM_TYPE_SHARED, commRank, MPI_INFO_NULL,
+            &nodeMpiComm ) );
+        Comm nodeComm( nodeMpiComm );
+        leader = AllReduce( commRank, MIN, nodeComm );
+        Free( nodeComm );
+#endif
+        AllGather( &leader, 1, leaders.data(), 1, comm );
+    }
+
+    nodeOfRank.resize( commSize );
+    nodeRanks.clear();
+    vector<int> nodeOfLeader( commSize, -1 );
+    for( int q=0; q<commSize; ++q )
+    {
+        if( nodeOfLeader[leaders[q]] == -1 )
+        {
+            nodeOfLeader[leaders[q]] = nodeRanks.size();
+            nodeRanks.emplace_back();
+        }
+        nodeOfRank[q] = nodeOfLeader[leaders[q]];
+        nodeRanks[nodeOfRank[q]].push_back( q );
+    }
+}
+
+struct PlanPiece
+{
+    int origin, dest, count, off;
+};
+
+void FormHierarchicalPlan
+( SparseAllToAllPlan& plan,
+  const vector<int>& sendCounts, const vector<int>& sendOffs,
+  const vector<int>& recvOffs,
+  const vector<int>& nodeOfRank, const vector<vector<int>>& nodeRanks )
+{
+    DEBUG_ONLY(CSE cse("mpi::FormHierarchicalPlan"))
+    Comm comm = plan.comm;
+    const int commSize = Size( comm );
+    const int commRank = Rank( comm );
+    const int myNode = nodeOfRank[commRank];
+
+    // The process of node 'from' which communicates with node 'to'
+    auto gateway = [&]( int from, int to )
+    { return nodeRanks[from][to % nodeRanks[from].size()]; };
+
+    vector<PlanPiece> held;
+    for( int q=0; q<commSize; ++q )
+        if( sendCounts[q] > 0 )
+            held.push_back( PlanPiece{commRank,q,sendCounts[q],sendOffs[q]} );
+    int heldPhase = -1;
+
+    const int numPhases = 3;
+    plan.phases.resize( numPhases );
+    for( int k=0; k<numPhases; ++k )
+    {
+        auto& phase = plan.phases[k];
+
+        // Retire the pieces which have arrived and route the rest
+        vector<PlanPiece> moving;
+        vector<int> hops;
+        for( const auto& piece : held )
+        {
+            if( piece.dest == commRank )
+            {
+                plan.unpackPhases.push_back( heldPhase );
+                plan.unpackOffs.push_back( piece.off );
+                plan.unpackCounts.push_back( piece.count );
+                plan.unpackDestOffs.push_back( recvOffs[piece.origin] );
+                continue;
+            }
+            const int destNode = nodeOfRank[piece.dest];
+            int hop;
+            if( k == 0 )
+                hop = ( destNode==myNode ? piece.dest
+                                         : gateway(myNode,destNode) );
+            else if( k == 1 )
+                hop = gateway( destNode, myNode );
+            else
+                hop = piece.dest;
+            moving.push_back( piece );
+            hops.push_back( hop );
+        }
+
+        // Pack the moving pieces by their next hop
+        const int numMoving = moving.size();
+        vector<int> order( numMoving );
+        std::iota( order.begin(), order.end(), 0 );
+        std::stable_sort
+        ( order.begin(), order.end(),
+          [&]( int a, int b ) { return hops[a] < hops[b]; } );
+        vector<int> pieceSendCounts( commSize, 0 );
+        vector<int> meta;
+        meta.reserve( 3*numMoving );
+        for( const int s : order )
+        {
+            const auto& piece = moving[s];
+            const int hop = hops[s];
+            if( phase.sendRanks.empty() || phase.sendRanks.back() != hop )
+            {
+                phase.sendRanks.push_back( hop );
+                phase.sendCounts.push_back( 0 );
+            }
+            phase.sendCounts.back() += piece.count;
+            phase.packOffs.push_back( piece.off );
+            phase.packCounts.push_back( piece.count );
+            phase.packSize += piece.count;
+            ++pieceSendCounts[hop];
+            meta.push_back( piece.origin );
+            meta.push_back( piece.dest );
+            meta.push_back( piece.count );
+        }
+
+        // Tell each hop which pieces it will receive
+        vector<int> pieceRecvCounts( commSize );
+        AllToAll
+        ( pieceSendCounts.data(), 1, pieceRecvCounts.data(), 1, comm );
+        vector<int> metaSendCounts(commSize), metaSendOffs(commSize),
+                    metaRecvCounts(commSize), metaRecvOffs(commSize);
+        int metaSendSize=0, metaRecvSize=0;
+        for( int q=0; q<commSize; ++q )
+        {
+            metaSendCounts[q] = 3*pieceSendCounts[q];
+            metaRecvCounts[q] = 3*pieceRecvCounts[q];
+            metaSendOffs[q] = metaSendSize;
+            metaRecvOffs[q] = metaRecvSize;
+            metaSendSize += metaSendCounts[q];
+            metaRecvSize += metaRecvCounts[q];
+        }
+        vector<int> metaRecv( metaRecvSize );
+        SparseAllToAll
+        ( meta, metaSendCounts, metaSendOffs,
+          metaRecv, metaRecvCounts, metaRecvOffs, comm );
+
+        // The received pieces are held contiguously in order of their source
+        held.clear();
+        for( int q=0; q<commSize; ++q )
+        {
+            if( pieceRecvCounts[q] == 0 )
+                continue;
+            phase.recvRanks.push_back( q );
+            phase.recvCounts.push_back( 0 );
+            for( int s=0; s<pieceRecvCounts[q]; ++s )
+            {
+                const int* entry = &metaRecv[metaRecvOffs[q]+3*s];
+                held.push_back
+                ( PlanPiece{entry[0],entry[1],entry[2],phase.recvSize} );
+                phase.recvCounts.back() += entry[2];
+                phase.recvSize += entry[2];
+            }
+        }
+        heldPhase = k;
+    }
+    for( const auto& piece : held )
+    {
+        DEBUG_ONLY(
+          if( piece.dest != commRank )
+              LogicError("Piece was not delivered");
+        )
+        plan.unpackPhases.push_back( heldPhase );
+        plan.unpackOffs.push_back( piece.off );
+        plan.unpackCounts.push_back( piece.count );
+        plan.unpackDestOffs.push_back( recvOffs[piece.origin] );
+    }
+}
+
+} // anonymous namespace
+
+int NodeSize( Comm comm )
+{
+    DEBUG_ONLY(CSE cse("mpi::NodeSize"))
+    vector<int> nodeOfRank;
+    vector<vector<int>> nodeRanks;
+    NodeLayout( comm, 0, nodeOfRank, nodeRanks );
+    return nodeRanks[nodeOfRank[Rank(comm)]].size();
+}
+
+SparseAllToAllPlan MakeSparseAllToAllPlan
+( const vector<int>& sendCounts, const vector<int>& sendOffs,
+  const vector<int>& recvCounts, const vector<int>& recvOffs,
+  Comm comm, int ranksPerNode )
+{
+    DEBUG_ONLY(
+      CSE cse("mpi::MakeSparseAllToAllPlan");
+      VerifySendsAndRecvs( sendCounts, recvCounts, comm );
+    )
+    const int commSize = Size( comm );
+    const int commRank = Rank( comm );
+    SparseAllToAllPlan plan;
+    plan.comm = comm;
+
+    plan.selfCount = sendCounts[commRank];
+    plan.selfSendOff = sendOffs[commRank];
+    plan.selfRecvOff = recvOffs[commRank];
+    for( int q=0; q<commSize; ++q )
+    {
+        if( q == commRank )
+            continue;
+        if( sendCounts[q] > 0 )
+        {
+            plan.sendRanks.push_back( q );
+            plan.sendCounts.push_back( sendCounts[q] );
+            plan.sendOffs.push_back( sendOffs[q] );
+        }
+        if( recvCounts[q] > 0 )
+        {
+            plan.recvRanks.push_back( q );
+            plan.recvCounts.push_back( recvCounts[q] );
+            plan.recvOffs.push_back( recvOffs[q] );
+        }
+    }
+
+    vector<int> nodeOfRank;
+    vector<vector<int>> nodeRanks;
+    NodeLayout( comm, ranksPerNode, nodeOfRank, nodeRanks );
+    const double numNodes = nodeRanks.size();
+    bool sharedNodes = false;
+    for( const auto& ranks : nodeRanks )
+        if( ranks.size() > 1 )
+            sharedNodes = true;
+    if( numNodes > 1 && sharedNodes )
+    {
+        // Only aggregate if it at least halves the inter-node messages
+        double numOffNode = 0;
+        for( const int q : plan.sendRanks )
+            if( nodeOfRank[q] != nodeOfRank[commRank] )
+                ++numOffNode;
+        numOffNode = AllReduce( numOffNode, comm );
+        plan.hierarchical = ( numOffNode >= 2*numNodes*(numNodes-1) );
+    }
+    if( plan.hierarchical )
+        FormHierarchicalPlan
+        ( plan, sendCounts, sendOffs, recvOffs, nodeOfRank, nodeRanks );
+
+    plan.ready = true;
+    return plan;
+}
+
+void VerifyPlan
+( const SparseAllToAllPlan& plan,
+  const vector<int>& sendCounts, const vector<int>& sendOffs,
+  const vector<int>& recvCounts, const vector<int>& recvOffs )
+{
+    DEBUG_ONLY(CSE cse("mpi::VerifyPlan"))
+    if( !plan.ready )
+        LogicError("The plan was not formed");
+    const int commSize = Size( plan.comm );
+    const int commRank = Rank( plan.comm );
+    if( int(sendCounts.size()) != commSize || 
+        int(recvCounts.size()) != commSize )
+        LogicError("Expected counts for each of ",commSize," processes");
+    if( sendCounts[commRank] != plan.selfCount ||
+        (plan.selfCount > 0 && 
+         (sendOffs[commRank] != plan.selfSendOff ||
+          recvOffs[commRank] != plan.selfRecvOff)) )
+        LogicError("The exchange with ourself did not match the plan");
+    unsigned sendInd=0, recvInd=0;
+    for( int q=0; q<commSize; ++q )
+    {
+        if( q == commRank )
+            continue;
+        if( sendCounts[q] > 0 )
+        {
+            if( sendInd >= plan.sendRanks.size() ||
+                plan.sendRanks[sendInd] != q ||
+                plan.sendCounts[sendInd] != sendCounts[q] ||
+                plan.sendOffs[sendInd] != sendOffs[q] )
+                LogicError("The sends to process ",q," did not match the plan");
+            ++sendInd;
+        }
+        if( recvCounts[q] > 0 )
+        {
+            if( recvInd >= plan.recvRanks.size() ||
+                plan.recvRanks[recvInd] != q ||
+                plan.recvCounts[recvInd] != recvCounts[q] ||
+                plan.recvOffs[recvInd] != recvOffs[q] )
+                LogicError
+                ("The receives from process ",q," did not match the plan");
+            ++recvInd;
+        }
+    }
+    if( sendInd != plan.sendRanks.size() || recvInd != plan.recvRanks.size() )
+        LogicError("The plan has neighbors which are no longer exchanged with");
+}
+
+// Communication tracing
+// =====================
+
+void EnableTracing()
+{
+    if( !::tracing )
+    {
+        ResetTracing();
+        ::traceRequestComms.clear();
+        ::tracing = true;
+    }
+}
+
+void DisableTracing()
+{
+    // Waits are no longer charged, so there is no need to remember requests
+    ::tracing = false;
+    ::traceRequestComms.clear();
+}
+
+bool Tracing() { return ::tracing; }
+
+void ResetTracing()
+{
+    ::traceRecords.clear();
+    int worldSize;
+    MPI_Comm_size( MPI_COMM_WORLD, &worldSize );
+    ::traceVolumes.assign( worldSize, 0 );
+}
+
+std::vector<TraceStats> GetTraceStats()
+{
+    // Merge the records with equal names
+    std::map<std::string,TraceStats> merged;
+    for( const auto& entry : ::traceRecords )
+    {
+        const TraceKey& key = entry.first;
+        const TraceRecord& record = entry.second;
+        TraceStats stats;
+        stats.routine = key.routine;
+        stats.comm = ( key.comm >= 0 ? ::traceComms[key.comm].label : "-" );
+        stats.site = key.site;
+        const std::string name =
+          stats.routine + "\t" + stats.comm + "\t" + stats.site;
+        auto it = merged.find( name );
+        if( it == merged.end() )
+        {
+            stats.numCalls = record.numCalls;
+            stats.sendBytes = record.sendBytes;
+            stats.recvBytes = record.recvBytes;
+            stats.time = record.time;
+            merged[name] = stats;
+        }
+        else
+        {
+            it->second.numCalls += record.numCalls;
+            it->second.sendBytes += record.sendBytes;
+            it->second.recvBytes += record.recvBytes;
+            it->second.time += record.time;
+        }
+    }
+    std::vector<TraceStats> statsList;
+    for( const auto& entry : merged )
+        statsList.push_back( entry.second );
+    return statsList;
+}
+
+std::vector<double> GetTraceVolumes() { return ::traceVolumes; }
+
+} // namespace mpi
+} // namespace El
+
+namespace {
+
+// The statistics of every rank of a communicator for a single key
+struct GlobalTraceStats
+{
+    std::string routine, comm, site;
+    std::vector<double> numCalls, sendBytes, recvBytes, time;
+};
+
+// Gather the statistics of every rank onto the root of 'comm', returning 
+// both the merged statistics and the per-rank lists
+std::vector<GlobalTraceStats> GatherTraceStats
+( El::mpi::Comm comm, std::vector<std::vector<El::mpi::TraceStats>>& perRank )
+{
+    using namespace El;
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+
+    // Serialize the local statistics, one key per line
+    std::ostringstream os;
+    os.precision( 17 );
+    for( const auto& s : mpi::GetTraceStats() )
+        os << s.numCalls << " " << s.sendBytes << " " << s.recvBytes << " "
+           << s.time << "\t" << s.routine << "\t" << s.comm << "\t"
+           << s.site << "\n";
+    const std::string local = os.str();
+    const int localSize = local.size();
+
+    std::vector<int> sizes(commSize), offs;
+    mpi::Gather( &localSize, 1, sizes.data(), 1, 0, comm );
+    int totalSize = 0;
+    if( commRank == 0 )
+        totalSize = Scan( sizes, offs );
+    std::vector<byte> buf( totalSize );
+    mpi::Gather
+    ( (const byte*)local.data(), localSize,
+      buf.data(), sizes.data(), offs.data(), 0, comm );
+
+    std::vector<GlobalTraceStats> globalStats;
+    perRank.clear();
+    if( commRank != 0 )
+        return globalStats;
+    perRank.resize( commSize );
+    std::map<std::string,int> index;
+    for( int q=0; q<commSize; ++q )
+    {
+        std::istringstream is
+        ( std::string((const char*)&buf[offs[q]],sizes[q]) );
+        std::string line;
+        while( std::getline( is, line ) )
+        {
+            std::istringstream ls( line );
+            mpi::TraceStats s;
+            ls >> s.numCalls >> s.sendBytes >> s.recvBytes >> s.time;
+            ls.get();
+            std::getline( ls, s.routine, '\t' );
+            std::getline( ls, s.comm, '\t' );
+            std::getline( ls, s.site );
+            perRank[q].push_back( s );
+
+            const std::string name = s.routine+"\t"+s.comm+"\t"+s.site;
+            auto it = index.find( name );
+            if( it == index.end() )
+            {
+                it = index.insert
+                     ( std::make_pair(name,int(globalStats.size())) ).first;
+                GlobalTraceStats g;
+                g.routine = s.routine;
+                g.comm = s.comm;
+                g.site = s.site;
+                g.numCalls.resize( commSize, 0 );
+                g.sendBytes.resize( commSize, 0 );
+                g.recvBytes.resize( commSize, 0 );
+                g.time.resize( commSize, 0 );
+                globalStats.push_back( g );
+            }
+            GlobalTraceStats& g = globalStats[it->second];
+            g.numCalls[q] = s.numCalls;
+            g.sendBytes[q] = s.sendBytes;
+            g.recvBytes[q] = s.recvBytes;
+            g.time[q] = s.time;
+        }
+    }
+    // List the most expensive keys first
+    std::sort
+    ( globalStats.begin(), globalStats.end(),
+      []( const GlobalTraceStats& a, const GlobalTraceStats& b )
+      { return *std::max_element(a.time.begin(),a.time.end()) >
+               *std::max_element(b.time.begin(),b.time.end()); } );
+    return globalStats;
+}
+
+void PrintTraceHeader( std::ostream& os, bool perRank )
+{
+    os << std::left << std::setw(16) << "Routine" << std::setw(24) << "Comm"
+       << std::setw(32) << "Site" << std::right << std::setw(10) << "calls"
+       << std::setw(12) << "MB sent" << std::setw(12) << "MB recv";
+    if( perRank )
+        os << std::setw(12) << "time\n";
+    else
+        os << std::setw(12) << "time min" << std::setw(12) << "time avg"
+           << std::setw(12) << "time max\n";
+}
+
+void PrintTraceTable
+( const std::vector<GlobalTraceStats>& stats, std::ostream& os )
+{
+    PrintTraceHeader( os, false );
+    for( const auto& g : stats )
+    {
+        auto sum = []( const std::vector<double>& x )
+          { return std::accumulate( x.begin(), x.end(), 0. ); };
+        const double minTime = *std::min_element(g.time.begin(),g.time.end());
+        const double maxTime = *std::max_element(g.time.begin(),g.time.end());
+        os << std::left << std::setw(16) << g.routine
+           << std::setw(24) << g.comm
+           << std::setw(32) << ( g.site.empty() ? "-" : g.site )
+           << std::right << std::setw(10) << sum(g.numCalls)
+           << std::setw(12) << sum(g.sendBytes)/1.e6
+           << std::setw(12) << sum(g.recvBytes)/1.e6
+           << std::setw(12) << minTime
+           << std::setw(12) << sum(g.time)/g.time.size()
+           << std::setw(12) << maxTime << "\n";
+    }
+}
+
+// Temporarily disable tracing so that the reports do not trace themselves
+class PauseTracing
+{
+public:
+    PauseTracing() : tracing_(tracing) { tracing = false; }
+    ~PauseTracing() { tracing = tracing_; }
+private:
+    bool tracing_;
+};
+
+} // anonymous namespace
+
+namespace El {
+namespace mpi {
+
+void PrintTrace( Comm comm, std::ostream& os )
+{
+    DEBUG_ONLY(CSE cse("mpi::PrintTrace"))
+    PauseTracing pause;
+    std::vector<std::vector<TraceStats>> perRank;
+    auto stats = GatherTraceStats( comm, perRank );
+    if( Rank(comm) == 0 )
+    {
+        os << "Communication over " << Size(comm) << " processes "
+           << "(times in seconds)\n";
+        PrintTraceTable( stats, os );
+        os.flush();
+    }
+}
+
+void WriteTrace( const std::string& basename, Comm comm )
+{
+    DEBUG_ONLY(CSE cse("mpi::WriteTrace"))
+    PauseTracing pause;
+    const int commRank = Rank( comm );
+    const int commSize = Size( comm );
+    std::vector<std::vector<TraceStats>> perRank;
+    auto stats = GatherTraceStats( comm, perRank );
+
+    // Gather the rows of the communication matrix
+    const int worldSize = ::traceVolumes.size();
+    std::vector<double> volumes;
+    if( commRank == 0 )
+        volumes.resize( commSize*worldSize );
+    Gather
+    ( ::traceVolumes.data(), worldSize, volumes.data(), worldSize, 0, comm );
+
+    if( commRank == 0 )
+    {
+        std::ofstream text( (basename+".txt").c_str() );
+        if( !text.is_open() )
+            RuntimeError("Could not open ",basename,".txt");
+        text << "Communication over " << commSize << " processes "
+             << "(times in seconds)\n";
+        PrintTraceTable( stats, text );
+        for( int q=0; q<commSize; ++q )
+        {
+            text << "\nProcess " << q << "\n";
+            PrintTraceHeader( text, true );
+            for( const auto& s : perRank[q] )
+                text << std::left << std::setw(16) << s.routine
+                     << std::setw(24) << s.comm
+                     << std::setw(32) << ( s.site.empty() ? "-" : s.site )
+                     << std::right << std::setw(10) << s.numCalls
+                     << std::setw(12) << s.sendBytes/1.e6
+                     << std::setw(12) << s.recvBytes/1.e6
+                     << std::setw(12) << s.time << "\n";
+        }
+
+        std::ofstream matrix( (basename+"-matrix.txt").c_str() );
+        if( !matrix.is_open() )
+            RuntimeError("Could not open ",basename,"-matrix.txt");
+        matrix << "# Bytes sent from each process of the communicator (row) "
+               << "to each process of COMM_WORLD (column)\n";
+        matrix.precision( 17 );
+        for( int q=0; q<commSize; ++q )
+        {
+            for( int r=0; r<worldSize; ++r )
+                matrix << ( r==0 ? "" : " " ) << volumes[q*worldSize+r];
+            matrix << "\n";
+        }
+    }
+}
+
 template<typename Real>
 void Scan( const Real* sbuf, Real* rbuf, int count, Op op, Comm comm )
 {
     DEBUG_ONLY(CSE cse("mpi::Scan"))
+    CallTrace trace("Scan",comm);
+    if( trace.Active() )
+    {
+        const double bytes = double(count)*sizeof(*sbuf);
+        if( trace.Rank()+1 < trace.Size() )
+            trace.SendTo( trace.Rank()+1, bytes );
+        if( trace.Rank() > 0 )
+            trace.Recv( bytes );
+    }
     if( count != 0 )
     {
         MPI_Op opC;
@@ -1925,6 +3331,15 @@ void Scan
         Complex<Real>* rbuf, int count, Op op, Comm comm )
 {
     DEBUG_ONLY(CSE cse("mpi::Scan"))
+    CallTrace trace("Scan",comm);
+    if( trace.Active() )
+    {
+        const double bytes = double(count)*sizeof(*sbuf);
+        if( trace.Rank()+1 < trace.Size() )
+            trace.SendTo( trace.Rank()+1, bytes );
+        if( trace.Rank() > 0 )
+            trace.Recv( bytes );
+    }
     if( count != 0 )
     {
         MPI_Op opC;
@@ -1981,6 +3396,15 @@ template<typename Real>
 void Scan( Real* buf, int count, Op op, Comm comm )
 {
     DEBUG_ONLY(CSE cse("mpi::Scan"))
+    CallTrace trace("Scan",comm);
+    if( trace.Active() )
+    {
+        const double bytes = double(count)*sizeof(*buf);
+        if( trace.Rank()+1 < trace.Size() )
+            trace.SendTo( trace.Rank()+1, bytes );
+        if( trace.Rank() > 0 )
+            trace.Recv( bytes );
+    }
     if( count != 0 )
     {
         MPI_Op opC;
@@ -2011,6 +3435,15 @@ template<typename Real>
 void Scan( Complex<Real>* buf, int count, Op op, Comm comm )
 {
     DEBUG_ONLY(CSE cse("mpi::Scan"))
+    CallTrace trace("Scan",comm);
+    if( trace.Active() )
+    {
+        const double bytes = double(count)*sizeof(*buf);
+        if( trace.Rank()+1 < trace.Size() )
+            trace.SendTo( trace.Rank()+1, bytes );
+        if( trace.Rank() > 0 )
+            trace.Recv( bytes );
+    }
     if( count != 0 )
     {
         MPI_Op opC;
@@ -2081,6 +3514,13 @@ void SparseAllToAll
   const vector<int>& recvCounts, const vector<int>& recvDispls,
         mpi::Comm comm )
 {
+    CallTrace trace("SparseAllToAll",comm);
+    if( trace.Active() )
+    {
+        trace.SendToEach( sendCounts.data(), sizeof(T) );
+        trace.Recv
+        ( SumOthers(recvCounts.data(),trace.Size(),trace.Rank())*sizeof(T) );
+    }
 #ifdef EL_USE_CUSTOM_ALLTOALLV
     const int commSize = mpi::Size( comm );
     int numSends=0,numRecvs=0;
@@ -2122,6 +3562,125 @@ void SparseAllToAll
 #endif
 }
 
+template<typename T>
+void SparseAllToAll
+( const vector<T>& sendBuffer,
+        vector<T>& recvBuffer,
+  const SparseAllToAllPlan& plan, int width )
+{
+    DEBUG_ONLY(
+      CSE cse("mpi::SparseAllToAll");
+      if( !plan.ready )
+          LogicError("The plan was not formed");
+    )
+    Comm comm = plan.comm;
+    CallTrace trace("SparseAllToAll",comm);
+    vector<Request> requests;
+
+    if( !plan.hierarchical )
+    {
+        const int numSends = plan.sendRanks.size();
+        const int numRecvs = plan.recvRanks.size();
+        requests.resize( numSends+numRecvs );
+        for( int s=0; s<numRecvs; ++s )
+        {
+            IRecv
+            ( &recvBuffer[plan.recvOffs[s]*width], plan.recvCounts[s]*width,
+              plan.recvRanks[s], comm, requests[s] );
+            if( trace.Active() )
+                trace.Recv( double(plan.recvCounts[s])*width*sizeof(T) );
+        }
+        for( int s=0; s<numSends; ++s )
+        {
+            ISend
+            ( &sendBuffer[plan.sendOffs[s]*width], plan.sendCounts[s]*width,
+              plan.sendRanks[s], comm, requests[numRecvs+s] );
+            if( trace.Active() )
+                trace.SendTo
+                ( plan.sendRanks[s],
+                  double(plan.sendCounts[s])*width*sizeof(T) );
+        }
+        if( plan.selfCount > 0 )
+            MemCopy
+            ( &recvBuffer[plan.selfRecvOff*width],
+              &sendBuffer[plan.selfSendOff*width], plan.selfCount*width );
+        if( numSends+numRecvs > 0 )
+            WaitAll( numSends+numRecvs, requests.data() );
+        return;
+    }
+
+    const int commRank = Rank( comm );
+    const int numPhases = plan.phases.size();
+    vector<vector<T>> phaseBufs( numPhases );
+    vector<T> packBuf;
+    const T* held = sendBuffer.data();
+    for( int k=0; k<numPhases; ++k )
+    {
+        const auto& phase = plan.phases[k];
+        packBuf.resize( phase.packSize*width );
+        Int off = 0;
+        for( unsigned s=0; s<phase.packOffs.size(); ++s )
+        {
+            MemCopy
+            ( &packBuf[off], &held[phase.packOffs[s]*width],
+              phase.packCounts[s]*width );
+            off += phase.packCounts[s]*width;
+        }
+
+        auto& recvBuf = phaseBufs[k];
+        recvBuf.resize( phase.recvSize*width );
+        requests.clear();
+        requests.reserve( phase.recvRanks.size()+phase.sendRanks.size() );
+        T* selfRecv = nullptr;
+        off = 0;
+        for( unsigned s=0; s<phase.recvRanks.size(); ++s )
+        {
+            const int count = phase.recvCounts[s]*width;
+            if( phase.recvRanks[s] == commRank )
+                selfRecv = &recvBuf[off];
+            else
+            {
+                requests.emplace_back();
+                IRecv
+                ( &recvBuf[off], count, phase.recvRanks[s], comm,
+                  requests.back() );
+                if( trace.Active() )
+                    trace.Recv( double(count)*sizeof(T) );
+            }
+            off += count;
+        }
+        off = 0;
+        for( unsigned s=0; s<phase.sendRanks.size(); ++s )
+        {
+            const int count = phase.sendCounts[s]*width;
+            if( phase.sendRanks[s] == commRank )
+                MemCopy( selfRecv, &packBuf[off], count );
+            else
+            {
+                requests.emplace_back();
+                ISend
+                ( &packBuf[off], count, phase.sendRanks[s], comm,
+                  requests.back() );
+                if( trace.Active() )
+                    trace.SendTo( phase.sendRanks[s], double(count)*sizeof(T) );
+            }
+            off += count;
+        }
+        if( requests.size() > 0 )
+            WaitAll( requests.size(), requests.data() );
+        held = recvBuf.data();
+    }
+
+    for( unsigned s=0; s<plan.unpackPhases.size(); ++s )
+    {
+        const int k = plan.unpackPhases[s];
+        const T* source = ( k < 0 ? sendBuffer.data() : phaseBufs[k].data() );
+        MemCopy
+        ( &recvBuffer[plan.unpackDestOffs[s]*width],
+          &source[plan.unpackOffs[s]*width], plan.unpackCounts[s]*width );
+    }
+}
+
 #define MPI_PROTO(T) \
   template int GetCount<T>( Status& status ); \
   template void TaggedSend( const T* buf, int count, int to, int tag, Comm comm ); \
@@ -2168,6 +3727,9 @@ void SparseAllToAll
   ( const T* sbuf, int sc, \
           T* rbuf, const int* rcs, const int* rds, int root, Comm comm ); \
   template void AllGather( const T* sbuf, int sc, T* rbuf, int rc, Comm comm ); \
+  template void IAllGather \
+  ( const T* sbuf, int sc, \
+          T* rbuf, int rc, Comm comm, Request& request ); \
   template void AllGather \
   ( const T* sbuf, int sc, \
           T* rbuf, const int* rcs, const int* rds, Comm comm ); \
@@ -2211,7 +3773,11 @@ void SparseAllToAll
   template T Scan( T sb, Op op, Comm comm ); \
   template T Scan( T sb, Comm comm ); \
   template void Scan( T* buf, int count, Op op, Comm comm ); \
-  template void Scan( T* buf, int count, Comm comm );
+  template void Scan( T* buf, int count, Comm comm ); \
+  template void SparseAllToAll \
+  ( const vector<T>& sendBuffer, \
+          vector<T>& recvBuffer, \
+    const SparseAllToAllPlan& plan, int width );
 
 MPI_PROTO(byte)
 MPI_PROTO(int)
@@ -0,0 +1,148 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_DISTFILE_HPP
+#define EL_DISTFILE_HPP
+
+namespace El {
+namespace dist_file {
+
+// Form the datatypes describing the locations of the local entries of A
+// within a column-major file (relative to the beginning of the matrix data)
+// and within the local buffer. The same construction handles every
+// [U,V] element and block distribution, as only the local-to-global row and
+// column maps are queried. False is returned (and no types are created) if
+// there are no local entries.
+template<typename T,template<typename> class DistType>
+inline bool
+FileView
+( const DistType<T>& A, mpi::Datatype& fileType, mpi::Datatype& memType )
+{
+    DEBUG_ONLY(CSE cse("dist_file::FileView"))
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    if( localHeight == 0 || localWidth == 0 )
+        return false;
+    const Int height = A.Height();
+    mpi::Datatype elemType = mpi::TypeMap<T>();
+
+    // Coalesce the local rows into runs of consecutive global rows
+    vector<int> rowSizes, rowOffs;
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = A.GlobalRow(iLoc);
+        if( rowOffs.size() > 0 && rowOffs.back()+rowSizes.back() == i )
+            ++rowSizes.back();
+        else
+        {
+            rowOffs.push_back( i );
+            rowSizes.push_back( 1 );
+        }
+    }
+    mpi::Datatype colType;
+    mpi::CreateIndexed
+    ( rowSizes.size(), rowSizes.data(), rowOffs.data(), elemType, colType );
+
+    vector<int> colSizes( localWidth, 1 );
+    vector<mpi::Aint> colOffs( localWidth );
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        colOffs[jLoc] = mpi::Aint(A.GlobalCol(jLoc))*height*sizeof(T);
+    mpi::CreateHIndexed
+    ( localWidth, colSizes.data(), colOffs.data(), colType, fileType );
+    mpi::Free( colType );
+    mpi::Commit( fileType );
+
+    mpi::CreateVector( localWidth, localHeight, A.LDim(), elemType, memType );
+    mpi::Commit( memType );
+    return true;
+}
+
+// Collectively read the local entries of A from the column-major matrix
+// stored 'disp' bytes into the file
+template<typename T,template<typename> class DistType>
+inline void
+ReadLocal( mpi::File file, mpi::Offset disp, DistType<T>& A )
+{
+    DEBUG_ONLY(CSE cse("dist_file::ReadLocal"))
+    mpi::Datatype elemType = mpi::TypeMap<T>();
+    mpi::Datatype fileType, memType;
+    if( FileView( A, fileType, memType ) )
+    {
+        mpi::SetView( file, disp, elemType, fileType );
+        mpi::ReadAll( file, A.Buffer(), 1, memType );
+        mpi::Free( fileType );
+        mpi::Free( memType );
+    }
+    else
+    {
+        mpi::SetView( file, disp, elemType, elemType );
+        mpi::ReadAll( file, nullptr, 0, elemType );
+    }
+}
+
+// Collectively write the local entries of A into the column-major matrix
+// stored 'disp' bytes into the file. Only the first member of each team of
+// redundant owners contributes data.
+template<typename T,template<typename> class DistType>
+inline void
+WriteLocal( mpi::File file, mpi::Offset disp, const DistType<T>& A )
+{
+    DEBUG_ONLY(CSE cse("dist_file::WriteLocal"))
+    mpi::Datatype elemType = mpi::TypeMap<T>();
+    mpi::Datatype fileType, memType;
+    if( A.RedundantRank() == 0 && FileView( A, fileType, memType ) )
+    {
+        mpi::SetView( file, disp, elemType, fileType );
+        mpi::WriteAll( file, A.LockedBuffer(), 1, memType );
+        mpi::Free( fileType );
+        mpi::Free( memType );
+    }
+    else
+    {
+        mpi::SetView( file, disp, elemType, elemType );
+        mpi::WriteAll( file, nullptr, 0, elemType );
+    }
+}
+
+// Independently read 'count' entries starting 'offset' bytes into the file,
+// in pieces small enough for MPI's integer counts
+template<typename T>
+inline void
+ReadAt( mpi::File file, mpi::Offset offset, T* buf, Int count )
+{
+    DEBUG_ONLY(CSE cse("dist_file::ReadAt"))
+    const Int maxCount = std::numeric_limits<int>::max() / sizeof(T);
+    for( Int off=0; off<count; off+=maxCount )
+    {
+        const int pieceSize = Min(count-off,maxCount);
+        mpi::ReadAt
+        ( file, offset+mpi::Offset(off)*sizeof(T), &buf[off], pieceSize, 
+          mpi::TypeMap<T>() );
+    }
+}
+
+template<typename T>
+inline void
+WriteAt( mpi::File file, mpi::Offset offset, const T* buf, Int count )
+{
+    DEBUG_ONLY(CSE cse("dist_file::WriteAt"))
+    const Int maxCount = std::numeric_limits<int>::max() / sizeof(T);
+    for( Int off=0; off<count; off+=maxCount )
+    {
+        const int pieceSize = Min(count-off,maxCount);
+        mpi::WriteAt
+        ( file, offset+mpi::Offset(off)*sizeof(T), &buf[off], pieceSize, 
+          mpi::TypeMap<T>() );
+    }
+}
+
+} // namespace dist_file
+} // namespace El
+
+#endif // ifndef EL_DISTFILE_HPP
@@ -8,9 +8,11 @@
 */
 #include "El.hpp"
 
+#include "./DistFile.hpp"
 #include "./Read/Ascii.hpp"
 #include "./Read/AsciiMatlab.hpp"
 #include "./Read/Binary.hpp"
+#include "./Read/BinaryCSR.hpp"
 #include "./Read/BinaryFlat.hpp"
 #include "./Read/MatrixMarket.hpp"
 
@@ -54,7 +56,16 @@ void Read
     if( format == AUTO )
         format = DetectFormat( filename ); 
 
-    if( A.ColStride() == 1 && A.RowStride() == 1 )
+    if( !sequential && format == BINARY )
+    {
+        // Every process reads its own entries directly
+        read::Binary( A, filename );
+    }
+    else if( !sequential && format == BINARY_FLAT )
+    {
+        read::BinaryFlat( A, A.Height(), A.Width(), filename );
+    }
+    else if( A.ColStride() == 1 && A.RowStride() == 1 )
     {
         if( A.CrossRank() == A.Root() && A.RedundantRank() == 0 )
         {
@@ -87,12 +98,6 @@ void Read
         case ASCII_MATLAB:
             read::AsciiMatlab( A, filename );
             break;
-        case BINARY:
-            read::Binary( A, filename );
-            break;
-        case BINARY_FLAT:
-            read::BinaryFlat( A, A.Height(), A.Width(), filename );
-            break;
         case MATRIX_MARKET:
             read::MatrixMarket( A, filename );
             break;
@@ -111,7 +116,16 @@ void Read
     if( format == AUTO )
         format = DetectFormat( filename ); 
 
-    if( A.ColStride() == 1 && A.RowStride() == 1 )
+    if( !sequential && format == BINARY )
+    {
+        // Every process reads its own entries directly
+        read::Binary( A, filename );
+    }
+    else if( !sequential && format == BINARY_FLAT )
+    {
+        read::BinaryFlat( A, A.Height(), A.Width(), filename );
+    }
+    else if( A.ColStride() == 1 && A.RowStride() == 1 )
     {
         if( A.CrossRank() == A.Root() && A.RedundantRank() == 0 )
         {
@@ -144,12 +158,6 @@ void Read
         case ASCII_MATLAB:
             read::AsciiMatlab( A, filename );
             break;
-        case BINARY:
-            read::Binary( A, filename );
-            break;
-        case BINARY_FLAT:
-            read::BinaryFlat( A, A.Height(), A.Width(), filename );
-            break;
         case MATRIX_MARKET:
             read::MatrixMarket( A, filename );
             break;
@@ -159,6 +167,45 @@ void Read
     }
 }
 
+template<typename T>
+void Read( DistSparseMatrix<T>& A, const string filename, FileFormat format )
+{
+    DEBUG_ONLY(CSE cse("Read"))
+    if( format == AUTO )
+        format = DetectFormat( filename );
+
+    switch( format )
+    {
+    case BINARY_CSR:
+        read::BinaryCSR( A, filename );
+        break;
+    case MATRIX_MARKET:
+        read::MatrixMarket( A, filename );
+        break;
+    default:
+        LogicError("Unsupported distributed sparse read format");
+    }
+}
+
+void Read( DistGraph& graph, const string filename, FileFormat format )
+{
+    DEBUG_ONLY(CSE cse("Read"))
+    if( format == AUTO )
+        format = DetectFormat( filename );
+
+    switch( format )
+    {
+    case BINARY_CSR:
+        read::BinaryCSR( graph, filename );
+        break;
+    case MATRIX_MARKET:
+        read::MatrixMarket( graph, filename );
+        break;
+    default:
+        LogicError("Unsupported distributed graph read format");
+    }
+}
+
 #define PROTO(T) \
   template void Read \
   ( Matrix<T>& A, const string filename, FileFormat format ); \
@@ -167,7 +214,9 @@ void Read
     FileFormat format, bool sequential ); \
   template void Read \
   ( AbstractBlockDistMatrix<T>& A, const string filename, \
-    FileFormat format, bool sequential );
+    FileFormat format, bool sequential ); \
+  template void Read \
+  ( DistSparseMatrix<T>& A, const string filename, FileFormat format );
 
 #include "El/macros/Instantiate.h"
 
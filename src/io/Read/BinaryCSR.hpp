@@ -0,0 +1,145 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_READ_BINARYCSR_HPP
+#define EL_READ_BINARYCSR_HPP
+
+namespace El {
+namespace read {
+
+// The BINARY_CSR format is laid out as
+//
+//   Int height, width, numNonzeros;
+//   Int rowOffsets[height+1];
+//   Int colIndices[numNonzeros];
+//   T   values[numNonzeros];
+//
+// so that each array is contiguous (and the file can be memory-mapped as-is)
+// and each process can directly read the entries of the rows that it owns.
+
+inline void
+BinaryCSRHeader
+( mpi::File file, mpi::Comm comm, Int& height, Int& width, Int& numNonzeros )
+{
+    DEBUG_ONLY(CSE cse("read::BinaryCSRHeader"))
+    Int dims[3];
+    if( mpi::Rank(comm) == 0 )
+        mpi::ReadAt( file, 0, dims, 3, mpi::TypeMap<Int>() );
+    mpi::Broadcast( dims, 3, 0, comm );
+    height = dims[0];
+    width = dims[1];
+    numNonzeros = dims[2];
+}
+
+// Read the offsets and column indices of rows [firstRow,firstRow+numRows)
+// and return the index of the first entry
+inline Int
+BinaryCSRStructure
+( mpi::File file, Int height, Int numNonzeros, Int firstRow, Int numRows,
+  vector<Int>& rowOffs, vector<Int>& colInds )
+{
+    DEBUG_ONLY(CSE cse("read::BinaryCSRStructure"))
+    const mpi::Offset offsetsBeg = 3*sizeof(Int);
+    const mpi::Offset colsBeg = offsetsBeg + (height+1)*sizeof(Int);
+
+    rowOffs.resize( numRows+1 );
+    dist_file::ReadAt
+    ( file, offsetsBeg+firstRow*sizeof(Int), rowOffs.data(), numRows+1 );
+    const Int entryBeg = rowOffs[0];
+    const Int numLocalEntries = rowOffs[numRows] - entryBeg;
+    for( Int iLoc=0; iLoc<=numRows; ++iLoc )
+        rowOffs[iLoc] -= entryBeg;
+
+    colInds.resize( numLocalEntries );
+    dist_file::ReadAt
+    ( file, colsBeg+entryBeg*sizeof(Int), colInds.data(), numLocalEntries );
+    return entryBeg;
+}
+
+template<typename T>
+inline void
+BinaryCSR( DistSparseMatrix<T>& A, const string filename )
+{
+    DEBUG_ONLY(CSE cse("read::BinaryCSR"))
+    mpi::Comm comm = A.Comm();
+    mpi::File file;
+    mpi::Open( comm, filename, false, file );
+
+    Int height, width, numNonzeros;
+    BinaryCSRHeader( file, comm, height, width, numNonzeros );
+    const Int numBytes = mpi::Size( file );
+    const Int structBytes = (3+(height+1)+numNonzeros)*sizeof(Int);
+    const Int numBytesExp = structBytes + numNonzeros*sizeof(T);
+    if( numBytes != numBytesExp )
+    {
+        mpi::Close( file );
+        RuntimeError
+        ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
+    }
+    A.Resize( height, width );
+
+    const Int localHeight = A.LocalHeight();
+    vector<Int> rowOffs, colInds;
+    const Int entryBeg = 
+      BinaryCSRStructure
+      ( file, height, numNonzeros, A.FirstLocalRow(), localHeight, 
+        rowOffs, colInds );
+    const Int numLocalEntries = colInds.size();
+    vector<T> values( numLocalEntries );
+    dist_file::ReadAt
+    ( file, structBytes+entryBeg*sizeof(T), values.data(), numLocalEntries );
+    mpi::Close( file );
+
+    A.Reserve( numLocalEntries );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        for( Int e=rowOffs[iLoc]; e<rowOffs[iLoc+1]; ++e )
+            A.QueueLocalUpdate( iLoc, colInds[e], values[e] );
+    A.ProcessLocalQueues();
+}
+
+inline void
+BinaryCSR( DistGraph& graph, const string filename )
+{
+    DEBUG_ONLY(CSE cse("read::BinaryCSR"))
+    mpi::Comm comm = graph.Comm();
+    mpi::File file;
+    mpi::Open( comm, filename, false, file );
+
+    // The values (of unknown type) are ignored
+    Int numSources, numTargets, numEdges;
+    BinaryCSRHeader( file, comm, numSources, numTargets, numEdges );
+    const Int numBytes = mpi::Size( file );
+    const Int structBytes = (3+(numSources+1)+numEdges)*sizeof(Int);
+    if( numBytes < structBytes )
+    {
+        mpi::Close( file );
+        RuntimeError
+        ("Expected file to be at least ",structBytes," bytes but found ",
+         numBytes);
+    }
+    graph.Resize( numSources, numTargets );
+
+    const Int numLocalSources = graph.NumLocalSources();
+    vector<Int> edgeOffs, targets;
+    BinaryCSRStructure
+    ( file, numSources, numEdges, graph.FirstLocalSource(), numLocalSources,
+      edgeOffs, targets );
+    mpi::Close( file );
+
+    graph.Reserve( targets.size() );
+    for( Int sLoc=0; sLoc<numLocalSources; ++sLoc )
+        for( Int e=edgeOffs[sLoc]; e<edgeOffs[sLoc+1]; ++e )
+            graph.QueueLocalConnection( sLoc, targets[e] );
+    graph.ProcessLocalQueues();
+}
+
+} // namespace read
+} // namespace El
+
+#endif // ifndef EL_READ_BINARYCSR_HPP
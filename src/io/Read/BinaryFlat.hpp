@@ -36,122 +36,47 @@ BinaryFlat( Matrix<T>& A, Int height, Int width, const string filename )
             file.read( (char*)A.Buffer(0,j), height*sizeof(T) );
 }
 
-template<typename T>
+// Each process collectively reads its own local entries via MPI-IO
+template<typename T,template<typename> class DistType>
 inline void
-BinaryFlat
-( AbstractDistMatrix<T>& A, Int height, Int width, const string filename )
+DistBinaryFlat
+( DistType<T>& A, Int height, Int width, const string filename )
 {
-    DEBUG_ONLY(CSE cse("read::BinaryFlat"))
-    std::ifstream file( filename.c_str(), std::ios::binary );
-    if( !file.is_open() )
-        RuntimeError("Could not open ",filename);
+    DEBUG_ONLY(CSE cse("read::DistBinaryFlat"))
+    mpi::Comm comm = A.Grid().ViewingComm();
+    mpi::File file;
+    mpi::Open( comm, filename, false, file );
 
-    const Int numBytes = FileSize( file );
+    const Int numBytes = mpi::Size( file );
     const Int numBytesExp = height*width*sizeof(T);
     if( numBytes != numBytesExp )
+    {
+        mpi::Close( file );
         RuntimeError
         ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
+    }
 
     A.Resize( height, width );
-    if( A.ColStride() == 1 && A.RowStride() == 1 )
-    {
-        if( A.CrossRank() == A.Root() )
-        {
-            if( A.Height() == A.LDim() )
-                file.read( (char*)A.Buffer(), height*width*sizeof(T) );
-            else
-                for( Int j=0; j<width; ++j )
-                    file.read( (char*)A.Buffer(0,j), height*sizeof(T) );
-        }
-    }
-    else if( A.ColStride() == 1 )
-    {
-        const Int localWidth = A.LocalWidth();
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            const Int j = A.GlobalCol(jLoc);
-            const Int localIndex = j*height;
-            const std::streamoff pos = localIndex*sizeof(T);
-            file.seekg( pos );
-            file.read( (char*)A.Buffer(0,jLoc), height*sizeof(T) );
-        }
-    }
-    else
-    {
-        const Int localHeight = A.LocalHeight();
-        const Int localWidth = A.LocalWidth();
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            const Int j = A.GlobalCol(jLoc);
-            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-            {
-                const Int i = A.GlobalRow(iLoc);
-                const Int localIndex = i+j*height;
-                const std::streamoff pos = localIndex*sizeof(T);
-                file.seekg( pos );
-                file.read( (char*)A.Buffer(iLoc,jLoc), sizeof(T) );
-            }
-        }
-    }
+    dist_file::ReadLocal( file, 0, A );
+    mpi::Close( file );
 }
 
 template<typename T>
 inline void
 BinaryFlat
-( AbstractBlockDistMatrix<T>& A, Int height, Int width, const string filename )
+( AbstractDistMatrix<T>& A, Int height, Int width, const string filename )
 {
     DEBUG_ONLY(CSE cse("read::BinaryFlat"))
-    std::ifstream file( filename.c_str(), std::ios::binary );
-    if( !file.is_open() )
-        RuntimeError("Could not open ",filename);
-
-    const Int numBytes = FileSize( file );
-    const Int numBytesExp = height*width*sizeof(T);
-    if( numBytes != numBytesExp )
-        RuntimeError
-        ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
+    DistBinaryFlat( A, height, width, filename );
+}
 
-    A.Resize( height, width );
-    if( A.ColStride() == 1 && A.RowStride() == 1 )
-    {
-        if( A.CrossRank() == A.Root() )
-        {
-            if( A.Height() == A.LDim() )
-                file.read( (char*)A.Buffer(), height*width*sizeof(T) );
-            else
-                for( Int j=0; j<width; ++j )
-                    file.read( (char*)A.Buffer(0,j), height*sizeof(T) );
-        }
-    }
-    else if( A.ColStride() == 1 )
-    {
-        const Int localWidth = A.LocalWidth();
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            const Int j = A.GlobalCol(jLoc);
-            const Int localIndex = j*height;
-            const std::streamoff pos = localIndex*sizeof(T);
-            file.seekg( pos );
-            file.read( (char*)A.Buffer(0,jLoc), height*sizeof(T) );
-        }
-    }
-    else
-    {
-        const Int localHeight = A.LocalHeight();
-        const Int localWidth = A.LocalWidth();
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            const Int j = A.GlobalCol(jLoc);
-            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-            {
-                const Int i = A.GlobalRow(iLoc);
-                const Int localIndex = i+j*height;
-                const std::streamoff pos = localIndex*sizeof(T);
-                file.seekg( pos );
-                file.read( (char*)A.Buffer(iLoc,jLoc), sizeof(T) );
-            }
-        }
-    }
+template<typename T>
+inline void
+BinaryFlat
+( AbstractBlockDistMatrix<T>& A, Int height, Int width, const string filename )
+{
+    DEBUG_ONLY(CSE cse("read::BinaryFlat"))
+    DistBinaryFlat( A, height, width, filename );
 }
 
 } // namespace read
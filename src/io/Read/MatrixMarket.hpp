@@ -13,20 +13,21 @@
 namespace El {
 namespace read {
 
-template<typename T>
-inline void
-MatrixMarket( Matrix<T>& A, const string filename )
+struct MatrixMarketHeader
 {
-    DEBUG_ONLY(CSE cse("read::MatrixMarket"))
-    typedef Base<T> Real;
-    std::ifstream file( filename.c_str() );
-    if( !file.is_open() )
-        RuntimeError("Could not open ",filename);
+    bool isMatrix, isArray, isComplex, isPattern;
+    bool isGeneral, isSymmetric, isSkewSymmetric, isHermitian;
+};
+
+// Parse and validate the banner line and then skip past the comments
+inline MatrixMarketHeader
+ReadMatrixMarketHeader( std::ifstream& file )
+{
+    DEBUG_ONLY(CSE cse("read::ReadMatrixMarketHeader"))
+    MatrixMarketHeader header;
 
-    // Read the header
-    // ===============
     // Attempt to pull in the various header components
-    // ------------------------------------------------
+    // ================================================
     string line, stamp, object, format, field, symmetry;
     if( !std::getline( file, line ) )
         RuntimeError("Could not extract header line");
@@ -45,42 +46,68 @@ MatrixMarket( Matrix<T>& A, const string filename )
             RuntimeError("Missing Matrix Market symmetry");
     }
     // Ensure that the header components are individually valid
-    // --------------------------------------------------------
-    const bool isMatrix = ( object == string("matrix") );
-    const bool isArray = ( format == string("array") );
-    const bool isComplex = ( field == string("complex") );
-    const bool isPattern = ( field == string("pattern") );
-    const bool isGeneral = ( symmetry == string("general") );
-    const bool isSymmetric = ( symmetry == string("symmetric") );
-    const bool isSkewSymmetric = ( symmetry == string("skew-symmetric") );
-    const bool isHermitian = ( symmetry == string("hermitian") );
-    if( !isMatrix && object != string("vector") )
+    // ========================================================
+    header.isMatrix = ( object == string("matrix") );
+    header.isArray = ( format == string("array") );
+    header.isComplex = ( field == string("complex") );
+    header.isPattern = ( field == string("pattern") );
+    header.isGeneral = ( symmetry == string("general") );
+    header.isSymmetric = ( symmetry == string("symmetric") );
+    header.isSkewSymmetric = ( symmetry == string("skew-symmetric") );
+    header.isHermitian = ( symmetry == string("hermitian") );
+    if( !header.isMatrix && object != string("vector") )
         RuntimeError("Invalid Matrix Market object: ",object);
-    if( !isArray && format != string("coordinate") )
+    if( !header.isArray && format != string("coordinate") )
         RuntimeError("Invalid Matrix Market format: ",format);
-    if( !isComplex && !isPattern && 
+    if( !header.isComplex && !header.isPattern && 
         field != string("real") && 
         field != string("double") &&
         field != string("integer") )
         RuntimeError("Invalid Matrix Market field: ",field);
-    if( !isGeneral && !isSymmetric && !isSkewSymmetric && !isHermitian )
+    if( !header.isGeneral && !header.isSymmetric && 
+        !header.isSkewSymmetric && !header.isHermitian )
         RuntimeError("Invalid Matrix Market symmetry: ",symmetry);
     // Ensure that the components are consistent
-    // -----------------------------------------
-    if( isArray && isPattern )
+    // =========================================
+    if( header.isArray && header.isPattern )
         RuntimeError("Pattern field requires coordinate format");
     // NOTE: This constraint is only enforced because of the note located at
     //       http://people.sc.fsu.edu/~jburkardt/data/mm/mm.html
-    if( isSkewSymmetric && isPattern )
+    if( header.isSkewSymmetric && header.isPattern )
         RuntimeError("Pattern field incompatible with skew-symmetry");
-    if( isHermitian && !isComplex )
+    if( header.isHermitian && !header.isComplex )
         RuntimeError("Hermitian symmetry requires complex data");
 
     // Skip the comment lines
     // ======================
     while( file.peek() == '%' ) 
         std::getline( file, line );
+
+    return header;
+}
+
+template<typename T>
+inline void
+MatrixMarket( Matrix<T>& A, const string filename )
+{
+    DEBUG_ONLY(CSE cse("read::MatrixMarket"))
+    typedef Base<T> Real;
+    std::ifstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+
+    // Read the header
+    // ===============
+    const MatrixMarketHeader header = ReadMatrixMarketHeader( file );
+    const bool isMatrix = header.isMatrix;
+    const bool isArray = header.isArray;
+    const bool isComplex = header.isComplex;
+    const bool isPattern = header.isPattern;
+    const bool isSymmetric = header.isSymmetric;
+    const bool isSkewSymmetric = header.isSkewSymmetric;
+    const bool isHermitian = header.isHermitian;
   
+    string line;
     int m, n;
     if( !std::getline( file, line ) )
         RuntimeError("Could not extract the size line");
@@ -250,6 +277,133 @@ MatrixMarket( AbstractBlockDistMatrix<T>& A, const string filename )
     Copy( A_CIRC_CIRC, A );
 }
 
+// Every process parses the (coordinate) entries which begin within its
+// contiguous share of the bytes of the file and hands them to 'queue', which 
+// is expected to route them to their owners. Symmetric, skew-symmetric, and
+// Hermitian files have their strictly-upper triangles filled in on the fly.
+template<typename T,typename DistType,typename QueueType>
+inline void
+DistMatrixMarket( DistType& A, const string filename, QueueType queue )
+{
+    DEBUG_ONLY(CSE cse("read::DistMatrixMarket"))
+    typedef Base<T> Real;
+    std::ifstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+
+    // Every process redundantly reads the (short) header
+    // ==================================================
+    const MatrixMarketHeader header = ReadMatrixMarketHeader( file );
+    if( header.isArray )
+        RuntimeError("Sparse reads require the coordinate format");
+    string line;
+    if( !std::getline( file, line ) )
+        RuntimeError("Could not extract the size line");
+    Int m, n, numNonzero;
+    {
+        std::stringstream lineStream( line );
+        if( !(lineStream >> m) )
+            RuntimeError("Missing height: ",line);
+        if( header.isMatrix )
+        {
+            if( !(lineStream >> n) )
+                RuntimeError("Missing matrix width: ",line);
+        }
+        else
+            n = 1;
+        if( !(lineStream >> numNonzero) )
+            RuntimeError("Missing nonzeros entry: ",line);
+    }
+    A.Resize( m, n );
+
+    // Find our share of the nonzero lines
+    // ===================================
+    // Each line is parsed by the process whose byte range contains its start
+    mpi::Comm comm = A.Comm();
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+    const std::streamoff dataBeg = file.tellg();
+    const std::streamoff dataEnd = FileSize( file );
+    const std::streamoff numDataBytes = dataEnd - dataBeg;
+    const std::streamoff beg = dataBeg + (numDataBytes*commRank)/commSize;
+    const std::streamoff end = dataBeg + (numDataBytes*(commRank+1))/commSize;
+    if( beg > dataBeg )
+    {
+        file.seekg( beg-1 );
+        if( file.get() != '\n' )
+            std::getline( file, line );
+    }
+
+    // Parse the nonzeros
+    // ==================
+    const bool conjugateSkew = false;
+    Int i, j;
+    Real realPart, imagPart;
+    while( file.tellg() < end && std::getline( file, line ) )
+    {
+        std::stringstream lineStream( line );
+        if( !(lineStream >> i) )
+            continue; // blank line
+        --i; // convert from Fortran to C indexing
+        if( header.isMatrix )
+        {
+            if( !(lineStream >> j) )
+                RuntimeError("Could not extract col coordinate: ",line);
+            --j;
+        }
+        else
+            j = 0;
+
+        T value = T(1);
+        if( !header.isPattern )
+        {
+            if( !(lineStream >> realPart) )
+                RuntimeError("Could not extract real part: ",line);
+            value = realPart;
+            if( header.isComplex )
+            {
+                if( !(lineStream >> imagPart) )
+                    RuntimeError("Could not extract imag part: ",line);
+                SetImagPart( value, imagPart );
+            }
+        }
+
+        queue( i, j, value );
+        if( i != j )
+        {
+            if( header.isSymmetric )
+                queue( j, i, value );
+            else if( header.isHermitian )
+                queue( j, i, Conj(value) );
+            else if( header.isSkewSymmetric )
+                queue( j, i, -(conjugateSkew ? Conj(value) : value) );
+        }
+    }
+}
+
+template<typename T>
+inline void
+MatrixMarket( DistSparseMatrix<T>& A, const string filename )
+{
+    DEBUG_ONLY(CSE cse("read::MatrixMarket"))
+    DistMatrixMarket<T>
+    ( A, filename, 
+      [&]( Int i, Int j, T value ) { A.QueueUpdate( i, j, value, false ); } );
+    A.ProcessQueues();
+}
+
+inline void
+MatrixMarket( DistGraph& graph, const string filename )
+{
+    DEBUG_ONLY(CSE cse("read::MatrixMarket"))
+    // The values are parsed but ignored
+    DistMatrixMarket<Complex<double>>
+    ( graph, filename, 
+      [&]( Int i, Int j, Complex<double> value ) 
+      { graph.QueueConnection( i, j, false ); } );
+    graph.ProcessQueues();
+}
+
 } // namespace read
 } // namespace El
 
@@ -8,10 +8,12 @@
 */
 #include "El.hpp"
 
+#include "./DistFile.hpp"
 #include "./Write/Ascii.hpp"
 #include "./Write/AsciiMatlab.hpp"
 #include "./Write/Binary.hpp"
 #include "./Write/BinaryFlat.hpp"
+#include "./Write/BinaryCSR.hpp"
 #include "./Write/Image.hpp"
 #include "./Write/MatrixMarket.hpp"
 
@@ -49,7 +51,16 @@ void Write
   string basename, FileFormat format, string title )
 {
     DEBUG_ONLY(CSE cse("Write"))
-    if( A.ColStride() == 1 && A.RowStride() == 1 )
+    if( format == BINARY )
+    {
+        // Every process writes its own entries directly
+        write::Binary( A, basename );
+    }
+    else if( format == BINARY_FLAT )
+    {
+        write::BinaryFlat( A, basename );
+    }
+    else if( A.ColStride() == 1 && A.RowStride() == 1 )
     {
         if( A.CrossRank() == A.Root() && A.RedundantRank() == 0 )
             Write( A.LockedMatrix(), basename, format, title );
@@ -68,7 +79,16 @@ void Write
   string basename, FileFormat format, string title )
 {
     DEBUG_ONLY(CSE cse("Write"))
-    if( A.ColStride() == 1 && A.RowStride() == 1 )
+    if( format == BINARY )
+    {
+        // Every process writes its own entries directly
+        write::Binary( A, basename );
+    }
+    else if( format == BINARY_FLAT )
+    {
+        write::BinaryFlat( A, basename );
+    }
+    else if( A.ColStride() == 1 && A.RowStride() == 1 )
     {
         if( A.CrossRank() == A.Root() && A.RedundantRank() == 0 )
             Write( A.LockedMatrix(), basename, format, title );
@@ -81,6 +101,19 @@ void Write
     }
 }
 
+template<typename T>
+void Write
+( const DistSparseMatrix<T>& A, string basename, FileFormat format )
+{
+    DEBUG_ONLY(CSE cse("Write"))
+    switch( format )
+    {
+    case BINARY_CSR: write::BinaryCSR( A, basename ); break;
+    default:
+        LogicError("Unsupported distributed sparse write format");
+    }
+}
+
 #define PROTO(T) \
   template void Write \
   ( const Matrix<T>& A, \
@@ -90,7 +123,9 @@ void Write
     string basename, FileFormat format, string title ); \
   template void Write \
   ( const AbstractBlockDistMatrix<T>& A, \
-    string basename, FileFormat format, string title );
+    string basename, FileFormat format, string title ); \
+  template void Write \
+  ( const DistSparseMatrix<T>& A, string basename, FileFormat format );
 
 #define EL_ENABLE_QUAD
 #include "El/macros/Instantiate.h"
@@ -36,6 +36,48 @@ Binary( const Matrix<T>& A, string basename="matrix" )
             file.write( (char*)A.LockedBuffer(0,j), A.Height()*sizeof(T) );
 }
 
+// Each process collectively writes its own local entries via MPI-IO
+template<typename T,template<typename> class DistType>
+inline void
+DistBinary( const DistType<T>& A, string basename )
+{
+    DEBUG_ONLY(CSE cse("write::DistBinary"))
+    
+    string filename = basename + "." + FileExtension(BINARY);
+    mpi::Comm comm = A.Grid().ViewingComm();
+    mpi::File file;
+    mpi::Open( comm, filename, true, file );
+
+    // Truncate any previous contents
+    const Int metaBytes = 2*sizeof(Int);
+    const Int dataBytes = A.Height()*A.Width()*sizeof(T);
+    mpi::SetSize( file, metaBytes+dataBytes );
+
+    if( mpi::Rank(comm) == 0 )
+    {
+        Int dims[2] = { A.Height(), A.Width() };
+        mpi::WriteAt( file, 0, dims, 2, mpi::TypeMap<Int>() );
+    }
+    dist_file::WriteLocal( file, metaBytes, A );
+    mpi::Close( file );
+}
+
+template<typename T>
+inline void
+Binary( const AbstractDistMatrix<T>& A, string basename="matrix" )
+{
+    DEBUG_ONLY(CSE cse("write::Binary"))
+    DistBinary( A, basename );
+}
+
+template<typename T>
+inline void
+Binary( const AbstractBlockDistMatrix<T>& A, string basename="matrix" )
+{
+    DEBUG_ONLY(CSE cse("write::Binary"))
+    DistBinary( A, basename );
+}
+
 } // namespace write
 } // namespace El
 
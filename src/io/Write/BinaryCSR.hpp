@@ -0,0 +1,70 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_WRITE_BINARYCSR_HPP
+#define EL_WRITE_BINARYCSR_HPP
+
+namespace El {
+namespace write {
+
+// See src/io/Read/BinaryCSR.hpp for a description of the format.
+// Each process independently writes the rows that it owns.
+template<typename T>
+inline void
+BinaryCSR( const DistSparseMatrix<T>& A, string basename="matrix" )
+{
+    DEBUG_ONLY(CSE cse("write::BinaryCSR"))
+    
+    string filename = basename + "." + FileExtension(BINARY_CSR);
+    mpi::Comm comm = A.Comm();
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+    const Int height = A.Height();
+    const Int localHeight = A.LocalHeight();
+    const Int numLocalEntries = A.NumLocalEntries();
+    const Int numNonzeros = mpi::AllReduce( numLocalEntries, comm );
+    const Int entryBeg = mpi::Scan( numLocalEntries, comm ) - numLocalEntries;
+
+    mpi::File file;
+    mpi::Open( comm, filename, true, file );
+    const mpi::Offset offsetsBeg = 3*sizeof(Int);
+    const mpi::Offset colsBeg = offsetsBeg + (height+1)*sizeof(Int);
+    const mpi::Offset valuesBeg = colsBeg + numNonzeros*sizeof(Int);
+    // Truncate any previous contents
+    mpi::SetSize( file, valuesBeg+numNonzeros*sizeof(T) );
+
+    if( commRank == 0 )
+    {
+        Int dims[3] = { height, A.Width(), numNonzeros };
+        dist_file::WriteAt( file, 0, dims, 3 );
+    }
+
+    // The last process also writes the trailing offset
+    const Int numOffsets = ( commRank == commSize-1 ? localHeight+1 
+                                                     : localHeight );
+    vector<Int> rowOffs( numOffsets );
+    for( Int iLoc=0; iLoc<numOffsets; ++iLoc )
+        rowOffs[iLoc] = entryBeg + 
+          ( iLoc < localHeight ? A.EntryOffset(iLoc) : numLocalEntries );
+    dist_file::WriteAt
+    ( file, offsetsBeg+A.FirstLocalRow()*sizeof(Int), 
+      rowOffs.data(), numOffsets );
+    dist_file::WriteAt
+    ( file, colsBeg+entryBeg*sizeof(Int), 
+      A.LockedTargetBuffer(), numLocalEntries );
+    dist_file::WriteAt
+    ( file, valuesBeg+entryBeg*sizeof(T), 
+      A.LockedValueBuffer(), numLocalEntries );
+    mpi::Close( file );
+}
+
+} // namespace write
+} // namespace El
+
+#endif // ifndef EL_WRITE_BINARYCSR_HPP
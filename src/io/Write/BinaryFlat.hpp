@@ -31,6 +31,41 @@ BinaryFlat( const Matrix<T>& A, string basename="matrix" )
             file.write( (char*)A.LockedBuffer(0,j), A.Height()*sizeof(T) );
 }
 
+// Each process collectively writes its own local entries via MPI-IO
+template<typename T,template<typename> class DistType>
+inline void
+DistBinaryFlat( const DistType<T>& A, string basename )
+{
+    DEBUG_ONLY(CSE cse("write::DistBinaryFlat"))
+    
+    string filename = basename + "." + FileExtension(BINARY_FLAT);
+    mpi::Comm comm = A.Grid().ViewingComm();
+    mpi::File file;
+    mpi::Open( comm, filename, true, file );
+
+    // Truncate any previous contents
+    mpi::SetSize( file, A.Height()*A.Width()*sizeof(T) );
+
+    dist_file::WriteLocal( file, 0, A );
+    mpi::Close( file );
+}
+
+template<typename T>
+inline void
+BinaryFlat( const AbstractDistMatrix<T>& A, string basename="matrix" )
+{
+    DEBUG_ONLY(CSE cse("write::BinaryFlat"))
+    DistBinaryFlat( A, basename );
+}
+
+template<typename T>
+inline void
+BinaryFlat( const AbstractBlockDistMatrix<T>& A, string basename="matrix" )
+{
+    DEBUG_ONLY(CSE cse("write::BinaryFlat"))
+    DistBinaryFlat( A, basename );
+}
+
 } // namespace write
 } // namespace El
 
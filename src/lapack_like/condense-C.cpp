@@ -17,6 +17,8 @@ ElError ElHermitianTridiagCtrlDefault_s( ElHermitianTridiagCtrl* ctrl )
     ctrl->approach = EL_HERMITIAN_TRIDIAG_DEFAULT;
     ctrl->order = EL_ROW_MAJOR;
     ElSymvCtrlDefault_s( &ctrl->symvCtrl );
+    ctrl->twoStage = false;
+    ctrl->bandwidth = 0;
     return EL_SUCCESS;
 }
 ElError ElHermitianTridiagCtrlDefault_d( ElHermitianTridiagCtrl* ctrl )
@@ -24,6 +26,8 @@ ElError ElHermitianTridiagCtrlDefault_d( ElHermitianTridiagCtrl* ctrl )
     ctrl->approach = EL_HERMITIAN_TRIDIAG_DEFAULT;
     ctrl->order = EL_ROW_MAJOR;
     ElSymvCtrlDefault_d( &ctrl->symvCtrl );
+    ctrl->twoStage = false;
+    ctrl->bandwidth = 0;
     return EL_SUCCESS;
 }
 ElError ElHermitianTridiagCtrlDefault_c( ElHermitianTridiagCtrl* ctrl )
@@ -31,6 +35,8 @@ ElError ElHermitianTridiagCtrlDefault_c( ElHermitianTridiagCtrl* ctrl )
     ctrl->approach = EL_HERMITIAN_TRIDIAG_DEFAULT;
     ctrl->order = EL_ROW_MAJOR;
     ElSymvCtrlDefault_c( &ctrl->symvCtrl );
+    ctrl->twoStage = false;
+    ctrl->bandwidth = 0;
     return EL_SUCCESS;
 }
 ElError ElHermitianTridiagCtrlDefault_z( ElHermitianTridiagCtrl* ctrl )
@@ -38,6 +44,8 @@ ElError ElHermitianTridiagCtrlDefault_z( ElHermitianTridiagCtrl* ctrl )
     ctrl->approach = EL_HERMITIAN_TRIDIAG_DEFAULT;
     ctrl->order = EL_ROW_MAJOR;
     ElSymvCtrlDefault_z( &ctrl->symvCtrl );
+    ctrl->twoStage = false;
+    ctrl->bandwidth = 0;
     return EL_SUCCESS;
 }
 
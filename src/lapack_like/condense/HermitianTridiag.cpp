@@ -12,6 +12,7 @@
 #include "./HermitianTridiag/LSquare.hpp"
 #include "./HermitianTridiag/U.hpp"
 #include "./HermitianTridiag/USquare.hpp"
+#include "./HermitianTridiag/TwoStage.hpp"
 
 #include "./HermitianTridiag/ApplyQ.hpp"
 
@@ -33,6 +34,10 @@ void HermitianTridiag
   const HermitianTridiagCtrl<F>& ctrl )
 {
     DEBUG_ONLY(CSE cse("HermitianTridiag"))
+    if( ctrl.twoStage )
+        LogicError
+        ("The two-stage reduction requires herm_tridiag::TwoStage since its "
+         "Q is not stored in packed form");
 
     auto APtr = ReadWriteProxy<F,MC,MR>( &APre ); auto& A = *APtr;
     auto tPtr = WriteProxy<F,STAR,STAR>( &tPre ); auto& t = *tPtr;
@@ -134,13 +139,62 @@ void ExplicitCondensed
 {
     DEBUG_ONLY(CSE cse("herm_tridiag::ExplicitCondensed"))
     DistMatrix<F,STAR,STAR> t(A.Grid());
-    HermitianTridiag( uplo, A, t, ctrl );
+    if( ctrl.twoStage )
+    {
+        BulgeReflectors<F> bulge;
+        TwoStage( uplo, A, t, bulge, ctrl );
+    }
+    else
+        HermitianTridiag( uplo, A, t, ctrl );
     if( uplo == UPPER )
         MakeTrapezoidal( LOWER, A, 1 );
     else
         MakeTrapezoidal( UPPER, A, -1 );
 }
 
+template<typename F>
+void TwoStage
+( UpperOrLower uplo, AbstractDistMatrix<F>& APre, AbstractDistMatrix<F>& tPre,
+  BulgeReflectors<F>& bulge, const HermitianTridiagCtrl<F>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("herm_tridiag::TwoStage"))
+    auto APtr = ReadWriteProxy<F,MC,MR>( &APre ); auto& A = *APtr;
+    auto tPtr = WriteProxy<F,STAR,STAR>( &tPre ); auto& t = *tPtr;
+    TwoStageReduce( uplo, A, t, bulge, ctrl.bandwidth );
+}
+
+template<typename F>
+void ApplyQ
+( Orientation orientation,
+  const AbstractDistMatrix<F>& A, const AbstractDistMatrix<F>& t,
+  const BulgeReflectors<F>& bulge, AbstractDistMatrix<F>& B )
+{
+    DEBUG_ONLY(
+        CSE cse("herm_tridiag::ApplyQ");
+        if( B.Height() != bulge.height )
+            LogicError("B must have the same height as the reduced matrix");
+    )
+    // Each process owns entire columns of B[* ,VR]
+    const Int offset = -bulge.bandwidth;
+    DistMatrix<F,STAR,VR> B_STAR_VR( B.Grid() );
+    if( orientation == NORMAL )
+    {
+        Copy( B, B_STAR_VR );
+        ApplyBulgeReflectors( NORMAL, bulge, B_STAR_VR.Matrix() );
+        Copy( B_STAR_VR, B );
+        ApplyPackedReflectors
+        ( LEFT, LOWER, VERTICAL, BACKWARD, CONJUGATED, offset, A, t, B );
+    }
+    else
+    {
+        ApplyPackedReflectors
+        ( LEFT, LOWER, VERTICAL, FORWARD, UNCONJUGATED, offset, A, t, B );
+        Copy( B, B_STAR_VR );
+        ApplyBulgeReflectors( ADJOINT, bulge, B_STAR_VR.Matrix() );
+        Copy( B_STAR_VR, B );
+    }
+}
+
 } // namespace herm_tridiag
 
 #define PROTO(F) \
@@ -160,6 +214,15 @@ void ExplicitCondensed
   template void herm_tridiag::ApplyQ \
   ( LeftOrRight side, UpperOrLower uplo, Orientation orientation, \
     const AbstractDistMatrix<F>& A, const AbstractDistMatrix<F>& t, \
+          AbstractDistMatrix<F>& B ); \
+  template void herm_tridiag::TwoStage \
+  ( UpperOrLower uplo, AbstractDistMatrix<F>& A, AbstractDistMatrix<F>& t, \
+    herm_tridiag::BulgeReflectors<F>& bulge, \
+    const HermitianTridiagCtrl<F>& ctrl ); \
+  template void herm_tridiag::ApplyQ \
+  ( Orientation orientation, \
+    const AbstractDistMatrix<F>& A, const AbstractDistMatrix<F>& t, \
+    const herm_tridiag::BulgeReflectors<F>& bulge, \
           AbstractDistMatrix<F>& B );
 
 #define EL_NO_INT_PROTO
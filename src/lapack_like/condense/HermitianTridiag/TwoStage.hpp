@@ -0,0 +1,419 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_HERMITIANTRIDIAG_TWOSTAGE_HPP
+#define EL_HERMITIANTRIDIAG_TWOSTAGE_HPP
+
+// Two-stage reduction to real symmetric tridiagonal form. The first stage
+// reduces A to a band matrix with b subdiagonals through a blocked sequence of
+// QR factorizations of the panels below the band, each of which is applied
+// to the trailing matrix through a Hemm and a Her2k. The band is then
+// gathered onto every process, where the second stage annihilates its
+// columns one at a time, with each sweep chasing the resulting bulge off of
+// the end of the band. The steps of successive sweeps are pipelined on a
+// TaskGraph.
+//
+// The first-stage reflectors are stored below the b'th subdiagonal of A (in
+// the same form as the one-stage reflectors are stored below the first), and
+// the second-stage reflectors are returned in a BulgeReflectors structure,
+// whose application to the eigenvectors is blocked over groups of sweeps.
+//
+// Only the lower triangle of A is used, and so the upper triangle is first
+// conjugate-transposed into it when uplo == UPPER.
+
+namespace El {
+namespace herm_tridiag {
+
+// Form the upper-triangular S such that
+//
+//   (I - conj(tau_0) v_0 v_0^H) ... (I - conj(tau_{r-1}) v_{r-1} v_{r-1}^H)
+//     = I - V S V^H,
+//
+// given the (lower triangle of the) Gram matrix G = V^H V
+template<typename F>
+inline void
+TwoStageTriangularFactor
+( const Matrix<F>& G, const vector<F>& tau, Matrix<F>& S )
+{
+    DEBUG_ONLY(CSE cse("herm_tridiag::TwoStageTriangularFactor"))
+    const Int r = tau.size();
+    Zeros( S, r, r );
+    Matrix<F> g01;
+    for( Int j=0; j<r; ++j )
+    {
+        const F tauConj = Conj(tau[j]);
+        S.Set( j, j, tauConj );
+        if( j == 0 )
+            continue;
+        auto S00 = S( IR(0,j), IR(0,j) );
+        auto s01 = S( IR(0,j), IR(j) );
+        Adjoint( G( IR(j), IR(0,j) ), g01 );
+        Gemv( NORMAL, -tauConj, S00, g01, F(0), s01 );
+    }
+}
+
+// The first stage
+// ===============
+template<typename F>
+inline void
+BandReduce( DistMatrix<F>& A, DistMatrix<F,STAR,STAR>& t, Int b )
+{
+    DEBUG_ONLY(CSE cse("herm_tridiag::BandReduce"))
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+    Zeros( t, Max(n-b,0), 1 );
+
+    DistMatrix<F> V(g), Y(g), G(g);
+    DistMatrix<F,MD,STAR> tPan(g);
+    DistMatrix<Base<F>,MD,STAR> dPan(g);
+    DistMatrix<F,STAR,STAR> tPan_STAR_STAR(g), G_STAR_STAR(g), S(g), C(g);
+    for( Int k=0; k+b<n; k+=b )
+    {
+        const Range<Int> ind1( k, k+b ), ind2( k+b, n );
+        auto A21 = A( ind2, ind1 );
+        auto A22 = A( ind2, ind2 );
+        const Int r = Min(n-k-b,b);
+
+        // Factor the panel below the band and then undo the normalization of
+        // the diagonal of R, so that A21 = (H_0^H ... H_{r-1}^H) R
+        QR( A21, tPan, dPan );
+        auto R = A21( IR(0,r), ALL );
+        DiagonalScaleTrapezoid( LEFT, UPPER, NORMAL, dPan, R );
+        tPan_STAR_STAR = tPan;
+        auto t1 = t( IR(k,k+r), ALL );
+        t1 = tPan_STAR_STAR;
+
+        V.AlignWith( A22 );
+        V = A21( ALL, IR(0,r) );
+        MakeTrapezoidal( LOWER, V );
+        FillDiagonal( V, F(1) );
+
+        // Form the compact WY representation, Q^H = I - V S^H V^H
+        Zeros( G, r, r );
+        Gemm( ADJOINT, NORMAL, F(1), V, V, F(0), G );
+        G_STAR_STAR = G;
+        vector<F> tau( r );
+        for( Int j=0; j<r; ++j )
+            tau[j] = tPan_STAR_STAR.GetLocal(j,0);
+        S.Resize( r, r );
+        TwoStageTriangularFactor( G_STAR_STAR.Matrix(), tau, S.Matrix() );
+
+        // A22 := Q^H A22 Q = A22 - V W^H - W V^H, where, with Y = A22 V S,
+        // W = Y - 1/2 V S^H V^H Y
+        Y.AlignWith( A22 );
+        Zeros( Y, A22.Height(), r );
+        Hemm( LEFT, LOWER, F(1), A22, V, F(0), Y );
+        Zeros( G, r, r );
+        Gemm( ADJOINT, NORMAL, F(1), V, Y, F(0), G );
+        G_STAR_STAR = G;
+        Trmm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), S, Y );
+        C = G_STAR_STAR;
+        Trmm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), S, C );
+        Trmm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), S, C );
+        Gemm( NORMAL, NORMAL, F(-1)/F(2), V, C, F(1), Y );
+        Her2k( LOWER, NORMAL, F(-1), V, Y, Base<F>(1), A22 );
+    }
+}
+
+// The second stage
+// ================
+// Entry (i,j) of the lower triangle, with i-j <= 2b, is stored in entry
+// (i-j,j) of 'band' (the entries more than b below the diagonal hold bulges)
+
+template<typename F>
+inline void
+GetBandBlock
+( const Matrix<F>& band, Int iBeg, Int iEnd, Int jBeg, Int jEnd,
+  Matrix<F>& B )
+{
+    const Int maxOffset = band.Height()-1;
+    const F* bandBuf = band.LockedBuffer();
+    const Int bandLDim = band.LDim();
+    Zeros( B, iEnd-iBeg, jEnd-jBeg );
+    F* BBuf = B.Buffer();
+    const Int BLDim = B.LDim();
+    for( Int j=jBeg; j<jEnd; ++j )
+        for( Int i=Max(iBeg,j); i<Min(iEnd,j+maxOffset+1); ++i )
+            BBuf[(i-iBeg)+(j-jBeg)*BLDim] = bandBuf[(i-j)+j*bandLDim];
+}
+
+template<typename F>
+inline void
+SetBandBlock( Matrix<F>& band, Int iBeg, Int jBeg, const Matrix<F>& B )
+{
+    const Int maxOffset = band.Height()-1;
+    const Int iEnd = iBeg + B.Height();
+    const Int jEnd = jBeg + B.Width();
+    F* bandBuf = band.Buffer();
+    const Int bandLDim = band.LDim();
+    const F* BBuf = B.LockedBuffer();
+    const Int BLDim = B.LDim();
+    for( Int j=jBeg; j<jEnd; ++j )
+        for( Int i=Max(iBeg,j); i<Min(iEnd,j+maxOffset+1); ++i )
+            bandBuf[(i-j)+j*bandLDim] = BBuf[(i-iBeg)+(j-jBeg)*BLDim];
+}
+
+// Each sweep j >= 0 begins by annihilating column j below its subdiagonal
+// with a reflector acting on rows [j+1,j+1+b), and step s then annihilates
+// the first column of the bulge in rows [j+1+s b,j+1+(s+1) b), which is only
+// necessary while it has at least two rows
+inline Int NumBulgeSteps( Int n, Int b, Int j )
+{
+    if( j >= n-1 )
+        return 0;
+    if( n-3-j < 0 )
+        return 1;
+    return 1 + (n-3-j)/b;
+}
+
+template<typename F>
+inline void
+ChaseBulge( Matrix<F>& band, Int j, Int s, BulgeReflectors<F>& bulge )
+{
+    DEBUG_ONLY(CSE cse("herm_tridiag::ChaseBulge"))
+    const Int n = band.Width();
+    const Int b = bulge.bandwidth;
+    const Int qBeg = j+1+s*b;
+    const Int qEnd = Min(qBeg+b,n);
+    const Int pBeg = ( s==0 ? j : qBeg-b );
+    const Int pEnd = ( s==0 ? j+1 : qBeg );
+    const Int yEnd = Min(qEnd+b,n);
+
+    // Annihilate the first column of A(Q,P) below its first entry and
+    // apply the reflector from the left to the remainder of A(Q,P)
+    Matrix<F> X, z;
+    GetBandBlock( band, qBeg, qEnd, pBeg, pEnd, X );
+    auto chi = X( IR(0), IR(0) );
+    auto x = X( IR(1,END), IR(0) );
+    const F tau = LeftReflector( chi, x );
+    const Int r = bulge.sweepOffsets[j] + s;
+    const Int length = qEnd - qBeg;
+    F* vBuf = &bulge.vectors[bulge.vectorOffsets[r]];
+    vBuf[0] = F(1);
+    for( Int i=1; i<length; ++i )
+        vBuf[i] = x.Get(i-1,0);
+    bulge.taus[r] = tau;
+    Zero( x );
+    Matrix<F> v;
+    v.Attach( length, 1, vBuf, length );
+    if( X.Width() > 1 )
+    {
+        auto X1 = X( ALL, IR(1,END) );
+        Zeros( z, X1.Width(), 1 );
+        Gemv( ADJOINT, F(1), X1, v, F(0), z );
+        Ger( -tau, v, z, X1 );
+    }
+    SetBandBlock( band, qBeg, pBeg, X );
+
+    // A(Q,Q) := H A(Q,Q) H^H
+    Matrix<F> D, w;
+    GetBandBlock( band, qBeg, qEnd, qBeg, qEnd, D );
+    Zeros( w, length, 1 );
+    Hemv( LOWER, Conj(tau), D, v, F(0), w );
+    const F alpha = -Conj(tau)*Dot( w, v )/F(2);
+    Axpy( alpha, v, w );
+    Her2( LOWER, F(-1), v, w, D );
+    SetBandBlock( band, qBeg, qBeg, D );
+
+    // A(Q',Q) := A(Q',Q) H^H for the next block of rows, Q', which creates
+    // the bulge to be chased by the next step
+    if( qEnd < yEnd )
+    {
+        Matrix<F> Y;
+        GetBandBlock( band, qEnd, yEnd, qBeg, qEnd, Y );
+        Zeros( z, Y.Height(), 1 );
+        Gemv( NORMAL, F(1), Y, v, F(0), z );
+        Ger( -Conj(tau), z, v, Y );
+        SetBandBlock( band, qEnd, qBeg, Y );
+    }
+}
+
+template<typename F>
+inline void
+ChaseBulges( Matrix<F>& band, Int b, BulgeReflectors<F>& bulge )
+{
+    DEBUG_ONLY(CSE cse("herm_tridiag::ChaseBulges"))
+    const Int n = band.Width();
+    const Int numSweeps = Max(n-1,0);
+    bulge.height = n;
+    bulge.bandwidth = b;
+    bulge.sweepOffsets.resize( numSweeps+1 );
+    bulge.vectorOffsets.resize( 1 );
+    bulge.sweepOffsets[0] = 0;
+    bulge.vectorOffsets[0] = 0;
+    for( Int j=0; j<numSweeps; ++j )
+    {
+        const Int numSteps = NumBulgeSteps( n, b, j );
+        bulge.sweepOffsets[j+1] = bulge.sweepOffsets[j] + numSteps;
+        for( Int s=0; s<numSteps; ++s )
+        {
+            const Int qBeg = j+1+s*b;
+            bulge.vectorOffsets.push_back
+            ( bulge.vectorOffsets.back() + Min(b,n-qBeg) );
+        }
+    }
+    bulge.taus.resize( bulge.sweepOffsets.back() );
+    bulge.vectors.resize( bulge.vectorOffsets.back() );
+
+    // Step s of sweep j only touches columns [pBeg,qEnd), and so the
+    // dependencies are tracked over (tokens for) blocks of b columns
+    const Int numBlocks = (n+b-1)/b;
+    vector<char> blocks( numBlocks );
+    TaskGraph graph;
+    for( Int j=0; j<numSweeps; ++j )
+    {
+        const Int numSteps = NumBulgeSteps( n, b, j );
+        for( Int s=0; s<numSteps; ++s )
+        {
+            const Int qBeg = j+1+s*b;
+            const Int qEnd = Min(qBeg+b,n);
+            const Int pBeg = ( s==0 ? j : qBeg-b );
+            vector<const void*> outputs;
+            for( Int k=pBeg/b; k<=(qEnd-1)/b; ++k )
+                outputs.push_back( &blocks[k] );
+            graph.Insert
+            ( [&band,&bulge,j,s]() { ChaseBulge( band, j, s, bulge ); },
+              {}, outputs, -j );
+        }
+    }
+    graph.Run();
+}
+
+// B := Q2 B or B := Q2^H B, where the reflectors of each group of b
+// consecutive sweeps with the same step index are applied together in
+// compact WY form. Since the supports of the steps of a single sweep are
+// disjoint, and the support of step s of sweep j only overlaps those of steps
+// s-1 and s of later sweeps within the group, it suffices to apply the blocks
+// for increasing s (or decreasing s for Q2^H).
+template<typename F>
+inline void
+ApplyBulgeReflectors
+( Orientation orientation, const BulgeReflectors<F>& bulge, Matrix<F>& B )
+{
+    DEBUG_ONLY(CSE cse("herm_tridiag::ApplyBulgeReflectors"))
+    const Int n = bulge.height;
+    const Int b = bulge.bandwidth;
+    const Int numSweeps = Max(n-1,0);
+    const Int groupSize = b;
+    const bool adjoint = ( orientation != NORMAL );
+
+    Matrix<F> V, G, S, W;
+    vector<F> tau;
+    auto applyBlock = [&]( Int j0, Int j1, Int s )
+      {
+          // The number of steps is non-increasing in the sweep index
+          Int jEnd = j0;
+          while( jEnd < j1 && NumBulgeSteps(n,b,jEnd) > s )
+              ++jEnd;
+          const Int numRefl = jEnd - j0;
+          const Int rowBeg = j0+1+s*b;
+          const Int rowEnd = Min(jEnd+s*b+b,n);
+          Zeros( V, rowEnd-rowBeg, numRefl );
+          tau.resize( numRefl );
+          for( Int c=0; c<numRefl; ++c )
+          {
+              const Int j = j0 + c;
+              const Int r = bulge.sweepOffsets[j] + s;
+              const Int offset = bulge.vectorOffsets[r];
+              const Int length = bulge.vectorOffsets[r+1] - offset;
+              for( Int i=0; i<length; ++i )
+                  V.Set( c+i, c, bulge.vectors[offset+i] );
+              tau[c] = bulge.taus[r];
+          }
+          Zeros( G, numRefl, numRefl );
+          Herk( LOWER, ADJOINT, Base<F>(1), V, Base<F>(0), G );
+          TwoStageTriangularFactor( G, tau, S );
+
+          auto B1 = B( IR(rowBeg,rowEnd), ALL );
+          Zeros( W, numRefl, B1.Width() );
+          Gemm( ADJOINT, NORMAL, F(1), V, B1, F(0), W );
+          Trmm
+          ( LEFT, UPPER, (adjoint ? ADJOINT : NORMAL), NON_UNIT, F(1), S, W );
+          Gemm( NORMAL, NORMAL, F(-1), V, W, F(1), B1 );
+      };
+
+    const Int numGroups = (numSweeps+groupSize-1)/groupSize;
+    if( adjoint )
+    {
+        for( Int group=0; group<numGroups; ++group )
+        {
+            const Int j0 = group*groupSize;
+            const Int j1 = Min(j0+groupSize,numSweeps);
+            for( Int s=NumBulgeSteps(n,b,j0)-1; s>=0; --s )
+                applyBlock( j0, j1, s );
+        }
+    }
+    else
+    {
+        for( Int group=numGroups-1; group>=0; --group )
+        {
+            const Int j0 = group*groupSize;
+            const Int j1 = Min(j0+groupSize,numSweeps);
+            const Int numSteps = NumBulgeSteps(n,b,j0);
+            for( Int s=0; s<numSteps; ++s )
+                applyBlock( j0, j1, s );
+        }
+    }
+}
+
+template<typename F>
+inline void
+TwoStageReduce
+( UpperOrLower uplo, DistMatrix<F>& A, DistMatrix<F,STAR,STAR>& t,
+  BulgeReflectors<F>& bulge, Int bandwidth )
+{
+    DEBUG_ONLY(
+        CSE cse("herm_tridiag::TwoStageReduce");
+        if( A.Height() != A.Width() )
+            LogicError("A must be square");
+    )
+    const Int n = A.Height();
+    const Int b = Max(Min(bandwidth>0 ? bandwidth : Blocksize(),n-1),1);
+    if( uplo == UPPER )
+        MakeHermitian( UPPER, A );
+
+    BandReduce( A, t, b );
+
+    // Gather the band onto every process
+    Matrix<F> band;
+    Zeros( band, 2*b+1, n );
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Int i = A.GlobalRow(iLoc);
+            if( i >= j && i <= j+b )
+                band.Set( i-j, j, A.GetLocal(iLoc,jLoc) );
+        }
+    }
+    if( A.Participating() )
+        mpi::AllReduce( band.Buffer(), band.Height()*n, A.DistComm() );
+
+    ChaseBulges( band, b, bulge );
+
+    // Store the tridiagonal matrix in (both triangles of) A
+    for( Int j=0; j<n; ++j )
+    {
+        A.Set( j, j, RealPart(band.Get(0,j)) );
+        if( j < n-1 )
+        {
+            const F epsilon = RealPart(band.Get(1,j));
+            A.Set( j+1, j, epsilon );
+            A.Set( j, j+1, epsilon );
+        }
+    }
+}
+
+} // namespace herm_tridiag
+} // namespace El
+
+#endif // ifndef EL_HERMITIANTRIDIAG_TWOSTAGE_HPP
@@ -8,10 +8,14 @@
 */
 #include "El.hpp"
 
+#include "El/blas_like/level1/copy_internal.hpp"
+
 #include "./Cholesky/LVar3.hpp"
 #include "./Cholesky/LVar3Pivoted.hpp"
 #include "./Cholesky/UVar3.hpp"
 #include "./Cholesky/UVar3Pivoted.hpp"
+#include "./Cholesky/Lookahead.hpp"
+#include "./Cholesky/Tiled.hpp"
 #include "./Cholesky/SolveAfter.hpp"
 
 #include "./Cholesky/LMod.hpp"
@@ -49,6 +53,20 @@ void Cholesky( UpperOrLower uplo, Matrix<F>& A, Matrix<Int>& p )
         cholesky::UVar3( A, p );
 }
 
+template<typename F>
+void Cholesky( UpperOrLower uplo, TileMatrix<F>& A )
+{
+    DEBUG_ONLY(
+        CSE cse("Cholesky");
+        if( A.Height() != A.Width() )
+            LogicError("A must be square");
+    )
+    if( uplo == LOWER )
+        cholesky::LTiled( A );
+    else
+        cholesky::UTiled( A );
+}
+
 template<typename F>
 void ReverseCholesky( UpperOrLower uplo, Matrix<F>& A )
 {
@@ -73,6 +91,19 @@ void Cholesky( UpperOrLower uplo, AbstractDistMatrix<F>& A )
         cholesky::UVar3( A );
 }
 
+template<typename F>
+void Cholesky
+( UpperOrLower uplo, AbstractDistMatrix<F>& A, const CholeskyCtrl& ctrl )
+{
+    DEBUG_ONLY(CSE cse("Cholesky"))
+    if( !ctrl.lookahead )
+        Cholesky( uplo, A );
+    else if( uplo == LOWER )
+        cholesky::LVar3Lookahead( A, ctrl );
+    else
+        cholesky::UVar3Lookahead( A, ctrl );
+}
+
 template<typename F> 
 void Cholesky
 ( UpperOrLower uplo, AbstractDistMatrix<F>& A, AbstractDistMatrix<Int>& p )
@@ -168,7 +199,10 @@ void HPSDCholesky( UpperOrLower uplo, AbstractDistMatrix<F>& APre )
 #define PROTO(F) \
   template void Cholesky( UpperOrLower uplo, Matrix<F>& A ); \
   template void Cholesky( UpperOrLower uplo, AbstractDistMatrix<F>& A ); \
+  template void Cholesky \
+  ( UpperOrLower uplo, AbstractDistMatrix<F>& A, const CholeskyCtrl& ctrl ); \
   template void Cholesky( UpperOrLower uplo, DistMatrix<F,STAR,STAR>& A ); \
+  template void Cholesky( UpperOrLower uplo, TileMatrix<F>& A ); \
   template void ReverseCholesky( UpperOrLower uplo, Matrix<F>& A ); \
   template void ReverseCholesky \
   ( UpperOrLower uplo, AbstractDistMatrix<F>& A ); \
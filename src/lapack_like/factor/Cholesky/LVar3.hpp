@@ -30,7 +30,7 @@ LVar3Unb( Matrix<F>& A )
     {
         Real alpha = RealPart(ABuffer[j+j*lda]);
         if( alpha <= Real(0) )
-            LogicError("A was not numerically HPD");
+            throw NonHPDMatrixException("A was not numerically HPD");
         alpha = Sqrt( alpha );
         ABuffer[j+j*lda] = alpha;
 
@@ -60,7 +60,7 @@ ReverseLVar3Unb( Matrix<F>& A )
     {
         Real alpha = RealPart(ABuffer[j+j*lda]);
         if( alpha <= Real(0) )
-            LogicError("A was not numerically HPD");
+            throw NonHPDMatrixException("A was not numerically HPD");
         alpha = Sqrt( alpha );
         ABuffer[j+j*lda] = alpha;
 
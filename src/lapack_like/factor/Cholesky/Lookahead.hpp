@@ -0,0 +1,252 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_CHOLESKY_LOOKAHEAD_HPP
+#define EL_CHOLESKY_LOOKAHEAD_HPP
+
+// Variant 3 with a lookahead of one panel: as soon as the next panel has
+// received the update from the current one, it is factored and its
+// redistribution is started with non-blocking collectives, which then proceed
+// while the rest of the trailing matrix is updated in column blocks (testing
+// the outstanding requests after each block in order to progress them).
+//
+// Two sets of panel redistributions are kept: the current panel's, which
+// drives the trailing update, and the next panel's, which is in flight.
+
+namespace El {
+namespace cholesky {
+
+template<typename F>
+inline void
+LVar3Lookahead( AbstractDistMatrix<F>& APre, const CholeskyCtrl& ctrl )
+{
+    DEBUG_ONLY(
+        CSE cse("cholesky::LVar3Lookahead");
+        if( APre.Height() != APre.Width() )
+            LogicError("Can only compute Cholesky factor of square matrices");
+    )
+    const Grid& g = APre.Grid();
+    auto APtr = ReadWriteProxy<F,MC,MR>( &APre );
+    auto& A = *APtr;
+
+    DistMatrix<F,STAR,STAR> A11_STAR_STAR(g);
+    DistMatrix<F,VC,  STAR> A21_VC_STAR(g);
+    DistMatrix<F,VR,  STAR> A21_VR_STAR(g);
+    DistMatrix<F,STAR,VC  > A21Trans_STAR_VC(g);
+    DistMatrix<F,STAR,VR  > A21Adj_STAR_VR(g);
+    DistMatrix<F,STAR,MC  > A21Trans_STAR_MC0(g), A21Trans_STAR_MC1(g);
+    DistMatrix<F,STAR,MR  > A21Adj_STAR_MR0(g), A21Adj_STAR_MR1(g);
+    DistMatrix<F,STAR,MC  >* A21Trans_STAR_MC[2] =
+      { &A21Trans_STAR_MC0, &A21Trans_STAR_MC1 };
+    DistMatrix<F,STAR,MR  >* A21Adj_STAR_MR[2] =
+      { &A21Adj_STAR_MR0, &A21Adj_STAR_MR1 };
+    copy::AllGatherRequest<F> transReq[2], adjReq[2];
+
+    const Int n = A.Height();
+    const Int bsize = Blocksize();
+    const Int numUpdateBlocks = Max(ctrl.numUpdateBlocks,Int(1));
+
+    // Factor the panel beginning at index k and start its redistribution
+    auto startPanel =
+      [&]( Int k, Int s )
+      {
+          const Int nb = Min(bsize,n-k);
+          const Range<Int> ind1( k, k+nb ), ind2( k+nb, n );
+          auto A11 = A( ind1, ind1 );
+          auto A21 = A( ind2, ind1 );
+          auto A22 = A( ind2, ind2 );
+
+          A11_STAR_STAR = A11;
+          Cholesky( LOWER, A11_STAR_STAR );
+          A11 = A11_STAR_STAR;
+
+          A21_VC_STAR.AlignWith( A22 );
+          A21_VC_STAR = A21;
+          LocalTrsm
+          ( RIGHT, LOWER, ADJOINT, NON_UNIT,
+            F(1), A11_STAR_STAR, A21_VC_STAR );
+
+          A21_VR_STAR.AlignWith( A22 );
+          A21_VR_STAR = A21_VC_STAR;
+          Transpose( A21_VC_STAR, A21Trans_STAR_VC );
+          Adjoint( A21_VR_STAR, A21Adj_STAR_VR );
+
+          A21Trans_STAR_MC[s]->AlignWith( A22 );
+          A21Adj_STAR_MR[s]->AlignWith( A22 );
+          copy::IPartialRowAllGather
+          ( A21Trans_STAR_VC, *A21Trans_STAR_MC[s], transReq[s] );
+          copy::IPartialRowAllGather
+          ( A21Adj_STAR_VR, *A21Adj_STAR_MR[s], adjReq[s] );
+      };
+
+    // Update the lower triangle of the columns [jBeg,jEnd) of A22
+    auto update =
+      [&]( DistMatrix<F>& A22, Int s, Int jBeg, Int jEnd )
+      {
+          const Range<Int> indL( jBeg, jEnd ), indB( jEnd, END );
+          auto A22LL = A22( indL, indL );
+          auto A22BL = A22( indB, indL );
+          auto XTransL = (*A21Trans_STAR_MC[s])( ALL, indL );
+          auto XTransB = (*A21Trans_STAR_MC[s])( ALL, indB );
+          auto XAdjL = (*A21Adj_STAR_MR[s])( ALL, indL );
+
+          LocalTrrk( LOWER, TRANSPOSE, F(-1), XTransL, XAdjL, F(1), A22LL );
+          LocalGemm( TRANSPOSE, NORMAL, F(-1), XTransB, XAdjL, F(1), A22BL );
+      };
+
+    if( n > 0 )
+        startPanel( 0, 0 );
+    for( Int k=0, s=0; k<n; k+=bsize, s=1-s )
+    {
+        const Int nb = Min(bsize,n-k);
+        const Range<Int> ind1( k, k+nb ), ind2( k+nb, n );
+        auto A21 = A( ind2, ind1 );
+        auto A22 = A( ind2, ind2 );
+
+        copy::FinishAllGather( transReq[s] );
+        copy::FinishAllGather( adjReq[s] );
+        Transpose( *A21Trans_STAR_MC[s], A21 );
+
+        const Int nNext = n-(k+nb);
+        if( nNext == 0 )
+            break;
+        const Int nbNext = Min(bsize,nNext);
+
+        // Bring the next panel up to date, then factor it and begin its
+        // redistribution
+        update( A22, s, 0, nbNext );
+        startPanel( k+nb, 1-s );
+
+        // Update the remainder of the trailing matrix while the next panel's
+        // redistribution is in flight
+        const Int restWidth = nNext - nbNext;
+        const Int blockWidth = (restWidth+numUpdateBlocks-1) / numUpdateBlocks;
+        for( Int j=nbNext; j<nNext; j+=blockWidth )
+        {
+            update( A22, s, j, Min(j+blockWidth,nNext) );
+            copy::TestAllGather( transReq[1-s] );
+            copy::TestAllGather( adjReq[1-s] );
+        }
+    }
+}
+
+template<typename F>
+inline void
+UVar3Lookahead( AbstractDistMatrix<F>& APre, const CholeskyCtrl& ctrl )
+{
+    DEBUG_ONLY(
+        CSE cse("cholesky::UVar3Lookahead");
+        if( APre.Height() != APre.Width() )
+            LogicError("Can only compute Cholesky factor of square matrices");
+    )
+    const Grid& g = APre.Grid();
+    auto APtr = ReadWriteProxy<F,MC,MR>( &APre );
+    auto& A = *APtr;
+
+    DistMatrix<F,STAR,STAR> A11_STAR_STAR(g);
+    DistMatrix<F,STAR,VR  > A12_STAR_VR(g);
+    DistMatrix<F,STAR,VC  > A12_STAR_VC(g);
+    DistMatrix<F,STAR,MC  > A12_STAR_MC0(g), A12_STAR_MC1(g);
+    DistMatrix<F,STAR,MR  > A12_STAR_MR0(g), A12_STAR_MR1(g);
+    DistMatrix<F,STAR,MC  >* A12_STAR_MC[2] = { &A12_STAR_MC0, &A12_STAR_MC1 };
+    DistMatrix<F,STAR,MR  >* A12_STAR_MR[2] = { &A12_STAR_MR0, &A12_STAR_MR1 };
+    copy::AllGatherRequest<F> mcReq[2], mrReq[2];
+
+    const Int n = A.Height();
+    const Int bsize = Blocksize();
+    const Int numUpdateBlocks = Max(ctrl.numUpdateBlocks,Int(1));
+
+    // Factor the panel beginning at index k and start its redistribution
+    auto startPanel =
+      [&]( Int k, Int s )
+      {
+          const Int nb = Min(bsize,n-k);
+          const Range<Int> ind1( k, k+nb ), ind2( k+nb, n );
+          auto A11 = A( ind1, ind1 );
+          auto A12 = A( ind1, ind2 );
+          auto A22 = A( ind2, ind2 );
+
+          A11_STAR_STAR = A11;
+          Cholesky( UPPER, A11_STAR_STAR );
+          A11 = A11_STAR_STAR;
+
+          A12_STAR_VR.AlignWith( A22 );
+          A12_STAR_VR = A12;
+          LocalTrsm
+          ( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), A11_STAR_STAR, A12_STAR_VR );
+
+          A12_STAR_VC.AlignWith( A22 );
+          A12_STAR_VC = A12_STAR_VR;
+
+          A12_STAR_MC[s]->AlignWith( A22 );
+          A12_STAR_MR[s]->AlignWith( A22 );
+          copy::IPartialRowAllGather
+          ( A12_STAR_VC, *A12_STAR_MC[s], mcReq[s] );
+          copy::IPartialRowAllGather
+          ( A12_STAR_VR, *A12_STAR_MR[s], mrReq[s] );
+      };
+
+    if( n > 0 )
+        startPanel( 0, 0 );
+    for( Int k=0, s=0; k<n; k+=bsize, s=1-s )
+    {
+        const Int nb = Min(bsize,n-k);
+        const Range<Int> ind1( k, k+nb ), ind2( k+nb, n );
+        auto A12 = A( ind1, ind2 );
+        auto A22 = A( ind2, ind2 );
+
+        copy::FinishAllGather( mcReq[s] );
+        copy::FinishAllGather( mrReq[s] );
+        A12 = *A12_STAR_MR[s];
+
+        const Int nNext = n-(k+nb);
+        if( nNext == 0 )
+            break;
+        const Int nbNext = Min(bsize,nNext);
+
+        // Bring the next panel (the leading rows of A22) up to date, then
+        // factor it and begin its redistribution
+        {
+            const Range<Int> indT( 0, nbNext ), indR( nbNext, END );
+            auto A22TT = A22( indT, indT );
+            auto A22TR = A22( indT, indR );
+            auto XT_MC = (*A12_STAR_MC[s])( ALL, indT );
+            auto XT_MR = (*A12_STAR_MR[s])( ALL, indT );
+            auto XR_MR = (*A12_STAR_MR[s])( ALL, indR );
+            LocalTrrk( UPPER, ADJOINT, F(-1), XT_MC, XT_MR, F(1), A22TT );
+            LocalGemm( ADJOINT, NORMAL, F(-1), XT_MC, XR_MR, F(1), A22TR );
+        }
+        startPanel( k+nb, 1-s );
+
+        // Update the remainder of the trailing matrix (excluding the rows
+        // of the next panel) while its redistribution is in flight
+        const Int restWidth = nNext - nbNext;
+        const Int blockWidth = (restWidth+numUpdateBlocks-1) / numUpdateBlocks;
+        for( Int j=nbNext; j<nNext; j+=blockWidth )
+        {
+            const Int jEnd = Min(j+blockWidth,nNext);
+            const Range<Int> indT( nbNext, j ), indR( j, jEnd );
+            auto A22TR = A22( indT, indR );
+            auto A22RR = A22( indR, indR );
+            auto XT_MC = (*A12_STAR_MC[s])( ALL, indT );
+            auto XR_MC = (*A12_STAR_MC[s])( ALL, indR );
+            auto XR_MR = (*A12_STAR_MR[s])( ALL, indR );
+            LocalGemm( ADJOINT, NORMAL, F(-1), XT_MC, XR_MR, F(1), A22TR );
+            LocalTrrk( UPPER, ADJOINT, F(-1), XR_MC, XR_MR, F(1), A22RR );
+
+            copy::TestAllGather( mcReq[1-s] );
+            copy::TestAllGather( mrReq[1-s] );
+        }
+    }
+}
+
+} // namespace cholesky
+} // namespace El
+
+#endif // ifndef EL_CHOLESKY_LOOKAHEAD_HPP
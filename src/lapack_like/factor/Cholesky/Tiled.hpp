@@ -0,0 +1,110 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_CHOLESKY_TILED_HPP
+#define EL_CHOLESKY_TILED_HPP
+
+// Right-looking tile Cholesky expressed as a DAG of tile kernels (a diagonal
+// factorization, triangular solves, and Herk/Gemm updates). Tasks are
+// prioritized by the tile column (or row) which they modify so that the
+// next panel is brought up to date as early as possible.
+
+namespace El {
+namespace cholesky {
+
+template<typename F>
+inline void
+LTiled( TileMatrix<F>& A )
+{
+    DEBUG_ONLY(CSE cse("cholesky::LTiled"))
+    typedef Base<F> Real;
+    const Int nt = A.TileRows();
+    TaskGraph graph;
+    for( Int k=0; k<nt; ++k )
+    {
+        Matrix<F>& A11 = A.Tile(k,k);
+        graph.Insert
+        ( [&A11]() { Cholesky( LOWER, A11 ); }, {}, {&A11}, -k );
+        for( Int i=k+1; i<nt; ++i )
+        {
+            Matrix<F>& A21 = A.Tile(i,k);
+            graph.Insert
+            ( [&A11,&A21]()
+              { Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), A11, A21 ); },
+              {&A11}, {&A21}, -k );
+        }
+        for( Int i=k+1; i<nt; ++i )
+        {
+            const Matrix<F>& A21 = A.Tile(i,k);
+            for( Int j=k+1; j<i; ++j )
+            {
+                const Matrix<F>& A31 = A.Tile(j,k);
+                Matrix<F>& A22 = A.Tile(i,j);
+                graph.Insert
+                ( [&A21,&A31,&A22]()
+                  { Gemm( NORMAL, ADJOINT, F(-1), A21, A31, F(1), A22 ); },
+                  {&A21,&A31}, {&A22}, -j );
+            }
+            Matrix<F>& A22 = A.Tile(i,i);
+            graph.Insert
+            ( [&A21,&A22]()
+              { Herk( LOWER, NORMAL, Real(-1), A21, Real(1), A22 ); },
+              {&A21}, {&A22}, -i );
+        }
+    }
+    graph.Run();
+}
+
+template<typename F>
+inline void
+UTiled( TileMatrix<F>& A )
+{
+    DEBUG_ONLY(CSE cse("cholesky::UTiled"))
+    typedef Base<F> Real;
+    const Int nt = A.TileRows();
+    TaskGraph graph;
+    for( Int k=0; k<nt; ++k )
+    {
+        Matrix<F>& A11 = A.Tile(k,k);
+        graph.Insert
+        ( [&A11]() { Cholesky( UPPER, A11 ); }, {}, {&A11}, -k );
+        for( Int j=k+1; j<nt; ++j )
+        {
+            Matrix<F>& A12 = A.Tile(k,j);
+            graph.Insert
+            ( [&A11,&A12]()
+              { Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), A11, A12 ); },
+              {&A11}, {&A12}, -k );
+        }
+        for( Int j=k+1; j<nt; ++j )
+        {
+            const Matrix<F>& A12 = A.Tile(k,j);
+            for( Int i=k+1; i<j; ++i )
+            {
+                const Matrix<F>& A13 = A.Tile(k,i);
+                Matrix<F>& A22 = A.Tile(i,j);
+                graph.Insert
+                ( [&A12,&A13,&A22]()
+                  { Gemm( ADJOINT, NORMAL, F(-1), A13, A12, F(1), A22 ); },
+                  {&A12,&A13}, {&A22}, -i );
+            }
+            Matrix<F>& A22 = A.Tile(j,j);
+            graph.Insert
+            ( [&A12,&A22]()
+              { Herk( UPPER, ADJOINT, Real(-1), A12, Real(1), A22 ); },
+              {&A12}, {&A22}, -j );
+        }
+    }
+    graph.Run();
+}
+
+} // namespace cholesky
+} // namespace El
+
+#endif // ifndef EL_CHOLESKY_TILED_HPP
@@ -163,6 +163,7 @@ void DistFront<F>::Pull
     const int numSendEntries = Scan( sEntriesSizes, sEntriesOffs );
     vector<F> sEntries( numSendEntries );
     vector<Int> sTargets( numSendEntries );
+    pullMeta.sendEntries.resize( numSendEntries );
     for( Int q=0; q<commSize; ++q )
     {
         Int index = sEntriesOffs[q];
@@ -181,6 +182,7 @@ void DistFront<F>::Pull
                 const Int mappedTarget = mappedTargets[targetOff];
                 sEntries[index] = (conjugate ? Conj(value) : value);
                 sTargets[index] = mappedTarget;
+                pullMeta.sendEntries[index] = localEntryOff+t;
                 ++index;
             }
         }
@@ -237,6 +239,9 @@ void DistFront<F>::Pull
           const Int off = node.off;
           const Int lowerSize = node.lowerStruct.size();
           Zeros( front.L, size+lowerSize, size );
+          front.pullSources.clear();
+          front.pullRows.clear();
+          front.pullCols.clear();
 
           for( Int t=0; t<size; ++t )
           {
@@ -248,22 +253,28 @@ void DistFront<F>::Pull
 
               for( Int k=0; k<numEntries; ++k )
               {
+                  const Int source = entryOff;
                   const F value = rEntries[entryOff];
                   const Int target = rTargets[entryOff];
                   ++entryOff;
   
                   if( target < off+t )
                       continue;
-                  else if( target < off+size )
+
+                  Int row;
+                  if( target < off+size )
                   {
-                      front.L.Set( target-off, t, value );
+                      row = target-off;
                   }
                   else
                   {
                       const Int origOff = Find( node.origLowerStruct, target );
-                      const Int row = node.origLowerRelInds[origOff];
-                      front.L.Set( row, t, value );
+                      row = node.origLowerRelInds[origOff];
                   }
+                  front.L.Set( row, t, value );
+                  front.pullSources.push_back( source );
+                  front.pullRows.push_back( row );
+                  front.pullCols.push_back( t );
               }
           }
       };
@@ -275,6 +286,7 @@ void DistFront<F>::Pull
       {
           front.type = SYMM_2D;
           front.isHermitian = conjugate;
+          front.commMeta.Empty();
           const Grid& grid = *node.grid;
 
           if( sep.child == nullptr )
@@ -295,6 +307,9 @@ void DistFront<F>::Pull
           const Int lowerSize = node.lowerStruct.size();
           front.L2D.SetGrid( grid );
           Zeros( front.L2D, size+lowerSize, size );
+          front.pullSources.clear();
+          front.pullLocRows.clear();
+          front.pullLocCols.clear();
           
           const Int localWidth = front.L2D.LocalWidth();
           for( Int tLoc=0; tLoc<localWidth; ++tLoc )
@@ -308,21 +323,31 @@ void DistFront<F>::Pull
 
               for( Int k=0; k<numEntries; ++k )
               {
+                  const Int source = entryOff;
                   const F value = rEntries[entryOff];
                   const Int target = rTargets[entryOff];
                   ++entryOff;
 
                   if( target < off+t )
                       continue;
-                  else if( target < off+size )
+
+                  Int row;
+                  if( target < off+size )
                   {
-                      front.L2D.Set( target-off, t, value );
+                      row = target-off;
                   }
                   else 
                   {
                       const Int origOff = Find( node.origLowerStruct, target );
-                      const Int row = node.origLowerRelInds[origOff];
-                      front.L2D.Set( row, t, value );
+                      row = node.origLowerRelInds[origOff];
+                  }
+                  if( front.L2D.IsLocalRow(row) )
+                  {
+                      const Int rowLoc = front.L2D.LocalRow(row);
+                      front.L2D.SetLocal( rowLoc, tLoc, value );
+                      front.pullSources.push_back( source );
+                      front.pullLocRows.push_back( rowLoc );
+                      front.pullLocCols.push_back( tLoc );
                   }
               }
           }
@@ -333,6 +358,98 @@ void DistFront<F>::Pull
           if( entryOffs[q] != rEntriesOffs[q]+rEntriesSizes[q] )
               LogicError("entryOffs were incorrect");
     )
+
+    // Keep the exchange pattern so that the fronts can be refilled
+    pullMeta.sendSizes = sEntriesSizes;
+    pullMeta.sendOffs = sEntriesOffs;
+    pullMeta.recvSizes = rEntriesSizes;
+    pullMeta.recvOffs = rEntriesOffs;
+}
+
+template<typename F>
+void DistFront<F>::Refill( const DistSparseMatrix<F>& A )
+{
+    DEBUG_ONLY(
+      CSE cse("DistFront::Refill");
+      if( pullMeta.sendSizes.size() == 0 )
+          LogicError("The fronts were not pulled from a sparse matrix");
+    )
+    mpi::Comm comm = A.Comm();
+    const int commSize = mpi::Size( comm );
+    const bool conjugate = isHermitian;
+
+    // Exchange the new values of the pulled entries
+    const Int numSendEntries = pullMeta.sendEntries.size();
+    const F* values = A.LockedValueBuffer();
+    vector<F> sEntries( numSendEntries );
+    for( Int s=0; s<numSendEntries; ++s )
+    {
+        const F value = values[pullMeta.sendEntries[s]];
+        sEntries[s] = ( conjugate ? Conj(value) : value );
+    }
+    const Int numRecvEntries =
+      pullMeta.recvOffs[commSize-1] + pullMeta.recvSizes[commSize-1];
+    vector<F> rEntries( numRecvEntries );
+    mpi::AllToAll
+    ( sEntries.data(), pullMeta.sendSizes.data(), pullMeta.sendOffs.data(),
+      rEntries.data(), pullMeta.recvSizes.data(), pullMeta.recvOffs.data(),
+      comm );
+    SwapClear( sEntries );
+
+    // Overwrite the fronts in place. The value buffers above are only the
+    // size of the pulled entries, and so they are not kept between refills.
+    function<void(Front<F>&)> refillLocal =
+      [&]( Front<F>& front )
+      {
+          for( Front<F>* child : front.children )
+              refillLocal( *child );
+
+          front.type = SYMM_2D;
+          front.isHermitian = conjugate;
+          Zero( front.L );
+          F* LBuf = front.L.Buffer();
+          const Int LLDim = front.L.LDim();
+          const Int numPulled = front.pullSources.size();
+          for( Int k=0; k<numPulled; ++k )
+              LBuf[front.pullRows[k]+front.pullCols[k]*LLDim] = 
+                rEntries[front.pullSources[k]];
+      };
+    function<void(DistFront<F>&)> refill =
+      [&]( DistFront<F>& front )
+      {
+          front.isHermitian = conjugate;
+          const bool was1D = FrontIs1D(front.type);
+          front.type = SYMM_2D;
+          if( front.duplicate != nullptr )
+          {
+              refillLocal( *front.duplicate );
+              if( was1D )
+              {
+                  front.L2D.Attach( front.L1D.Grid(), front.duplicate->L );
+                  front.L1D.Empty();
+              }
+              return;
+          }
+          refill( *front.child );
+
+          // Return to the 2D storage that the entries were pulled into
+          // without redistributing the factor, as it is about to be
+          // overwritten
+          if( was1D )
+          {
+              front.L2D.SetGrid( front.L1D.Grid() );
+              front.L2D.Resize( front.L1D.Height(), front.L1D.Width() );
+              front.L1D.Empty();
+          }
+          Zero( front.L2D );
+          F* LBuf = front.L2D.Buffer();
+          const Int LLDim = front.L2D.LDim();
+          const Int numPulled = front.pullSources.size();
+          for( Int k=0; k<numPulled; ++k )
+              LBuf[front.pullLocRows[k]+front.pullLocCols[k]*LLDim] = 
+                rEntries[front.pullSources[k]];
+      };
+    refill( *this );
 }
 
 template<typename F>
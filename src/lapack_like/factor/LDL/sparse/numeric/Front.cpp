@@ -89,6 +89,9 @@ void Front<F>::Pull
 
         const Int lowerSize = node.lowerStruct.size();
         Zeros( front.L, node.size+lowerSize, node.size );
+        front.pullSources.clear();
+        front.pullRows.clear();
+        front.pullCols.clear();
 
         for( Int t=0; t<node.size; ++t )
         {
@@ -104,26 +107,59 @@ void Front<F>::Pull
 
                 if( i < node.off+t )
                     continue;
-                else if( i < node.off+node.size )
+
+                Int row;
+                if( i < node.off+node.size )
                 {
-                    front.L.Set( i-node.off, t, value );
+                    row = i-node.off;
                 }
                 else
                 {
                     const Int origOff = Find( node.origLowerStruct, i );
-                    const Int row = node.origLowerRelInds[origOff];
+                    row = node.origLowerRelInds[origOff];
                     DEBUG_ONLY(
                         if( row < t )
                             LogicError("Tried to touch upper triangle");
                     )
-                    front.L.Set( row, t, value );
                 }
+                front.L.Set( row, t, value );
+                front.pullSources.push_back( entryOff+k );
+                front.pullRows.push_back( row );
+                front.pullCols.push_back( t );
             }
         }
       };
     pull( rootInfo, *this );
 }
 
+template<typename F>
+void Front<F>::Refill( const SparseMatrix<F>& A )
+{
+    DEBUG_ONLY(CSE cse("Front::Refill"))
+    const F* values = A.LockedValueBuffer();
+    const bool conjugate = isHermitian;
+    function<void(Front<F>&)> refill =
+      [&]( Front<F>& front )
+      {
+        for( Front<F>* child : front.children )
+            refill( *child );
+
+        front.type = SYMM_2D;
+        front.isHermitian = conjugate;
+        Zero( front.L );
+        F* LBuf = front.L.Buffer();
+        const Int LLDim = front.L.LDim();
+        const Int numPulled = front.pullSources.size();
+        for( Int k=0; k<numPulled; ++k )
+        {
+            const F transVal = values[front.pullSources[k]];
+            LBuf[front.pullRows[k]+front.pullCols[k]*LLDim] =
+              ( conjugate ? Conj(transVal) : transVal );
+        }
+      };
+    refill( *this );
+}
+
 template<typename F>
 void Front<F>::Push
 ( SparseMatrix<F>& A, 
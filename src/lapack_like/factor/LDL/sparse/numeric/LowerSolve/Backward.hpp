@@ -128,11 +128,28 @@ inline void LowerBackwardSolve
     vector<int> sendSizes(commSize), recvSizes(commSize);
     for( int q=0; q<commSize; ++q )
     {
-        sendSizes[q] = X.commMeta.childRecvInds[q].size()*numRHS;
-        recvSizes[q] = X.commMeta.numChildSendInds[q]*numRHS;
+        sendSizes[q] = X.commMeta.childRecvInds[q].size();
+        recvSizes[q] = X.commMeta.numChildSendInds[q];
     }
     DEBUG_ONLY(VerifySendsAndRecvs( sendSizes, recvSizes, comm ))
     vector<int> sendOffs, recvOffs;
+    Scan( sendSizes, sendOffs );
+    Scan( recvSizes, recvOffs );
+    // The plan is cached, so its counts should never change
+    DEBUG_ONLY(
+      if( info.backwardPlan.ready )
+          mpi::VerifyPlan
+          ( info.backwardPlan, sendSizes, sendOffs, recvSizes, recvOffs );
+    )
+    if( !info.backwardPlan.ready )
+        info.backwardPlan =
+          mpi::MakeSparseAllToAllPlan
+          ( sendSizes, sendOffs, recvSizes, recvOffs, comm );
+    for( int q=0; q<commSize; ++q )
+    {
+        sendSizes[q] *= numRHS;
+        recvSizes[q] *= numRHS;
+    }
     const int sendBufSize = Scan( sendSizes, sendOffs );
     const int recvBufSize = Scan( recvSizes, recvOffs );
 
@@ -153,9 +170,7 @@ inline void LowerBackwardSolve
 
     // AllToAll to send and recv parent updates
     vector<F> recvBuf( recvBufSize );
-    SparseAllToAll
-    ( sendBuf, sendSizes, sendOffs,
-      recvBuf, recvSizes, recvOffs, comm );
+    mpi::SparseAllToAll( sendBuf, recvBuf, info.backwardPlan, numRHS );
     SwapClear( sendBuf );
     SwapClear( sendSizes );
     SwapClear( sendOffs );
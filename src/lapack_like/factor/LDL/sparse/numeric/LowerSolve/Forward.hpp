@@ -119,11 +119,28 @@ inline void LowerForwardSolve
     vector<int> sendSizes(commSize), recvSizes(commSize);
     for( int q=0; q<commSize; ++q )
     {
-        sendSizes[q] = X.commMeta.numChildSendInds[q]*numRHS;
-        recvSizes[q] = X.commMeta.childRecvInds[q].size()*numRHS;
+        sendSizes[q] = X.commMeta.numChildSendInds[q];
+        recvSizes[q] = X.commMeta.childRecvInds[q].size();
     }
     DEBUG_ONLY(VerifySendsAndRecvs( sendSizes, recvSizes, comm ))
     vector<int> sendOffs, recvOffs;
+    Scan( sendSizes, sendOffs );
+    Scan( recvSizes, recvOffs );
+    // The plan is cached, so its counts should never change
+    DEBUG_ONLY(
+      if( info.forwardPlan.ready )
+          mpi::VerifyPlan
+          ( info.forwardPlan, sendSizes, sendOffs, recvSizes, recvOffs );
+    )
+    if( !info.forwardPlan.ready )
+        info.forwardPlan =
+          mpi::MakeSparseAllToAllPlan
+          ( sendSizes, sendOffs, recvSizes, recvOffs, comm );
+    for( int q=0; q<commSize; ++q )
+    {
+        sendSizes[q] *= numRHS;
+        recvSizes[q] *= numRHS;
+    }
     const int sendBufSize = Scan( sendSizes, sendOffs );
     const int recvBufSize = Scan( recvSizes, recvOffs );
 
@@ -146,9 +163,7 @@ inline void LowerForwardSolve
 
     // AllToAll to send and receive the child updates
     vector<F> recvBuf( recvBufSize );
-    SparseAllToAll
-    ( sendBuf, sendSizes, sendOffs,
-      recvBuf, recvSizes, recvOffs, comm );
+    mpi::SparseAllToAll( sendBuf, recvBuf, info.forwardPlan, numRHS );
     SwapClear( sendBuf );
     SwapClear( sendSizes );
     SwapClear( sendOffs );
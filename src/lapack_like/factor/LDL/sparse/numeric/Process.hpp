@@ -26,13 +26,79 @@
 namespace El {
 namespace ldl {
 
-template<typename F> 
-inline void 
-Process( const NodeInfo& info, Front<F>& front, LDLFrontType factorType )
+// Add the columns [jBeg,jEnd) of the update matrix of child 'c' into the
+// parent front. Since the relative indices of a single child are distinct,
+// disjoint column ranges of the same child update may be merged concurrently.
+//
+// The relative indices are increasing, so they are split into runs which map
+// to contiguous rows of the parent, and each column of the lower triangle of
+// the update is merged as a few contiguous pieces.
+template<typename F>
+inline void
+ExtendAdd
+( const NodeInfo& info, Front<F>& front, Int c, Int jBeg, Int jEnd )
 {
-    DEBUG_ONLY(CSE cse("ldl::Process"))
+    DEBUG_ONLY(CSE cse("ldl::ExtendAdd"))
+    auto& FL = front.L;
+    auto& FBR = front.work;
+    const auto& childU = front.children[c]->work;
+    const auto& relInds = info.childRelInds[c];
+    const Int childUSize = childU.Height();
+
+    vector<Int> runOffs;
+    for( Int iChild=0; iChild<childUSize; ++iChild )
+        if( iChild == 0 || relInds[iChild] != relInds[iChild-1]+1 )
+            runOffs.push_back( iChild );
+    runOffs.push_back( childUSize );
+    const Int numRuns = runOffs.size()-1;
 
-    const int updateSize = info.lowerStruct.size();
+    const F* UBuf = childU.LockedBuffer();
+    const Int ULDim = childU.LDim();
+    F* FLBuf = FL.Buffer();
+    const Int FLLDim = FL.LDim();
+    F* FBRBuf = FBR.Buffer();
+    const Int FBRLDim = FBR.LDim();
+
+    Int firstRun = 0;
+    for( Int jChild=jBeg; jChild<jEnd; ++jChild )
+    {
+        const Int j = relInds[jChild];
+        F* destCol;
+        Int rowOff;
+        if( j < info.size )
+        {
+            destCol = &FLBuf[j*FLLDim];
+            rowOff = 0;
+        }
+        else
+        {
+            destCol = &FBRBuf[(j-info.size)*FBRLDim];
+            rowOff = info.size;
+        }
+        const F* srcCol = &UBuf[jChild*ULDim];
+
+        while( runOffs[firstRun+1] <= jChild )
+            ++firstRun;
+        for( Int run=firstRun; run<numRuns; ++run )
+        {
+            const Int iBeg = Max(runOffs[run],jChild);
+            const Int runSize = runOffs[run+1]-iBeg;
+            F* dest = &destCol[relInds[iBeg]-rowOff];
+            const F* src = &srcCol[iBeg];
+            for( Int t=0; t<runSize; ++t )
+                dest[t] += src[t];
+        }
+    }
+}
+
+template<typename F>
+inline void
+ProcessSequential
+( const NodeInfo& info, Front<F>& front, LDLFrontType factorType )
+{
+    DEBUG_ONLY(CSE cse("ldl::ProcessSequential"))
+
+    const Int updateSize = info.lowerStruct.size();
     auto& FL = front.L;
     auto& FBR = front.work;
     FBR.Empty();
@@ -43,31 +109,130 @@ Process( const NodeInfo& info, Front<F>& front, LDLFrontType factorType )
 
     // Process children and add in their updates
     Zeros( FBR, updateSize, updateSize );
-    const int numChildren = info.children.size();
+    const Int numChildren = info.children.size();
     for( Int c=0; c<numChildren; ++c )
     {
-        Process( *info.children[c], *front.children[c], factorType );
+        ProcessSequential( *info.children[c], *front.children[c], factorType );
+        ExtendAdd( info, front, c, 0, front.children[c]->work.Height() );
+        front.children[c]->work.Empty();
+    }
 
-        auto& childU = front.children[c]->work;
-        const int childUSize = childU.Height();
-        for( int jChild=0; jChild<childUSize; ++jChild )
+    ProcessFront( front, factorType );
+}
+
+#ifdef EL_HYBRID
+// Factor the subtree rooted at the given front by spawning an OpenMP task for
+// each child subtree until the recursion depth reaches 'taskDepth'; below
+// that depth, the subtrees are processed sequentially by the task which
+// owns them. Must be called from within a parallel region.
+template<typename F>
+inline void
+ProcessTasks
+( const NodeInfo& info, Front<F>& front, LDLFrontType factorType,
+  Int depth, Int taskDepth )
+{
+    DEBUG_ONLY(CSE cse("ldl::ProcessTasks"))
+    if( depth >= taskDepth )
+    {
+        ProcessSequential( info, front, factorType );
+        return;
+    }
+
+    const Int updateSize = info.lowerStruct.size();
+    auto& FL = front.L;
+    auto& FBR = front.work;
+    FBR.Empty();
+    DEBUG_ONLY(
+      if( FL.Height() != info.size+updateSize || FL.Width() != info.size )
+          LogicError("Front was not the proper size");
+    )
+
+    // The child subtrees are independent, so factor them concurrently
+    const Int numChildren = info.children.size();
+    for( Int c=0; c<numChildren; ++c )
+    {
+        const NodeInfo* childInfo = info.children[c];
+        Front<F>* childFront = front.children[c];
+        #pragma omp task firstprivate(childInfo,childFront)
+        ProcessTasks( *childInfo, *childFront, factorType, depth+1, taskDepth );
+    }
+    Zeros( FBR, updateSize, updateSize );
+    #pragma omp taskwait
+
+    // Merge the child updates one child at a time (different children may
+    // update the same entries) while splitting each update into column
+    // blocks of roughly equal work which are merged concurrently
+    const Int numThreads = omp_get_num_threads();
+    const Int minWork = 4096;
+    for( Int c=0; c<numChildren; ++c )
+    {
+        const Int childUSize = front.children[c]->work.Height();
+        const Int totalWork = (childUSize*(childUSize+1))/2;
+        const Int numBlocks =
+          Max(Min(numThreads,totalWork/minWork),Int(1));
+        if( numBlocks == 1 )
+        {
+            ExtendAdd( info, front, c, 0, childUSize );
+        }
+        else
         {
-            const int j = info.childRelInds[c][jChild];
-            for( int iChild=jChild; iChild<childUSize; ++iChild )
+            // Choose the block boundaries so that each block contains about
+            // the same number of entries of the lower triangle
+            Int jBeg = 0;
+            for( Int b=0; b<numBlocks; ++b )
             {
-                const int i = info.childRelInds[c][iChild];
-                const F value = childU.Get(iChild,jChild);
-                if( j < info.size )
-                    FL.Update( i, j, value );
+                Int jEnd = jBeg;
+                if( b == numBlocks-1 )
+                    jEnd = childUSize;
                 else
-                    FBR.Update( i-info.size, j-info.size, value );
+                {
+                    const Int blockWork = (totalWork*(b+1))/numBlocks;
+                    Int work = (jBeg*(2*childUSize-jBeg+1))/2;
+                    while( jEnd < childUSize && work < blockWork )
+                    {
+                        work += childUSize-jEnd;
+                        ++jEnd;
+                    }
+                }
+                #pragma omp task firstprivate(c,jBeg,jEnd) shared(info,front)
+                ExtendAdd( info, front, c, jBeg, jEnd );
+                jBeg = jEnd;
             }
+            #pragma omp taskwait
         }
-        childU.Empty();
+        front.children[c]->work.Empty();
     }
 
     ProcessFront( front, factorType );
 }
+#endif // ifdef EL_HYBRID
+
+template<typename F> 
+inline void 
+Process( const NodeInfo& info, Front<F>& front, LDLFrontType factorType )
+{
+    DEBUG_ONLY(CSE cse("ldl::Process"))
+    ProfileRegion profile("ldl::Process");
+#ifdef EL_HYBRID
+    // Independent subtrees of the elimination tree are factored in parallel.
+    // Since nested dissection trees are nearly balanced, spawning tasks down
+    // to a depth which provides a few subtrees per thread is sufficient for
+    // load balance, and the remaining subtrees are processed sequentially
+    // to avoid tasking overhead on the (numerous) tiny leaf fronts.
+    const Int numThreads = omp_get_max_threads();
+    if( numThreads > 1 && !omp_in_parallel() )
+    {
+        const Int taskDepth = Log2(Unsigned(4*numThreads)) + 1;
+        #pragma omp parallel
+        {
+            #pragma omp single
+            ProcessTasks( info, front, factorType, Int(0), taskDepth );
+        }
+        return;
+    }
+#endif
+    ProcessSequential( info, front, factorType );
+}
 
 template<typename F>
 inline void
@@ -75,6 +240,7 @@ Process
 ( const DistNodeInfo& info, DistFront<F>& front, LDLFrontType factorType )
 {
     DEBUG_ONLY(CSE cse("ldl::Process"))
+    ProfileRegion profile("ldl::Process");
 
     // Switch to a sequential algorithm if possible
     if( front.duplicate != nullptr )
@@ -112,8 +278,11 @@ Process
           LogicError("Front was not the proper size");
     )
 
-    // Compute the metadata for sharing child updates
-    front.ComputeCommMeta( info, true );
+    // Compute the metadata for sharing child updates (unless it was kept from
+    // a previous factorization of these fronts, which were since refilled)
+    if( front.commMeta.numChildSendInds.size() == 0 ||
+        front.commMeta.childRecvInds.size() == 0 )
+        front.ComputeCommMeta( info, true );
     mpi::Comm comm = front.L2D.DistComm();
     const int commSize = mpi::Size( comm );
     const auto& childU = childFront.work;
@@ -161,9 +330,17 @@ Process
     // AllToAll to send and receive the child updates
     vector<F> recvBuf( recvBufSize );
     DEBUG_ONLY(VerifySendsAndRecvs( sendSizes, recvSizes, comm ))
-    SparseAllToAll
-    ( sendBuf, sendSizes, sendOffs,
-      recvBuf, recvSizes, recvOffs, comm );
+    // The plan is cached, so its counts should never change
+    DEBUG_ONLY(
+      if( info.factorPlan.ready )
+          mpi::VerifyPlan
+          ( info.factorPlan, sendSizes, sendOffs, recvSizes, recvOffs );
+    )
+    if( !info.factorPlan.ready )
+        info.factorPlan =
+          mpi::MakeSparseAllToAllPlan
+          ( sendSizes, sendOffs, recvSizes, recvOffs, comm );
+    mpi::SparseAllToAll( sendBuf, recvBuf, info.factorPlan );
     SwapClear( sendBuf );
     SwapClear( sendSizes );
     SwapClear( sendOffs );
@@ -42,6 +42,7 @@ inline void ProcessFrontVanilla( Matrix<F>& AL, Matrix<F>& ABR, bool conjugate )
 
     Matrix<F> S21T, S21B;
     Matrix<F> AL21T, AL21B;
+    Matrix<F> AL22T, AL22B;
 
     const Int bsize = Blocksize();
     for( Int k=0; k<n; k+=bsize )
@@ -60,10 +61,13 @@ inline void ProcessFrontVanilla( Matrix<F>& AL, Matrix<F>& ABR, bool conjugate )
         S21 = AL21;
         DiagonalSolve( RIGHT, NORMAL, d1, AL21 );
 
+        // Only the lower triangles of the trailing diagonal block and of the
+        // Schur complement are kept, so avoid forming their upper triangles
         PartitionDown( S21, S21T, S21B, AL22.Width() );
         PartitionDown( AL21, AL21T, AL21B, AL22.Width() );
-        Gemm( NORMAL, orientation, F(-1), S21, AL21T, F(1), AL22 );
-        MakeTrapezoidal( LOWER, AL22 );
+        PartitionDown( AL22, AL22T, AL22B, AL22.Width() );
+        Trrk( LOWER, NORMAL, orientation, F(-1), S21T, AL21T, F(1), AL22T );
+        Gemm( NORMAL, orientation, F(-1), S21B, AL21T, F(1), AL22B );
         Trrk( LOWER, NORMAL, orientation, F(-1), S21B, AL21B, F(1), ABR );
     }
 }
@@ -109,11 +113,10 @@ inline void ProcessFrontBlock
         // TODO: Expose the pivot type as an option?
         LDL( ATL, dSub, p, conjugate );
 
-        // Solve against ABL and update ABR
-        // NOTE: This does not exploit symmetry
+        // Solve against ABL and update the lower triangle of ABR
         SolveAfter( ATL, dSub, p, ABL, conjugate );
         const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
-        Gemm( NORMAL, orientation, F(-1), ABL, BBL, F(1), ABR );
+        Trrk( LOWER, NORMAL, orientation, F(-1), ABL, BBL, F(1), ABR );
 
         // Copy the original contents of ABL back
         ABL = BBL;
@@ -285,11 +288,10 @@ inline void ProcessFrontBlock
         // TODO: Expose the pivot type as an option?
         LDL( ATL, dSub, p, conjugate );
 
-        // Solve against ABL and update ABR
-        // NOTE: This update does not exploit symmetry
+        // Solve against ABL and update the lower triangle of ABR
         SolveAfter( ATL, dSub, p, ABL, conjugate );
         const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
-        Gemm( NORMAL, orientation, F(-1), ABL, BBL, F(1), ABR );
+        Trrk( LOWER, NORMAL, orientation, F(-1), ABL, BBL, F(1), ABR );
 
         // Copy the original contents of ABL back
         ABL = BBL;
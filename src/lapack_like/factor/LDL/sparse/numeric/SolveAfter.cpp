@@ -29,6 +29,7 @@ void SolveAfter
   const Front<F>& front, Matrix<F>& X )
 {
     DEBUG_ONLY(CSE cse("ldl::SolveAfter"))
+    ProfileRegion profile("ldl::SolveAfter");
 
     MatrixNode<F> XNodal( invMap, info, X );
     SolveAfter( info, front, XNodal );
@@ -40,6 +41,7 @@ void SolveAfter
 ( const NodeInfo& info, const Front<F>& front, MatrixNode<F>& X )
 {
     DEBUG_ONLY(CSE cse("ldl::SolveAfter"))
+    ProfileRegion profile("ldl::SolveAfter");
 
     const Orientation orientation = ( front.isHermitian ? ADJOINT : TRANSPOSE );
     if( BlockFactorization(front.type) )
@@ -66,6 +68,7 @@ void SolveAfter
   const DistFront<F>& front, DistMultiVec<F>& X )
 {
     DEBUG_ONLY(CSE cse("ldl::SolveAfter"))
+    ProfileRegion profile("ldl::SolveAfter");
 
     if( FrontIs1D(front.type) )
     {
@@ -87,6 +90,7 @@ void SolveAfter
   const DistFront<F>& front, DistMultiVecNode<F>& X )
 {
     DEBUG_ONLY(CSE cse("ldl::SolveAfter"))
+    ProfileRegion profile("ldl::SolveAfter");
 
     if( !FrontIs1D(front.type) )
     {
@@ -122,6 +126,7 @@ void SolveAfter
   const DistFront<F>& front, DistMatrixNode<F>& X )
 {
     DEBUG_ONLY(CSE cse("ldl::SolveAfter"))
+    ProfileRegion profile("ldl::SolveAfter");
 
     if( FrontIs1D(front.type) )
     {
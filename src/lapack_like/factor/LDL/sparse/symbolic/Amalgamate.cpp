@@ -0,0 +1,211 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, Stanford University, and the
+   Georgia Insitute of Technology.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+namespace El {
+namespace ldl {
+
+namespace {
+
+// A copy of a sequential elimination subtree which stores each supernode as an
+// explicit list of indices (in the original numbering) so that supernodes may
+// be merged before the subtree is renumbered
+struct RelaxedNode
+{
+    Int off;
+    vector<Int> inds;       // in the original numbering
+    vector<Int> sepInds;    // the degrees of freedom of each of 'inds'
+    vector<Int> origStruct; // in the original numbering
+    Int structSize;         // the size of the factored lower structure
+    double numZeros;        // the number of explicit zeros from merges
+    vector<RelaxedNode*> children;
+
+    ~RelaxedNode()
+    {
+        for( const RelaxedNode* child : children )
+            delete child;
+    }
+};
+
+RelaxedNode* BuildRelaxed
+( const Node& node, const Separator& sep,
+  vector<Int>& factStruct, Int& firstInd )
+{
+    DEBUG_ONLY(
+      CSE cse("ldl::BuildRelaxed");
+      if( node.children.size() != sep.children.size() )
+          LogicError("Node and separator trees do not match");
+      if( node.size != Int(sep.inds.size()) )
+          LogicError("Node and separator sizes do not match");
+    )
+    auto relaxed = new RelaxedNode;
+    relaxed->inds.resize( node.size );
+    for( Int i=0; i<node.size; ++i )
+        relaxed->inds[i] = node.off + i;
+    relaxed->sepInds = sep.inds;
+    relaxed->origStruct = node.lowerStruct;
+    relaxed->numZeros = 0;
+    firstInd = Min( firstInd, node.off );
+
+    // Perform a step of the symbolic factorization
+    factStruct = node.lowerStruct;
+    const Int numChildren = node.children.size();
+    relaxed->children.resize( numChildren );
+    vector<Int> childStruct;
+    for( Int c=0; c<numChildren; ++c )
+    {
+        relaxed->children[c] =
+          BuildRelaxed
+          ( *node.children[c], *sep.children[c], childStruct, firstInd );
+        factStruct = Union( factStruct, childStruct );
+    }
+    // Remove our own indices, which precede those of our ancestors
+    auto ourEnd =
+      std::lower_bound( factStruct.begin(), factStruct.end(), node.off+node.size );
+    factStruct.erase( factStruct.begin(), ourEnd );
+    relaxed->structSize = factStruct.size();
+
+    return relaxed;
+}
+
+// Since the factored structure of a child is contained within the union of
+// the indices and factored structure of its parent, absorbing a child with
+// s_c pivots and a structure of size l_c into a parent with s_p pivots and a
+// structure of size l_p leaves the parent's structure unchanged and introduces
+// s_c (s_p + l_p - l_c) explicit zeros into the lower triangle of the front.
+void Relax( RelaxedNode& node, const BisectCtrl& ctrl )
+{
+    DEBUG_ONLY(CSE cse("ldl::Relax"))
+    for( RelaxedNode* child : node.children )
+        Relax( *child, ctrl );
+
+    // Each absorbed child is replaced by its own children, which are then
+    // candidates for absorption
+    vector<RelaxedNode*> children;
+    children.swap( node.children );
+    Int numAbsorbed = 0;
+    Int c = 0;
+    while( c < Int(children.size()) )
+    {
+        RelaxedNode* child = children[c];
+        const double sc = child->inds.size();
+        const double lc = child->structSize;
+        const double sp = node.inds.size();
+        const double lp = node.structSize;
+        const double s = sc + sp;
+        const double numEntries = s*(s+1)/2 + s*lp;
+        const double numZeros =
+          node.numZeros + child->numZeros + sc*(sp+lp-lc);
+        if( s <= ctrl.relaxSize || numZeros <= ctrl.relaxFill*numEntries )
+        {
+            node.inds.insert
+            ( node.inds.begin()+numAbsorbed,
+              child->inds.begin(), child->inds.end() );
+            node.sepInds.insert
+            ( node.sepInds.begin()+numAbsorbed,
+              child->sepInds.begin(), child->sepInds.end() );
+            numAbsorbed += child->inds.size();
+            node.origStruct = Union( node.origStruct, child->origStruct );
+            node.numZeros = numZeros;
+
+            children.erase( children.begin()+c );
+            children.insert
+            ( children.begin()+c,
+              child->children.begin(), child->children.end() );
+            SwapClear( child->children );
+            delete child;
+        }
+        else
+            ++c;
+    }
+    node.children.swap( children );
+}
+
+// Assign contiguous indices to each supernode in a postordering
+void Renumber
+( RelaxedNode& node, Int& off, Int firstInd, vector<Int>& newInds )
+{
+    for( RelaxedNode* child : node.children )
+        Renumber( *child, off, firstInd, newInds );
+    node.off = off;
+    const Int size = node.inds.size();
+    for( Int t=0; t<size; ++t )
+        newInds[node.inds[t]-firstInd] = off + t;
+    off += size;
+}
+
+void Rebuild
+( const RelaxedNode& relaxed, Node& node, Separator& sep,
+  Int firstInd, const vector<Int>& newInds )
+{
+    DEBUG_ONLY(CSE cse("ldl::Rebuild"))
+    node.size = relaxed.inds.size();
+    node.off = relaxed.off;
+    sep.off = relaxed.off;
+    sep.inds = relaxed.sepInds;
+
+    // Translate the original structure, dropping any indices which were
+    // absorbed into this supernode
+    const Int lastInd = firstInd + newInds.size();
+    const Int nodeEnd = node.off + node.size;
+    node.lowerStruct.resize( 0 );
+    for( Int i : relaxed.origStruct )
+    {
+        const Int iNew =
+          ( i >= firstInd && i < lastInd ? newInds[i-firstInd] : i );
+        if( iNew >= nodeEnd )
+            node.lowerStruct.push_back( iNew );
+    }
+    std::sort( node.lowerStruct.begin(), node.lowerStruct.end() );
+
+    const Int numChildren = relaxed.children.size();
+    node.children.resize( numChildren );
+    sep.children.resize( numChildren );
+    for( Int c=0; c<numChildren; ++c )
+    {
+        node.children[c] = new Node(&node);
+        sep.children[c] = new Separator(&sep);
+        Rebuild
+        ( *relaxed.children[c], *node.children[c], *sep.children[c],
+          firstInd, newInds );
+    }
+}
+
+} // anonymous namespace
+
+void Amalgamate( Node& rootNode, Separator& rootSep, const BisectCtrl& ctrl )
+{
+    DEBUG_ONLY(CSE cse("ldl::Amalgamate"))
+    ProfileRegion profile("ldl::Amalgamate");
+
+    vector<Int> factStruct;
+    Int firstInd = rootNode.off;
+    unique_ptr<RelaxedNode> root
+    ( BuildRelaxed( rootNode, rootSep, factStruct, firstInd ) );
+    Relax( *root, ctrl );
+
+    // Postorder the merged supernodes over the same range of indices
+    const Int lastInd = rootNode.off + rootNode.size;
+    vector<Int> newInds( lastInd-firstInd );
+    Int off = firstInd;
+    Renumber( *root, off, firstInd, newInds );
+
+    for( const Node* child : rootNode.children )
+        delete child;
+    SwapClear( rootNode.children );
+    for( const Separator* child : rootSep.children )
+        delete child;
+    SwapClear( rootSep.children );
+    Rebuild( *root, rootNode, rootSep, firstInd, newInds );
+}
+
+} // namespace ldl
+} // namespace El
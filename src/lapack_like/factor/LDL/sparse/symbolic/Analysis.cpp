@@ -353,5 +353,117 @@ void Analysis
     ComputeStructAndRelInds( theirSize, theirLowerStruct, node, info );
 }
 
+namespace {
+
+const Int numStatsBins = 8*sizeof(Int);
+
+void AccumulateFront( Int size, Int lowerStructSize, AnalysisStats& stats )
+{
+    const Int frontSize = size + lowerStructSize;
+    ++stats.numFronts;
+    stats.maxFrontSize = Max( stats.maxFrontSize, frontSize );
+
+    const double s = size;
+    const double l = lowerStructSize;
+    stats.numEntries += s*(s+1)/2 + s*l;
+    // Eliminating a pivot with r rows beneath it requires r divisions and
+    // a symmetric rank-one update of r(r+1)/2 multiply-adds, and r runs
+    // from l+s-1 down to l
+    auto sumOfSquares = []( double n ) { return (n-1)*n*(2*n-1)/6; };
+    auto sum = []( double n ) { return (n-1)*n/2; };
+    const double m = s + l;
+    stats.numFactorFlops +=
+      (sumOfSquares(m)-sumOfSquares(l)) + 2*(sum(m)-sum(l));
+
+    Int bin = 0;
+    while( bin+1 < numStatsBins && (Int(2)<<bin) <= frontSize )
+        ++bin;
+    ++stats.sizeHistogram[bin];
+}
+
+void AccumulateStats( const NodeInfo& info, AnalysisStats& stats )
+{
+    for( const NodeInfo* child : info.children )
+        AccumulateStats( *child, stats );
+    AccumulateFront( info.size, info.lowerStruct.size(), stats );
+}
+
+void AccumulateStats( const DistNodeInfo& info, AnalysisStats& stats )
+{
+    if( info.duplicate != nullptr )
+    {
+        // The bottom front is owned by a single process
+        AccumulateStats( *info.duplicate, stats );
+        return;
+    }
+    AccumulateStats( *info.child, stats );
+    if( mpi::Rank(info.comm) == 0 )
+        AccumulateFront( info.size, info.lowerStruct.size(), stats );
+}
+
+void InitializeStats( AnalysisStats& stats )
+{
+    stats.numFronts = 0;
+    stats.maxFrontSize = 0;
+    stats.numEntries = 0;
+    stats.numFactorFlops = 0;
+    stats.sizeHistogram.assign( numStatsBins, 0 );
+}
+
+void TrimHistogram( AnalysisStats& stats )
+{
+    auto& hist = stats.sizeHistogram;
+    while( !hist.empty() && hist.back() == 0 )
+        hist.pop_back();
+}
+
+} // anonymous namespace
+
+AnalysisStats GetAnalysisStats( const NodeInfo& rootInfo )
+{
+    DEBUG_ONLY(CSE cse("ldl::GetAnalysisStats"))
+    AnalysisStats stats;
+    InitializeStats( stats );
+    AccumulateStats( rootInfo, stats );
+    TrimHistogram( stats );
+    return stats;
+}
+
+AnalysisStats GetAnalysisStats( const DistNodeInfo& rootInfo )
+{
+    DEBUG_ONLY(CSE cse("ldl::GetAnalysisStats"))
+    AnalysisStats stats;
+    InitializeStats( stats );
+    AccumulateStats( rootInfo, stats );
+
+    mpi::Comm comm = rootInfo.comm;
+    stats.numFronts = mpi::AllReduce( stats.numFronts, comm );
+    stats.maxFrontSize = mpi::AllReduce( stats.maxFrontSize, mpi::MAX, comm );
+    stats.numEntries = mpi::AllReduce( stats.numEntries, comm );
+    stats.numFactorFlops = mpi::AllReduce( stats.numFactorFlops, comm );
+    mpi::AllReduce( stats.sizeHistogram.data(), numStatsBins, comm );
+    TrimHistogram( stats );
+    return stats;
+}
+
+void PrintAnalysisStats( const AnalysisStats& stats, ostream& os )
+{
+    DEBUG_ONLY(CSE cse("ldl::PrintAnalysisStats"))
+    os << "Number of fronts:         " << stats.numFronts << "\n"
+       << "Maximum front size:       " << stats.maxFrontSize << "\n"
+       << "Entries in factor:        " << stats.numEntries << "\n"
+       << "Factorization flops:      " << stats.numFactorFlops << "\n"
+       << "Front size histogram:" << endl;
+    const Int numBins = stats.sizeHistogram.size();
+    for( Int bin=0; bin<numBins; ++bin )
+    {
+        const Int lower = ( bin == 0 ? 0 : Int(1)<<bin );
+        const Int upper = Int(2)<<bin;
+        os << "  [" << lower << "," << upper << "): "
+           << stats.sizeHistogram[bin] << "\n";
+    }
+    os.flush();
+}
+
 } // namespace ldl
 } // namespace El
@@ -13,6 +13,214 @@
 namespace El {
 namespace ldl {
 
+// Replace a leaf of the dissection with the supernodal elimination tree of an
+// approximate minimum degree ordering of its vertices. The tree is postordered
+// so that each fundamental supernode is contiguous, and any additional roots
+// (from disconnected pieces of the leaf) become children of the last one.
+inline void
+OrderLeaf
+( const Graph& graph,
+  const vector<Int>& perm,
+        Separator& sep,
+        Node& node,
+        Int off )
+{
+    DEBUG_ONLY(CSE cse("ldl::OrderLeaf"))
+    const Int numSources = graph.NumSources();
+    vector<Int> amdPerm;
+    ApproximateMinimumDegree( graph, amdPerm );
+
+    // Form the (symmetric) lower adjacency in the new ordering
+    vector<vector<Int>> lowerAdj( numSources );
+    for( Int s=0; s<numSources; ++s )
+    {
+        const Int i = amdPerm[s];
+        const Int edgeOff = graph.EdgeOffset( s );
+        const Int numConnections = graph.NumConnections( s );
+        for( Int t=0; t<numConnections; ++t )
+        {
+            const Int target = graph.Target( edgeOff+t );
+            if( target == s || target >= numSources )
+                continue;
+            const Int j = amdPerm[target];
+            if( i < j )
+                lowerAdj[j].push_back( i );
+            else
+                lowerAdj[i].push_back( j );
+        }
+    }
+
+    // Compute the elimination tree with path compression
+    vector<Int> amdParents( numSources, -1 ), ancestors( numSources, -1 );
+    for( Int j=0; j<numSources; ++j )
+    {
+        for( Int i : lowerAdj[j] )
+        {
+            Int r = i;
+            while( ancestors[r] != -1 && ancestors[r] != j )
+            {
+                const Int next = ancestors[r];
+                ancestors[r] = j;
+                r = next;
+            }
+            if( ancestors[r] == -1 )
+            {
+                ancestors[r] = j;
+                amdParents[r] = j;
+            }
+        }
+    }
+
+    // Postorder the elimination tree
+    vector<vector<Int>> amdChildren( numSources );
+    for( Int j=0; j<numSources; ++j )
+        if( amdParents[j] != -1 )
+            amdChildren[amdParents[j]].push_back( j );
+    vector<Int> post( numSources );
+    Int numOrdered = 0;
+    vector<std::pair<Int,Int>> stack;
+    for( Int root=0; root<numSources; ++root )
+    {
+        if( amdParents[root] != -1 )
+            continue;
+        stack.push_back( std::make_pair(root,Int(0)) );
+        while( !stack.empty() )
+        {
+            auto& top = stack.back();
+            if( top.second < Int(amdChildren[top.first].size()) )
+            {
+                const Int child = amdChildren[top.first][top.second++];
+                stack.push_back( std::make_pair(child,Int(0)) );
+            }
+            else
+            {
+                post[top.first] = numOrdered++;
+                stack.pop_back();
+            }
+        }
+    }
+    vector<Int> parents( numSources, -1 ), invOrder( numSources );
+    for( Int j=0; j<numSources; ++j )
+    {
+        if( amdParents[j] != -1 )
+            parents[post[j]] = post[amdParents[j]];
+    }
+    for( Int s=0; s<numSources; ++s )
+        invOrder[post[amdPerm[s]]] = s;
+
+    // Form the original lower structure of each column (in the numbering of
+    // the entire graph) and the factored column counts
+    // (since postordering preserves the ancestors, each lower connection
+    // remains a lower connection)
+    vector<vector<Int>> origStructs( numSources );
+    for( Int j=0; j<numSources; ++j )
+    {
+        const Int s = invOrder[j];
+        const Int edgeOff = graph.EdgeOffset( s );
+        const Int numConnections = graph.NumConnections( s );
+        for( Int t=0; t<numConnections; ++t )
+        {
+            const Int target = graph.Target( edgeOff+t );
+            if( target >= numSources )
+                origStructs[j].push_back( off+target );
+        }
+    }
+    for( Int j=0; j<numSources; ++j )
+        for( Int i : lowerAdj[j] )
+            origStructs[post[i]].push_back( off+post[j] );
+    for( auto& origStruct : origStructs )
+    {
+        std::sort( origStruct.begin(), origStruct.end() );
+        origStruct.erase
+        ( std::unique(origStruct.begin(),origStruct.end()), origStruct.end() );
+    }
+    vector<Int> colCounts( numSources ), numChildren( numSources, 0 );
+    {
+        vector<vector<Int>> structs( numSources );
+        for( Int j=0; j<numSources; ++j )
+        {
+            auto& factStruct = structs[j];
+            factStruct = Union( factStruct, origStructs[j] );
+            auto ourEnd =
+              std::upper_bound( factStruct.begin(), factStruct.end(), off+j );
+            factStruct.erase( factStruct.begin(), ourEnd );
+            colCounts[j] = factStruct.size();
+            if( parents[j] != -1 )
+            {
+                ++numChildren[parents[j]];
+                structs[parents[j]] = Union( structs[parents[j]], factStruct );
+            }
+            SwapClear( factStruct );
+        }
+    }
+
+    // Find the fundamental supernodes
+    vector<Int> supernodeOffs( 1, 0 );
+    for( Int j=1; j<numSources; ++j )
+        if( parents[j-1] != j || numChildren[j] != 1 ||
+            colCounts[j-1] != colCounts[j]+1 )
+            supernodeOffs.push_back( j );
+    const Int numSupernodes = supernodeOffs.size();
+    supernodeOffs.push_back( numSources );
+    vector<Int> supernodeOf( numSources );
+    for( Int k=0; k<numSupernodes; ++k )
+        for( Int j=supernodeOffs[k]; j<supernodeOffs[k+1]; ++j )
+            supernodeOf[j] = k;
+    const Int root = numSupernodes-1;
+    vector<Int> supernodeParents( numSupernodes, root );
+    for( Int k=0; k<root; ++k )
+    {
+        const Int last = supernodeOffs[k+1]-1;
+        if( parents[last] != -1 )
+            supernodeParents[k] = supernodeOf[parents[last]];
+    }
+
+    // Build the tree of supernodes beneath the leaf
+    // TODO: Replace with better deletion mechanism
+    SwapClear( sep.children );
+    SwapClear( node.children );
+    vector<Node*> nodes( numSupernodes );
+    vector<Separator*> seps( numSupernodes );
+    nodes[root] = &node;
+    seps[root] = &sep;
+    for( Int k=root-1; k>=0; --k )
+    {
+        nodes[k] = new Node(nodes[supernodeParents[k]]);
+        seps[k] = new Separator(seps[supernodeParents[k]]);
+    }
+    for( Int k=0; k<root; ++k )
+    {
+        nodes[supernodeParents[k]]->children.push_back( nodes[k] );
+        seps[supernodeParents[k]]->children.push_back( seps[k] );
+    }
+    for( Int k=0; k<numSupernodes; ++k )
+    {
+        const Int first = supernodeOffs[k];
+        const Int size = supernodeOffs[k+1] - first;
+        Node& supernode = *nodes[k];
+        Separator& supernodeSep = *seps[k];
+        supernode.size = size;
+        supernode.off = off + first;
+        supernodeSep.off = off + first;
+        supernodeSep.inds.resize( size );
+        vector<Int> lowerStruct;
+        for( Int j=first; j<first+size; ++j )
+        {
+            supernodeSep.inds[j-first] = perm[invOrder[j]];
+            const auto& origStruct = origStructs[j];
+            auto structBeg = std::upper_bound
+              ( origStruct.begin(), origStruct.end(), off+first+size-1 );
+            lowerStruct.insert
+            ( lowerStruct.end(), structBeg, origStruct.end() );
+        }
+        std::sort( lowerStruct.begin(), lowerStruct.end() );
+        lowerStruct.erase
+        ( std::unique(lowerStruct.begin(),lowerStruct.end()),
+          lowerStruct.end() );
+        supernode.lowerStruct = lowerStruct;
+    }
+}
+
 inline void
 NestedDissectionRecursion
 ( const Graph& graph, 
@@ -23,7 +231,12 @@ NestedDissectionRecursion
   const BisectCtrl& ctrl )
 {
     DEBUG_ONLY(CSE cse("ldl::NestedDissectionRecursion"))
-    if( graph.NumSources() <= ctrl.cutoff )
+    if( ctrl.orderLeaves && graph.NumSources() > 1 &&
+        graph.NumSources() <= ctrl.cutoff )
+    {
+        OrderLeaf( graph, perm, sep, node, off );
+    }
+    else if( graph.NumSources() <= ctrl.cutoff )
     {
         // Fill in this node of the local separator tree
         const Int numSources = graph.NumSources();
@@ -233,6 +446,8 @@ NestedDissectionRecursion
 
         NestedDissectionRecursion
         ( seqGraph, perm.Map(), *sep.duplicate, *node.duplicate, off, ctrl );
+        if( ctrl.amalgamate )
+            Amalgamate( *node.duplicate, *sep.duplicate, ctrl );
 
         // Pull information up from the duplicates
         sep.off = sep.duplicate->off;
@@ -251,6 +466,7 @@ void NestedDissection
   const BisectCtrl& ctrl )
 {
     DEBUG_ONLY(CSE cse("ldl::NestedDissection"))
+    ProfileRegion profile("ldl::NestedDissection");
     // NOTE: There is a potential memory leak here if sep or info is reused
 
     const Int numSources = graph.NumSources();
@@ -260,6 +476,8 @@ void NestedDissection
 
     Node node;
     NestedDissectionRecursion( graph, perm, sep, node, 0, ctrl );
+    if( ctrl.amalgamate )
+        Amalgamate( node, sep, ctrl );
 
     // Construct the distributed reordering    
     BuildMap( sep, map );
@@ -277,6 +495,7 @@ void NestedDissection
   const BisectCtrl& ctrl )
 {
     DEBUG_ONLY(CSE cse("ldl::NestedDissection"))
+    ProfileRegion profile("ldl::NestedDissection");
     // NOTE: There is a potential memory leak here if sep or info is reused
 
     DistMap perm( graph.NumSources(), graph.Comm() );
@@ -8,9 +8,13 @@
 */
 #include "El.hpp"
 
+#include "El/blas_like/level1/copy_internal.hpp"
+
 #include "./LU/Local.hpp"
 #include "./LU/Panel.hpp"
 #include "./LU/Full.hpp"
+#include "./LU/Lookahead.hpp"
+#include "./LU/Tiled.hpp"
 #include "./LU/Mod.hpp"
 #include "./LU/SolveAfter.hpp"
 
@@ -226,6 +230,24 @@ void LU( AbstractDistMatrix<F>& APre, AbstractDistMatrix<Int>& pPre )
     }
 }
 
+template<typename F>
+void LU
+( AbstractDistMatrix<F>& A, AbstractDistMatrix<Int>& p, const LUCtrl& ctrl )
+{
+    DEBUG_ONLY(CSE cse("LU"))
+    if( ctrl.lookahead )
+        lu::Lookahead( A, p, ctrl );
+    else
+        LU( A, p );
+}
+
+template<typename F>
+void LU( TileMatrix<F>& A, Matrix<Int>& p )
+{
+    DEBUG_ONLY(CSE cse("LU"))
+    lu::Tiled( A, p );
+}
+
 template<typename F> 
 void LU
 ( AbstractDistMatrix<F>& A, 
@@ -241,6 +263,10 @@ void LU
   template void LU( DistMatrix<F,STAR,STAR>& A ); \
   template void LU( Matrix<F>& A, Matrix<Int>& p ); \
   template void LU( AbstractDistMatrix<F>& A, AbstractDistMatrix<Int>& p ); \
+  template void LU \
+  ( AbstractDistMatrix<F>& A, AbstractDistMatrix<Int>& p, \
+    const LUCtrl& ctrl ); \
+  template void LU( TileMatrix<F>& A, Matrix<Int>& p ); \
   template void LU( Matrix<F>& A, Matrix<Int>& p, Matrix<Int>& q ); \
   template void LU \
   ( AbstractDistMatrix<F>& A, \
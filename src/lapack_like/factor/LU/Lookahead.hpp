@@ -0,0 +1,173 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_LU_LOOKAHEAD_HPP
+#define EL_LU_LOOKAHEAD_HPP
+
+// Partially-pivoted LU with a lookahead of one panel. Once the next panel has
+// received the update from the current one, it is factored and its row
+// interchanges are applied both to the (not yet updated) trailing matrix and
+// to the current panel's redistributed L21, which is equivalent since row
+// interchanges commute with the update. After the next panel's rows of the
+// trailing matrix are brought up to date, their triangular solve is performed
+// and their redistribution started with non-blocking collectives, which then
+// proceed while the rest of the trailing matrix is updated in column blocks.
+
+namespace El {
+namespace lu {
+
+template<typename F>
+inline void
+Lookahead
+( AbstractDistMatrix<F>& APre, AbstractDistMatrix<Int>& pPre,
+  const LUCtrl& ctrl )
+{
+    DEBUG_ONLY(
+        CSE cse("lu::Lookahead");
+        AssertSameGrids( APre, pPre );
+    )
+    auto APtr = ReadWriteProxy<F,MC,MR>( &APre ); auto& A = *APtr;
+    auto pPtr = WriteProxy<Int,VC,STAR>( &pPre ); auto& p = *pPtr;
+
+    const Grid& g = A.Grid();
+    DistMatrix<F,  STAR,STAR> A11_STAR_STAR(g);
+    DistMatrix<F,  MC,  STAR> A21_MC_STAR0(g), A21_MC_STAR1(g);
+    DistMatrix<F,  STAR,VR  > A12_STAR_VR(g);
+    DistMatrix<F,  STAR,MR  > A12_STAR_MR0(g), A12_STAR_MR1(g);
+    DistMatrix<Int,STAR,STAR> p1Piv_STAR_STAR(g);
+    DistMatrix<F,MC,  STAR>* A21_MC_STAR[2] = { &A21_MC_STAR0, &A21_MC_STAR1 };
+    DistMatrix<F,STAR,MR  >* A12_STAR_MR[2] = { &A12_STAR_MR0, &A12_STAR_MR1 };
+    copy::AllGatherRequest<F> req[2];
+
+    // Initialize the permutation to the identity
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    p.Resize( m, 1 );
+    for( Int iLoc=0; iLoc<p.LocalHeight(); ++iLoc )
+        p.SetLocal( iLoc, 0, p.GlobalRow(iLoc) );
+
+    DistMatrix<Int,VC,STAR> p1(g), p1Inv(g);
+
+    const Int bsize = Blocksize();
+    const Int numUpdateBlocks = Max(ctrl.numUpdateBlocks,Int(1));
+
+    // Factor the (up-to-date) panel beginning at index k and apply its row
+    // interchanges, including to the previous panel's L21 (if any)
+    auto factorPanel =
+      [&]( Int k, Int s, DistMatrix<F,MC,STAR>* prevL21 )
+      {
+          const Int nb = Min(bsize,minDim-k);
+          const Range<Int> ind1( k, k+nb ), ind2( k+nb, END ), indB( k, END );
+          auto A11 = A( ind1, ind1 );
+          auto A21 = A( ind2, ind1 );
+          auto A22 = A( ind2, ind2 );
+          auto AB = A( indB, ALL );
+
+          A21_MC_STAR[s]->AlignWith( A22 );
+          *A21_MC_STAR[s] = A21;
+          A11_STAR_STAR = A11;
+
+          lu::Panel( A11_STAR_STAR, *A21_MC_STAR[s], p1Piv_STAR_STAR );
+          PivotsToPartialPermutation( p1Piv_STAR_STAR, p1, p1Inv );
+          PermuteRows( AB, p1, p1Inv );
+          if( prevL21 != nullptr )
+              PermuteRows( *prevL21, p1, p1Inv );
+
+          // Update the preimage of the permutation
+          auto pB = p( indB, ALL );
+          PermuteRows( pB, p1, p1Inv );
+
+          A11 = A11_STAR_STAR;
+          A21 = *A21_MC_STAR[s];
+      };
+
+    // Solve for the (up-to-date) block row of U beginning at index k and
+    // start its redistribution
+    auto startRow =
+      [&]( Int k, Int s )
+      {
+          const Int nb = Min(bsize,minDim-k);
+          const Range<Int> ind1( k, k+nb ), ind2( k+nb, END );
+          auto A12 = A( ind1, ind2 );
+          auto A22 = A( ind2, ind2 );
+
+          A12_STAR_VR.AlignWith( A22 );
+          A12_STAR_VR = A12;
+          LocalTrsm
+          ( LEFT, LOWER, NORMAL, UNIT, F(1), A11_STAR_STAR, A12_STAR_VR );
+
+          A12_STAR_MR[s]->AlignWith( A22 );
+          copy::IPartialRowAllGather( A12_STAR_VR, *A12_STAR_MR[s], req[s] );
+      };
+
+    if( minDim > 0 )
+    {
+        factorPanel( 0, 0, nullptr );
+        startRow( 0, 0 );
+    }
+    for( Int k=0, s=0; k<minDim; k+=bsize, s=1-s )
+    {
+        const Int nb = Min(bsize,minDim-k);
+        const Range<Int> ind1( k, k+nb ), ind2( k+nb, END );
+        auto A12 = A( ind1, ind2 );
+        auto A22 = A( ind2, ind2 );
+        auto& L21 = *A21_MC_STAR[s];
+        auto& U12 = *A12_STAR_MR[s];
+
+        copy::FinishAllGather( req[s] );
+        A12 = U12;
+
+        // The trailing matrix of the last panel is empty
+        const Int kNext = k+nb;
+        if( kNext >= minDim )
+            break;
+        const Int nbNext = Min(bsize,minDim-kNext);
+        const Int nRest = n - (kNext+nbNext);
+
+        // Bring the next panel up to date and factor it
+        {
+            const Range<Int> indL( 0, nbNext );
+            auto A22L = A22( ALL, indL );
+            auto U12L = U12( ALL, indL );
+            LocalGemm( NORMAL, NORMAL, F(-1), L21, U12L, F(1), A22L );
+        }
+        factorPanel( kNext, 1-s, &L21 );
+
+        // Bring the next panel's block row up to date and start its
+        // redistribution
+        const Range<Int> indT( 0, nbNext ), indB( nbNext, END );
+        {
+            auto A22TR = A22( indT, indB );
+            auto L21T = L21( indT, ALL );
+            auto U12R = U12( ALL, indB );
+            LocalGemm( NORMAL, NORMAL, F(-1), L21T, U12R, F(1), A22TR );
+        }
+        startRow( kNext, 1-s );
+
+        // Update the remainder of the trailing matrix while the next block
+        // row's redistribution is in flight
+        auto A22BR = A22( indB, indB );
+        auto L21B = L21( indB, ALL );
+        const Int blockWidth = (nRest+numUpdateBlocks-1) / numUpdateBlocks;
+        for( Int j=0; j<nRest; j+=blockWidth )
+        {
+            const Int jEnd = Min(j+blockWidth,nRest);
+            auto A22BJ = A22BR( ALL, IR(j,jEnd) );
+            auto U12J = U12( ALL, IR(nbNext+j,nbNext+jEnd) );
+            LocalGemm( NORMAL, NORMAL, F(-1), L21B, U12J, F(1), A22BJ );
+            copy::TestAllGather( req[1-s] );
+        }
+    }
+}
+
+} // namespace lu
+} // namespace El
+
+#endif // ifndef EL_LU_LOOKAHEAD_HPP
@@ -0,0 +1,247 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_LU_TILED_HPP
+#define EL_LU_TILED_HPP
+
+// Tile LU with tournament pivoting (as in communication-avoiding LU), executed
+// as a DAG of tile kernels. The pivot rows of each panel are chosen by a
+// binary reduction tree: each tile of the panel nominates the rows selected
+// by partial pivoting on a copy of it, and each pair of candidate sets is
+// reduced by partial pivoting on (a copy of) their stacked original rows. The
+// winners are then swapped to the top of the panel, which is factored without
+// further pivoting, so that the tiles of the panel never need to be factored
+// together.
+
+namespace El {
+namespace lu {
+
+template<typename F>
+struct TournamentCandidates
+{
+    vector<Int> rows;  // the (current) global indices of the candidate rows
+    Matrix<F> values;  // the corresponding rows of the panel
+};
+
+// Overwrite C with the rows of 'values' chosen by partial pivoting
+template<typename F>
+inline void
+SelectCandidates
+( const vector<Int>& rows, const Matrix<F>& values,
+  TournamentCandidates<F>& C )
+{
+    DEBUG_ONLY(CSE cse("lu::SelectCandidates"))
+    const Int m = values.Height();
+    const Int n = values.Width();
+    const Int numSelected = Min(m,n);
+
+    Matrix<F> work( values );
+    Matrix<Int> p;
+    LU( work, p );
+
+    C.rows.resize( numSelected );
+    C.values.Resize( numSelected, n );
+    for( Int t=0; t<numSelected; ++t )
+    {
+        const Int i = p.Get(t,0);
+        C.rows[t] = rows[i];
+        for( Int j=0; j<n; ++j )
+            C.values.Set( t, j, values.Get(i,j) );
+    }
+}
+
+template<typename F>
+inline void
+SwapTileRows
+( TileMatrix<F>& A, Int j, const vector<Int>& pivots, Int offset )
+{
+    DEBUG_ONLY(CSE cse("lu::SwapTileRows"))
+    const Int nb = A.TileSize();
+    const Int width = A.TileWidth( j );
+    const Int numPivots = pivots.size();
+    for( Int t=0; t<numPivots; ++t )
+    {
+        const Int iFrom = offset+t;
+        const Int iTo = pivots[t];
+        if( iFrom == iTo )
+            continue;
+        Matrix<F>& AFrom = A.Tile( iFrom/nb, j );
+        Matrix<F>& ATo = A.Tile( iTo/nb, j );
+        blas::Swap
+        ( width, AFrom.Buffer(iFrom%nb,0), AFrom.LDim(),
+                 ATo.Buffer(iTo%nb,0),     ATo.LDim() );
+    }
+}
+
+template<typename F>
+inline void
+Tiled( TileMatrix<F>& A, Matrix<Int>& p )
+{
+    DEBUG_ONLY(CSE cse("lu::Tiled"))
+    const Int m = A.Height();
+    const Int mt = A.TileRows();
+    const Int nt = A.TileCols();
+    const Int minTiles = Min(mt,nt);
+    const Int nb = A.TileSize();
+
+    p.Resize( m, 1 );
+    for( Int i=0; i<m; ++i )
+        p.Set( i, 0, i );
+
+    // The reduction trees and the resulting (LAPACK-style) pivot sequences
+    // must outlive the execution of the graph
+    vector<vector<TournamentCandidates<F>>> trees( minTiles );
+    vector<vector<Int>> pivots( minTiles );
+
+    TaskGraph graph;
+    for( Int k=0; k<minTiles; ++k )
+    {
+        const Int numLeaves = mt-k;
+        auto& tree = trees[k];
+        tree.resize( 2*numLeaves-1 );
+
+        // Nominate candidates from each tile of the panel
+        vector<Int> level( numLeaves );
+        for( Int i=k; i<mt; ++i )
+        {
+            const Matrix<F>& A1 = A.Tile(i,k);
+            auto& C = tree[i-k];
+            graph.Insert
+            ( [&A1,&C,i,nb]()
+              {
+                  vector<Int> rows( A1.Height() );
+                  for( Int t=0; t<A1.Height(); ++t )
+                      rows[t] = i*nb + t;
+                  SelectCandidates( rows, A1, C );
+              },
+              {&A1}, {&C}, -k );
+            level[i-k] = i-k;
+        }
+
+        // Reduce the candidates pairwise
+        Int numNodes = numLeaves;
+        while( level.size() > 1 )
+        {
+            vector<Int> nextLevel;
+            for( Int s=0; s+1<Int(level.size()); s+=2 )
+            {
+                const auto& CL = tree[level[s]];
+                const auto& CR = tree[level[s+1]];
+                auto& C = tree[numNodes];
+                graph.Insert
+                ( [&CL,&CR,&C]()
+                  {
+                      vector<Int> rows( CL.rows );
+                      rows.insert( rows.end(), CR.rows.begin(), CR.rows.end() );
+                      const Int mL = CL.values.Height();
+                      const Int mR = CR.values.Height();
+                      const Int n = CL.values.Width();
+                      Matrix<F> values( mL+mR, n );
+                      auto valuesT = values( IR(0,mL), ALL );
+                      auto valuesB = values( IR(mL,END), ALL );
+                      valuesT = CL.values;
+                      valuesB = CR.values;
+                      SelectCandidates( rows, values, C );
+                  },
+                  {&CL,&CR}, {&C}, -k );
+                nextLevel.push_back( numNodes++ );
+            }
+            if( level.size() % 2 == 1 )
+                nextLevel.push_back( level.back() );
+            level.swap( nextLevel );
+        }
+
+        // Convert the winners into a sequence of row interchanges
+        const auto& root = tree[level[0]];
+        auto& piv = pivots[k];
+        graph.Insert
+        ( [&root,&piv,&p,k,nb]()
+          {
+              const Int numPivots = root.rows.size();
+              // Track the rows which are moved by the interchanges
+              std::map<Int,Int> contents, position;
+              auto contentsOf = [&]( Int i )
+                { auto it = contents.find(i);
+                  return it == contents.end() ? i : it->second; };
+              auto positionOf = [&]( Int i )
+                { auto it = position.find(i);
+                  return it == position.end() ? i : it->second; };
+              piv.resize( numPivots );
+              for( Int t=0; t<numPivots; ++t )
+              {
+                  const Int iTo = k*nb + t;
+                  const Int iFrom = positionOf( root.rows[t] );
+                  piv[t] = iFrom;
+                  const Int rowTo = contentsOf( iTo );
+                  contents[iTo] = root.rows[t];
+                  contents[iFrom] = rowTo;
+                  position[root.rows[t]] = iTo;
+                  position[rowTo] = iFrom;
+
+                  const Int pTo = p.Get(iTo,0);
+                  p.Set( iTo, 0, p.Get(iFrom,0) );
+                  p.Set( iFrom, 0, pTo );
+              }
+          },
+          {&root}, {&piv,&p}, -k );
+
+        // Apply the interchanges to every tile column (the ones to the left
+        // of the panel are only needed for the final form of L)
+        for( Int j=0; j<nt; ++j )
+        {
+            vector<const void*> outputs;
+            for( Int i=k; i<mt; ++i )
+                outputs.push_back( &A.Tile(i,j) );
+            graph.Insert
+            ( [&A,&piv,j,k,nb]() { SwapTileRows( A, j, piv, k*nb ); },
+              {&piv}, outputs, ( j<k ? -nt : -j ) );
+        }
+
+        // Factor the panel without pivoting
+        Matrix<F>& A11 = A.Tile(k,k);
+        graph.Insert( [&A11]() { LU( A11 ); }, {}, {&A11}, -k );
+        for( Int i=k+1; i<mt; ++i )
+        {
+            Matrix<F>& A21 = A.Tile(i,k);
+            graph.Insert
+            ( [&A11,&A21]()
+              {
+                  auto U11 = A11( IR(0,A11.Width()), ALL );
+                  Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), U11, A21 );
+              },
+              {&A11}, {&A21}, -k );
+        }
+        for( Int j=k+1; j<nt; ++j )
+        {
+            Matrix<F>& A12 = A.Tile(k,j);
+            graph.Insert
+            ( [&A11,&A12]()
+              {
+                  auto L11 = A11( ALL, IR(0,A11.Height()) );
+                  Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), L11, A12 );
+              },
+              {&A11}, {&A12}, -j );
+            for( Int i=k+1; i<mt; ++i )
+            {
+                const Matrix<F>& A21 = A.Tile(i,k);
+                Matrix<F>& A22 = A.Tile(i,j);
+                graph.Insert
+                ( [&A21,&A12,&A22]()
+                  { Gemm( NORMAL, NORMAL, F(-1), A21, A12, F(1), A22 ); },
+                  {&A21,&A12}, {&A22}, -j );
+            }
+        }
+    }
+    graph.Run();
+}
+
+} // namespace lu
+} // namespace El
+
+#endif // ifndef EL_LU_TILED_HPP
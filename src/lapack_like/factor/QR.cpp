@@ -15,6 +15,7 @@
 #include "./QR/SolveAfter.hpp"
 #include "./QR/Explicit.hpp"
 #include "./QR/TS.hpp"
+#include "./QR/Tiled.hpp"
 
 namespace El {
 
@@ -34,6 +35,13 @@ void QR
     qr::Householder( A, t, d );
 }
 
+template<typename F>
+void QR( TileMatrix<F>& A, TileMatrix<F>& T )
+{
+    DEBUG_ONLY(CSE cse("QR"))
+    qr::Tiled( A, T );
+}
+
 // Variants which perform (Businger-Golub) column-pivoting
 // =======================================================
 
@@ -61,6 +69,7 @@ void QR
   template void QR \
   ( AbstractDistMatrix<F>& A, AbstractDistMatrix<F>& t, \
     AbstractDistMatrix<Base<F>>& d ); \
+  template void QR( TileMatrix<F>& A, TileMatrix<F>& T ); \
   template void QR \
   ( Matrix<F>& A, Matrix<F>& t, \
     Matrix<Base<F>>& d, Matrix<Int>& p, \
@@ -97,6 +106,9 @@ void QR
   ( LeftOrRight side, Orientation orientation, \
     const AbstractDistMatrix<F>& A, const AbstractDistMatrix<F>& t, \
     const AbstractDistMatrix<Base<F>>& d, AbstractDistMatrix<F>& B ); \
+  template void qr::ApplyQ \
+  ( Orientation orientation, \
+    const TileMatrix<F>& A, const TileMatrix<F>& T, TileMatrix<F>& B ); \
   template void qr::SolveAfter \
   ( Orientation orientation, \
     const Matrix<F>& A, const Matrix<F>& t, \
@@ -0,0 +1,315 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_QR_TILED_HPP
+#define EL_QR_TILED_HPP
+
+// Tile Householder QR (with a flat reduction tree down each tile column),
+// executed as a DAG of tile kernels. Each diagonal tile is factored on its
+// own, and its triangle is then successively annihilated against the tiles
+// below it through "triangle-on-top-of-square" factorizations.
+//
+// Each block of reflectors is stored in the compact WY form
+//
+//   H_0 H_1 ... H_{r-1} = I - V S V^H,
+//
+// where H_j = I - conj(tau_j) v_j v_j^H is the adjoint of the transformation
+// applied by the j'th reflector, so that the upper-triangular S (stored in the
+// corresponding tile of T) yields Q^H = I - V S^H V^H. The Householder vectors
+// are stored below the diagonal of the diagonal tiles (with an implicit unit
+// diagonal) and in the full subdiagonal tiles (whose reflectors also have an
+// implicit identity on top). Unlike the standard QR, the diagonal of R is not
+// normalized to be non-negative.
+
+namespace El {
+namespace qr {
+
+// Form S from the (explicit) vectors V and the scalars tau, where only the
+// strictly upper triangle of V^H V is needed
+template<typename F>
+inline void
+TileTriangularFactor
+( const Matrix<F>& V, const Matrix<F>& tau, Matrix<F>& S )
+{
+    DEBUG_ONLY(CSE cse("qr::TileTriangularFactor"))
+    const Int r = tau.Height();
+    Matrix<F> G;
+    Zeros( G, r, r );
+    Gemm( ADJOINT, NORMAL, F(1), V, V, F(0), G );
+    Zero( S );
+    for( Int j=0; j<r; ++j )
+    {
+        const F tauConj = Conj(tau.Get(j,0));
+        S.Set( j, j, tauConj );
+        if( j == 0 )
+            continue;
+        auto S00 = S( IR(0,j), IR(0,j) );
+        auto s01 = S( IR(0,j), IR(j) );
+        auto g01 = G( IR(0,j), IR(j) );
+        Gemv( NORMAL, -tauConj, S00, g01, F(0), s01 );
+    }
+}
+
+// Form the explicit unit-lower-trapezoidal reflectors stored in a diagonal
+// tile (without reading its upper triangle, which may be concurrently
+// modified by a subdiagonal factorization)
+template<typename F>
+inline void
+TileReflectors( const Matrix<F>& A, Matrix<F>& V )
+{
+    DEBUG_ONLY(CSE cse("qr::TileReflectors"))
+    const Int m = A.Height();
+    const Int r = Min(m,A.Width());
+    Zeros( V, m, r );
+    for( Int j=0; j<r; ++j )
+    {
+        V.Set( j, j, F(1) );
+        for( Int i=j+1; i<m; ++i )
+            V.Set( i, j, A.Get(i,j) );
+    }
+}
+
+// Overwrite the (diagonal) tile A with its R and Householder vectors and the
+// top-left corner of S with their triangular factor
+template<typename F>
+inline void
+TileFactor( Matrix<F>& A, Matrix<F>& S )
+{
+    DEBUG_ONLY(CSE cse("qr::TileFactor"))
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int r = Min(m,n);
+    Matrix<F> tau( r, 1 ), z;
+    for( Int j=0; j<r; ++j )
+    {
+        const Range<Int> ind1( j ), ind2( j+1, END ), indB( j, END );
+        auto alpha11 = A( ind1, ind1 );
+        auto a21     = A( ind2, ind1 );
+        auto aB1     = A( indB, ind1 );
+        auto AB2     = A( indB, ind2 );
+
+        const F tauj = LeftReflector( alpha11, a21 );
+        tau.Set( j, 0, tauj );
+
+        // AB2 := (I - tau aB1 aB1^H) AB2, with a temporary unit diagonal
+        const F alpha = alpha11.Get(0,0);
+        alpha11.Set( 0, 0, F(1) );
+        Zeros( z, AB2.Width(), 1 );
+        Gemv( ADJOINT, F(1), AB2, aB1, F(0), z );
+        Ger( -tauj, aB1, z, AB2 );
+        alpha11.Set( 0, 0, alpha );
+    }
+
+    Matrix<F> V;
+    TileReflectors( A, V );
+    auto S11 = S( IR(0,r), IR(0,r) );
+    TileTriangularFactor( V, tau, S11 );
+}
+
+// C := Q C or C := Q^H C for the reflectors of a diagonal tile
+template<typename F>
+inline void
+TileApply
+( Orientation orientation,
+  const Matrix<F>& A, const Matrix<F>& S, Matrix<F>& C )
+{
+    DEBUG_ONLY(CSE cse("qr::TileApply"))
+    const Int r = Min(A.Height(),A.Width());
+    Matrix<F> V;
+    TileReflectors( A, V );
+    auto S11 = S( IR(0,r), IR(0,r) );
+
+    Matrix<F> W;
+    Zeros( W, r, C.Width() );
+    Gemm( ADJOINT, NORMAL, F(1), V, C, F(0), W );
+    Trmm
+    ( LEFT, UPPER, (orientation==NORMAL ? NORMAL : ADJOINT), NON_UNIT,
+      F(1), S11, W );
+    Gemm( NORMAL, NORMAL, F(-1), V, W, F(1), C );
+}
+
+// Annihilate the tile A2 against the upper triangle R, storing the
+// Householder vectors in A2 and their triangular factor in S
+template<typename F>
+inline void
+TileTSFactor( Matrix<F>& R, Matrix<F>& A2, Matrix<F>& S )
+{
+    DEBUG_ONLY(CSE cse("qr::TileTSFactor"))
+    const Int n = R.Width();
+    Matrix<F> tau( n, 1 ), z;
+    for( Int j=0; j<n; ++j )
+    {
+        const Range<Int> ind1( j ), ind2( j+1, END );
+        auto rho11 = R( ind1, ind1 );
+        auto r12   = R( ind1, ind2 );
+        auto a21   = A2( ALL, ind1 );
+        auto A22   = A2( ALL, ind2 );
+
+        const F tauj = LeftReflector( rho11, a21 );
+        tau.Set( j, 0, tauj );
+
+        // | r12 | := (I - tau | 1   | | 1, a21^H |) | r12 |
+        // | A22 |             | a21 |               | A22 |
+        Adjoint( r12, z );
+        Gemv( ADJOINT, F(1), A22, a21, F(1), z );
+        for( Int t=0; t<z.Height(); ++t )
+            r12.Update( 0, t, -tauj*Conj(z.Get(t,0)) );
+        Ger( -tauj, a21, z, A22 );
+    }
+    auto S11 = S( IR(0,n), IR(0,n) );
+    TileTriangularFactor( A2, tau, S11 );
+}
+
+// | C1 | := Q | C1 | or Q^H | C1 | for the reflectors of a subdiagonal tile
+// | C2 |      | C2 |        | C2 |
+template<typename F>
+inline void
+TileTSApply
+( Orientation orientation,
+  const Matrix<F>& V2, const Matrix<F>& S, Matrix<F>& C1, Matrix<F>& C2 )
+{
+    DEBUG_ONLY(CSE cse("qr::TileTSApply"))
+    const Int n = V2.Width();
+    auto S11 = S( IR(0,n), IR(0,n) );
+    Matrix<F> W( C1 );
+    Gemm( ADJOINT, NORMAL, F(1), V2, C2, F(1), W );
+    Trmm
+    ( LEFT, UPPER, (orientation==NORMAL ? NORMAL : ADJOINT), NON_UNIT,
+      F(1), S11, W );
+    Axpy( F(-1), W, C1 );
+    Gemm( NORMAL, NORMAL, F(-1), V2, W, F(1), C2 );
+}
+
+// Since the subdiagonal factorizations only modify the upper triangle of a
+// diagonal tile, the reflectors stored below its diagonal are tracked through
+// its triangular factor so that their application need not wait for them.
+
+template<typename F>
+inline void
+Tiled( TileMatrix<F>& A, TileMatrix<F>& T )
+{
+    DEBUG_ONLY(CSE cse("qr::Tiled"))
+    const Int mt = A.TileRows();
+    const Int nt = A.TileCols();
+    const Int nb = A.TileSize();
+    T.Resize( mt*nb, A.Width(), nb );
+
+    TaskGraph graph;
+    for( Int k=0; k<Min(mt,nt); ++k )
+    {
+        Matrix<F>& A11 = A.Tile(k,k);
+        Matrix<F>& S11 = T.Tile(k,k);
+        graph.Insert
+        ( [&A11,&S11]() { TileFactor( A11, S11 ); }, {}, {&A11,&S11}, -k );
+        for( Int j=k+1; j<nt; ++j )
+        {
+            Matrix<F>& A12 = A.Tile(k,j);
+            graph.Insert
+            ( [&A11,&S11,&A12]() { TileApply( ADJOINT, A11, S11, A12 ); },
+              {&S11}, {&A12}, -j );
+        }
+        for( Int i=k+1; i<mt; ++i )
+        {
+            Matrix<F>& A21 = A.Tile(i,k);
+            Matrix<F>& S21 = T.Tile(i,k);
+            graph.Insert
+            ( [&A11,&A21,&S21]()
+              {
+                  auto R11 = A11( IR(0,A11.Width()), ALL );
+                  TileTSFactor( R11, A21, S21 );
+              },
+              {}, {&A11,&A21,&S21}, -k );
+            for( Int j=k+1; j<nt; ++j )
+            {
+                Matrix<F>& A12 = A.Tile(k,j);
+                Matrix<F>& A22 = A.Tile(i,j);
+                graph.Insert
+                ( [&A21,&S21,&A12,&A22]()
+                  {
+                      auto A12T = A12( IR(0,A21.Width()), ALL );
+                      TileTSApply( ADJOINT, A21, S21, A12T, A22 );
+                  },
+                  {&A21,&S21}, {&A12,&A22}, -j );
+            }
+        }
+    }
+    graph.Run();
+}
+
+template<typename F>
+void ApplyQ
+( Orientation orientation,
+  const TileMatrix<F>& A, const TileMatrix<F>& T, TileMatrix<F>& B )
+{
+    DEBUG_ONLY(
+        CSE cse("qr::ApplyQ");
+        if( B.Height() != A.Height() || B.TileSize() != A.TileSize() )
+            LogicError("B must match the height and tiling of A");
+    )
+    const Int mt = A.TileRows();
+    const Int ntB = B.TileCols();
+    const Int numSteps = Min(mt,A.TileCols());
+    const bool adjoint = ( orientation != NORMAL );
+
+    TaskGraph graph;
+    auto applyDiagonal = [&]( Int k )
+      {
+          const Matrix<F>& A11 = A.Tile(k,k);
+          const Matrix<F>& S11 = T.Tile(k,k);
+          for( Int j=0; j<ntB; ++j )
+          {
+              Matrix<F>& B1 = B.Tile(k,j);
+              graph.Insert
+              ( [&A11,&S11,&B1,orientation]()
+                { TileApply( orientation, A11, S11, B1 ); },
+                {&A11,&S11}, {&B1} );
+          }
+      };
+    auto applySubdiagonal = [&]( Int i, Int k )
+      {
+          const Matrix<F>& A21 = A.Tile(i,k);
+          const Matrix<F>& S21 = T.Tile(i,k);
+          for( Int j=0; j<ntB; ++j )
+          {
+              Matrix<F>& B1 = B.Tile(k,j);
+              Matrix<F>& B2 = B.Tile(i,j);
+              graph.Insert
+              ( [&A21,&S21,&B1,&B2,orientation]()
+                {
+                    auto B1T = B1( IR(0,A21.Width()), ALL );
+                    TileTSApply( orientation, A21, S21, B1T, B2 );
+                },
+                {&A21,&S21}, {&B1,&B2} );
+          }
+      };
+    if( adjoint )
+    {
+        for( Int k=0; k<numSteps; ++k )
+        {
+            applyDiagonal( k );
+            for( Int i=k+1; i<mt; ++i )
+                applySubdiagonal( i, k );
+        }
+    }
+    else
+    {
+        for( Int k=numSteps-1; k>=0; --k )
+        {
+            for( Int i=mt-1; i>k; --i )
+                applySubdiagonal( i, k );
+            applyDiagonal( k );
+        }
+    }
+    graph.Run();
+}
+
+} // namespace qr
+} // namespace El
+
+#endif // ifndef EL_QR_TILED_HPP
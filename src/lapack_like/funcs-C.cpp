@@ -18,6 +18,9 @@ ElError ElSignCtrlDefault_s( ElSignCtrl_s* ctrl )
     ctrl->tol = 0;
     ctrl->power = 1;
     ctrl->scaling = EL_SIGN_SCALE_FROB;
+    ctrl->method = EL_SIGN_NEWTON;
+    ctrl->newtonSchulzTol = 0.5;
+    ctrl->zolotarevDegree = 0;
     ctrl->progress = false;
     return EL_SUCCESS;
 }
@@ -27,6 +30,9 @@ ElError ElSignCtrlDefault_d( ElSignCtrl_d* ctrl )
     ctrl->tol = 0;
     ctrl->power = 1;
     ctrl->scaling = EL_SIGN_SCALE_FROB;
+    ctrl->method = EL_SIGN_NEWTON;
+    ctrl->newtonSchulzTol = 0.5;
+    ctrl->zolotarevDegree = 0;
     ctrl->progress = false;
     return EL_SUCCESS;
 }
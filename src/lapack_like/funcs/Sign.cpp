@@ -16,6 +16,257 @@ namespace El {
 
 namespace sign {
 
+namespace zolotarev {
+
+// The arithmetic-geometric mean of 1 and b, which yields the complete elliptic
+// integral of the first kind as K(k) = pi/(2 AGM(1,sqrt(1-k^2)))
+template<typename Real>
+inline Real AGM( Real b )
+{
+    const Real eps = Epsilon<Real>();
+    Real a = 1;
+    for( Int it=0; it<64 && Abs(a-b) > 4*eps*a; ++it )
+    {
+        const Real aNew = (a+b)/2;
+        b = Sqrt(a*b);
+        a = aNew;
+    }
+    return a;
+}
+
+// Computes the Jacobi elliptic functions sn(u) and cn(u) for the modulus 
+// sqrt(1-lComp^2) and 0 <= u <= K'/2 using the descending Landen 
+// transformation (see Section 16.4 of Abramowitz and Stegun). When lComp is 
+// tiny, the first Landen step loses roughly half of the digits of cn(u), so 
+// the expansions of Section 16.15, whose relative truncation error is
+// O(lComp^2) over this range, are used instead.
+template<typename Real>
+inline void JacobiSnCn( Real u, Real lComp, Real& sn, Real& cn )
+{
+    const Real eps = Epsilon<Real>();
+    if( lComp <= Pow(eps,Real(1)/Real(3)) )
+    {
+        const Real tanhU = Tanh(u);
+        const Real sechU = 1/Cosh(u);
+        const Real corr = lComp*lComp*(Sinh(u)*Cosh(u)-u)/4;
+        sn = tanhU + corr*sechU*sechU;
+        cn = sechU - corr*tanhU*sechU;
+        return;
+    }
+    vector<Real> a(1,Real(1)), c(1,Sqrt((1-lComp)*(1+lComp)));
+    Real b = lComp;
+    while( Abs(c.back()) > 4*eps*a.back() && a.size() < 64 )
+    {
+        const Real aLast = a.back();
+        a.push_back( (aLast+b)/2 );
+        c.push_back( (aLast-b)/2 );
+        b = Sqrt(aLast*b);
+    }
+    const Int N = a.size()-1;
+    Real phi = Pow(Real(2),Real(N))*a[N]*u;
+    for( Int i=N; i>0; --i )
+        phi = (phi + Asin(c[i]/a[i]*Sin(phi)))/2;
+    sn = Sin(phi);
+    cn = Cos(phi);
+}
+
+} // namespace zolotarev
+
+template<typename Real>
+Real ZolotarevCoefficients( Int r, Real l, vector<Real>& c, vector<Real>& a )
+{
+    DEBUG_ONLY(
+        CSE cse("sign::ZolotarevCoefficients");
+        if( r < 1 )
+            LogicError("The Zolotarev degree must be positive");
+    )
+    const Real eps = Epsilon<Real>();
+    l = Min( Max( l, eps*eps ), Real(1) );
+
+    // The complete elliptic integral for the complementary modulus, 
+    // sqrt(1-l^2), is K' = pi/(2 AGM(1,l))
+    const Real KComp = Real(M_PI)/(2*zolotarev::AGM(l));
+
+    // The (2r) zeros and poles of f are +-i sqrt(cAll(k)), where
+    // cAll(k) = l^2 sc^2(u_k), with u_k = (k+1) K'/(2r+1). Near K', where cn is
+    // tiny, the reflection sc(K'-v) = cs(v)/l is used to preserve accuracy.
+    vector<Real> cAll(2*r);
+    for( Int k=0; k<2*r; ++k )
+    {
+        const Real u = (k+1)*KComp/(2*r+1);
+        Real sn, cn;
+        if( 2*(k+1) <= 2*r+1 )
+        {
+            zolotarev::JacobiSnCn( u, l, sn, cn );
+            cAll[k] = l*l*(sn/cn)*(sn/cn);
+        }
+        else
+        {
+            zolotarev::JacobiSnCn( KComp-u, l, sn, cn );
+            cAll[k] = (cn/sn)*(cn/sn);
+        }
+    }
+
+    // f(x) = M x prod_j (x^2 + cAll(2j+1))/(x^2 + cAll(2j))
+    //      = M x (1 + sum_j a(j)/(x^2 + cAll(2j)))
+    c.resize( r );
+    a.resize( r );
+    Real M = 1;
+    for( Int j=0; j<r; ++j )
+    {
+        c[j] = cAll[2*j];
+        M *= (1+cAll[2*j])/(1+cAll[2*j+1]);
+    }
+    for( Int j=0; j<r; ++j )
+    {
+        Real num=1, den=1;
+        for( Int k=0; k<r; ++k )
+        {
+            num *= cAll[2*j] - cAll[2*k+1];
+            if( k != j )
+                den *= cAll[2*j] - cAll[2*k];
+        }
+        a[j] = -num/den;
+    }
+    return M;
+}
+
+template<typename Real>
+Real ZolotarevEvaluate
+( Real x, Real M, const vector<Real>& c, const vector<Real>& a )
+{
+    DEBUG_ONLY(CSE cse("sign::ZolotarevEvaluate"))
+    Real sum = 1;
+    for( size_t j=0; j<c.size(); ++j )
+        sum += a[j]/(x*x+c[j]);
+    return M*x*sum;
+}
+
+template<typename Real>
+Int ZolotarevDegree( Real l, Real tol )
+{
+    DEBUG_ONLY(CSE cse("sign::ZolotarevDegree"))
+    const Int maxDegree = 8;
+    vector<Real> c, a;
+    for( Int r=1; r<maxDegree; ++r )
+    {
+        // Track the image of the lower bound of the interval through two
+        // iterations (the upper bound is fixed at one)
+        Real x = l;
+        for( Int it=0; it<2; ++it )
+        {
+            const Real M = ZolotarevCoefficients( r, x, c, a );
+            x = ZolotarevEvaluate( x, M, c, a );
+        }
+        if( 1-x <= tol )
+            return r;
+    }
+    return maxDegree;
+}
+
+// Hager's estimator of the one-norm of an implicit n x n operator, as refined
+// by Higham; 'apply' and 'applyAdj' overwrite a column vector with its image
+// under the operator and its adjoint. The result is a lower bound.
+template<typename F>
+Base<F> OneNormEstimate
+( Int n,
+  function<void(Matrix<F>&)> apply,
+  function<void(Matrix<F>&)> applyAdj )
+{
+    DEBUG_ONLY(CSE cse("sign::OneNormEstimate"))
+    typedef Base<F> Real;
+    if( n == 0 )
+        return Real(0);
+    auto sgn = []( F alpha )
+      { const Real absAlpha = Abs(alpha);
+        return absAlpha == Real(0) ? F(1) : alpha/absAlpha; };
+
+    Matrix<F> x, y, z;
+    Ones( x, n, 1 );
+    Scale( Real(1)/Real(n), x );
+    y = x;
+    apply( y );
+    Real est = OneNorm( y );
+    for( Int it=0; it<5; ++it )
+    {
+        z = y;
+        EntrywiseMap( z, function<F(F)>(sgn) );
+        applyAdj( z );
+        const ValueInt<Real> zMax = VectorMaxAbs( z );
+        if( it > 0 && zMax.value <= RealPart(Dot(z,x)) )
+            break;
+        Zeros( x, n, 1 );
+        x.Set( zMax.index, 0, F(1) );
+        y = x;
+        apply( y );
+        const Real newEst = OneNorm( y );
+        if( newEst <= est )
+            break;
+        est = newEst;
+    }
+
+    // Guard against the pathological cases of Hager's iteration
+    for( Int i=0; i<n; ++i )
+    {
+        const Real mag = 1 + (n>1 ? Real(i)/Real(n-1) : Real(0));
+        x.Set( i, 0, (i%2==0 ? mag : -mag) );
+    }
+    apply( x );
+    return Max( est, 2*OneNorm(x)/(3*n) );
+}
+
+template<typename F>
+Base<F> OneNormEstimate
+( const Grid& g, Int n,
+  function<void(DistMatrix<F>&)> apply,
+  function<void(DistMatrix<F>&)> applyAdj )
+{
+    DEBUG_ONLY(CSE cse("sign::OneNormEstimate"))
+    typedef Base<F> Real;
+    if( n == 0 )
+        return Real(0);
+    auto sgn = []( F alpha )
+      { const Real absAlpha = Abs(alpha);
+        return absAlpha == Real(0) ? F(1) : alpha/absAlpha; };
+
+    DistMatrix<F> x(g), y(g), z(g);
+    Ones( x, n, 1 );
+    Scale( Real(1)/Real(n), x );
+    y = x;
+    apply( y );
+    Real est = OneNorm( y );
+    for( Int it=0; it<5; ++it )
+    {
+        z = y;
+        EntrywiseMap( z, function<F(F)>(sgn) );
+        applyAdj( z );
+        const ValueInt<Real> zMax = VectorMaxAbs( z );
+        if( it > 0 && zMax.value <= RealPart(Dot(z,x)) )
+            break;
+        Zeros( x, n, 1 );
+        x.Set( zMax.index, 0, F(1) );
+        y = x;
+        apply( y );
+        const Real newEst = OneNorm( y );
+        if( newEst <= est )
+            break;
+        est = newEst;
+    }
+
+    // Guard against the pathological cases of Hager's iteration
+    if( x.LocalWidth() == 1 )
+    {
+        for( Int iLoc=0; iLoc<x.LocalHeight(); ++iLoc )
+        {
+            const Int i = x.GlobalRow(iLoc);
+            const Real mag = 1 + (n>1 ? Real(i)/Real(n-1) : Real(0));
+            x.SetLocal( iLoc, 0, (i%2==0 ? mag : -mag) );
+        }
+    }
+    apply( x );
+    return Max( est, 2*OneNorm(x)/(3*n) );
+}
+
 template<typename F>
 inline void
 NewtonStep
@@ -75,37 +326,181 @@ NewtonStep
     Axpy( halfMu, X, XNew );
 }
 
+// XTmp := 3I - X^2, returning || I - X^2 ||_1
 template<typename F>
-inline void
-NewtonSchulzStep( const Matrix<F>& X, Matrix<F>& XTmp, Matrix<F>& XNew )
+inline Base<F>
+NewtonSchulzSquare( const Matrix<F>& X, Matrix<F>& XTmp )
 {
-    DEBUG_ONLY(CSE cse("sign::NewtonSchulzStep"))
-    typedef Base<F> Real;
+    DEBUG_ONLY(CSE cse("sign::NewtonSchulzSquare"))
     const Int n = X.Height();
- 
-    // XTmp := 3I - X^2
     Identity( XTmp, n, n );
-    Gemm( NORMAL, NORMAL, Real(-1), X, X, Real(3), XTmp );
+    Gemm( NORMAL, NORMAL, F(-1), X, X, F(3), XTmp );
 
-    // XNew := 1/2 X XTmp
-    Gemm( NORMAL, NORMAL, Real(1)/Real(2), X, XTmp, XNew );
+    ShiftDiagonal( XTmp, F(-2) );
+    const Base<F> residual = OneNorm( XTmp );
+    ShiftDiagonal( XTmp, F(2) );
+    return residual;
+}
+
+template<typename F>
+inline Base<F>
+NewtonSchulzSquare( const DistMatrix<F>& X, DistMatrix<F>& XTmp )
+{
+    DEBUG_ONLY(CSE cse("sign::NewtonSchulzSquare"))
+    const Int n = X.Height();
+    Identity( XTmp, n, n );
+    Gemm( NORMAL, NORMAL, F(-1), X, X, F(3), XTmp );
+
+    ShiftDiagonal( XTmp, F(-2) );
+    const Base<F> residual = OneNorm( XTmp );
+    ShiftDiagonal( XTmp, F(2) );
+    return residual;
+}
+
+// XNew := 1/2 X XTmp, where XTmp = 3I - X^2
+template<typename F>
+inline void
+NewtonSchulzStep( const Matrix<F>& X, const Matrix<F>& XTmp, Matrix<F>& XNew )
+{
+    DEBUG_ONLY(CSE cse("sign::NewtonSchulzStep"))
+    Gemm( NORMAL, NORMAL, F(1)/F(2), X, XTmp, XNew );
 }
 
 template<typename F>
 inline void
 NewtonSchulzStep
-( const DistMatrix<F>& X, DistMatrix<F>& XTmp, DistMatrix<F>& XNew )
+( const DistMatrix<F>& X, const DistMatrix<F>& XTmp, DistMatrix<F>& XNew )
 {
     DEBUG_ONLY(CSE cse("sign::NewtonSchulzStep"))
+    Gemm( NORMAL, NORMAL, F(1)/F(2), X, XTmp, XNew );
+}
+
+// The first Zolotarev step scales X by alpha >= || X ||_2 and sets
+// l = 1/(alpha beta), where beta >= || inv(X) ||_2, so that the moduli of the
+// eigenvalues of X/alpha lie in [l,1]. Each step then applies the rational 
+// function f which best approximates sgn(x) over [-1,-l] U [l,1], i.e.,
+//
+//   XNew = (M/alpha) X + M alpha sum_j a(j) inv(X^2 + alpha^2 c(j) I) X,
+//
+// and the real eigenvalues of XNew lie in [f(l),1], so that l := f(l) and 
+// alpha := 1 for all subsequent steps. For matrices with real spectra, two
+// steps suffice for the degree chosen by ZolotarevDegree, and the shifted 
+// solves within each step are independent. Since f is a positive combination 
+// of x and x/(x^2+c) = 1/(x+c/x), it maps the open right and left half-planes
+// to themselves, and, as l approaches one, f approaches the principal Pade 
+// iteration of degree 2r+1, which converges over each entire half-plane.
+// 
+// See Nakatsukasa and Freund's "Computing fundamental matrix decompositions 
+// accurately via the matrix sign function in two iterations: The power of
+// Zolotarev's functions".
+
+template<typename F>
+inline void
+ZolotarevStep
+( const Matrix<F>& X, Matrix<F>& XNew, Int& degree, Base<F>& l, 
+  Base<F> tol )
+{
+    DEBUG_ONLY(CSE cse("sign::ZolotarevStep"))
     typedef Base<F> Real;
-    const Int n = X.Height();
 
-    // XTmp := 3I - X^2
-    Identity( XTmp, n, n );
-    Gemm( NORMAL, NORMAL, Real(-1), X, X, Real(3), XTmp );
+    Real alpha = 1;
+    if( l == Real(0) )
+    {
+        // Bound the extremal singular values, estimating the norms of inv(X)
+        // from a single LU factorization. Since the estimates are lower
+        // bounds, l may overshoot sigma_min(X)/alpha, which at worst costs
+        // an additional iteration.
+        const Int n = X.Height();
+        Matrix<F> XLU( X );
+        Matrix<Int> pX;
+        LU( XLU, pX );
+        auto solve = [&]( Matrix<F>& y )
+          { lu::SolveAfter( NORMAL, XLU, pX, y ); };
+        auto solveAdj = [&]( Matrix<F>& y )
+          { lu::SolveAfter( ADJOINT, XLU, pX, y ); };
+        const Real invOneNorm = OneNormEstimate<F>( n, solve, solveAdj );
+        const Real invInfNorm = OneNormEstimate<F>( n, solveAdj, solve );
+        alpha = Sqrt(OneNorm(X)*InfinityNorm(X));
+        const Real beta = Sqrt(invOneNorm*invInfNorm);
+        l = Min( Real(1)/(alpha*beta), Real(1) );
+    }
+    if( degree == 0 )
+        degree = ZolotarevDegree( l, tol );
+    vector<Real> c, a;
+    const Real M = ZolotarevCoefficients( degree, l, c, a );
+    l = Min( ZolotarevEvaluate( l, M, c, a ), Real(1) );
+
+    Matrix<F> XSquared;
+    Gemm( NORMAL, NORMAL, F(1), X, X, XSquared );
+    XNew = X;
+    Scale( M/alpha, XNew );
 
-    // XNew := 1/2 X XTmp
-    Gemm( NORMAL, NORMAL, Real(1)/Real(2), X, XTmp, XNew );
+    Matrix<Int> p;
+    Matrix<F> T, Y;
+    for( Int j=0; j<degree; ++j )
+    {
+        T = XSquared;
+        ShiftDiagonal( T, F(alpha*alpha*c[j]) );
+        LU( T, p );
+        Y = X;
+        lu::SolveAfter( NORMAL, T, p, Y );
+        Axpy( M*alpha*a[j], Y, XNew );
+    }
+}
+
+template<typename F>
+inline void
+ZolotarevStep
+( const DistMatrix<F>& X, DistMatrix<F>& XNew, Int& degree, Base<F>& l,
+  Base<F> tol )
+{
+    DEBUG_ONLY(CSE cse("sign::ZolotarevStep"))
+    typedef Base<F> Real;
+    const Grid& g = X.Grid();
+
+    Real alpha = 1;
+    if( l == Real(0) )
+    {
+        // Bound the extremal singular values, estimating the norms of inv(X)
+        // from a single LU factorization. Since the estimates are lower
+        // bounds, l may overshoot sigma_min(X)/alpha, which at worst costs
+        // an additional iteration.
+        const Int n = X.Height();
+        DistMatrix<F> XLU( X );
+        DistMatrix<Int,VC,STAR> pX(g);
+        LU( XLU, pX );
+        auto solve = [&]( DistMatrix<F>& y )
+          { lu::SolveAfter( NORMAL, XLU, pX, y ); };
+        auto solveAdj = [&]( DistMatrix<F>& y )
+          { lu::SolveAfter( ADJOINT, XLU, pX, y ); };
+        const Real invOneNorm = OneNormEstimate<F>( g, n, solve, solveAdj );
+        const Real invInfNorm = OneNormEstimate<F>( g, n, solveAdj, solve );
+        alpha = Sqrt(OneNorm(X)*InfinityNorm(X));
+        const Real beta = Sqrt(invOneNorm*invInfNorm);
+        l = Min( Real(1)/(alpha*beta), Real(1) );
+    }
+    if( degree == 0 )
+        degree = ZolotarevDegree( l, tol );
+    vector<Real> c, a;
+    const Real M = ZolotarevCoefficients( degree, l, c, a );
+    l = Min( ZolotarevEvaluate( l, M, c, a ), Real(1) );
+
+    DistMatrix<F> XSquared(g);
+    Gemm( NORMAL, NORMAL, F(1), X, X, XSquared );
+    XNew = X;
+    Scale( M/alpha, XNew );
+
+    DistMatrix<Int,VC,STAR> p(g);
+    DistMatrix<F> T(g), Y(g);
+    for( Int j=0; j<degree; ++j )
+    {
+        T = XSquared;
+        ShiftDiagonal( T, F(alpha*alpha*c[j]) );
+        LU( T, p );
+        Y = X;
+        lu::SolveAfter( NORMAL, T, p, Y );
+        Axpy( M*alpha*a[j], Y, XNew );
+    }
 }
 
 // Please see Chapter 5 of Higham's 
@@ -189,7 +584,214 @@ Newton( DistMatrix<F>& A, const SignCtrl<Base<F>>& ctrl )
     return numIts;
 }
 
-// TODO: NewtonSchulzHybrid which estimates when || X^2 - I ||_2 < 1
+// Near convergence, the Newton updates approximate X - sgn(X), and so
+// 2 || X ||_1 || XNew - X ||_1 estimates || I - X^2 ||_1; X^2 is only formed 
+// once this estimate is small, and, once || I - X^2 ||_1 is verified to be 
+// at most ctrl.newtonSchulzTol, the inversion-free (and Gemm-rich) 
+// Newton-Schulz iteration takes over.
+template<typename F>
+inline Int
+NewtonSchulzHybrid( Matrix<F>& A, const SignCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("sign::NewtonSchulzHybrid"))
+    typedef Base<F> Real;
+    Real tol = ctrl.tol;
+    if( tol == Real(0) )
+        tol = A.Height()*Epsilon<Real>();
+
+    Int numIts=0;
+    bool schulz=false;
+    Matrix<F> B, XTmp;
+    Matrix<F> *X=&A, *XNew=&B;
+    while( numIts < ctrl.maxIts )
+    {
+        // Overwrite XNew with the new iterate
+        const bool schulzStep = schulz;
+        if( schulzStep )
+            NewtonSchulzStep( *X, XTmp, *XNew );
+        else
+            NewtonStep( *X, *XNew, ctrl.scaling );
+
+        // Use the difference in the iterates to test for convergence
+        Axpy( Real(-1), *XNew, *X );
+        const Real oneDiff = OneNorm( *X );
+        const Real oneNew = OneNorm( *XNew );
+
+        // Ensure that X holds the current iterate and break if possible
+        ++numIts;
+        std::swap( X, XNew );
+        if( ctrl.progress )
+            cout << "after " << numIts 
+                 << (schulzStep ? " Newton-Schulz" : " Newton") << " iter's: "
+                 << "oneDiff=" << oneDiff << ", oneNew=" << oneNew 
+                 << ", oneDiff/oneNew=" << oneDiff/oneNew << ", tol=" 
+                 << tol << endl;
+        if( oneDiff/oneNew <= Pow(oneNew,ctrl.power)*tol )
+            break;
+
+        if( schulz || 2*oneNew*oneDiff <= ctrl.newtonSchulzTol )
+            schulz = ( NewtonSchulzSquare( *X, XTmp ) <= ctrl.newtonSchulzTol );
+    }
+    if( X != &A )
+        A = *X;
+    return numIts;
+}
+
+template<typename F>
+inline Int
+NewtonSchulzHybrid( DistMatrix<F>& A, const SignCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("sign::NewtonSchulzHybrid"))
+    typedef Base<F> Real;
+    Real tol = ctrl.tol;
+    if( tol == Real(0) )
+        tol = A.Height()*Epsilon<Real>();
+
+    Int numIts=0;
+    bool schulz=false;
+    DistMatrix<F> B( A.Grid() ), XTmp( A.Grid() );
+    DistMatrix<F> *X=&A, *XNew=&B;
+    while( numIts < ctrl.maxIts )
+    {
+        // Overwrite XNew with the new iterate
+        const bool schulzStep = schulz;
+        if( schulzStep )
+            NewtonSchulzStep( *X, XTmp, *XNew );
+        else
+            NewtonStep( *X, *XNew, ctrl.scaling );
+
+        // Use the difference in the iterates to test for convergence
+        Axpy( Real(-1), *XNew, *X );
+        const Real oneDiff = OneNorm( *X );
+        const Real oneNew = OneNorm( *XNew );
+
+        // Ensure that X holds the current iterate and break if possible
+        ++numIts;
+        std::swap( X, XNew );
+        if( ctrl.progress && A.Grid().Rank() == 0 )
+            cout << "after " << numIts 
+                 << (schulzStep ? " Newton-Schulz" : " Newton") << " iter's: "
+                 << "oneDiff=" << oneDiff << ", oneNew=" << oneNew 
+                 << ", oneDiff/oneNew=" << oneDiff/oneNew << ", tol=" 
+                 << tol << endl;
+        if( oneDiff/oneNew <= Pow(oneNew,ctrl.power)*tol )
+            break;
+
+        if( schulz || 2*oneNew*oneDiff <= ctrl.newtonSchulzTol )
+            schulz = ( NewtonSchulzSquare( *X, XTmp ) <= ctrl.newtonSchulzTol );
+    }
+    if( X != &A )
+        A = *X;
+    return numIts;
+}
+
+template<typename F>
+inline Int
+Zolotarev( Matrix<F>& A, const SignCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("sign::Zolotarev"))
+    typedef Base<F> Real;
+    Real tol = ctrl.tol;
+    if( tol == Real(0) )
+        tol = A.Height()*Epsilon<Real>();
+
+    Int numIts=0, degree=ctrl.zolotarevDegree;
+    Real l=0;
+    Matrix<F> B;
+    Matrix<F> *X=&A, *XNew=&B;
+    while( numIts < ctrl.maxIts )
+    {
+        // Overwrite XNew with the new iterate
+        ZolotarevStep( *X, *XNew, degree, l, tol );
+
+        // Use the difference in the iterates to test for convergence
+        Axpy( Real(-1), *XNew, *X );
+        const Real oneDiff = OneNorm( *X );
+        const Real oneNew = OneNorm( *XNew );
+
+        // Ensure that X holds the current iterate and break if possible
+        ++numIts;
+        std::swap( X, XNew );
+        if( ctrl.progress )
+            cout << "after " << numIts << " Zolotarev iter's (degree " 
+                 << degree << "): oneDiff=" << oneDiff 
+                 << ", oneNew=" << oneNew 
+                 << ", oneDiff/oneNew=" << oneDiff/oneNew << ", tol=" 
+                 << tol << endl;
+        if( oneDiff/oneNew <= Pow(oneNew,ctrl.power)*tol )
+            break;
+    }
+    if( X != &A )
+        A = *X;
+    return numIts;
+}
+
+template<typename F>
+inline Int
+Zolotarev( DistMatrix<F>& A, const SignCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("sign::Zolotarev"))
+    typedef Base<F> Real;
+    Real tol = ctrl.tol;
+    if( tol == Real(0) )
+        tol = A.Height()*Epsilon<Real>();
+
+    Int numIts=0, degree=ctrl.zolotarevDegree;
+    Real l=0;
+    DistMatrix<F> B( A.Grid() );
+    DistMatrix<F> *X=&A, *XNew=&B;
+    while( numIts < ctrl.maxIts )
+    {
+        // Overwrite XNew with the new iterate
+        ZolotarevStep( *X, *XNew, degree, l, tol );
+
+        // Use the difference in the iterates to test for convergence
+        Axpy( Real(-1), *XNew, *X );
+        const Real oneDiff = OneNorm( *X );
+        const Real oneNew = OneNorm( *XNew );
+
+        // Ensure that X holds the current iterate and break if possible
+        ++numIts;
+        std::swap( X, XNew );
+        if( ctrl.progress && A.Grid().Rank() == 0 )
+            cout << "after " << numIts << " Zolotarev iter's (degree " 
+                 << degree << "): oneDiff=" << oneDiff 
+                 << ", oneNew=" << oneNew 
+                 << ", oneDiff/oneNew=" << oneDiff/oneNew << ", tol=" 
+                 << tol << endl;
+        if( oneDiff/oneNew <= Pow(oneNew,ctrl.power)*tol )
+            break;
+    }
+    if( X != &A )
+        A = *X;
+    return numIts;
+}
+
+template<typename F>
+inline Int
+Iterate( Matrix<F>& A, const SignCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("sign::Iterate"))
+    if( ctrl.method == SIGN_NEWTON_SCHULZ )
+        return NewtonSchulzHybrid( A, ctrl );
+    else if( ctrl.method == SIGN_ZOLOTAREV )
+        return Zolotarev( A, ctrl );
+    else
+        return Newton( A, ctrl );
+}
+
+template<typename F>
+inline Int
+Iterate( DistMatrix<F>& A, const SignCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("sign::Iterate"))
+    if( ctrl.method == SIGN_NEWTON_SCHULZ )
+        return NewtonSchulzHybrid( A, ctrl );
+    else if( ctrl.method == SIGN_ZOLOTAREV )
+        return Zolotarev( A, ctrl );
+    else
+        return Newton( A, ctrl );
+}
 
 } // namespace sign
 
@@ -197,7 +799,7 @@ template<typename F>
 void Sign( Matrix<F>& A, const SignCtrl<Base<F>> ctrl )
 {
     DEBUG_ONLY(CSE cse("Sign"))
-    sign::Newton( A, ctrl );
+    sign::Iterate( A, ctrl );
 }
 
 template<typename F>
@@ -205,7 +807,7 @@ void Sign( Matrix<F>& A, Matrix<F>& N, const SignCtrl<Base<F>> ctrl )
 {
     DEBUG_ONLY(CSE cse("Sign"))
     Matrix<F> ACopy( A );
-    sign::Newton( A, ctrl );
+    sign::Iterate( A, ctrl );
     Gemm( NORMAL, NORMAL, F(1), A, ACopy, N );
 }
 
@@ -217,7 +819,7 @@ void Sign( AbstractDistMatrix<F>& APre, const SignCtrl<Base<F>> ctrl )
     auto APtr = ReadWriteProxy<F,MC,MR>( &APre );
     auto& A = *APtr;
 
-    sign::Newton( A, ctrl );
+    sign::Iterate( A, ctrl );
 }
 
 template<typename F>
@@ -231,7 +833,7 @@ void Sign
     auto NPtr = WriteProxy<F,MC,MR>( &NPre );     auto& N = *NPtr;
 
     DistMatrix<F> ACopy( A );
-    sign::Newton( A, ctrl );
+    sign::Iterate( A, ctrl );
     Gemm( NORMAL, NORMAL, F(1), A, ACopy, N );
 }
 
@@ -383,6 +985,14 @@ void HermitianSign
     HermitianFromEVD( uplo, N, wAbs, Z );
 }
 
+#define PROTO_REAL(Real) \
+  PROTO(Real) \
+  template Real sign::ZolotarevCoefficients \
+  ( Int r, Real l, vector<Real>& c, vector<Real>& a ); \
+  template Real sign::ZolotarevEvaluate \
+  ( Real x, Real M, const vector<Real>& c, const vector<Real>& a ); \
+  template Int sign::ZolotarevDegree( Real l, Real tol );
+
 #define PROTO(F) \
   template void Sign \
   ( Matrix<F>& A, const SignCtrl<Base<F>> ctrl ); \
@@ -404,7 +1014,15 @@ void HermitianSign
     const HermitianEigCtrl<F>& ctrl ); \
   template void HermitianSign \
   ( UpperOrLower uplo, AbstractDistMatrix<F>& A, AbstractDistMatrix<F>& N, \
-    const HermitianEigCtrl<F>& ctrl );
+    const HermitianEigCtrl<F>& ctrl ); \
+  template Base<F> sign::OneNormEstimate \
+  ( Int n, \
+    function<void(Matrix<F>&)> apply, \
+    function<void(Matrix<F>&)> applyAdj ); \
+  template Base<F> sign::OneNormEstimate \
+  ( const Grid& g, Int n, \
+    function<void(DistMatrix<F>&)> apply, \
+    function<void(DistMatrix<F>&)> applyAdj );
 
 #define EL_NO_INT_PROTO
 #include "El/macros/Instantiate.h"
@@ -8,6 +8,8 @@
 */
 #include "El.hpp"
 
+#include "./MixedPrecision.hpp"
+
 namespace El {
 
 namespace hpd_solve {
@@ -58,6 +60,126 @@ void HPDSolve
     hpd_solve::Overwrite( uplo, orientation, ACopy, B );
 }
 
+template<typename F>
+Int HPDSolve
+( UpperOrLower uplo, Orientation orientation, 
+  const Matrix<F>& A, Matrix<F>& B, const MixedPrecisionCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(
+      CSE cse("HPDSolve");
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+      if( A.Height() != B.Height() )
+          LogicError("A and B must be the same height");
+    )
+    typedef typename mixed_solve::LowerPrecision<F>::type FLow;
+
+    // Since A is Hermitian, A^T X = B is equivalent to A conj(X) = conj(B)
+    if( orientation == TRANSPOSE )
+        Conjugate( B );
+
+    Matrix<FLow> ALow;
+    bool factored = 
+      mixed_solve::FitsLowerPrecision<F>( HermitianMaxNorm(uplo,A) );
+    if( factored )
+    {
+        Copy( A, ALow );
+        try { Cholesky( uplo, ALow ); }
+        catch( NonHPDMatrixException& e ) { factored = false; }
+    }
+    Int numIts = -1;
+    if( factored )
+    {
+        auto applyA = [&]( const Matrix<F>& X, Matrix<F>& Y )
+          { Hemm( LEFT, uplo, F(-1), A, X, F(1), Y ); };
+        auto solveLow = [&]( Matrix<F>& Y )
+          {
+              Matrix<FLow> YLow;
+              Copy( Y, YLow );
+              cholesky::SolveAfter( uplo, NORMAL, ALow, YLow );
+              Copy( YLow, Y );
+          };
+        Matrix<F> X;
+        numIts = mixed_solve::Refine<F>
+          ( applyA, solveLow, HermitianFrobeniusNorm(uplo,A), B, X, ctrl );
+        if( numIts >= 0 )
+            B = X;
+    }
+    if( numIts < 0 )
+    {
+        if( ctrl.progress )
+            cout << "    falling back to a working-precision solve" << endl;
+        HPDSolve( uplo, NORMAL, A, B );
+    }
+
+    if( orientation == TRANSPOSE )
+        Conjugate( B );
+    return numIts;
+}
+
+template<typename F>
+Int HPDSolve
+( UpperOrLower uplo, Orientation orientation, 
+  const AbstractDistMatrix<F>& APre, AbstractDistMatrix<F>& BPre,
+  const MixedPrecisionCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(
+      CSE cse("HPDSolve");
+      AssertSameGrids( APre, BPre );
+      if( APre.Height() != APre.Width() )
+          LogicError("A must be square");
+      if( APre.Height() != BPre.Height() )
+          LogicError("A and B must be the same height");
+    )
+    typedef typename mixed_solve::LowerPrecision<F>::type FLow;
+
+    auto APtr = ReadProxy<F,MC,MR>( &APre );      auto& A = *APtr;
+    auto BPtr = ReadWriteProxy<F,MC,MR>( &BPre ); auto& B = *BPtr;
+    const Grid& g = A.Grid();
+
+    // Since A is Hermitian, A^T X = B is equivalent to A conj(X) = conj(B)
+    if( orientation == TRANSPOSE )
+        Conjugate( B );
+
+    DistMatrix<FLow> ALow(g);
+    bool factored = 
+      mixed_solve::FitsLowerPrecision<F>( HermitianMaxNorm(uplo,A) );
+    if( factored )
+    {
+        Copy( A, ALow );
+        try { Cholesky( uplo, ALow ); }
+        catch( NonHPDMatrixException& e ) { factored = false; }
+    }
+    Int numIts = -1;
+    if( factored )
+    {
+        auto applyA = [&]( const DistMatrix<F>& X, DistMatrix<F>& Y )
+          { Hemm( LEFT, uplo, F(-1), A, X, F(1), Y ); };
+        auto solveLow = [&]( DistMatrix<F>& Y )
+          {
+              DistMatrix<FLow> YLow(g);
+              Copy( Y, YLow );
+              cholesky::SolveAfter( uplo, NORMAL, ALow, YLow );
+              Copy( YLow, Y );
+          };
+        DistMatrix<F> X(g);
+        numIts = mixed_solve::Refine<F>
+          ( applyA, solveLow, HermitianFrobeniusNorm(uplo,A), B, X, ctrl );
+        if( numIts >= 0 )
+            B = X;
+    }
+    if( numIts < 0 )
+    {
+        if( ctrl.progress && g.Rank() == 0 )
+            cout << "    falling back to a working-precision solve" << endl;
+        HPDSolve( uplo, NORMAL, A, B );
+    }
+
+    if( orientation == TRANSPOSE )
+        Conjugate( B );
+    return numIts;
+}
+
 // TODO: Add iterative refinement parameter
 template<typename F>
 void HPDSolve
@@ -121,6 +243,14 @@ void HPDSolve
   template void HPDSolve \
   ( UpperOrLower uplo, Orientation orientation, \
     const AbstractDistMatrix<F>& A, AbstractDistMatrix<F>& B ); \
+  template Int HPDSolve \
+  ( UpperOrLower uplo, Orientation orientation, \
+    const Matrix<F>& A, Matrix<F>& B, \
+    const MixedPrecisionCtrl<Base<F>>& ctrl ); \
+  template Int HPDSolve \
+  ( UpperOrLower uplo, Orientation orientation, \
+    const AbstractDistMatrix<F>& A, AbstractDistMatrix<F>& B, \
+    const MixedPrecisionCtrl<Base<F>>& ctrl ); \
   template void HPDSolve \
   ( const SparseMatrix<F>& A, Matrix<F>& B, const BisectCtrl& ctrl ); \
   template void HPDSolve \
@@ -8,6 +8,8 @@
 */
 #include "El.hpp"
 
+#include "./MixedPrecision.hpp"
+
 namespace El {
 
 namespace lu {
@@ -50,14 +52,16 @@ RowEchelon( Matrix<F>& A, Matrix<F>& B )
         auto A12 = A( ind1, ind2 );
         auto A21 = A( ind2, ind1 );
         auto A22 = A( ind2, ind2 ); 
+        auto AB1 = A( indB, ind1 );
         auto AB2 = A( indB, ind2 );
         auto B1  = B( ind1, ALL );
         auto B2  = B( ind2, ALL );
         auto BB  = B( indB, ALL );
 
-        lu::Panel( AB2, p1Piv );
+        lu::Panel( AB1, p1Piv );
         PivotsToPartialPermutation( p1Piv, p1, p1Inv ); 
-        PermuteRows( BB, p1, p1Inv );
+        PermuteRows( AB2, p1, p1Inv );
+        PermuteRows( BB,  p1, p1Inv );
 
         Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), A11, A12 );
         Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), A11, B1 );
@@ -196,6 +200,108 @@ void LinearSolve
     lin_solve::Overwrite( ACopy, B );
 }
 
+template<typename F> 
+Int LinearSolve
+( const Matrix<F>& A, Matrix<F>& B, const MixedPrecisionCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(
+      CSE cse("LinearSolve");
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+      if( A.Height() != B.Height() )
+          LogicError("A and B must be the same height");
+    )
+    typedef typename mixed_solve::LowerPrecision<F>::type FLow;
+
+    Matrix<FLow> ALow;
+    Matrix<Int> p;
+    bool factored = mixed_solve::FitsLowerPrecision<F>( MaxNorm(A) );
+    if( factored )
+    {
+        Copy( A, ALow );
+        try { LU( ALow, p ); }
+        catch( SingularMatrixException& e ) { factored = false; }
+    }
+    if( factored )
+    {
+        auto applyA = [&]( const Matrix<F>& X, Matrix<F>& Y )
+          { Gemm( NORMAL, NORMAL, F(-1), A, X, F(1), Y ); };
+        auto solveLow = [&]( Matrix<F>& Y )
+          {
+              Matrix<FLow> YLow;
+              Copy( Y, YLow );
+              lu::SolveAfter( NORMAL, ALow, p, YLow );
+              Copy( YLow, Y );
+          };
+        Matrix<F> X;
+        const Int numIts = mixed_solve::Refine<F>
+          ( applyA, solveLow, FrobeniusNorm(A), B, X, ctrl );
+        if( numIts >= 0 )
+        {
+            B = X;
+            return numIts;
+        }
+    }
+    if( ctrl.progress )
+        cout << "    falling back to a working-precision solve" << endl;
+    LinearSolve( A, B );
+    return -1;
+}
+
+template<typename F> 
+Int LinearSolve
+( const AbstractDistMatrix<F>& APre, AbstractDistMatrix<F>& BPre,
+  const MixedPrecisionCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(
+      CSE cse("LinearSolve");
+      AssertSameGrids( APre, BPre );
+      if( APre.Height() != APre.Width() )
+          LogicError("A must be square");
+      if( APre.Height() != BPre.Height() )
+          LogicError("A and B must be the same height");
+    )
+    typedef typename mixed_solve::LowerPrecision<F>::type FLow;
+
+    auto APtr = ReadProxy<F,MC,MR>( &APre );      auto& A = *APtr;
+    auto BPtr = ReadWriteProxy<F,MC,MR>( &BPre ); auto& B = *BPtr;
+    const Grid& g = A.Grid();
+
+    DistMatrix<FLow> ALow(g);
+    DistMatrix<Int,VC,STAR> p(g);
+    bool factored = mixed_solve::FitsLowerPrecision<F>( MaxNorm(A) );
+    if( factored )
+    {
+        Copy( A, ALow );
+        try { LU( ALow, p ); }
+        catch( SingularMatrixException& e ) { factored = false; }
+    }
+    if( factored )
+    {
+        auto applyA = [&]( const DistMatrix<F>& X, DistMatrix<F>& Y )
+          { Gemm( NORMAL, NORMAL, F(-1), A, X, F(1), Y ); };
+        auto solveLow = [&]( DistMatrix<F>& Y )
+          {
+              DistMatrix<FLow> YLow(g);
+              Copy( Y, YLow );
+              lu::SolveAfter( NORMAL, ALow, p, YLow );
+              Copy( YLow, Y );
+          };
+        DistMatrix<F> X(g);
+        const Int numIts = mixed_solve::Refine<F>
+          ( applyA, solveLow, FrobeniusNorm(A), B, X, ctrl );
+        if( numIts >= 0 )
+        {
+            B = X;
+            return numIts;
+        }
+    }
+    if( ctrl.progress && g.Rank() == 0 )
+        cout << "    falling back to a working-precision solve" << endl;
+    LinearSolve( A, B );
+    return -1;
+}
+
 template<typename F>
 void LinearSolve
 ( const SparseMatrix<F>& A, Matrix<F>& B, 
@@ -226,6 +332,12 @@ void LinearSolve
   template void LinearSolve( const Matrix<F>& A, Matrix<F>& B ); \
   template void LinearSolve \
   ( const AbstractDistMatrix<F>& A, AbstractDistMatrix<F>& B ); \
+  template Int LinearSolve \
+  ( const Matrix<F>& A, Matrix<F>& B, \
+    const MixedPrecisionCtrl<Base<F>>& ctrl ); \
+  template Int LinearSolve \
+  ( const AbstractDistMatrix<F>& A, AbstractDistMatrix<F>& B, \
+    const MixedPrecisionCtrl<Base<F>>& ctrl ); \
   template void LinearSolve \
   ( const SparseMatrix<F>& A, Matrix<F>& B, \
     const LeastSquaresCtrl<Base<F>>& ctrl ); \
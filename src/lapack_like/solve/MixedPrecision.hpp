@@ -0,0 +1,242 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_SOLVE_MIXEDPRECISION_HPP
+#define EL_SOLVE_MIXEDPRECISION_HPP
+
+// Iterative refinement of the solution of A X = B using a factorization of A
+// in a lower precision, where the residuals and corrections are accumulated
+// in the working precision. The factorization is hidden behind a functor
+// which overwrites a working-precision matrix Y with inv(M) Y, and A is
+// similarly only accessed through a functor which performs Y := Y - A X, so
+// that the same driver is used for LU and Cholesky, and for both Matrix and
+// DistMatrix.
+
+namespace El {
+namespace mixed_solve {
+
+// The precision of the factorization (a type without a lower precision is
+// refined against a factorization in its own precision)
+template<typename F> struct LowerPrecision { typedef F type; };
+template<> struct LowerPrecision<double> { typedef float type; };
+template<> struct LowerPrecision<Complex<double>>
+{ typedef Complex<float> type; };
+
+// Whether a matrix with entries no larger than maxAbs in magnitude may be
+// safely converted to (and factored in) the lower precision
+template<typename F>
+inline bool FitsLowerPrecision( Base<F> maxAbs )
+{
+    typedef Base<typename LowerPrecision<F>::type> RealLow;
+    const Base<F> overflow = Base<F>(1)/lapack::MachineSafeMin<RealLow>();
+    return maxAbs < overflow;
+}
+
+template<typename F>
+inline bool IsRoot( const Matrix<F>& X ) { return true; }
+template<typename F>
+inline bool IsRoot( const DistMatrix<F>& X ) { return X.Grid().Rank() == 0; }
+
+// Return the two-norms of the columns of X on every process
+template<typename F>
+inline void AllColumnNorms( const Matrix<F>& X, Matrix<Base<F>>& norms )
+{ ColumnNorms( X, norms ); }
+
+template<typename F>
+inline void AllColumnNorms( const DistMatrix<F>& X, Matrix<Base<F>>& norms )
+{
+    DistMatrix<Base<F>,MR,STAR> normsDist( X.Grid() );
+    ColumnNorms( X, normsDist );
+    DistMatrix<Base<F>,STAR,STAR> norms_STAR_STAR( normsDist );
+    norms = norms_STAR_STAR.Matrix();
+}
+
+// Y := inv(M) Y, where Y is scaled so that the conversion of a (small)
+// residual to the lower precision does not underflow
+template<typename F,class MatrixType,class SolveType>
+inline void ScaledSolve( const SolveType& solveLow, MatrixType& Y )
+{
+    typedef Base<F> Real;
+    const Real maxAbs = MaxNorm( Y );
+    if( maxAbs == Real(0) )
+        return;
+    Scale( Real(1)/maxAbs, Y );
+    solveLow( Y );
+    Scale( maxAbs, Y );
+}
+
+// Solve A d = r with GMRES (without restarts) preconditioned on the left by
+// the low-precision factorization
+template<typename F,class MatrixType,class ApplyAType,class SolveType>
+inline void GMRES
+( const ApplyAType& applyA, const SolveType& solveLow,
+  const MatrixType& r, MatrixType& d,
+  Base<F> relTol, Int maxIts )
+{
+    DEBUG_ONLY(CSE cse("mixed_solve::GMRES"))
+    typedef Base<F> Real;
+
+    // The Krylov basis is stored as separate vectors so that they share a
+    // common alignment
+    MatrixType w( r );
+    ScaledSolve<F>( solveLow, w );
+    const Real beta = Nrm2( w );
+    d = w;
+    Zero( d );
+    if( beta == Real(0) )
+        return;
+    vector<MatrixType> V( 1, w );
+    Scale( Real(1)/beta, V[0] );
+
+    Matrix<Real> cs;
+    Matrix<F> sn, H, t;
+    Zeros( cs, maxIts, 1 );
+    Zeros( sn, maxIts, 1 );
+    Zeros( H, maxIts, maxIts );
+    Zeros( t, maxIts+1, 1 );
+    t.Set( 0, 0, beta );
+
+    Int numIts = 0;
+    for( Int j=0; j<maxIts; ++j )
+    {
+        // w := inv(M) A v_j
+        Zero( w );
+        applyA( V[j], w );
+        Scale( F(-1), w );
+        ScaledSolve<F>( solveLow, w );
+
+        // Run the j'th step of (modified Gram-Schmidt) Arnoldi
+        for( Int i=0; i<=j; ++i )
+        {
+            H.Set( i, j, Dot(V[i],w) );
+            Axpy( -H.Get(i,j), V[i], w );
+        }
+        const Real delta = Nrm2( w );
+        V.push_back( w );
+        if( delta > Real(0) )
+            Scale( Real(1)/delta, V[j+1] );
+
+        // Apply the previous rotations to the new column of H, and then
+        // generate and apply one which annihilates its subdiagonal
+        for( Int i=0; i<j; ++i )
+        {
+            const Real c = cs.Get(i,0);
+            const F s = sn.Get(i,0);
+            const F eta_i_j = H.Get(i,j);
+            const F eta_ip1_j = H.Get(i+1,j);
+            H.Set( i,   j,  c       *eta_i_j + s*eta_ip1_j );
+            H.Set( i+1, j, -Conj(s)*eta_i_j + c*eta_ip1_j );
+        }
+        Real c;
+        F s;
+        const F rho = lapack::Givens( H.Get(j,j), F(delta), &c, &s );
+        H.Set( j, j, rho );
+        cs.Set( j, 0, c );
+        sn.Set( j, 0, s );
+        const F tau_j = t.Get(j,0);
+        const F tau_jp1 = t.Get(j+1,0);
+        t.Set( j,   0,  c       *tau_j + s*tau_jp1 );
+        t.Set( j+1, 0, -Conj(s)*tau_j + c*tau_jp1 );
+
+        numIts = j+1;
+        const Real residNorm = Abs(t.Get(j+1,0));
+        if( residNorm <= relTol*beta || delta == Real(0) )
+            break;
+    }
+
+    // d := V y, where y solves the (rotated) minimum residual problem
+    auto y = t( IR(0,numIts), ALL );
+    auto HTL = H( IR(0,numIts), IR(0,numIts) );
+    Trsv( UPPER, NORMAL, NON_UNIT, HTL, y );
+    for( Int i=0; i<numIts; ++i )
+        Axpy( y.Get(i,0), V[i], d );
+}
+
+// Overwrite X with the refined solution to A X = B, returning the number of
+// refinement iterations, or -1 if the refinement stalled (or did not converge
+// in time)
+template<typename F,class MatrixType,class ApplyAType,class SolveType>
+inline Int Refine
+( const ApplyAType& applyA, const SolveType& solveLow, Base<F> normA,
+  const MatrixType& B, MatrixType& X,
+  const MixedPrecisionCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CSE cse("mixed_solve::Refine"))
+    typedef Base<F> Real;
+    const Int n = B.Height();
+    const Int numRHS = B.Width();
+    const Real tol = Sqrt(Real(n))*ctrl.relTol;
+
+    X = B;
+    ScaledSolve<F>( solveLow, X );
+
+    MatrixType R( B ), D( B ), r( B ), d( B );
+    Matrix<Real> residNorms, solNorms;
+    const Real infinity = std::numeric_limits<Real>::infinity();
+    Real lastError = infinity;
+    for( Int it=0; ; ++it )
+    {
+        // R := B - A X
+        R = B;
+        applyA( X, R );
+
+        // Measure the largest normwise backward error of the columns
+        AllColumnNorms( R, residNorms );
+        AllColumnNorms( X, solNorms );
+        Real error = 0;
+        for( Int j=0; j<numRHS; ++j )
+        {
+            const Real denom = normA*solNorms.Get(j,0);
+            const Real residNorm = residNorms.Get(j,0);
+            if( residNorm != Real(0) )
+                error = Max( error, residNorm/denom );
+            // NaN's should be treated as a stall
+            if( residNorm != residNorm )
+                error = infinity;
+        }
+        if( ctrl.progress && IsRoot(X) )
+            cout << "    refinement iteration " << it << ": backward error = "
+                 << error << endl;
+        if( error <= tol )
+            return it;
+        if( it == ctrl.maxRefineIts || !(error < ctrl.stallRatio*lastError) )
+        {
+            if( ctrl.progress && IsRoot(X) )
+                cout << "    refinement stalled" << endl;
+            return -1;
+        }
+        lastError = error;
+
+        // X := X + inv(A) R, where inv(A) is approximated by the
+        // low-precision factorization (optionally within GMRES)
+        if( ctrl.alg == MIXED_REFINE_IR )
+        {
+            D = R;
+            ScaledSolve<F>( solveLow, D );
+        }
+        else
+        {
+            Zeros( D, n, numRHS );
+            for( Int j=0; j<numRHS; ++j )
+            {
+                r = R( ALL, IR(j) );
+                auto dj = D( ALL, IR(j) );
+                GMRES<F>( applyA, solveLow, r, d, ctrl.relTolGMRES,
+                  ctrl.maxGMRESIts );
+                dj = d;
+            }
+        }
+        Axpy( F(1), D, X );
+    }
+}
+
+} // namespace mixed_solve
+} // namespace El
+
+#endif // ifndef EL_SOLVE_MIXEDPRECISION_HPP
@@ -100,6 +100,7 @@ ElError ElPolarCtrlDefault( ElPolarCtrl* ctrl )
 ElError ElSVDCtrlDefault_s( ElSVDCtrl_s* ctrl )
 {
     ctrl->seqQR = false;
+    ctrl->distMRRR = true;
     ctrl->valChanRatio = 1.2;
     ctrl->fullChanRatio = 1.5;
     ctrl->thresholded = false;
@@ -110,6 +111,7 @@ ElError ElSVDCtrlDefault_s( ElSVDCtrl_s* ctrl )
 ElError ElSVDCtrlDefault_d( ElSVDCtrl_d* ctrl )
 {
     ctrl->seqQR = false;
+    ctrl->distMRRR = true;
     ctrl->valChanRatio = 1.2;
     ctrl->fullChanRatio = 1.5;
     ctrl->thresholded = false;
@@ -124,6 +126,11 @@ ElError ElHessQRCtrlDefault( ElHessQRCtrl* ctrl )
     ctrl->distAED = false;
     ctrl->blockHeight = DefaultBlockHeight();
     ctrl->blockWidth = DefaultBlockWidth();
+    ctrl->scalapack = false;
+    ctrl->numShifts = 0;
+    ctrl->deflationSize = 0;
+    ctrl->minMultiBulgeSize = 75;
+    ctrl->chaseAdvance = 0;
     return EL_SUCCESS;
 }
 
@@ -184,6 +191,7 @@ ElError ElSnapshotCtrlDefault( ElSnapshotCtrl* ctrl )
     ctrl->imgFormat = EL_PNG;
     ctrl->numFormat = EL_ASCII_MATLAB;
     ctrl->itCounts = true;
+    ctrl->shiftTimes = false;
     return EL_SUCCESS;
 }
 ElError ElSnapshotCtrlDestroy( const ElSnapshotCtrl* ctrl )
@@ -208,6 +216,7 @@ ElError ElPseudospecCtrlDefault_s( ElPseudospecCtrl_s* ctrl )
     ctrl->arnoldi = true;
     ctrl->basisSize = 10;
     ctrl->reorthog = true;
+    ctrl->shiftBatchSize = 0;
     ctrl->progress = false;
     ElSnapshotCtrlDefault( &ctrl->snapCtrl );
     return EL_SUCCESS;
@@ -233,6 +242,7 @@ ElError ElPseudospecCtrlDefault_d( ElPseudospecCtrl_d* ctrl )
     ctrl->arnoldi = true;
     ctrl->basisSize = 10;
     ctrl->reorthog = true;
+    ctrl->shiftBatchSize = 0;
     ctrl->progress = false;
     ElSnapshotCtrlDefault( &ctrl->snapCtrl );
     return EL_SUCCESS;
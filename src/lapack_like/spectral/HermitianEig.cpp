@@ -137,6 +137,7 @@ void HermitianEig
   const HermitianEigCtrl<F>& ctrl )
 {
     DEBUG_ONLY(CSE cse("HermitianEig"))
+    ProfileRegion profile("HermitianEig");
     if( A.Height() != A.Width() )
         LogicError("Hermitian matrices must be square");
     if( ctrl.useSDC )
@@ -185,6 +186,7 @@ void HermitianEig
   const HermitianEigCtrl<F>& ctrl )
 {
     DEBUG_ONLY(CSE cse("HermitianEig"))
+    ProfileRegion profile("HermitianEig");
     const Int n = A.Height();
     if( A.Height() != A.Width() )
         LogicError("Hermitian matrices must be square");
@@ -235,6 +237,7 @@ void HermitianEig
   const HermitianEigCtrl<F>& ctrl )
 {
     DEBUG_ONLY(CSE cse("HermitianEig"))
+    ProfileRegion profile("HermitianEig");
     if( APre.Height() != APre.Width() )
         LogicError("Hermitian matrices must be square");
 
@@ -311,6 +314,7 @@ void HermitianEig
   const HermitianEigCtrl<F>& ctrl )
 {
     DEBUG_ONLY(CSE cse("HermitianEig"))
+    ProfileRegion profile("HermitianEig");
     if( A.Height() != A.Width() )
         LogicError("Hermitian matrices must be square");
     if( ctrl.useSDC )
@@ -371,6 +375,7 @@ void HermitianEig
   const HermitianEigCtrl<F>& ctrl )
 {
     DEBUG_ONLY(CSE cse("HermitianEig"))
+    ProfileRegion profile("HermitianEig");
     const Int n = A.Height();
     if( A.Height() != A.Width() )
         LogicError("Hermitian matrices must be square");
@@ -433,6 +438,7 @@ void HermitianEig
   const HermitianEigCtrl<F>& ctrl )
 {
     DEBUG_ONLY(CSE cse("HermitianEig"))
+    ProfileRegion profile("HermitianEig");
     typedef Base<F> Real;
     const Int n = APre.Height();
     if( APre.Height() != APre.Width() )
@@ -475,7 +481,11 @@ void HermitianEig
     // Tridiagonalize A
     const Grid& g = A.Grid();
     DistMatrix<F,STAR,STAR> t(g);
-    HermitianTridiag( uplo, A, t, ctrl.tridiagCtrl );
+    herm_tridiag::BulgeReflectors<F> bulge;
+    if( ctrl.tridiagCtrl.twoStage )
+        herm_tridiag::TwoStage( uplo, A, t, bulge, ctrl.tridiagCtrl );
+    else
+        HermitianTridiag( uplo, A, t, ctrl.tridiagCtrl );
 
     if( ctrl.timeStages )
     {
@@ -594,7 +604,10 @@ void HermitianEig
     }
 
     // Backtransform the tridiagonal eigenvectors, Z
-    herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, t, Z );
+    if( ctrl.tridiagCtrl.twoStage )
+        herm_tridiag::ApplyQ( NORMAL, A, t, bulge, Z );
+    else
+        herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, t, Z );
 
     if( ctrl.timeStages )
     {
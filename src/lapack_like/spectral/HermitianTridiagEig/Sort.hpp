@@ -57,16 +57,18 @@ void Sort
     const Grid& g = Z.Grid();
     DistMatrix<F,VC,STAR> Z_VC_STAR( Z );
     DistMatrix<F,VC,STAR> ZPerm_VC_STAR( n, k, g );
+    DistMatrix<Real,STAR,STAR> w_STAR_STAR( k, 1, g );
     const Int nLocal = Z_VC_STAR.LocalHeight();
     for( Int j=0; j<k; ++j )
     {
         MemCopy
         ( ZPerm_VC_STAR.Buffer(0,j), 
           Z_VC_STAR.LockedBuffer(0,pairs[j].index), nLocal );
-        w.Set( j, 0, pairs[j].value );
+        w_STAR_STAR.SetLocal( j, 0, pairs[j].value );
     }
     Z_VC_STAR.Empty();
     Copy( ZPerm_VC_STAR, Z );
+    Copy( w_STAR_STAR, w );
 }
 
 } // namespace herm_eig
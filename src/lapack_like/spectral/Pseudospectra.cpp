@@ -21,6 +21,35 @@
 
 namespace El {
 
+namespace pspec {
+
+// If U alone does not fit in the cache, every batch would stream it from
+// memory, and so all of the shifts are processed at once
+Int SequentialBatchSize
+( Int batchSize, Int numShifts, Int n, Int entryBytes, Int rowBytes,
+  Int cacheBytes )
+{
+    DEBUG_ONLY(CSE cse("pspec::SequentialBatchSize"))
+    const Int numAll = Max(numShifts,Int(1));
+    if( batchSize > 0 )
+        return batchSize;
+    const double triangBytes = double(entryBytes)*n*(n+1)/2;
+    const double freeBytes = cacheBytes - triangBytes;
+    if( freeBytes <= 0 )
+        return numAll;
+    const double batchBytes = double(rowBytes)*Max(n,Int(1));
+    return Max( Min( Int(freeBytes/batchBytes), numAll ), Int(1) );
+}
+
+Int DistBatchSize( Int batchSize, Int numShifts, Int gridWidth )
+{
+    DEBUG_ONLY(CSE cse("pspec::DistBatchSize"))
+    const Int numAll = Max(numShifts,Int(1));
+    return ( batchSize > 0 ? Min(batchSize*gridWidth,numAll) : numAll );
+}
+
+} // namespace pspec
+
 template<typename F>
 Matrix<Int> TriangularSpectralCloud
 ( const Matrix<F>& UPre, const Matrix<Complex<Base<F>>>& shifts, 
@@ -276,7 +276,9 @@ IRA
 
     psCtrl.snapCtrl.ResetCounts();
 
-    Timer timer, subtimer;
+    Timer timer, subtimer, shiftTimer;
+    Matrix<Real> shiftTimes;
+    Zeros( shiftTimes, numShifts, 1 );
     Int numIts=0, numDone=0;
     Matrix<Real> estimates(numShifts,1);
     Zeros( estimates, numShifts, 1 );
@@ -299,6 +301,7 @@ IRA
         for( Int j=0; j<numActive; ++j )
             Zeros( HList[j], basisSize+1, basisSize );
 
+        shiftTimer.Start();
         if( progress )
             timer.Start();
         ColumnNorms( activeVList[0], colNorms );
@@ -312,12 +315,9 @@ IRA
             {
                 if( progress )
                     subtimer.Start();
-                MultiShiftTrsm
-                ( LEFT, UPPER, NORMAL, 
-                  C(1), UCopy, activeShifts, activeVList[j+1] );
-                MultiShiftTrsm
-                ( LEFT, UPPER, ADJOINT, 
-                  C(1), UCopy, activeShifts, activeVList[j+1] );
+                ShiftedSolves
+                ( UCopy, activeShifts, activeVList[j+1],
+                  psCtrl.shiftBatchSize );
                 if( progress )
                 {
                     const double msTime = subtimer.Stop();
@@ -412,6 +412,8 @@ IRA
             numDone += numActiveDone;
         else
             numDone = numActiveDone;
+        AccumulateShiftTimes
+        ( activePreimage, numActive, deflate, shiftTimer.Stop(), shiftTimes );
         numIts += basisSize;
         if( progress )
         {
@@ -442,6 +444,9 @@ IRA
     if( deflate )
         RestoreOrdering( preimage, invNorms, itCounts );
     FinalSnapshot( invNorms, itCounts, psCtrl.snapCtrl );
+    TimingSnapshot( shiftTimes, psCtrl.snapCtrl );
+    if( progress )
+        ReportShiftTimes( shiftTimes, shifts );
 
     return itCounts;
 }
@@ -499,7 +504,9 @@ IRA
 
     psCtrl.snapCtrl.ResetCounts();
 
-    Timer timer, subtimer;
+    Timer timer, subtimer, shiftTimer;
+    Matrix<Real> shiftTimes;
+    Zeros( shiftTimes, numShifts, 1 );
     Int numIts=0, numDone=0;
     Matrix<Real> estimates(numShifts,1);
     Zeros( estimates, numShifts, 1 );
@@ -513,18 +520,19 @@ IRA
         auto activeItCounts = itCounts( IR(0,numActive), ALL );
         for( Int j=0; j<basisSize+1; ++j )
         {
-            activeVRealList[j] = VRealList[j]( ALL, IR(0,numActive) ); 
-            activeVImagList[j] = VImagList[j]( ALL, IR(0,numActive) ); 
+            View( activeVRealList[j], VRealList[j], ALL, IR(0,numActive) );
+            View( activeVImagList[j], VImagList[j], ALL, IR(0,numActive) );
         }
         if( deflate )
         {
-            activePreimage = preimage( IR(0,numActive), ALL );
+            View( activePreimage, preimage, IR(0,numActive), ALL );
             Zeros( activeConverged, numActive, 1 );
         }
         HList.resize( numActive );
         for( Int j=0; j<numActive; ++j )
             Zeros( HList[j], basisSize+1, basisSize );
 
+        shiftTimer.Start();
         if( progress )
             timer.Start();
         ColumnNorms( activeVRealList[0], activeVImagList[0], colNorms );
@@ -537,12 +545,9 @@ IRA
             activeVImagList[j+1] = activeVImagList[j];
             if( progress )
                 subtimer.Start();
-            MultiShiftQuasiTrsm
-            ( LEFT, UPPER, NORMAL, C(1), U, activeShifts, 
-              activeVRealList[j+1], activeVImagList[j+1] );
-            MultiShiftQuasiTrsm
-            ( LEFT, UPPER, ADJOINT, C(1), U, activeShifts, 
-              activeVRealList[j+1], activeVImagList[j+1] );
+            ShiftedSolves
+            ( U, activeShifts, activeVRealList[j+1], activeVImagList[j+1],
+              psCtrl.shiftBatchSize );
             if( progress )
             {
                 const double msTime = subtimer.Stop();
@@ -623,6 +628,8 @@ IRA
             numDone += numActiveDone;
         else
             numDone = numActiveDone;
+        AccumulateShiftTimes
+        ( activePreimage, numActive, deflate, shiftTimer.Stop(), shiftTimes );
         numIts += basisSize;
         if( progress )
         {
@@ -654,6 +661,9 @@ IRA
     if( deflate )
         RestoreOrdering( preimage, invNorms, itCounts );
     FinalSnapshot( invNorms, itCounts, psCtrl.snapCtrl );
+    TimingSnapshot( shiftTimes, psCtrl.snapCtrl );
+    if( progress )
+        ReportShiftTimes( shiftTimes, shifts );
 
     return itCounts;
 }
@@ -733,7 +743,9 @@ IRA
 
     psCtrl.snapCtrl.ResetCounts();
 
-    Timer timer, subtimer;
+    Timer timer, subtimer, shiftTimer;
+    Matrix<Real> shiftTimes;
+    Zeros( shiftTimes, numShifts, 1 );
     Int numIts=0, numDone=0;
     DistMatrix<Real,MR,STAR> estimates(g), lastActiveEsts(g);
     estimates.AlignWith( shifts );
@@ -756,6 +768,7 @@ IRA
         for( size_t jLoc=0; jLoc<HList.size(); ++jLoc )
             Zeros( HList[jLoc], basisSize+1, basisSize );
 
+        shiftTimer.Start();
         if( progress )
         {
             mpi::Barrier( g.Comm() );
@@ -776,12 +789,8 @@ IRA
                     if( g.Rank() == 0 )
                         subtimer.Start();
                 }
-                MultiShiftTrsm
-                ( LEFT, UPPER, NORMAL, 
-                  C(1), U, activeShifts, activeVList[j+1] );
-                MultiShiftTrsm
-                ( LEFT, UPPER, ADJOINT, 
-                  C(1), U, activeShifts, activeVList[j+1] );
+                ShiftedSolves
+                ( U, activeShifts, activeVList[j+1], psCtrl.shiftBatchSize );
                 if( progress )
                 {
                     mpi::Barrier( g.Comm() );
@@ -900,6 +909,9 @@ IRA
             numDone += numActiveDone;
         else
             numDone = numActiveDone;
+        AccumulateShiftTimes
+        ( activePreimage, activeShifts, deflate, shiftTimer.Stop(),
+          shiftTimes );
         numIts += basisSize;
         if( progress )
         {
@@ -934,6 +946,10 @@ IRA
     if( deflate )
         RestoreOrdering( preimage, invNorms, itCounts );
     FinalSnapshot( invNorms, itCounts, psCtrl.snapCtrl );
+    FinishShiftTimes( shiftTimes, g.VRComm() );
+    TimingSnapshot( shiftTimes, g, psCtrl.snapCtrl );
+    if( progress )
+        ReportShiftTimes( shiftTimes, shifts );
 
     return itCounts;
 }
@@ -1012,7 +1028,9 @@ IRA
 
     psCtrl.snapCtrl.ResetCounts();
 
-    Timer timer, subtimer;
+    Timer timer, subtimer, shiftTimer;
+    Matrix<Real> shiftTimes;
+    Zeros( shiftTimes, numShifts, 1 );
     Int numIts=0, numDone=0;
     DistMatrix<Real,MR,STAR> estimates(g), lastActiveEsts(g);
     estimates.AlignWith( shifts );
@@ -1038,6 +1056,7 @@ IRA
         for( size_t jLoc=0; jLoc<HList.size(); ++jLoc )
             Zeros( HList[jLoc], basisSize+1, basisSize );
 
+        shiftTimer.Start();
         if( progress )
         {
             mpi::Barrier( g.Comm() );
@@ -1058,12 +1077,9 @@ IRA
                 if( g.Rank() == 0 )
                     subtimer.Start();
             }
-            MultiShiftQuasiTrsm
-            ( LEFT, UPPER, NORMAL, C(1), U, activeShifts, 
-              activeVRealList[j+1], activeVImagList[j+1] );
-            MultiShiftQuasiTrsm
-            ( LEFT, UPPER, ADJOINT, C(1), U, activeShifts, 
-              activeVRealList[j+1], activeVImagList[j+1] );
+            ShiftedSolves
+            ( U, activeShifts, activeVRealList[j+1], activeVImagList[j+1],
+              psCtrl.shiftBatchSize );
             if( progress )
             {
                 mpi::Barrier( g.Comm() );
@@ -1157,6 +1173,9 @@ IRA
             numDone += numActiveDone;
         else
             numDone = numActiveDone;
+        AccumulateShiftTimes
+        ( activePreimage, activeShifts, deflate, shiftTimer.Stop(),
+          shiftTimes );
         numIts += basisSize;
         if( progress )
         {
@@ -1192,6 +1211,10 @@ IRA
     if( deflate )
         RestoreOrdering( preimage, invNorms, itCounts );
     FinalSnapshot( invNorms, itCounts, psCtrl.snapCtrl );
+    FinishShiftTimes( shiftTimes, g.VRComm() );
+    TimingSnapshot( shiftTimes, g, psCtrl.snapCtrl );
+    if( progress )
+        ReportShiftTimes( shiftTimes, shifts );
 
     return itCounts;
 }
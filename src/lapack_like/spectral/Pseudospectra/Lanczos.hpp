@@ -120,94 +120,39 @@ Deflate
     Timer timer;
     if( progress && activeShifts.Grid().Rank() == 0 )
         timer.Start();
-    const Int numActive = activeX.Width(); 
-    Int swapTo = numActive-1;
 
-    DistMatrix<Complex<Real>,STAR,STAR> shiftsCopy( activeShifts );
-    DistMatrix<Int,STAR,STAR> preimageCopy( activePreimage );
-    DistMatrix<Real,STAR,STAR> estimatesCopy( activeEsts );
-    DistMatrix<Int, STAR,STAR> itCountsCopy( activeItCounts );
-    DistMatrix<Int, STAR,STAR> convergedCopy( activeConverged );
-    DistMatrix<Complex<Real>,VC,STAR> XOldCopy( activeXOld ), XCopy( activeX );
-
-    const Int n = ( activeX.LocalWidth()>0 ? HDiagList[0].Height() : 0 );
-    for( Int swapFrom=numActive-1; swapFrom>=0; --swapFrom )
-    {
-        if( convergedCopy.Get(swapFrom,0) )
-        {
-            if( swapTo != swapFrom )
-            {
-                // TODO: Avoid this large latency penalty
-                if( activeX.IsLocalCol(swapFrom) && 
-                    activeX.IsLocalCol(swapTo) )
-                {
-                    const Int localFrom = activeX.LocalCol(swapFrom);
-                    const Int localTo = activeX.LocalCol(swapTo);
-                    DEBUG_ONLY(
-                        if( HDiagList[localFrom].Height() != n )
-                            LogicError("Invalid HDiagList size");
-                        if( HDiagList[localTo].Height() != n )
-                            LogicError("Invalid HDiagList size");
-                        if( HSubdiagList[localFrom].Height() != n )
-                            LogicError("Invalid HSubdiagList size");
-                        if( HSubdiagList[localTo].Height() != n )
-                            LogicError("Invalid HSubdiagList size");
-                    )
-                    std::swap( HDiagList[localFrom], HDiagList[localTo] );
-                    std::swap( HSubdiagList[localFrom], HSubdiagList[localTo] );
-                }
-                else if( activeX.IsLocalCol(swapFrom) )
-                {
-                    const Int localFrom = activeX.LocalCol(swapFrom);
-                    DEBUG_ONLY(
-                        if( HDiagList[localFrom].Height() != n )
-                            LogicError("Invalid HDiagList size");
-                        if( HSubdiagList[localFrom].Height() != n )
-                            LogicError("Invalid HSubdiagList size");
-                    )
-                    const Int partner = activeX.ColOwner(swapTo);
-                    mpi::TaggedSendRecv
-                    ( HDiagList[localFrom].Buffer(), n,
-                      partner, swapFrom, partner, swapFrom, activeX.RowComm() );
-                    mpi::TaggedSendRecv
-                    ( HSubdiagList[localFrom].Buffer(), n, 
-                      partner, swapFrom, partner, swapFrom, activeX.RowComm() );
-                }
-                else if( activeX.IsLocalCol(swapTo) )
-                {
-                    const Int localTo = activeX.LocalCol(swapTo);
-                    DEBUG_ONLY(
-                        if( HDiagList[localTo].Height() != n )
-                            LogicError("Invalid HDiagList size");
-                        if( HSubdiagList[localTo].Height() != n )
-                            LogicError("Invalid HSubdiagList size");
-                    )
-                    const Int partner = activeX.ColOwner(swapFrom);
-                    mpi::TaggedSendRecv
-                    ( HDiagList[localTo].Buffer(), n,
-                      partner, swapFrom, partner, swapFrom, activeX.RowComm() );
-                    mpi::TaggedSendRecv
-                    ( HSubdiagList[localTo].Buffer(), n, 
-                      partner, swapFrom, partner, swapFrom, activeX.RowComm() );
-                }
-
-                RowSwap( shiftsCopy,    swapFrom, swapTo );
-                RowSwap( preimageCopy,  swapFrom, swapTo );
-                RowSwap( estimatesCopy, swapFrom, swapTo );
-                RowSwap( itCountsCopy,  swapFrom, swapTo );
-                ColSwap( XOldCopy,      swapFrom, swapTo );
-                ColSwap( XCopy,         swapFrom, swapTo );
-            }
-            --swapTo;
-        }
-    }
-
-    activeShifts   = shiftsCopy;
-    activePreimage = preimageCopy;
-    activeEsts     = estimatesCopy;
-    activeItCounts = itCountsCopy;
-    activeXOld     = XOldCopy;
-    activeX        = XCopy;
+    DistMatrix<Int,STAR,STAR> convergedCopy( activeConverged );
+    const Int numActive = activeX.Width();
+    const Int numKeep = numActive - ZeroNorm( convergedCopy.Matrix() );
+    auto perm = DeflationPermutation( convergedCopy.Matrix() );
+
+    PermuteActiveRows( activeShifts,   perm );
+    PermuteActiveRows( activePreimage, perm );
+    PermuteActiveRows( activeEsts,     perm );
+    PermuteActiveRows( activeItCounts, perm );
+    // NOTE: We only need to move the iterates which remain active
+    PermuteActiveCols( activeXOld, perm, numKeep );
+    PermuteActiveCols( activeX,    perm, numKeep );
+
+    // The tridiagonals are stored locally for each [MC,MR] column of X and
+    // all have the same length (one entry per Lanczos step so far)
+    const Int krylovSize =
+      ( activeX.LocalWidth()>0 ? HDiagList[0].Height() : 0 );
+    DEBUG_ONLY(
+      for( size_t jLoc=0; jLoc<HDiagList.size(); ++jLoc )
+          if( HDiagList[jLoc].Height() != krylovSize ||
+              HSubdiagList[jLoc].Height() != krylovSize )
+              LogicError("Invalid tridiagonal list sizes");
+    )
+    auto owner = [&]( Int j ) { return int(activeX.ColOwner(j)); };
+    PermuteItems<Real>
+    ( perm, numKeep, krylovSize, 1, owner,
+      [&]( Int j ) { return HDiagList[activeX.LocalCol(j)].Buffer(); },
+      activeX.RowComm() );
+    PermuteItems<Real>
+    ( perm, numKeep, krylovSize, 1, owner,
+      [&]( Int j ) { return HSubdiagList[activeX.LocalCol(j)].Buffer(); },
+      activeX.RowComm() );
 
     if( progress ) 
     {
@@ -271,7 +216,9 @@ Lanczos
 
     psCtrl.snapCtrl.ResetCounts();
 
-    Timer timer, subtimer;
+    Timer timer, subtimer, shiftTimer;
+    Matrix<Real> shiftTimes;
+    Zeros( shiftTimes, numShifts, 1 );
     Int numIts=0, numDone=0;
     Matrix<Real> estimates(numShifts,1);
     Zeros( estimates, numShifts, 1 );
@@ -293,6 +240,7 @@ Lanczos
         HDiagList.resize( numActive );
         HSubdiagList.resize( numActive );
 
+        shiftTimer.Start();
         if( progress )
             timer.Start();
         activeXNew = activeX;
@@ -300,10 +248,8 @@ Lanczos
         {
             if( progress )
                 subtimer.Start();
-            MultiShiftTrsm
-            ( LEFT, UPPER, NORMAL, C(1), UCopy, activeShifts, activeXNew );
-            MultiShiftTrsm
-            ( LEFT, UPPER, ADJOINT, C(1), UCopy, activeShifts, activeXNew );
+            ShiftedSolves
+            ( UCopy, activeShifts, activeXNew, psCtrl.shiftBatchSize );
             if( progress )
             {
                 const double msTime = subtimer.Stop();
@@ -375,6 +321,8 @@ Lanczos
                  << " converged" << endl;
         }
 
+        AccumulateShiftTimes
+        ( activePreimage, numActive, deflate, shiftTimer.Stop(), shiftTimes );
         ++numIts;
         if( numIts >= maxIts )
             break;
@@ -398,6 +346,9 @@ Lanczos
     if( deflate )
         RestoreOrdering( preimage, invNorms, itCounts );
     FinalSnapshot( invNorms, itCounts, psCtrl.snapCtrl );
+    TimingSnapshot( shiftTimes, psCtrl.snapCtrl );
+    if( progress )
+        ReportShiftTimes( shiftTimes, shifts );
 
     return itCounts;
 }
@@ -431,9 +382,6 @@ Lanczos
     const bool deflate = psCtrl.deflate;
     const bool progress = psCtrl.progress;
 
-    if( deflate && g.Rank() == 0 ) 
-        cerr << "NOTE: Deflation swaps not yet optimized!" << endl;
-
     // Keep track of the number of iterations per shift
     DistMatrix<Int,VR,STAR> itCounts(g);
     Ones( itCounts, numShifts, 1 );
@@ -478,7 +426,9 @@ Lanczos
 
     psCtrl.snapCtrl.ResetCounts();
 
-    Timer timer, subtimer;
+    Timer timer, subtimer, shiftTimer;
+    Matrix<Real> shiftTimes;
+    Zeros( shiftTimes, numShifts, 1 );
     Int numIts=0, numDone=0;
     DistMatrix<Real,MR,STAR> estimates(g);
     estimates.AlignWith( shifts );
@@ -501,6 +451,7 @@ Lanczos
         HDiagList.resize( activeX.LocalWidth() );
         HSubdiagList.resize( activeX.LocalWidth() );
 
+        shiftTimer.Start();
         if( progress )
         {
             mpi::Barrier( g.Comm() );
@@ -516,10 +467,8 @@ Lanczos
                 if( g.Rank() == 0 )
                     subtimer.Start();
             }
-            MultiShiftTrsm
-            ( LEFT, UPPER, NORMAL, C(1), U, activeShifts, activeXNew );
-            MultiShiftTrsm
-            ( LEFT, UPPER, ADJOINT, C(1), U, activeShifts, activeXNew );
+            ShiftedSolves
+            ( U, activeShifts, activeXNew, psCtrl.shiftBatchSize );
             if( progress )
             {
                 mpi::Barrier( g.Comm() );
@@ -621,6 +570,9 @@ Lanczos
             }
         }
 
+        AccumulateShiftTimes
+        ( activePreimage, activeShifts, deflate, shiftTimer.Stop(),
+          shiftTimes );
         ++numIts;
         if( numIts >= maxIts )
             break;
@@ -644,6 +596,10 @@ Lanczos
     if( deflate )
         RestoreOrdering( preimage, invNorms, itCounts );
     FinalSnapshot( invNorms, itCounts, psCtrl.snapCtrl );
+    FinishShiftTimes( shiftTimes, g.VRComm() );
+    TimingSnapshot( shiftTimes, g, psCtrl.snapCtrl );
+    if( progress )
+        ReportShiftTimes( shiftTimes, shifts );
 
     return itCounts;
 }
@@ -106,41 +106,25 @@ Deflate
     Timer timer;
     if( progress && activeShifts.Grid().Rank() == 0 )
         timer.Start();
-    const Int numActive = activeX.Width(); 
-    Int swapTo = numActive-1;
 
-    DistMatrix<Complex<Real>,STAR,STAR> shiftsCopy( activeShifts );
-    DistMatrix<Int,STAR,STAR> preimageCopy( activePreimage );
-    DistMatrix<Real,STAR,STAR> estimatesCopy( activeEsts );
-    DistMatrix<Int, STAR,STAR> itCountsCopy( activeItCounts );
-    DistMatrix<Int, STAR,STAR> convergedCopy( activeConverged );
-    DistMatrix<Complex<Real>,VC,STAR> XCopy( activeX );
+    DistMatrix<Int,STAR,STAR> convergedCopy( activeConverged );
+    const Int numActive = activeX.Width();
+    const Int numKeep = numActive - ZeroNorm( convergedCopy.Matrix() );
+    auto perm = DeflationPermutation( convergedCopy.Matrix() );
 
-    for( Int swapFrom=numActive-1; swapFrom>=0; --swapFrom )
+    PermuteActiveRows( activeShifts,   perm );
+    PermuteActiveRows( activePreimage, perm );
+    PermuteActiveRows( activeEsts,     perm );
+    PermuteActiveRows( activeItCounts, perm );
+    // NOTE: We only need to move the iterates which remain active
+    PermuteActiveCols( activeX, perm, numKeep );
+
+    if( progress )
     {
-        if( convergedCopy.Get(swapFrom,0) )
-        {
-            if( swapTo != swapFrom )
-            {
-                RowSwap( shiftsCopy,    swapFrom, swapTo );
-                RowSwap( preimageCopy,  swapFrom, swapTo );
-                RowSwap( estimatesCopy, swapFrom, swapTo );
-                RowSwap( itCountsCopy,  swapFrom, swapTo );
-                // NOTE: We only need to move information one way
-                ColSwap( XCopy,         swapFrom, swapTo );
-            }
-            --swapTo;
-        }
+        mpi::Barrier( activeShifts.Grid().Comm() );
+        if( activeShifts.Grid().Rank() == 0 )
+            cout << "Deflation took " << timer.Stop() << " seconds" << endl;
     }
-
-    activeShifts   = shiftsCopy;
-    activePreimage = preimageCopy;
-    activeEsts     = estimatesCopy;
-    activeItCounts = itCountsCopy;
-    activeX        = XCopy;
-
-    if( progress && activeShifts.Grid().Rank() == 0 )
-        cout << "Deflation took " << timer.Stop() << " seconds" << endl;
 }
 
 template<typename Real>
@@ -159,41 +143,19 @@ Deflate
     Timer timer;
     if( progress && activeShifts.Grid().Rank() == 0 )
         timer.Start();
-    const Int numActive = activeXReal.Width();
-    Int swapTo = numActive-1;
-
-    DistMatrix<Complex<Real>,STAR,STAR> shiftsCopy( activeShifts );
-    DistMatrix<Int,STAR,STAR> preimageCopy( activePreimage );
-    DistMatrix<Real,STAR,STAR> estimatesCopy( activeEsts );
-    DistMatrix<Int, STAR,STAR> itCountsCopy( activeItCounts );
-    DistMatrix<Int, STAR,STAR> convergedCopy( activeConverged );
-    DistMatrix<Real,VC,STAR> XRealCopy( activeXReal ),
-                             XImagCopy( activeXImag );
 
-    for( Int swapFrom=numActive-1; swapFrom>=0; --swapFrom )
-    {
-        if( convergedCopy.Get(swapFrom,0) )
-        {
-            if( swapTo != swapFrom )
-            {
-                RowSwap( shiftsCopy,    swapFrom, swapTo );
-                RowSwap( preimageCopy,  swapFrom, swapTo );
-                RowSwap( estimatesCopy, swapFrom, swapTo );
-                RowSwap( itCountsCopy,  swapFrom, swapTo );
-                // NOTE: We only need to move information one way
-                ColSwap( XRealCopy,     swapFrom, swapTo );
-                ColSwap( XImagCopy,     swapFrom, swapTo );
-            }
-            --swapTo;
-        }
-    }
-
-    activeShifts   = shiftsCopy;
-    activePreimage = preimageCopy;
-    activeEsts     = estimatesCopy;
-    activeItCounts = itCountsCopy;
-    activeXReal    = XRealCopy;
-    activeXImag    = XImagCopy;
+    DistMatrix<Int,STAR,STAR> convergedCopy( activeConverged );
+    const Int numActive = activeXReal.Width();
+    const Int numKeep = numActive - ZeroNorm( convergedCopy.Matrix() );
+    auto perm = DeflationPermutation( convergedCopy.Matrix() );
+
+    PermuteActiveRows( activeShifts,   perm );
+    PermuteActiveRows( activePreimage, perm );
+    PermuteActiveRows( activeEsts,     perm );
+    PermuteActiveRows( activeItCounts, perm );
+    // NOTE: We only need to move the iterates which remain active
+    PermuteActiveCols( activeXReal, perm, numKeep );
+    PermuteActiveCols( activeXImag, perm, numKeep );
 
     if( progress )
     {
@@ -13,5 +13,6 @@
 #include "./Util/Rearrange.hpp"
 #include "./Util/BasicMath.hpp"
 #include "./Util/Snapshot.hpp"
+#include "./Util/Schedule.hpp"
 
 #endif // ifndef EL_PSEUDOSPECTRA_UTIL_HPP
@@ -0,0 +1,385 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_PSEUDOSPECTRA_UTIL_SCHEDULE_HPP
+#define EL_PSEUDOSPECTRA_UTIL_SCHEDULE_HPP
+
+#if defined(__unix__) || defined(__APPLE__)
+# include <unistd.h>
+#endif
+
+namespace El {
+namespace pspec {
+
+// Deflation
+// =========
+// Since the active shifts always form a prefix of the full list, and the
+// shifts are distributed cyclically over [VR,STAR] (and their iterates over
+// the process columns of [MC,MR]), compacting the unconverged shifts into
+// the front of the list after each deflation keeps the remaining work evenly
+// dealt out across the processes.
+
+// Entry i of the returned permutation is the (active) index of the shift
+// which is moved into slot i. Converged shifts are swapped to the back of the
+// active set in the same manner as the sequential Deflate routines.
+inline Matrix<Int> DeflationPermutation( const Matrix<Int>& activeConverged )
+{
+    DEBUG_ONLY(CSE cse("pspec::DeflationPermutation"))
+    const Int numActive = activeConverged.Height();
+    Matrix<Int> perm( numActive, 1 );
+    for( Int j=0; j<numActive; ++j )
+        perm.Set( j, 0, j );
+    Int swapTo = numActive-1;
+    for( Int swapFrom=numActive-1; swapFrom>=0; --swapFrom )
+    {
+        if( activeConverged.Get(swapFrom,0) )
+        {
+            if( swapTo != swapFrom )
+                RowSwap( perm, swapFrom, swapTo );
+            --swapTo;
+        }
+    }
+    return perm;
+}
+
+// Move item perm[i] into slot i for every i in [0,numKeep) with a single
+// AllToAll over the communicator the items are distributed over. Only the
+// items which change owners or positions are packed. Each item consists of
+// 'itemSize' entries spaced 'entryStride' apart in the local buffer returned
+// by 'locate', and 'owner' maps an item index to its rank within 'comm'.
+template<typename T,typename OwnerMap,typename LocateMap>
+inline void
+PermuteItems
+( const Matrix<Int>& perm, Int numKeep, Int itemSize, Int entryStride,
+  OwnerMap owner, LocateMap locate, mpi::Comm comm )
+{
+    DEBUG_ONLY(CSE cse("pspec::PermuteItems"))
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+
+    vector<int> sendCounts(commSize,0), recvCounts(commSize,0);
+    for( Int i=0; i<numKeep; ++i )
+    {
+        const Int iPre = perm.Get(i,0);
+        if( iPre == i )
+            continue;
+        const int preOwner = owner(iPre);
+        const int postOwner = owner(i);
+        if( preOwner == commRank )
+            sendCounts[postOwner] += itemSize;
+        if( postOwner == commRank )
+            recvCounts[preOwner] += itemSize;
+    }
+    vector<int> sendDispls(commSize), recvDispls(commSize);
+    int totalSend=0, totalRecv=0;
+    for( int q=0; q<commSize; ++q )
+    {
+        sendDispls[q] = totalSend;
+        recvDispls[q] = totalRecv;
+        totalSend += sendCounts[q];
+        totalRecv += recvCounts[q];
+    }
+
+    // Pack the items in the order in which they will be unpacked
+    vector<T> sendBuf( mpi::Pad(totalSend) );
+    auto offsets = sendDispls;
+    for( Int i=0; i<numKeep; ++i )
+    {
+        const Int iPre = perm.Get(i,0);
+        if( iPre == i || owner(iPre) != commRank )
+            continue;
+        const T* item = locate(iPre);
+        int& offset = offsets[owner(i)];
+        for( Int k=0; k<itemSize; ++k )
+            sendBuf[offset+k] = item[k*entryStride];
+        offset += itemSize;
+    }
+
+    vector<T> recvBuf( mpi::Pad(totalRecv) );
+    mpi::AllToAll
+    ( sendBuf.data(), sendCounts.data(), sendDispls.data(),
+      recvBuf.data(), recvCounts.data(), recvDispls.data(), comm );
+
+    offsets = recvDispls;
+    for( Int i=0; i<numKeep; ++i )
+    {
+        const Int iPre = perm.Get(i,0);
+        if( iPre == i || owner(i) != commRank )
+            continue;
+        T* item = locate(i);
+        int& offset = offsets[owner(iPre)];
+        for( Int k=0; k<itemSize; ++k )
+            item[k*entryStride] = recvBuf[offset+k];
+        offset += itemSize;
+    }
+}
+
+// Only the first numKeep columns of the result are filled
+template<typename T>
+inline void
+PermuteActiveCols( DistMatrix<T>& X, const Matrix<Int>& perm, Int numKeep )
+{
+    DEBUG_ONLY(CSE cse("pspec::PermuteActiveCols"))
+    PermuteItems<T>
+    ( perm, numKeep, X.LocalHeight(), 1,
+      [&]( Int j ) { return int(X.ColOwner(j)); },
+      [&]( Int j ) { return X.Buffer(0,X.LocalCol(j)); },
+      X.RowComm() );
+}
+
+template<typename T,Dist U>
+inline void
+PermuteActiveRows( DistMatrix<T,U,STAR>& x, const Matrix<Int>& perm )
+{
+    DEBUG_ONLY(CSE cse("pspec::PermuteActiveRows"))
+    PermuteItems<T>
+    ( perm, perm.Height(), x.LocalWidth(), x.LDim(),
+      [&]( Int i ) { return int(x.RowOwner(i)); },
+      [&]( Int i ) { return x.Buffer(x.LocalRow(i),0); },
+      x.ColComm() );
+}
+
+// Batched triangular solves
+// =========================
+// Apply inv(U - shift I)' inv(U - shift I) to each column of X. In the
+// sequential case, the shifts are processed in groups so that U and the
+// right-hand sides of each group stay in cache between the two triangular
+// solves. A nonpositive batchSize selects the largest such group which fits
+// (alongside U) in the local level 2 cache; if U alone does not fit, every
+// group would stream U from memory, and so all shifts are processed at once.
+//
+// In the distributed case, the columns of X are spread over the process
+// columns and each group of solves pays the latency of the distributed
+// triangular solves again, so batching is only performed upon request, with
+// batchSize counting the local columns per process in each group. (The group
+// sizes are computed by pspec::SequentialBatchSize and pspec::DistBatchSize.)
+
+inline Int LocalCacheBytes()
+{
+    Int cacheBytes = Int(1) << 20;
+#if defined(_SC_LEVEL2_CACHE_SIZE)
+    const long l2Bytes = sysconf( _SC_LEVEL2_CACHE_SIZE );
+    if( l2Bytes > 0 )
+        cacheBytes = l2Bytes;
+#endif
+    return cacheBytes;
+}
+
+template<typename F>
+inline void
+ShiftedSolves
+( Matrix<F>& U, const Matrix<F>& shifts, Matrix<F>& X, Int batchSize )
+{
+    DEBUG_ONLY(CSE cse("pspec::ShiftedSolves"))
+    const Int numShifts = shifts.Height();
+    const Int bsize = 
+      SequentialBatchSize
+      ( batchSize, numShifts, U.Height(), sizeof(F), sizeof(F),
+        LocalCacheBytes() );
+    for( Int s=0; s<numShifts; s+=bsize )
+    {
+        const Int nb = Min(bsize,numShifts-s);
+        auto shiftsBatch = shifts( IR(s,s+nb), ALL );
+        auto XBatch = X( ALL, IR(s,s+nb) );
+        MultiShiftTrsm( LEFT, UPPER, NORMAL, F(1), U, shiftsBatch, XBatch );
+        MultiShiftTrsm( LEFT, UPPER, ADJOINT, F(1), U, shiftsBatch, XBatch );
+    }
+}
+
+template<typename Real>
+inline void
+ShiftedSolves
+( const Matrix<Real>& U, const Matrix<Complex<Real>>& shifts,
+  Matrix<Real>& XReal, Matrix<Real>& XImag, Int batchSize )
+{
+    DEBUG_ONLY(CSE cse("pspec::ShiftedSolves"))
+    typedef Complex<Real> C;
+    const Int numShifts = shifts.Height();
+    const Int bsize = 
+      SequentialBatchSize
+      ( batchSize, numShifts, U.Height(), sizeof(Real), 2*sizeof(Real),
+        LocalCacheBytes() );
+    for( Int s=0; s<numShifts; s+=bsize )
+    {
+        const Int nb = Min(bsize,numShifts-s);
+        auto shiftsBatch = shifts( IR(s,s+nb), ALL );
+        auto XRealBatch = XReal( ALL, IR(s,s+nb) );
+        auto XImagBatch = XImag( ALL, IR(s,s+nb) );
+        MultiShiftQuasiTrsm
+        ( LEFT, UPPER, NORMAL, C(1), U, shiftsBatch, XRealBatch, XImagBatch );
+        MultiShiftQuasiTrsm
+        ( LEFT, UPPER, ADJOINT, C(1), U, shiftsBatch, XRealBatch, XImagBatch );
+    }
+}
+
+template<typename F>
+inline void
+ShiftedSolves
+( const DistMatrix<F>& U, const DistMatrix<F,VR,STAR>& shifts,
+  DistMatrix<F>& X, Int batchSize )
+{
+    DEBUG_ONLY(CSE cse("pspec::ShiftedSolves"))
+    const Int numShifts = shifts.Height();
+    const Int bsize = DistBatchSize( batchSize, numShifts, X.Grid().Width() );
+    for( Int s=0; s<numShifts; s+=bsize )
+    {
+        const Int nb = Min(bsize,numShifts-s);
+        auto shiftsBatch = shifts( IR(s,s+nb), ALL );
+        auto XBatch = X( ALL, IR(s,s+nb) );
+        MultiShiftTrsm( LEFT, UPPER, NORMAL, F(1), U, shiftsBatch, XBatch );
+        MultiShiftTrsm( LEFT, UPPER, ADJOINT, F(1), U, shiftsBatch, XBatch );
+    }
+}
+
+template<typename Real>
+inline void
+ShiftedSolves
+( const DistMatrix<Real>& U, const DistMatrix<Complex<Real>,VR,STAR>& shifts,
+  DistMatrix<Real>& XReal, DistMatrix<Real>& XImag, Int batchSize )
+{
+    DEBUG_ONLY(CSE cse("pspec::ShiftedSolves"))
+    typedef Complex<Real> C;
+    const Int numShifts = shifts.Height();
+    const Int bsize =
+      DistBatchSize( batchSize, numShifts, XReal.Grid().Width() );
+    for( Int s=0; s<numShifts; s+=bsize )
+    {
+        const Int nb = Min(bsize,numShifts-s);
+        auto shiftsBatch = shifts( IR(s,s+nb), ALL );
+        auto XRealBatch = XReal( ALL, IR(s,s+nb) );
+        auto XImagBatch = XImag( ALL, IR(s,s+nb) );
+        MultiShiftQuasiTrsm
+        ( LEFT, UPPER, NORMAL, C(1), U, shiftsBatch, XRealBatch, XImagBatch );
+        MultiShiftQuasiTrsm
+        ( LEFT, UPPER, ADJOINT, C(1), U, shiftsBatch, XRealBatch, XImagBatch );
+    }
+}
+
+// Per-shift timings
+// =================
+// All of the active shifts are advanced simultaneously, so the wall-clock
+// time of each sweep is split evenly between them and charged to their
+// original indices. The result is replicated over every process.
+
+template<typename Real>
+inline void
+AccumulateShiftTimes
+( const Matrix<Int>& activePreimage, Int numActive, bool deflate,
+  double seconds, Matrix<Real>& shiftTimes )
+{
+    DEBUG_ONLY(CSE cse("pspec::AccumulateShiftTimes"))
+    if( numActive == 0 )
+        return;
+    const Real share = Real(seconds/numActive);
+    for( Int j=0; j<numActive; ++j )
+    {
+        const Int i = ( deflate ? activePreimage.Get(j,0) : j );
+        shiftTimes.Update( i, 0, share );
+    }
+}
+
+// Each process only charges the shifts it owns; the contributions are
+// summed by FinishShiftTimes
+template<typename Real>
+inline void
+AccumulateShiftTimes
+( const DistMatrix<Int,VR,STAR>& activePreimage,
+  const DistMatrix<Complex<Real>,VR,STAR>& activeShifts,
+  bool deflate, double seconds, Matrix<Real>& shiftTimes )
+{
+    DEBUG_ONLY(CSE cse("pspec::AccumulateShiftTimes"))
+    const Int numActive = activeShifts.Height();
+    if( numActive == 0 )
+        return;
+    const Real share = Real(seconds/numActive);
+    const Int numLocShifts = activeShifts.LocalHeight();
+    for( Int jLoc=0; jLoc<numLocShifts; ++jLoc )
+    {
+        const Int i =
+          ( deflate ? activePreimage.GetLocal(jLoc,0)
+                    : activeShifts.GlobalRow(jLoc) );
+        shiftTimes.Update( i, 0, share );
+    }
+}
+
+template<typename Real>
+inline void
+FinishShiftTimes( Matrix<Real>& shiftTimes, mpi::Comm comm )
+{
+    DEBUG_ONLY(CSE cse("pspec::FinishShiftTimes"))
+    mpi::AllReduce( shiftTimes.Buffer(), shiftTimes.Height(), comm );
+}
+
+// The minimum, mean, and maximum of the (nonempty) shift times, along with
+// the index of the slowest shift
+template<typename Real>
+inline void
+ShiftTimeSummary
+( const Matrix<Real>& shiftTimes,
+  Real& minTime, Real& meanTime, Real& maxTime, Int& slowest )
+{
+    const Int numShifts = shiftTimes.Height();
+    minTime = maxTime = shiftTimes.Get(0,0);
+    slowest = 0;
+    Real totalTime = 0;
+    for( Int i=0; i<numShifts; ++i )
+    {
+        const Real time = shiftTimes.Get(i,0);
+        totalTime += time;
+        minTime = Min(minTime,time);
+        if( time > maxTime )
+        {
+            maxTime = time;
+            slowest = i;
+        }
+    }
+    meanTime = totalTime / numShifts;
+}
+
+template<typename Real>
+inline void
+ReportShiftTimes
+( const Matrix<Real>& shiftTimes, const Matrix<Complex<Real>>& shifts )
+{
+    DEBUG_ONLY(CSE cse("pspec::ReportShiftTimes"))
+    if( shiftTimes.Height() == 0 )
+        return;
+    Real minTime, meanTime, maxTime;
+    Int slowest;
+    ShiftTimeSummary( shiftTimes, minTime, meanTime, maxTime, slowest );
+    cout << "Per-shift time: min=" << minTime
+         << ", mean=" << meanTime << ", max=" << maxTime
+         << " seconds (slowest shift: " << shifts.Get(slowest,0) << ")"
+         << endl;
+}
+
+template<typename Real>
+inline void
+ReportShiftTimes
+( const Matrix<Real>& shiftTimes,
+  const DistMatrix<Complex<Real>,VR,STAR>& shifts )
+{
+    DEBUG_ONLY(CSE cse("pspec::ReportShiftTimes"))
+    if( shiftTimes.Height() == 0 )
+        return;
+    Real minTime, meanTime, maxTime;
+    Int slowest;
+    ShiftTimeSummary( shiftTimes, minTime, meanTime, maxTime, slowest );
+    // NOTE: Every process must take part in the Get
+    const Complex<Real> slowShift = shifts.Get(slowest,0);
+    if( shifts.Grid().Rank() == 0 )
+        cout << "Per-shift time: min=" << minTime
+             << ", mean=" << meanTime << ", max=" << maxTime
+             << " seconds (slowest shift: " << slowShift << ")" << endl;
+}
+
+} // namespace pspec
+} // namespace El
+
+#endif // ifndef EL_PSEUDOSPECTRA_UTIL_SCHEDULE_HPP
@@ -150,6 +150,21 @@ FinalSnapshot
     }
 }
 
+template<typename Real>
+inline void
+TimingSnapshot( const Matrix<Real>& shiftTimes, SnapshotCtrl& snapCtrl )
+{
+    DEBUG_ONLY(CSE cse("pspec::TimingSnapshot"));
+    if( snapCtrl.realSize != 0 && snapCtrl.imagSize != 0 &&
+        snapCtrl.numSaveFreq >= 0 && snapCtrl.shiftTimes )
+    {
+        Matrix<Real> timeMap;
+        ReshapeIntoGrid
+        ( snapCtrl.realSize, snapCtrl.imagSize, shiftTimes, timeMap );
+        Write( timeMap, snapCtrl.numBase+"-times", snapCtrl.numFormat );
+    }
+}
+
 template<typename Real>
 inline void
 Snapshot
@@ -290,6 +305,27 @@ FinalSnapshot
     }
 }
 
+// The timings are replicated over the grid
+template<typename Real>
+inline void
+TimingSnapshot
+( const Matrix<Real>& shiftTimes, const Grid& g, SnapshotCtrl& snapCtrl )
+{
+    DEBUG_ONLY(CSE cse("pspec::TimingSnapshot"));
+    if( snapCtrl.realSize != 0 && snapCtrl.imagSize != 0 &&
+        snapCtrl.numSaveFreq >= 0 && snapCtrl.shiftTimes )
+    {
+        DistMatrix<Real,STAR,STAR> shiftTimes_STAR_STAR(g);
+        shiftTimes_STAR_STAR.Resize( shiftTimes.Height(), 1 );
+        Copy( shiftTimes, shiftTimes_STAR_STAR.Matrix() );
+        DistMatrix<Real,VR,STAR> shiftTimes_VR_STAR( shiftTimes_STAR_STAR );
+        DistMatrix<Real> timeMap(g);
+        ReshapeIntoGrid
+        ( snapCtrl.realSize, snapCtrl.imagSize, shiftTimes_VR_STAR, timeMap );
+        Write( timeMap, snapCtrl.numBase+"-times", snapCtrl.numFormat );
+    }
+}
+
 } // namespace pspec
 } // namespace El
 
@@ -36,7 +36,7 @@ void SVD
 }
 
 template<typename F>
-void SVD
+bool SVD
 ( AbstractDistMatrix<F>& A, AbstractDistMatrix<Base<F>>& s, 
   AbstractDistMatrix<F>& V, const SVDCtrl<Base<F>>& ctrl )
 {
@@ -50,9 +50,10 @@ void SVD
         }
         else
             svd::Thresholded( A, s, V, ctrl.tol, ctrl.relative );
+        return false;
     }
     else
-        svd::Chan( A, s, V, ctrl.fullChanRatio );
+        return svd::Chan( A, s, V, ctrl );
 }
 
 // Return the singular values
@@ -86,7 +87,7 @@ void SVD
   template void SVD \
   ( Matrix<F>& A, Matrix<Base<F>>& s, Matrix<F>& V, \
     const SVDCtrl<Base<F>>& ctrl ); \
-  template void SVD \
+  template bool SVD \
   ( AbstractDistMatrix<F>& A, AbstractDistMatrix<Base<F>>& s, \
     AbstractDistMatrix<F>& V, const SVDCtrl<Base<F>>& ctrl );
 
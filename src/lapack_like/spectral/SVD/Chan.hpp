@@ -11,24 +11,29 @@
 #define EL_SVD_CHAN_HPP
 
 #include "./GolubReinsch.hpp"
+#include "./GolubKahanMRRR.hpp"
 
 namespace El {
 namespace svd {
 
+// Returns true if PMRRR was used on the Golub-Kahan tridiagonal without
+// falling back to the bidiagonal QR algorithm
 template<typename F>
-inline void
+inline bool
 ChanUpper
 ( AbstractDistMatrix<F>& APre, AbstractDistMatrix<Base<F>>& s, 
-  AbstractDistMatrix<F>& VPre, double heightRatio=1.5 )
+  AbstractDistMatrix<F>& VPre,
+  const SVDCtrl<Base<F>>& ctrl=SVDCtrl<Base<F>>() )
 {
     DEBUG_ONLY(
         CSE cse("svd::ChanUpper");
         AssertSameGrids( APre, s, VPre );
         if( APre.Height() < APre.Width() )
             LogicError("A must be at least as tall as it is wide");
-        if( heightRatio <= 1.0 )
+        if( ctrl.fullChanRatio <= 1.0 )
             LogicError("Nonsensical switchpoint for SVD");
     )
+    const double heightRatio = ctrl.fullChanRatio;
 
     auto APtr = ReadWriteProxy<F,MC,MR>( &APre ); auto& A = *APtr; 
     auto VPtr = WriteProxy<F,MC,MR>( &VPre );     auto& V = *VPtr;
@@ -36,11 +41,15 @@ ChanUpper
     const Grid& g = A.Grid();
     const Int m = A.Height();
     const Int n = A.Width();
+    bool usedMRRR = false;
     if( m > heightRatio*n )
     {
         DistMatrix<F> R(g);
         qr::Explicit( A, R );
-        svd::GolubReinsch( R, s, V );
+        if( ctrl.distMRRR )
+            usedMRRR = svd::GolubKahanMRRR( R, s, V );
+        else
+            svd::GolubReinsch( R, s, V );
         // Unfortunately, extra memory is used in forming A := A R,
         // where A has been overwritten with the Q from the QR factorization
         // of the original state of A, and R has been overwritten with the U 
@@ -52,8 +61,12 @@ ChanUpper
     }
     else
     {
-        svd::GolubReinsch( A, s, V );
+        if( ctrl.distMRRR )
+            usedMRRR = svd::GolubKahanMRRR( A, s, V );
+        else
+            svd::GolubReinsch( A, s, V );
     }
+    return usedMRRR;
 }
 
 template<typename F>
@@ -89,15 +102,16 @@ ChanUpper
 //----------------------------------------------------------------------------//
 
 template<typename F>
-inline void
+inline bool
 Chan
 ( AbstractDistMatrix<F>& APre, AbstractDistMatrix<Base<F>>& s, 
-  AbstractDistMatrix<F>& VPre, double heightRatio=1.5 )
+  AbstractDistMatrix<F>& VPre,
+  const SVDCtrl<Base<F>>& ctrl=SVDCtrl<Base<F>>() )
 {
     DEBUG_ONLY(
         CSE cse("svd::Chan");
         AssertSameGrids( APre, s, VPre );
-        if( heightRatio <= 1.0 )
+        if( ctrl.fullChanRatio <= 1.0 )
             LogicError("Nonsensical switchpoint for SVD");
     )
 
@@ -112,21 +126,23 @@ Chan
 
     // TODO: Switch between different algorithms. For instance, starting 
     //       with a QR decomposition of tall-skinny matrices.
+    bool usedMRRR;
     if( A.Height() >= A.Width() )
     {
-        svd::ChanUpper( A, s, V, heightRatio );
+        usedMRRR = svd::ChanUpper( A, s, V, ctrl );
     }
     else
     {
         // Explicit formation of the Q from an LQ factorization is not yet
         // optimized
         Adjoint( A, V );
-        svd::ChanUpper( V, s, A, heightRatio );
+        usedMRRR = svd::ChanUpper( V, s, A, ctrl );
     }
 
     // Rescale the singular values if necessary
     if( needRescaling )
         Scale( 1/scale, s );
+    return usedMRRR;
 }
 
 //----------------------------------------------------------------------------//
@@ -0,0 +1,191 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_SVD_GOLUBKAHANMRRR_HPP
+#define EL_SVD_GOLUBKAHANMRRR_HPP
+
+#include "./Util.hpp"
+
+namespace El {
+namespace svd {
+
+// The SVD of the n x n upper bidiagonal matrix B, with diagonal d and
+// superdiagonal e, is computed from the n largest eigenpairs of its
+// Golub-Kahan tridiagonal, the 2n x 2n matrix with a zero diagonal and the
+// off-diagonal (d_0,e_0,d_1,e_1,...,e_{n-2},d_{n-1}), which is the perfect
+// shuffle of [0, B^T; B, 0]. If B v = sigma u and B^T u = sigma v, then the
+// shuffle of [v; u]/sqrt(2) is an eigenvector with eigenvalue sigma, and so
+// the singular vectors are read off of the even and odd rows of the
+// eigenvectors computed by PMRRR, which leaves them distributed in a
+// [STAR,VR] fashion rather than redundantly accumulating rotations on every
+// process.
+//
+// The two halves of each eigenvector are renormalized separately. Even when
+// the eigenvectors are numerically orthonormal, the halves need not be: for
+// (numerically) zero or tightly clustered singular values, the eigenvectors
+// of the Golub-Kahan matrix need not be shuffles of singular vector pairs. If
+// either half of an eigenvector has lost most of its mass, or if
+// ||U^H U - I||_F or ||V^H V - I||_F exceeds a modest multiple of n eps,
+// then the bidiagonal QR algorithm is run instead. The return value is
+// false if this fallback was taken.
+
+template<typename F>
+inline Base<F> OrthogonalityError( const DistMatrix<F>& Q )
+{
+    DEBUG_ONLY(CSE cse("svd::OrthogonalityError"))
+    typedef Base<F> Real;
+    DistMatrix<F> E(Q.Grid());
+    Identity( E, Q.Width(), Q.Width() );
+    Herk( LOWER, ADJOINT, Real(-1), Q, Real(1), E );
+    return HermitianFrobeniusNorm( LOWER, E );
+}
+
+template<typename F>
+inline bool
+GolubKahanMRRR
+( AbstractDistMatrix<F>& APre, AbstractDistMatrix<Base<F>>& s,
+  AbstractDistMatrix<F>& VPre )
+{
+    DEBUG_ONLY(
+      CSE cse("svd::GolubKahanMRRR");
+      if( APre.Height() < APre.Width() )
+          LogicError("A must be at least as tall as it is wide");
+    )
+    typedef Base<F> Real;
+
+    auto APtr = ReadWriteProxy<F,MC,MR>( &APre ); auto& A = *APtr;
+    auto VPtr = WriteProxy<F,MC,MR>( &VPre );     auto& V = *VPtr;
+
+    const Int n = A.Width();
+    const Grid& g = A.Grid();
+
+    // Bidiagonalize A
+    DistMatrix<F,STAR,STAR> tP(g), tQ(g);
+    Bidiag( A, tP, tQ );
+
+    // Form the Golub-Kahan tridiagonal
+    auto d_MD_STAR = GetRealPartOfDiagonal(A);
+    auto e_MD_STAR = GetRealPartOfDiagonal(A,1);
+    DistMatrix<Real,STAR,STAR> d_STAR_STAR( d_MD_STAR ),
+                               e_STAR_STAR( e_MD_STAR );
+    DistMatrix<Real,STAR,STAR> tgkDiag(g), tgkSub(g);
+    Zeros( tgkDiag, 2*n, 1 );
+    Zeros( tgkSub, Max(2*n-1,0), 1 );
+    for( Int j=0; j<n; ++j )
+    {
+        tgkSub.SetLocal( 2*j, 0, d_STAR_STAR.GetLocal(j,0) );
+        if( j < n-1 )
+            tgkSub.SetLocal( 2*j+1, 0, e_STAR_STAR.GetLocal(j,0) );
+    }
+
+    // Compute its n largest eigenpairs
+    DistMatrix<Real,VR,STAR> w(g);
+    DistMatrix<Real,STAR,VR> Z(g);
+    HermitianEigSubset<Real> subset;
+    subset.indexSubset = true;
+    subset.lowerIndex = n;
+    subset.upperIndex = 2*n-1;
+    if( n > 0 )
+        HermitianTridiagEig( tgkDiag, tgkSub, w, Z, DESCENDING, subset );
+    else
+    {
+        w.Resize( 0, 1 );
+        Z.Resize( 0, 0 );
+    }
+
+    // Split the eigenvectors into the left and right singular vectors
+    DistMatrix<F,STAR,VR> U_STAR_VR(g), V_STAR_VR(g);
+    U_STAR_VR.AlignWith( Z );
+    V_STAR_VR.AlignWith( Z );
+    Zeros( U_STAR_VR, n, n );
+    Zeros( V_STAR_VR, n, n );
+    const Real minHalfNorm = Real(1)/Real(2);
+    int split = 1;
+    for( Int jLoc=0; jLoc<Z.LocalWidth(); ++jLoc )
+    {
+        Real uNorm=0, vNorm=0;
+        for( Int i=0; i<n; ++i )
+        {
+            vNorm += Z.GetLocal(2*i,jLoc)*Z.GetLocal(2*i,jLoc);
+            uNorm += Z.GetLocal(2*i+1,jLoc)*Z.GetLocal(2*i+1,jLoc);
+        }
+        uNorm = Sqrt(uNorm);
+        vNorm = Sqrt(vNorm);
+        if( uNorm < minHalfNorm || vNorm < minHalfNorm )
+        {
+            split = 0;
+            break;
+        }
+        for( Int i=0; i<n; ++i )
+        {
+            V_STAR_VR.SetLocal( i, jLoc, Z.GetLocal(2*i,jLoc)/vNorm );
+            U_STAR_VR.SetLocal( i, jLoc, Z.GetLocal(2*i+1,jLoc)/uNorm );
+        }
+    }
+    split = mpi::AllReduce( split, mpi::MIN, g.VRComm() );
+    Z.Empty();
+
+    // Make a copy of A (for the Householder vectors) and pull the singular
+    // vectors of the bidiagonal matrix into a standard matrix dist.
+    auto B( A );
+    DistMatrix<F> AT(g), AB(g);
+    PartitionDown( A, AT, AB, n );
+    if( split )
+    {
+        AT = U_STAR_VR;
+        V = V_STAR_VR;
+        const Real orthogTol =
+          100*Max(n,Int(1))*lapack::MachineEpsilon<Real>();
+        if( OrthogonalityError( AT ) > orthogTol || 
+            OrthogonalityError( V ) > orthogTol )
+            split = 0;
+    }
+    U_STAR_VR.Empty();
+    V_STAR_VR.Empty();
+    if( split )
+    {
+        Zero( AB );
+        Copy( w, s );
+    }
+    else
+    {
+        // Fall back to the redundant bidiagonal QR algorithm
+        // NOTE: lapack::BidiagQRAlg expects e to be of length n
+        DistMatrix<Real,STAR,STAR> eHat_STAR_STAR( n, 1, g );
+        auto eT_STAR_STAR = eHat_STAR_STAR( IR(0,n-1), ALL );
+        eT_STAR_STAR = e_STAR_STAR;
+        DistMatrix<F,VC,STAR> U_VC_STAR( g );
+        U_VC_STAR.AlignWith( AT );
+        Identity( U_VC_STAR, n, n );
+        DistMatrix<F,STAR,VC> VAdj_STAR_VC( g );
+        VAdj_STAR_VC.AlignWith( V );
+        Identity( VAdj_STAR_VC, n, n );
+        Matrix<F>& ULoc = U_VC_STAR.Matrix();
+        Matrix<F>& VAdjLoc = VAdj_STAR_VC.Matrix();
+        lapack::BidiagQRAlg
+        ( 'U', n, VAdjLoc.Width(), ULoc.Height(),
+          d_STAR_STAR.Buffer(), eT_STAR_STAR.Buffer(),
+          VAdjLoc.Buffer(), VAdjLoc.LDim(),
+          ULoc.Buffer(), ULoc.LDim() );
+        AT = U_VC_STAR;
+        Zero( AB );
+        Adjoint( VAdj_STAR_VC, V );
+        Copy( d_STAR_STAR, s );
+    }
+
+    // Backtransform U and V
+    bidiag::ApplyQ( LEFT, NORMAL, B, tQ, A );
+    bidiag::ApplyP( LEFT, NORMAL, B, tP, V );
+    return split;
+}
+
+} // namespace svd
+} // namespace El
+
+#endif // ifndef EL_SVD_GOLUBKAHANMRRR_HPP
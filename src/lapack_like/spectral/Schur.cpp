@@ -11,6 +11,7 @@
 #include "./Schur/CheckReal.hpp"
 #include "./Schur/RealToComplex.hpp"
 #include "./Schur/QuasiTriangEig.hpp"
+#include "./Schur/HessenbergQR.hpp"
 #include "./Schur/QR.hpp"
 #include "./Schur/SDC.hpp"
 #include "./Schur/InverseFreeSDC.hpp"
@@ -55,7 +56,6 @@ void Schur
   bool fullTriangle, const SchurCtrl<Base<F>> ctrl )
 {
     DEBUG_ONLY(CSE cse("Schur"))
-#ifdef EL_HAVE_SCALAPACK
     if( ctrl.useSDC )
     {
         if( fullTriangle )
@@ -68,15 +68,6 @@ void Schur
     }
     else
         schur::QR( A, w, fullTriangle, ctrl.qrCtrl );
-#else
-    if( fullTriangle )
-    {
-        DistMatrix<F> Q(A.Grid());
-        schur::SDC( A, w, Q, fullTriangle, ctrl.sdcCtrl );
-    }
-    else
-        schur::SDC( A, w, ctrl.sdcCtrl );
-#endif
 }
 
 template<typename F>
@@ -85,11 +76,7 @@ void Schur
   bool fullTriangle, const SchurCtrl<Base<F>> ctrl )
 {
     DEBUG_ONLY(CSE cse("Schur"))
-#ifdef EL_HAVE_SCALAPACK
     schur::QR( A, w, fullTriangle, ctrl.qrCtrl );
-#else
-    LogicError("Block distributed Schur currently requires ScaLAPACK support");
-#endif
 }
 
 template<typename F>
@@ -98,14 +85,10 @@ void Schur
   AbstractDistMatrix<F>& Q, bool fullTriangle, const SchurCtrl<Base<F>> ctrl )
 {
     DEBUG_ONLY(CSE cse("Schur"))
-#ifdef EL_HAVE_SCALAPACK
     if( ctrl.useSDC )
         schur::SDC( A, w, Q, fullTriangle, ctrl.sdcCtrl );
     else
         schur::QR( A, w, Q, fullTriangle, ctrl.qrCtrl );
-#else
-    schur::SDC( A, w, Q, fullTriangle, ctrl.sdcCtrl );
-#endif
 }
 
 template<typename F>
@@ -114,11 +97,7 @@ void Schur
   BlockDistMatrix<F>& Q, bool fullTriangle, const SchurCtrl<Base<F>> ctrl )
 {
     DEBUG_ONLY(CSE cse("Schur"))
-#ifdef EL_HAVE_SCALAPACK
     schur::QR( A, w, Q, fullTriangle, ctrl.qrCtrl );
-#else
-    LogicError("Block distributed Schur currently requires ScaLAPACK support");
-#endif
 }
 
 #define PROTO(F) \
@@ -0,0 +1,687 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_SCHUR_HESSENBERGQR_HPP
+#define EL_SCHUR_HESSENBERGQR_HPP
+
+// A native implementation of the small-bulge multishift QR algorithm with
+// aggressive early deflation (AED) for upper Hessenberg matrices in a [MC,MR]
+// distribution, loosely following LAPACK's xLAQR0, xLAQR3, and xLAQR5.
+//
+// Each sweep chases a chain of tightly-packed 3x3 bulges down the active
+// block through a sequence of overlapping diagonal windows. Each window is
+// gathered onto every process, where the chain is redundantly advanced as far
+// as the window allows while accumulating the reflectors into a small unitary
+// matrix, which is then applied to the off-diagonal blocks of the rows and
+// columns of the window (and to Q) with level 3 BLAS. The deflation window of
+// AED is similarly either gathered and reduced redundantly or, if requested
+// via HessQRCtrl::distAED, reduced by a recursive call to this routine.
+//
+// When only the eigenvalues are requested (fullTriangle=false), only the
+// active block is kept up to date, and so only the diagonal blocks of the
+// result are meaningful.
+
+namespace El {
+namespace schur {
+namespace hess_qr {
+
+// The minimum distance between the starting rows of consecutive bulges
+const Int bulgeSpacing = 4;
+
+// The (approximate) choice of xIPARMQ for the number of shifts per sweep
+inline Int NumShifts( Int n )
+{
+    Int numShifts;
+    if( n < 30 )
+        numShifts = 2;
+    else if( n < 60 )
+        numShifts = 4;
+    else if( n < 150 )
+        numShifts = 10;
+    else if( n < 590 )
+        numShifts = Max( Int(10), n/Int(Log(double(n))/Log(2.)+0.5) );
+    else if( n < 3000 )
+        numShifts = 64;
+    else if( n < 6000 )
+        numShifts = 128;
+    else
+        numShifts = 256;
+    return Max( 2, numShifts-numShifts%2 );
+}
+
+// Active blocks (and deflation windows) with at most this many rows are
+// reduced redundantly; as with NMIN in xLAQR0, it is never less than 11
+inline Int MinMultiBulgeSize( const HessQRCtrl& ctrl )
+{ return Max( ctrl.minMultiBulgeSize, Int(11) ); }
+
+template<typename Real>
+inline void FromComplex( const Complex<Real>& alpha, Real& beta )
+{ beta = RealPart(alpha); }
+
+template<typename Real>
+inline void FromComplex( const Complex<Real>& alpha, Complex<Real>& beta )
+{ beta = alpha; }
+
+// A := A Z
+template<typename F>
+inline void
+ApplyRight( DistMatrix<F>& A, const DistMatrix<F,STAR,STAR>& Z )
+{
+    DEBUG_ONLY(CSE cse("schur::hess_qr::ApplyRight"))
+    if( A.Height() == 0 || A.Width() == 0 )
+        return;
+    const Grid& g = A.Grid();
+    DistMatrix<F,MC,STAR> A_MC_STAR(g), B_MC_STAR(g);
+    A_MC_STAR.AlignWith( A );
+    B_MC_STAR.AlignWith( A );
+    A_MC_STAR = A;
+    LocalGemm( NORMAL, NORMAL, F(1), A_MC_STAR, Z, B_MC_STAR );
+    A = B_MC_STAR;
+}
+
+// A := Z^H A
+template<typename F>
+inline void
+ApplyAdjointLeft( const DistMatrix<F,STAR,STAR>& Z, DistMatrix<F>& A )
+{
+    DEBUG_ONLY(CSE cse("schur::hess_qr::ApplyAdjointLeft"))
+    if( A.Height() == 0 || A.Width() == 0 )
+        return;
+    const Grid& g = A.Grid();
+    DistMatrix<F,STAR,MR> A_STAR_MR(g), B_STAR_MR(g);
+    A_STAR_MR.AlignWith( A );
+    B_STAR_MR.AlignWith( A );
+    A_STAR_MR = A;
+    LocalGemm( ADJOINT, NORMAL, F(1), Z, A_STAR_MR, B_STAR_MR );
+    A = B_STAR_MR;
+}
+
+// Apply the similarity transformation defined by the reflector
+// I - tau v v^H, which acts upon indices [k,k+length), to the window W,
+// whose first row and column have the (global) index 'offset'. The reflector
+// is applied from the left to columns [jBeg,offset+W.Width()) and its adjoint
+// from the right to rows [offset,iEnd), and it is accumulated into U.
+template<typename F>
+inline void
+ApplyReflector
+( Matrix<F>& W, Matrix<F>& U, Int offset,
+  Int k, Int length, F tau, const F* v, Int jBeg, Int iEnd )
+{
+    const Int wSize = W.Height();
+    const Int kLoc = k - offset;
+    for( Int j=jBeg-offset; j<wSize; ++j )
+    {
+        F gamma = 0;
+        for( Int i=0; i<length; ++i )
+            gamma += Conj(v[i])*W.Get(kLoc+i,j);
+        gamma *= tau;
+        for( Int i=0; i<length; ++i )
+            W.Update( kLoc+i, j, -gamma*v[i] );
+    }
+    const F tauConj = Conj(tau);
+    for( Int i=0; i<iEnd-offset; ++i )
+    {
+        F gamma = 0;
+        for( Int l=0; l<length; ++l )
+            gamma += W.Get(i,kLoc+l)*v[l];
+        gamma *= tauConj;
+        for( Int l=0; l<length; ++l )
+            W.Update( i, kLoc+l, -gamma*Conj(v[l]) );
+    }
+    for( Int i=0; i<wSize; ++i )
+    {
+        F gamma = 0;
+        for( Int l=0; l<length; ++l )
+            gamma += U.Get(i,kLoc+l)*v[l];
+        gamma *= tauConj;
+        for( Int l=0; l<length; ++l )
+            U.Update( i, kLoc+l, -gamma*Conj(v[l]) );
+    }
+}
+
+// Advance each bulge of the chain by (at most) one row within the window
+// [wBeg,wEnd) of the active block [iLo,iHi). The next reflector of bulge j
+// begins in row rows[j], which is negative if the bulge has not yet been
+// introduced and greater than iHi-2 once it has been chased off of the end
+// of the active block. Bulges are only introduced when the window begins at
+// the top of the active block, and only advanced while both the rows touched
+// by their reflectors and the spacing from the previous bulge allow.
+template<typename F>
+inline bool
+ChaseStep
+( Matrix<F>& W, Matrix<F>& U, Int wBeg, Int wEnd, Int iLo, Int iHi,
+  const vector<Complex<Base<F>>>& shifts, vector<Int>& rows )
+{
+    DEBUG_ONLY(CSE cse("schur::hess_qr::ChaseStep"))
+    typedef Complex<Base<F>> C;
+    const Int numBulges = rows.size();
+    Matrix<F> x;
+    F v[3];
+    bool moved = false;
+    for( Int j=0; j<numBulges; ++j )
+    {
+        if( rows[j] > iHi-2 )
+            continue;
+        const bool prevActive = ( j > 0 && rows[j-1] <= iHi-2 );
+        if( rows[j] < 0 )
+        {
+            if( wBeg != iLo )
+                break;
+            if( prevActive && rows[j-1] < iLo+1+bulgeSpacing )
+                break;
+            if( iLo+3 >= wEnd && wEnd != iHi )
+                break;
+
+            // Form the first column of (H - s_0 I)(H - s_1 I), scaled to
+            // avoid overflow
+            const C s0 = shifts[2*j];
+            const C s1 = shifts[2*j+1];
+            const C eta00 = W.Get(iLo-wBeg,iLo-wBeg);
+            const C eta01 = W.Get(iLo-wBeg,iLo+1-wBeg);
+            const C eta10 = W.Get(iLo+1-wBeg,iLo-wBeg);
+            const C eta11 = W.Get(iLo+1-wBeg,iLo+1-wBeg);
+            const C eta21 = W.Get(iLo+2-wBeg,iLo+1-wBeg);
+            const Base<F> scale = Abs(eta00-s1) + Abs(eta10);
+            if( scale == Base<F>(0) )
+            {
+                v[0] = v[1] = v[2] = 0;
+            }
+            else
+            {
+                const C eta10Scaled = eta10/scale;
+                FromComplex( eta10Scaled*eta01+(eta00-s0)*((eta00-s1)/scale),
+                             v[0] );
+                FromComplex( eta10Scaled*(eta00+eta11-s0-s1), v[1] );
+                FromComplex( eta10Scaled*eta21, v[2] );
+            }
+            F chi = v[0];
+            x.Attach( 2, 1, &v[1], 2 );
+            const F tau = LeftReflector( chi, x );
+            v[0] = 1;
+            ApplyReflector( W, U, wBeg, iLo, 3, tau, v, iLo, Min(iLo+4,iHi) );
+            rows[j] = iLo+1;
+        }
+        else
+        {
+            const Int k = rows[j];
+            if( k-1 < wBeg || (k+3 >= wEnd && wEnd != iHi) )
+                break;
+            if( prevActive && rows[j-1]-(k+1) < bulgeSpacing )
+                break;
+
+            // Annihilate the bulge below the subdiagonal of column k-1
+            const Int length = Min(3,iHi-k);
+            for( Int i=0; i<length; ++i )
+                v[i] = W.Get(k+i-wBeg,k-1-wBeg);
+            F chi = v[0];
+            x.Attach( length-1, 1, &v[1], Max(length-1,1) );
+            const F tau = LeftReflector( chi, x );
+            v[0] = 1;
+            W.Set( k-wBeg, k-1-wBeg, chi );
+            for( Int i=1; i<length; ++i )
+                W.Set( k+i-wBeg, k-1-wBeg, F(0) );
+            ApplyReflector( W, U, wBeg, k, length, tau, v, k, Min(k+4,iHi) );
+            rows[j] = k+1;
+        }
+        moved = true;
+    }
+    return moved;
+}
+
+// Chase a chain of bulges, each defined by a pair of consecutive shifts (in
+// the real case, each pair must either be real or complex conjugates),
+// through the active block [iLo,iHi). Each window spans the chain plus the
+// number of rows the chain is to advance within it, which defaults to the
+// length of the chain so that, as in xLAQR5, the cost of gathering a window
+// and applying its accumulated reflectors is amortized over a comparable
+// amount of chasing.
+template<typename F>
+inline void
+Sweep
+( DistMatrix<F>& H, DistMatrix<F>& Q, bool wantQ, bool fullTriangle,
+  Int iLo, Int iHi, const vector<Complex<Base<F>>>& shifts, Int chaseAdvance )
+{
+    DEBUG_ONLY(CSE cse("schur::hess_qr::Sweep"))
+    const Grid& g = H.Grid();
+    const Int n = H.Height();
+    const Int numBulges = shifts.size()/2;
+    const Int chainLength = bulgeSpacing*numBulges;
+    const Int chaseStep = ( chaseAdvance > 0 ? chaseAdvance : chainLength );
+    const Int windowSize = chainLength + chaseStep + 4;
+    const Int rowBeg = ( fullTriangle ? 0 : iLo );
+    const Int colEnd = ( fullTriangle ? n : iHi );
+
+    vector<Int> rows( numBulges, -1 );
+    DistMatrix<F,STAR,STAR> W_STAR_STAR(g), U(g);
+    Int wBeg = iLo;
+    while( true )
+    {
+        const Int wEnd = Min( wBeg+windowSize, iHi );
+        const Range<Int> winInd( wBeg, wEnd );
+        auto HWin = H( winInd, winInd );
+        W_STAR_STAR = HWin;
+        Identity( U, wEnd-wBeg, wEnd-wBeg );
+        while( ChaseStep
+               ( W_STAR_STAR.Matrix(), U.Matrix(), wBeg, wEnd, iLo, iHi,
+                 shifts, rows ) );
+        HWin = W_STAR_STAR;
+
+        auto HRight = H( winInd, IR(wEnd,colEnd) );
+        auto HAbove = H( IR(rowBeg,wBeg), winInd );
+        ApplyAdjointLeft( U, HRight );
+        ApplyRight( HAbove, U );
+        if( wantQ )
+        {
+            auto QWin = Q( ALL, winInd );
+            ApplyRight( QWin, U );
+        }
+
+        // The next window begins just above the top active bulge (or at the
+        // top of the active block if bulges remain to be introduced)
+        bool introduced = true;
+        Int nextBeg = iHi;
+        for( Int j=0; j<numBulges; ++j )
+        {
+            if( rows[j] < 0 )
+                introduced = false;
+            else if( rows[j] <= iHi-2 )
+                nextBeg = Min( nextBeg, rows[j]-1 );
+        }
+        if( !introduced )
+            nextBeg = iLo;
+        if( nextBeg == iHi )
+            break;
+        wBeg = nextBeg;
+    }
+}
+
+// Choose (up to) numShifts shifts from the bottom of the list of eigenvalues
+// of the undeflated portion of the AED window. In the real case, complex
+// conjugate pairs are kept together, and the real shifts are paired up.
+template<typename F>
+inline vector<Complex<Base<F>>>
+SelectShifts( const Matrix<Complex<Base<F>>>& w, Int numShifts )
+{
+    typedef Complex<Base<F>> C;
+    vector<C> shifts, realShifts;
+    Int i = w.Height()-1;
+    Int count = 0;
+    while( i >= 0 && count < numShifts )
+    {
+        if( !IsComplex<F>::val && ImagPart(w.Get(i,0)) != Base<F>(0) && i > 0 )
+        {
+            shifts.push_back( w.Get(i-1,0) );
+            shifts.push_back( w.Get(i,0) );
+            i -= 2;
+            count += 2;
+        }
+        else
+        {
+            realShifts.push_back( w.Get(i,0) );
+            --i;
+            ++count;
+        }
+    }
+    if( realShifts.size() % 2 )
+        realShifts.pop_back();
+    shifts.insert( shifts.end(), realShifts.begin(), realShifts.end() );
+    return shifts;
+}
+
+// Ad-hoc shifts, which are used after several iterations without deflation,
+// in the manner of xLAQR0
+template<typename F>
+inline vector<Complex<Base<F>>>
+ExceptionalShifts( const DistMatrix<F>& H, Int iLo, Int iHi, Int numShifts )
+{
+    typedef Base<F> Real;
+    typedef Complex<Real> C;
+    const Real wilk1 = Real(3)/Real(4);
+    const Real wilk2 = Sqrt(Real(7)/Real(16));
+    vector<C> shifts;
+    for( Int i=iHi-1; i>=Max(iLo+2,iHi-numShifts); i-=2 )
+    {
+        const Real scale = Abs(H.Get(i,i-1)) + Abs(H.Get(i-1,i-2));
+        const C alpha = C(H.Get(i,i)) + wilk1*scale;
+        if( IsComplex<F>::val )
+        {
+            shifts.push_back( alpha );
+            shifts.push_back( alpha );
+        }
+        else
+        {
+            shifts.push_back( C(RealPart(alpha), wilk2*scale) );
+            shifts.push_back( C(RealPart(alpha),-wilk2*scale) );
+        }
+    }
+    return shifts;
+}
+
+template<typename F>
+void Helper
+( DistMatrix<F>& H, AbstractDistMatrix<Complex<Base<F>>>& w,
+  DistMatrix<F>& Q, bool wantQ, bool fullTriangle, const HessQRCtrl& ctrl );
+
+// Redundantly compute the Schur decomposition of the active block [iLo,iHi)
+template<typename F>
+inline void
+SolveWindow
+( DistMatrix<F>& H, DistMatrix<F>& Q, bool wantQ, bool fullTriangle,
+  Int iLo, Int iHi )
+{
+    DEBUG_ONLY(CSE cse("schur::hess_qr::SolveWindow"))
+    const Grid& g = H.Grid();
+    const Int n = H.Height();
+    const Int nWin = iHi - iLo;
+    const Int rowBeg = ( fullTriangle ? 0 : iLo );
+    const Int colEnd = ( fullTriangle ? n : iHi );
+
+    const Range<Int> winInd( iLo, iHi );
+    auto HWin = H( winInd, winInd );
+    DistMatrix<F,STAR,STAR> T_STAR_STAR( HWin ), Z(g);
+    Z.Resize( nWin, nWin );
+    Matrix<Complex<Base<F>>> wWin( nWin, 1 );
+    lapack::HessenbergSchur
+    ( nWin, T_STAR_STAR.Buffer(), T_STAR_STAR.LDim(), wWin.Buffer(),
+      Z.Buffer(), Z.LDim(), true, false );
+    HWin = T_STAR_STAR;
+
+    auto HRight = H( winInd, IR(iHi,colEnd) );
+    auto HAbove = H( IR(rowBeg,iLo), winInd );
+    ApplyAdjointLeft( Z, HRight );
+    ApplyRight( HAbove, Z );
+    if( wantQ )
+    {
+        auto QWin = Q( ALL, winInd );
+        ApplyRight( QWin, Z );
+    }
+}
+
+// Aggressive early deflation over the window [iHi-nw,iHi) of the active block
+// [iLo,iHi). The number of deflated eigenvalues is returned, and the
+// eigenvalues of the undeflated portion of the window are returned in 'w'
+// for use as shifts.
+template<typename F>
+inline Int
+AED
+( DistMatrix<F>& H, DistMatrix<F>& Q, bool wantQ, bool fullTriangle,
+  Int iLo, Int iHi, Int nw, const HessQRCtrl& ctrl,
+  Matrix<Complex<Base<F>>>& w )
+{
+    DEBUG_ONLY(CSE cse("schur::hess_qr::AED"))
+    typedef Base<F> Real;
+    const Grid& g = H.Grid();
+    const Int n = H.Height();
+    const Int rowBeg = ( fullTriangle ? 0 : iLo );
+    const Int colEnd = ( fullTriangle ? n : iHi );
+    const Real ulp = lapack::MachinePrecision<Real>();
+    const Real safeMin = lapack::MachineSafeMin<Real>();
+    const Real smallNum = safeMin*(Real(n)/ulp);
+
+    const Int kwTop = iHi - nw;
+    const F spike = ( kwTop > iLo ? H.Get(kwTop,kwTop-1) : F(0) );
+    const Range<Int> winInd( kwTop, iHi );
+    auto HWin = H( winInd, winInd );
+
+    // Compute the Schur decomposition of the window, T = V^H H_W V
+    DistMatrix<F,STAR,STAR> T_STAR_STAR(g), V(g);
+    if( ctrl.distAED && nw > MinMultiBulgeSize(ctrl) )
+    {
+        DistMatrix<F> TWin( HWin ), VWin(g);
+        Identity( VWin, nw, nw );
+        DistMatrix<Complex<Real>,STAR,STAR> wWin(g);
+        HessQRCtrl winCtrl( ctrl );
+        winCtrl.distAED = false;
+        Helper( TWin, wWin, VWin, true, true, winCtrl );
+        T_STAR_STAR = TWin;
+        V = VWin;
+    }
+    else
+    {
+        T_STAR_STAR = HWin;
+        V.Resize( nw, nw );
+        Matrix<Complex<Real>> wWin( nw, 1 );
+        lapack::HessenbergSchur
+        ( nw, T_STAR_STAR.Buffer(), T_STAR_STAR.LDim(), wWin.Buffer(),
+          V.Buffer(), V.LDim(), true, false );
+    }
+    Matrix<F>& T = T_STAR_STAR.Matrix();
+    Matrix<F>& VLoc = V.Matrix();
+
+    // Test the (1x1 and 2x2) diagonal blocks of T for deflation from the
+    // bottom up, moving each undeflatable block to the top of the window. If
+    // a block is too ill-conditioned to be moved (T and V remain consistent,
+    // but T may have been partially reordered), the remainder of the window
+    // is conservatively treated as undeflated.
+    Int numUndeflated = nw;
+    Int iLast = 0;
+    while( iLast < numUndeflated )
+    {
+        const Int k = numUndeflated-1;
+        const bool twoByTwo =
+          !IsComplex<F>::val && k > 0 && T.Get(k,k-1) != F(0);
+        if( twoByTwo )
+        {
+            Real scale = Abs(T.Get(k,k)) +
+                Sqrt(Abs(T.Get(k,k-1)))*Sqrt(Abs(T.Get(k-1,k)));
+            if( scale == Real(0) )
+                scale = Abs(spike);
+            const Real spikeMax =
+              Max( Abs(spike*VLoc.Get(0,k)), Abs(spike*VLoc.Get(0,k-1)) );
+            if( spikeMax <= Max(smallNum,ulp*scale) )
+                numUndeflated -= 2;
+            else if( lapack::SchurExchange
+                     ( nw, T.Buffer(), T.LDim(), VLoc.Buffer(), VLoc.LDim(),
+                       k-1, iLast ) )
+                iLast += 2;
+            else
+                break;
+        }
+        else
+        {
+            Real scale = Abs(T.Get(k,k));
+            if( scale == Real(0) )
+                scale = Abs(spike);
+            if( Abs(spike*VLoc.Get(0,k)) <= Max(smallNum,ulp*scale) )
+                numUndeflated -= 1;
+            else if( lapack::SchurExchange
+                     ( nw, T.Buffer(), T.LDim(), VLoc.Buffer(), VLoc.LDim(),
+                       k, iLast ) )
+                iLast += 1;
+            else
+                break;
+        }
+    }
+    const Int ns = numUndeflated;
+    const Int numDeflated = nw - ns;
+    QuasiTriangEig( T(IR(0,ns),IR(0,ns)), w );
+
+    // If nothing deflated, the window is left untouched
+    if( numDeflated == 0 && spike != F(0) )
+        return 0;
+
+    // Reduce the undeflated portion of the window (with its spike) back to
+    // Hessenberg form
+    F beta = 0;
+    if( ns > 0 && spike != F(0) )
+    {
+        Matrix<F> x( ns, 1 );
+        for( Int i=0; i<ns; ++i )
+            x.Set( i, 0, spike*Conj(VLoc.Get(0,i)) );
+        if( ns == 1 )
+            beta = x.Get(0,0);
+        else
+        {
+            beta = x.Get(0,0);
+            auto x1 = x( IR(1,ns), ALL );
+            const F tau = LeftReflector( beta, x1 );
+            x.Set( 0, 0, F(1) );
+            ApplyReflector( T, VLoc, 0, 0, ns, tau, x.Buffer(), 0, nw );
+
+            if( ns > 2 )
+            {
+                auto T11 = T( IR(0,ns), IR(0,ns) );
+                auto T12 = T( IR(0,ns), IR(ns,nw) );
+                auto V1 = VLoc( ALL, IR(0,ns) );
+                Matrix<F> t;
+                Hessenberg( UPPER, T11, t );
+                hessenberg::ApplyQ( LEFT, UPPER, ADJOINT, T11, t, T12 );
+                hessenberg::ApplyQ( RIGHT, UPPER, NORMAL, T11, t, V1 );
+            }
+        }
+    }
+    MakeTrapezoidal( UPPER, T, -1 );
+    auto T21 = T( IR(ns,nw), IR(0,ns) );
+    Zero( T21 );
+
+    // Write the window (and the spike) back and apply V to the rest of H
+    HWin = T_STAR_STAR;
+    if( kwTop > iLo )
+        H.Set( kwTop, kwTop-1, beta );
+    auto HRight = H( winInd, IR(iHi,colEnd) );
+    auto HAbove = H( IR(rowBeg,kwTop), winInd );
+    ApplyAdjointLeft( V, HRight );
+    ApplyRight( HAbove, V );
+    if( wantQ )
+    {
+        auto QWin = Q( ALL, winInd );
+        ApplyRight( QWin, V );
+    }
+    return numDeflated;
+}
+
+template<typename F>
+void Helper
+( DistMatrix<F>& H, AbstractDistMatrix<Complex<Base<F>>>& w,
+  DistMatrix<F>& Q, bool wantQ, bool fullTriangle, const HessQRCtrl& ctrl )
+{
+    DEBUG_ONLY(CSE cse("schur::hess_qr::Helper"))
+    typedef Base<F> Real;
+    const Int n = H.Height();
+    const Grid& g = H.Grid();
+    const Real ulp = lapack::MachinePrecision<Real>();
+    const Real safeMin = lapack::MachineSafeMin<Real>();
+    const Real smallNum = safeMin*(Real(n)/ulp);
+
+    const Int minMultiBulgeSize = MinMultiBulgeSize( ctrl );
+    const Int numShiftsMax =
+      ( ctrl.numShifts > 0 ? ctrl.numShifts : NumShifts(n) );
+    const Int deflationMax =
+      ( ctrl.deflationSize > 0 ? ctrl.deflationSize :
+        ( n < 500 ? NumShifts(n) : 3*NumShifts(n)/2 ) );
+    // The percentage of the deflation window which must deflate in order to
+    // skip the following sweep
+    const Int nibble = 14;
+    // The number of iterations without deflation before exceptional shifts
+    const Int exceptionalPeriod = 6;
+    const Int maxIts = 30*Max(n,Int(10));
+
+    DistMatrix<F,STAR,STAR> d_STAR_STAR(g), dSub_STAR_STAR(g);
+    Matrix<Complex<Real>> wUndeflated;
+    Int iHi = n;
+    Int numIts = 0, numNoDeflation = 0;
+    while( iHi > 0 )
+    {
+        // Search for a negligible subdiagonal entry to split off the active
+        // block [iLo,iHi)
+        auto HAct = H( IR(0,iHi), IR(0,iHi) );
+        d_STAR_STAR = GetDiagonal( HAct );
+        dSub_STAR_STAR = GetDiagonal( HAct, -1 );
+        Int iLo = iHi-1;
+        while( iLo > 0 )
+        {
+            const Real subAbs = Abs(dSub_STAR_STAR.GetLocal(iLo-1,0));
+            Real scale = Abs(d_STAR_STAR.GetLocal(iLo-1,0)) +
+                         Abs(d_STAR_STAR.GetLocal(iLo,0));
+            if( scale == Real(0) )
+            {
+                if( iLo-2 >= 0 )
+                    scale += Abs(dSub_STAR_STAR.GetLocal(iLo-2,0));
+                if( iLo+1 < iHi )
+                    scale += Abs(dSub_STAR_STAR.GetLocal(iLo,0));
+            }
+            if( subAbs <= Max(smallNum,ulp*scale) )
+                break;
+            --iLo;
+        }
+        if( iLo > 0 )
+            H.Set( iLo, iLo-1, F(0) );
+
+        const Int winSize = iHi - iLo;
+        if( winSize <= minMultiBulgeSize )
+        {
+            SolveWindow( H, Q, wantQ, fullTriangle, iLo, iHi );
+            iHi = iLo;
+            numNoDeflation = 0;
+            continue;
+        }
+        if( ++numIts > maxIts )
+            RuntimeError("Hessenberg QR algorithm did not converge");
+
+        Int numShifts = Min( numShiftsMax, winSize-1 );
+        numShifts = Max( Int(2), numShifts-numShifts%2 );
+        const Int nw = Max( Int(2), Min( deflationMax, winSize-1 ) );
+        const Int numDeflated =
+          AED( H, Q, wantQ, fullTriangle, iLo, iHi, nw, ctrl, wUndeflated );
+        const Int iHiNew = iHi - numDeflated;
+        if( numDeflated > 0 )
+            numNoDeflation = 0;
+        else
+            ++numNoDeflation;
+
+        // Sweep unless a large enough portion of the window deflated
+        if( (numDeflated == 0 || 100*numDeflated <= nibble*nw) &&
+            iHiNew-iLo > minMultiBulgeSize )
+        {
+            vector<Complex<Real>> shifts;
+            if( numNoDeflation > 0 && numNoDeflation % exceptionalPeriod == 0 )
+                shifts = ExceptionalShifts( H, iLo, iHiNew, numShifts );
+            else
+                shifts = SelectShifts<F>( wUndeflated, numShifts );
+            if( shifts.size() >= 2 )
+                Sweep
+                ( H, Q, wantQ, fullTriangle, iLo, iHiNew, shifts, 
+                  ctrl.chaseAdvance );
+        }
+        iHi = iHiNew;
+    }
+    QuasiTriangEig( H, w );
+}
+
+} // namespace hess_qr
+
+// Compute the Schur decomposition of the upper Hessenberg matrix H,
+// H = Z T Z^H, overwriting H with T (or, if fullTriangle is false, only its
+// diagonal blocks)
+template<typename F>
+inline void
+HessenbergQR
+( DistMatrix<F>& H, AbstractDistMatrix<Complex<Base<F>>>& w,
+  bool fullTriangle, const HessQRCtrl& ctrl=HessQRCtrl() )
+{
+    DEBUG_ONLY(CSE cse("schur::HessenbergQR"))
+    DistMatrix<F> Q(H.Grid());
+    hess_qr::Helper( H, w, Q, false, fullTriangle, ctrl );
+}
+
+// As above, but also overwrite Q with Q Z
+template<typename F>
+inline void
+HessenbergQR
+( DistMatrix<F>& H, AbstractDistMatrix<Complex<Base<F>>>& w,
+  DistMatrix<F>& Q, bool fullTriangle, const HessQRCtrl& ctrl=HessQRCtrl() )
+{
+    DEBUG_ONLY(CSE cse("schur::HessenbergQR"))
+    hess_qr::Helper( H, w, Q, true, fullTriangle, ctrl );
+}
+
+} // namespace schur
+} // namespace El
+
+#endif // ifndef EL_SCHUR_HESSENBERGQR_HPP
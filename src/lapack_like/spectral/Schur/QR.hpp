@@ -51,6 +51,52 @@ QR
     }
 }
 
+// Reduce A to upper Hessenberg form and then run the native multishift QR
+// algorithm (see HessenbergQR.hpp)
+template<typename F>
+inline void
+NativeQR
+( DistMatrix<F>& A, AbstractDistMatrix<Complex<Base<F>>>& w,
+  bool fullTriangle, const HessQRCtrl& ctrl )
+{
+    DEBUG_ONLY(CSE cse("schur::NativeQR"))
+    DistMatrix<F,STAR,STAR> t( A.Grid() );
+    Hessenberg( UPPER, A, t );
+    MakeTrapezoidal( UPPER, A, -1 );
+    HessenbergQR( A, w, fullTriangle, ctrl );
+    if( IsComplex<F>::val )
+        MakeTrapezoidal( UPPER, A );
+    else
+    {
+        MakeTrapezoidal( UPPER, A, -1 );
+        DEBUG_ONLY(CheckRealSchur(A))
+    }
+}
+
+template<typename F>
+inline void
+NativeQR
+( DistMatrix<F>& A, AbstractDistMatrix<Complex<Base<F>>>& w,
+  DistMatrix<F>& Q, bool fullTriangle, const HessQRCtrl& ctrl )
+{
+    DEBUG_ONLY(CSE cse("schur::NativeQR"))
+    const Int n = A.Height();
+    DistMatrix<F,STAR,STAR> t( A.Grid() );
+    Hessenberg( UPPER, A, t );
+    // There is not yet a 'form Q'
+    Identity( Q, n, n );
+    hessenberg::ApplyQ( LEFT, UPPER, NORMAL, A, t, Q );
+    MakeTrapezoidal( UPPER, A, -1 );
+    HessenbergQR( A, w, Q, fullTriangle, ctrl );
+    if( IsComplex<F>::val )
+        MakeTrapezoidal( UPPER, A );
+    else
+    {
+        MakeTrapezoidal( UPPER, A, -1 );
+        DEBUG_ONLY(CheckRealSchur(A))
+    }
+}
+
 template<typename F>
 inline void
 QR
@@ -58,6 +104,13 @@ QR
   bool fullTriangle, const HessQRCtrl& ctrl )
 {
     DEBUG_ONLY(CSE cse("schur::QR"))
+    if( !ctrl.scalapack )
+    {
+        DistMatrix<F> AElem( A );
+        NativeQR( AElem, w, fullTriangle, ctrl );
+        A = AElem;
+        return;
+    }
 #ifdef EL_HAVE_SCALAPACK
     const Int n = A.Height();
     const int bhandle = blacs::Handle( A.DistComm().comm );
@@ -101,7 +154,7 @@ QR
     blacs::FreeHandle( bhandle );
     blacs::Exit();
 #else
-    LogicError("Distributed schur::QR currently requires ScaLAPACK support");
+    LogicError("ScaLAPACK support was not enabled");
 #endif
     if( IsComplex<F>::val )
         MakeTrapezoidal( UPPER, A );
@@ -120,6 +173,14 @@ QR
   BlockDistMatrix<F>& Q, bool fullTriangle, const HessQRCtrl& ctrl )
 {
     DEBUG_ONLY(CSE cse("schur::QR"))
+    if( !ctrl.scalapack )
+    {
+        DistMatrix<F> AElem( A ), QElem( A.Grid() );
+        NativeQR( AElem, w, QElem, fullTriangle, ctrl );
+        A = AElem;
+        Q = QElem;
+        return;
+    }
 #ifdef EL_HAVE_SCALAPACK
     const Int n = A.Height();
     const int bhandle = blacs::Handle( A.DistComm().comm );
@@ -181,7 +242,7 @@ QR
     blacs::FreeHandle( bhandle );
     blacs::Exit();
 #else
-    LogicError("Distributed schur::QR currently requires ScaLAPACK support");
+    LogicError("ScaLAPACK support was not enabled");
 #endif
     if( IsComplex<F>::val )
         MakeTrapezoidal( UPPER, A );
@@ -202,6 +263,11 @@ QR
     DEBUG_ONLY(CSE cse("schur::QR"))
     auto APtr = ReadWriteProxy<F,MC,MR>( &APre );
     auto& A = *APtr;
+    if( !ctrl.scalapack )
+    {
+        NativeQR( A, w, fullTriangle, ctrl );
+        return;
+    }
 #ifdef EL_HAVE_SCALAPACK
     // Reduce the matrix to upper-Hessenberg form in an elemental form
     DistMatrix<F,STAR,STAR> t( A.Grid() );
@@ -209,7 +275,6 @@ QR
     MakeTrapezoidal( UPPER, A, -1 );
 
     // Run the QR algorithm in block form
-    // TODO: Create schur::HessenbergQR
     const Int n = A.Height(); 
     const Int mb = ctrl.blockHeight;
     const Int nb = ctrl.blockWidth;
@@ -240,7 +305,7 @@ QR
     blacs::FreeHandle( bhandle );
     blacs::Exit();
 #else
-    LogicError("Distributed schur::QR currently requires ScaLAPACK support");
+    LogicError("ScaLAPACK support was not enabled");
 #endif
     if( IsComplex<F>::val )
         MakeTrapezoidal( UPPER, A );
@@ -260,6 +325,11 @@ QR
     DEBUG_ONLY(CSE cse("schur::QR"))
     auto APtr = ReadWriteProxy<F,MC,MR>( &APre ); auto& A = *APtr;
     auto QPtr = WriteProxy<F,MC,MR>( &QPre );     auto& Q = *QPtr;
+    if( !ctrl.scalapack )
+    {
+        NativeQR( A, w, Q, fullTriangle, ctrl );
+        return;
+    }
 #ifdef EL_HAVE_SCALAPACK
     const Int n = A.Height();
     // Reduce A to upper-Hessenberg form in an element-wise distribution
@@ -313,7 +383,7 @@ QR
     blacs::FreeHandle( bhandle );
     blacs::Exit();
 #else
-    LogicError("Distributed schur::QR currently requires ScaLAPACK support");
+    LogicError("ScaLAPACK support was not enabled");
 #endif
     if( IsComplex<F>::val )
         MakeTrapezoidal( UPPER, A );
@@ -0,0 +1,164 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, Stanford University, and the
+   Georgia Insitute of Technology.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+namespace El {
+
+// The elimination is performed on the quotient graph, where each eliminated
+// vertex becomes an element whose variables form a clique. The external
+// degree of each variable adjacent to the new element p is bounded as in
+// Amestoy, Davis, and Duff's AMD:
+//
+//   d_i <= min( n-k-1, d_i + |L_p \ i|, |A_i \ i| + |L_p \ i| +
+//               sum_{e in E_i \ p} |L_e \ L_p| ),
+//
+// and elements whose variables are all within L_p are (aggressively)
+// absorbed. Indistinguishable variables are not detected, which only
+// affects the running time.
+
+void ApproximateMinimumDegree( const Graph& graph, vector<Int>& perm )
+{
+    DEBUG_ONLY(CSE cse("ApproximateMinimumDegree"))
+    const Int n = graph.NumSources();
+
+    // Form the symmetric variable adjacency
+    vector<vector<Int>> varAdj( n );
+    for( Int s=0; s<n; ++s )
+    {
+        const Int off = graph.EdgeOffset( s );
+        const Int numConnections = graph.NumConnections( s );
+        for( Int t=0; t<numConnections; ++t )
+        {
+            const Int target = graph.Target( off+t );
+            if( target != s && target < n )
+            {
+                varAdj[s].push_back( target );
+                varAdj[target].push_back( s );
+            }
+        }
+    }
+    for( auto& adj : varAdj )
+    {
+        std::sort( adj.begin(), adj.end() );
+        adj.erase( std::unique(adj.begin(),adj.end()), adj.end() );
+    }
+
+    const Int VARIABLE=0, ELEMENT=1, ABSORBED=2;
+    vector<Int> status( n, VARIABLE );
+    vector<vector<Int>> elemAdj( n ), elemVars( n );
+    vector<Int> degree( n );
+    std::set<std::pair<Int,Int>> queue;
+    for( Int i=0; i<n; ++i )
+    {
+        degree[i] = varAdj[i].size();
+        queue.insert( std::make_pair(degree[i],i) );
+    }
+
+    vector<Int> mark( n, -1 ), externalStamp( n, -1 ), external( n );
+    vector<Int> newAdj;
+    perm.resize( n );
+    for( Int k=0; k<n; ++k )
+    {
+        const Int p = queue.begin()->second;
+        queue.erase( queue.begin() );
+        perm[p] = k;
+        status[p] = ELEMENT;
+
+        // Form the variables of the new element, absorbing the elements
+        // adjacent to the pivot
+        vector<Int> pVars;
+        mark[p] = k;
+        for( Int i : varAdj[p] )
+        {
+            if( status[i] == VARIABLE && mark[i] != k )
+            {
+                mark[i] = k;
+                pVars.push_back( i );
+            }
+        }
+        for( Int e : elemAdj[p] )
+        {
+            if( status[e] != ELEMENT )
+                continue;
+            for( Int i : elemVars[e] )
+            {
+                if( status[i] == VARIABLE && mark[i] != k )
+                {
+                    mark[i] = k;
+                    pVars.push_back( i );
+                }
+            }
+            status[e] = ABSORBED;
+            SwapClear( elemVars[e] );
+        }
+        SwapClear( varAdj[p] );
+        SwapClear( elemAdj[p] );
+        elemVars[p] = pVars;
+        const Int pSize = pVars.size();
+
+        // Compute |L_e \ L_p| for each element adjacent to L_p
+        for( Int i : pVars )
+        {
+            for( Int e : elemAdj[i] )
+            {
+                if( status[e] != ELEMENT )
+                    continue;
+                if( externalStamp[e] != k )
+                {
+                    externalStamp[e] = k;
+                    external[e] = elemVars[e].size();
+                }
+                --external[e];
+            }
+        }
+
+        // Update the adjacencies and approximate degrees of L_p
+        const Int numRemaining = n - k - 1;
+        for( Int i : pVars )
+        {
+            Int newDegree = pSize - 1;
+
+            newAdj.resize( 0 );
+            for( Int e : elemAdj[i] )
+            {
+                if( status[e] != ELEMENT )
+                    continue;
+                if( external[e] == 0 )
+                {
+                    // Aggressive absorption
+                    status[e] = ABSORBED;
+                    SwapClear( elemVars[e] );
+                    continue;
+                }
+                newDegree += external[e];
+                newAdj.push_back( e );
+            }
+            newAdj.push_back( p );
+            elemAdj[i].swap( newAdj );
+
+            // Variables in L_p are now reached through p
+            newAdj.resize( 0 );
+            for( Int j : varAdj[i] )
+                if( status[j] == VARIABLE && mark[j] != k )
+                    newAdj.push_back( j );
+            varAdj[i].swap( newAdj );
+            newDegree += varAdj[i].size();
+
+            newDegree = Min( newDegree, degree[i]+pSize-1 );
+            newDegree = Max( Min( newDegree, numRemaining-1 ), Int(0) );
+            queue.erase( std::make_pair(degree[i],i) );
+            degree[i] = newDegree;
+            queue.insert( std::make_pair(degree[i],i) );
+        }
+    }
+}
+
+} // namespace El
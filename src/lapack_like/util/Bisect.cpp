@@ -12,7 +12,7 @@
 
 #ifdef EL_HAVE_PARMETIS
 # include "parmetis.h"
-#else
+#elif defined(EL_HAVE_METIS)
 # include "metis.h"
 #endif
 
@@ -24,6 +24,9 @@ Int Bisect
 {
     DEBUG_ONLY(CSE cse("Bisect"))
 #ifdef EL_HAVE_METIS
+    if( ctrl.native )
+        return MultilevelBisect( graph, leftChild, rightChild, perm, ctrl );
+
     // METIS assumes that there are no self-connections or connections 
     // outside the sources, so we must manually remove them from our graph
     const Int numSources = graph.NumSources();
@@ -91,8 +94,7 @@ Int Bisect
     ( graph, perm, sizes[0], leftChild, sizes[1], rightChild );
     return sizes[2];
 #else
-    LogicError("METIS interface was not available");
-    return -1;
+    return MultilevelBisect( graph, leftChild, rightChild, perm, ctrl );
 #endif
 }
 
@@ -105,6 +107,14 @@ Int Bisect
 {
     DEBUG_ONLY(CSE cse("Bisect"))
 #ifdef EL_HAVE_METIS
+# ifdef EL_HAVE_PARMETIS
+    const bool haveParMETIS = true;
+# else
+    const bool haveParMETIS = false;
+# endif
+    if( ctrl.native || (!ctrl.sequential && !haveParMETIS) )
+        return MultilevelBisect( graph, child, perm, onLeft, ctrl );
+
     mpi::Comm comm = graph.Comm();
     const int commSize = mpi::Size( comm );
     const int commRank = mpi::Rank( comm );
@@ -295,8 +305,7 @@ Int Bisect
     BuildChildFromPerm( graph, perm, sizes[0], sizes[1], onLeft, child );
     return sizes[2];
 #else
-    LogicError("METIS was not available");
-    return -1;
+    return MultilevelBisect( graph, child, perm, onLeft, ctrl );
 #endif
 }
 
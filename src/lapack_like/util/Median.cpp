@@ -10,48 +10,194 @@
 
 namespace El {
 
+namespace selection {
+
+// Ties in value are broken by the index so that the k'th entry is unique
 template<typename Real>
-ValueInt<Real> Median( const Matrix<Real>& x )
+inline bool Lesser( const ValueInt<Real>& a, const ValueInt<Real>& b )
+{ return a.value < b.value || (a.value == b.value && a.index < b.index); }
+
+// Once this few candidates remain, they are gathered onto every process
+const Int gatherCutoff = 4096;
+
+} // namespace selection
+
+template<typename Real>
+ValueInt<Real> Select( const Matrix<Real>& x, Int k )
 {
-    DEBUG_ONLY(CSE cse("Median"))
+    DEBUG_ONLY(CSE cse("Select"))
     if( IsComplex<Real>::val )
         LogicError("Complex numbers do not have a natural ordering");
     const Int m = x.Height();
     const Int n = x.Width();
     if( m != 1 && n != 1 )
-        LogicError("Median is meant for a single vector");
+        LogicError("Select is meant for a single vector");
 
-    const Int k = ( n==1 ? m : n );
+    const Int length = ( n==1 ? m : n );
     const Int stride = ( n==1 ? 1 : x.LDim() );
     const Real* xBuffer = x.LockedBuffer();
+    if( k < 0 || k >= length )
+        LogicError("Invalid selection index, ",k,", for length ",length);
 
-    vector<ValueInt<Real>> pairs( k );
-    for( Int i=0; i<k; ++i )
+    vector<ValueInt<Real>> pairs( length );
+    for( Int i=0; i<length; ++i )
     {
         pairs[i].value = xBuffer[i*stride];
         pairs[i].index = i;
     }
-    std::sort( pairs.begin(), pairs.end(), ValueInt<Real>::Lesser );
-
-    return pairs[k/2];
+    std::nth_element
+    ( pairs.begin(), pairs.begin()+k, pairs.end(), selection::Lesser<Real> );
+    return pairs[k];
 }
 
+// A distributed quickselect: each round, the pivot is the median of the
+// local medians of the remaining candidates (weighted by the number of local
+// candidates), which guarantees that at least a quarter of the candidates are
+// discarded, and so only O(log n) rounds of small reductions are required
+// before the remaining candidates are gathered
 template<typename Real>
-ValueInt<Real> Median( const AbstractDistMatrix<Real>& x )
+ValueInt<Real> Select( const AbstractDistMatrix<Real>& x, Int k )
 {
-    DEBUG_ONLY(CSE cse("Median"))
+    DEBUG_ONLY(CSE cse("Select"))
     if( x.ColDist() == STAR && x.RowDist() == STAR )
-    {
-        return Median( x.LockedMatrix() );
-    }
+        return Select( x.LockedMatrix(), k );
+    if( x.Height() != 1 && x.Width() != 1 )
+        LogicError("Select is meant for a single vector");
+    const Int length = Max( x.Height(), x.Width() );
+    if( k < 0 || k >= length )
+        LogicError("Invalid selection index, ",k,", for length ",length);
+
+    const Grid& g = x.Grid();
+    DistMatrix<Real,VC,STAR> x_VC_STAR(g);
+    if( x.Width() == 1 )
+        x_VC_STAR = x;
     else
+        Transpose( x, x_VC_STAR );
+    ValueInt<Real> pivot;
+    pivot.value = 0;
+    pivot.index = -1;
+    if( x_VC_STAR.Participating() )
     {
-        DistMatrix<Real,STAR,STAR> x_STAR_STAR( x );
-        return Median( x_STAR_STAR.LockedMatrix() );
+        mpi::Comm comm = x_VC_STAR.ColComm();
+        const int commSize = mpi::Size( comm );
+        const Int numLocal = x_VC_STAR.LocalHeight();
+        vector<ValueInt<Real>> pairs( numLocal );
+        for( Int iLoc=0; iLoc<numLocal; ++iLoc )
+        {
+            pairs[iLoc].value = x_VC_STAR.GetLocal(iLoc,0);
+            pairs[iLoc].index = x_VC_STAR.GlobalRow(iLoc);
+        }
+
+        Int numActive = length;
+        vector<ValueInt<Real>> medians( commSize );
+        vector<Int> weights( commSize );
+        while( numActive > selection::gatherCutoff )
+        {
+            // Choose the weighted median of the local medians as the pivot
+            ValueInt<Real> localMedian = pivot;
+            const Int numLocalActive = pairs.size();
+            if( numLocalActive > 0 )
+            {
+                auto mid = pairs.begin() + numLocalActive/2;
+                std::nth_element
+                ( pairs.begin(), mid, pairs.end(), selection::Lesser<Real> );
+                localMedian = *mid;
+            }
+            mpi::AllGather( &localMedian, 1, medians.data(), 1, comm );
+            mpi::AllGather( &numLocalActive, 1, weights.data(), 1, comm );
+            vector<Int> order;
+            for( int q=0; q<commSize; ++q )
+                if( weights[q] > 0 )
+                    order.push_back( q );
+            std::sort
+            ( order.begin(), order.end(),
+              [&]( int a, int b )
+              { return selection::Lesser<Real>( medians[a], medians[b] ); } );
+            Int weightSum = 0;
+            for( auto q : order )
+            {
+                weightSum += weights[q];
+                pivot = medians[q];
+                if( 2*weightSum >= numActive )
+                    break;
+            }
+
+            // Partition the local candidates about the pivot
+            auto split =
+              std::partition
+              ( pairs.begin(), pairs.end(),
+                [&]( const ValueInt<Real>& alpha )
+                { return selection::Lesser<Real>( alpha, pivot ); } );
+            const Int numLesser =
+              mpi::AllReduce( Int(split-pairs.begin()), comm );
+            if( k < numLesser )
+            {
+                pairs.erase( split, pairs.end() );
+                numActive = numLesser;
+            }
+            else if( k == numLesser )
+            {
+                numActive = 0;
+                break;
+            }
+            else
+            {
+                // Discard the lesser candidates and the pivot itself
+                pairs.erase( pairs.begin(), split );
+                pairs.erase
+                ( std::remove_if
+                  ( pairs.begin(), pairs.end(),
+                    [&]( const ValueInt<Real>& alpha )
+                    { return alpha.index == pivot.index; } ),
+                  pairs.end() );
+                k -= numLesser+1;
+                numActive -= numLesser+1;
+            }
+        }
+        if( numActive > 0 )
+        {
+            // Gather the remaining candidates and select locally
+            const int numLocalActive = pairs.size();
+            vector<int> sizes( commSize ), offs( commSize );
+            mpi::AllGather( &numLocalActive, 1, sizes.data(), 1, comm );
+            int offset = 0;
+            for( int q=0; q<commSize; ++q )
+            {
+                offs[q] = offset;
+                offset += sizes[q];
+            }
+            vector<ValueInt<Real>> active( numActive );
+            mpi::AllGather
+            ( pairs.data(), numLocalActive,
+              active.data(), sizes.data(), offs.data(), comm );
+            std::nth_element
+            ( active.begin(), active.begin()+k, active.end(),
+              selection::Lesser<Real> );
+            pivot = active[k];
+        }
     }
+    return pivot;
+}
+
+template<typename Real>
+ValueInt<Real> Median( const Matrix<Real>& x )
+{
+    DEBUG_ONLY(CSE cse("Median"))
+    const Int length = Max( x.Height(), x.Width() );
+    return Select( x, length/2 );
+}
+
+template<typename Real>
+ValueInt<Real> Median( const AbstractDistMatrix<Real>& x )
+{
+    DEBUG_ONLY(CSE cse("Median"))
+    const Int length = Max( x.Height(), x.Width() );
+    return Select( x, length/2 );
 }
 
 #define PROTO(Real) \
+  template ValueInt<Real> Select( const Matrix<Real>& x, Int k ); \
+  template ValueInt<Real> Select( const AbstractDistMatrix<Real>& x, Int k ); \
   template ValueInt<Real> Median( const Matrix<Real>& x ); \
   template ValueInt<Real> Median( const AbstractDistMatrix<Real>& x );
 
@@ -0,0 +1,1084 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, Stanford University, and the
+   Georgia Insitute of Technology.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+// A multilevel vertex-separator computation in the spirit of METIS: the graph
+// is repeatedly coarsened by contracting heavy-edge matchings, the coarsest
+// graph is bisected by greedy graph growing, and the bisection is projected
+// back through the levels with Fiduccia-Mattheyses refinement of the edge cut.
+// The vertex separator is then a minimum vertex cover of the cut edges.
+//
+// The distributed variant only matches vertices owned by the same process
+// (so that each coarse vertex is owned by the process which owned its
+// constituents), gathers the coarse graph once it is small, and refines the
+// projected bisections with a boundary greedy method whose moves in each
+// pass are all in the same direction. As with ParMETIS, the distributed graph
+// is assumed to be structurally symmetric.
+
+namespace El {
+
+namespace {
+
+const Int coarsestSize = 100;
+const Int distCoarsestSize = 5000;
+const double maxImbalance = 1.1;
+const double minCoarsening = 0.95;
+const Int numGrowTrials = 4;
+const Int maxRefinePasses = 8;
+const Int maxFruitlessMoves = 100;
+
+// A graph without self-connections whose vertices and edges are weighted
+struct WeightedGraph
+{
+    Int numVertices=0;
+    vector<Int> offsets, targets, edgeWeights, vertexWeights;
+};
+
+Int TotalWeight( const vector<Int>& vertexWeights )
+{
+    Int totalWeight = 0;
+    for( Int weight : vertexWeights )
+        totalWeight += weight;
+    return totalWeight;
+}
+
+Int MaxPartWeight( Int totalWeight )
+{
+    const Int maxWeight = Int(std::ceil(maxImbalance*totalWeight/2));
+    return Max( maxWeight, (totalWeight+1)/2 );
+}
+
+Int EdgeCut( const WeightedGraph& graph, const vector<Int>& part )
+{
+    Int cut = 0;
+    for( Int u=0; u<graph.numVertices; ++u )
+        for( Int e=graph.offsets[u]; e<graph.offsets[u+1]; ++e )
+            if( part[graph.targets[e]] != part[u] )
+                cut += graph.edgeWeights[e];
+    return cut/2;
+}
+
+void Contract
+( const WeightedGraph& fine, const vector<Int>& match,
+  WeightedGraph& coarse, vector<Int>& coarseMap )
+{
+    const Int n = fine.numVertices;
+    coarseMap.resize( n );
+    vector<Int> reps;
+    reps.reserve( n );
+    for( Int u=0; u<n; ++u )
+    {
+        if( match[u] >= u )
+        {
+            coarseMap[u] = reps.size();
+            coarseMap[match[u]] = reps.size();
+            reps.push_back( u );
+        }
+    }
+    const Int numCoarse = reps.size();
+
+    coarse.numVertices = numCoarse;
+    coarse.vertexWeights.resize( numCoarse );
+    coarse.offsets.resize( numCoarse+1 );
+    coarse.targets.resize( 0 );
+    coarse.edgeWeights.resize( 0 );
+    vector<Int> position( numCoarse, -1 );
+    for( Int c=0; c<numCoarse; ++c )
+    {
+        coarse.offsets[c] = coarse.targets.size();
+        const Int u = reps[c];
+        const Int members[2] = { u, match[u] };
+        const Int numMembers = ( match[u] == u ? 1 : 2 );
+        coarse.vertexWeights[c] = 0;
+        for( Int m=0; m<numMembers; ++m )
+        {
+            const Int v = members[m];
+            coarse.vertexWeights[c] += fine.vertexWeights[v];
+            for( Int e=fine.offsets[v]; e<fine.offsets[v+1]; ++e )
+            {
+                const Int d = coarseMap[fine.targets[e]];
+                if( d == c )
+                    continue;
+                if( position[d] < coarse.offsets[c] )
+                {
+                    position[d] = coarse.targets.size();
+                    coarse.targets.push_back( d );
+                    coarse.edgeWeights.push_back( fine.edgeWeights[e] );
+                }
+                else
+                    coarse.edgeWeights[position[d]] += fine.edgeWeights[e];
+            }
+        }
+    }
+    coarse.offsets[numCoarse] = coarse.targets.size();
+}
+
+// Contract a heavy-edge matching (visiting the vertices in a random order)
+void Coarsen
+( const WeightedGraph& fine, WeightedGraph& coarse, vector<Int>& coarseMap,
+  Int maxVertexWeight, std::mt19937& gen )
+{
+    const Int n = fine.numVertices;
+    vector<Int> order( n );
+    for( Int u=0; u<n; ++u )
+        order[u] = u;
+    std::shuffle( order.begin(), order.end(), gen );
+
+    vector<Int> match( n, -1 );
+    for( Int u : order )
+    {
+        if( match[u] != -1 )
+            continue;
+        Int best=-1, bestWeight=-1;
+        for( Int e=fine.offsets[u]; e<fine.offsets[u+1]; ++e )
+        {
+            const Int v = fine.targets[e];
+            if( match[v] == -1 && fine.edgeWeights[e] > bestWeight &&
+                fine.vertexWeights[u]+fine.vertexWeights[v] <= maxVertexWeight )
+            {
+                best = v;
+                bestWeight = fine.edgeWeights[e];
+            }
+        }
+        if( best == -1 )
+            match[u] = u;
+        else
+        {
+            match[u] = best;
+            match[best] = u;
+        }
+    }
+    Contract( fine, match, coarse, coarseMap );
+}
+
+// Grow part 0 in breadth-first order from a random vertex (restarting from
+// a random unvisited vertex for each new connected component)
+void GrowBisection
+( const WeightedGraph& graph, vector<Int>& part, std::mt19937& gen )
+{
+    const Int n = graph.numVertices;
+    const Int targetWeight = TotalWeight(graph.vertexWeights) / 2;
+    part.assign( n, 1 );
+    if( n == 0 )
+        return;
+    vector<bool> visited( n, false );
+    vector<Int> queue;
+    queue.reserve( n );
+    Int head=0, weight=0, numVisited=0;
+    std::uniform_int_distribution<Int> uniform( 0, n-1 );
+    Int scan = uniform( gen );
+    while( weight < targetWeight && numVisited < n )
+    {
+        if( head == Int(queue.size()) )
+        {
+            while( visited[scan] )
+                scan = (scan+1) % n;
+            visited[scan] = true;
+            ++numVisited;
+            queue.push_back( scan );
+        }
+        const Int u = queue[head++];
+        if( weight > 0 && weight+graph.vertexWeights[u] > targetWeight )
+            continue;
+        part[u] = 0;
+        weight += graph.vertexWeights[u];
+        for( Int e=graph.offsets[u]; e<graph.offsets[u+1]; ++e )
+        {
+            const Int v = graph.targets[e];
+            if( !visited[v] )
+            {
+                visited[v] = true;
+                ++numVisited;
+                queue.push_back( v );
+            }
+        }
+    }
+}
+
+// Fiduccia-Mattheyses passes over the boundary vertices which allow
+// uphill moves and then roll back to the best balanced bisection seen
+void RefineBisection
+( const WeightedGraph& graph, vector<Int>& part, Int maxWeight )
+{
+    const Int n = graph.numVertices;
+    vector<Int> gain( n );
+    vector<bool> moved( n ), queued( n );
+    for( Int pass=0; pass<maxRefinePasses; ++pass )
+    {
+        Int partWeights[2] = { 0, 0 };
+        for( Int u=0; u<n; ++u )
+            partWeights[part[u]] += graph.vertexWeights[u];
+
+        std::set<std::pair<Int,Int>> queues[2];
+        for( Int u=0; u<n; ++u )
+        {
+            Int internal=0, external=0;
+            for( Int e=graph.offsets[u]; e<graph.offsets[u+1]; ++e )
+            {
+                if( part[graph.targets[e]] == part[u] )
+                    internal += graph.edgeWeights[e];
+                else
+                    external += graph.edgeWeights[e];
+            }
+            gain[u] = external - internal;
+            moved[u] = false;
+            queued[u] = ( external > 0 );
+            if( queued[u] )
+                queues[part[u]].insert( std::make_pair(-gain[u],u) );
+        }
+
+        Int cut = EdgeCut( graph, part );
+        Int bestCut = cut;
+        Int bestMaxWeight = Max( partWeights[0], partWeights[1] );
+        bool bestFeasible = ( bestMaxWeight <= maxWeight );
+        Int numBest = 0;
+        vector<Int> moves;
+        while( true )
+        {
+            // Choose the side to move from
+            Int from = -1;
+            if( partWeights[0] > maxWeight )
+                from = ( queues[0].empty() ? -1 : 0 );
+            else if( partWeights[1] > maxWeight )
+                from = ( queues[1].empty() ? -1 : 1 );
+            else
+            {
+                Int bestGain = 0;
+                for( Int side=0; side<2; ++side )
+                {
+                    if( queues[side].empty() )
+                        continue;
+                    const Int u = queues[side].begin()->second;
+                    if( partWeights[1-side]+graph.vertexWeights[u] > maxWeight )
+                        continue;
+                    if( from == -1 || gain[u] > bestGain )
+                    {
+                        from = side;
+                        bestGain = gain[u];
+                    }
+                }
+            }
+            if( from == -1 )
+                break;
+
+            const Int u = queues[from].begin()->second;
+            queues[from].erase( queues[from].begin() );
+            queued[u] = false;
+            moved[u] = true;
+            part[u] = 1-from;
+            partWeights[from] -= graph.vertexWeights[u];
+            partWeights[1-from] += graph.vertexWeights[u];
+            cut -= gain[u];
+            moves.push_back( u );
+
+            for( Int e=graph.offsets[u]; e<graph.offsets[u+1]; ++e )
+            {
+                const Int v = graph.targets[e];
+                if( moved[v] )
+                    continue;
+                if( queued[v] )
+                    queues[part[v]].erase( std::make_pair(-gain[v],v) );
+                // The edge (u,v) switched between internal and external
+                if( part[v] == part[u] )
+                    gain[v] -= 2*graph.edgeWeights[e];
+                else
+                    gain[v] += 2*graph.edgeWeights[e];
+                queues[part[v]].insert( std::make_pair(-gain[v],v) );
+                queued[v] = true;
+            }
+
+            const Int maxPartWeight = Max( partWeights[0], partWeights[1] );
+            const bool feasible = ( maxPartWeight <= maxWeight );
+            bool improved;
+            if( feasible )
+                improved = !bestFeasible || cut < bestCut ||
+                           (cut == bestCut && maxPartWeight < bestMaxWeight);
+            else
+                improved = !bestFeasible && maxPartWeight < bestMaxWeight;
+            if( improved )
+            {
+                bestCut = cut;
+                bestMaxWeight = maxPartWeight;
+                bestFeasible = feasible;
+                numBest = moves.size();
+            }
+            else if( Int(moves.size())-numBest > maxFruitlessMoves )
+                break;
+        }
+
+        // Roll back to the best bisection
+        for( Int j=Int(moves.size())-1; j>=numBest; --j )
+            part[moves[j]] = 1-part[moves[j]];
+        if( numBest == 0 )
+            break;
+    }
+}
+
+// Returns the cut of a two-way partitioning of the graph
+Int MultilevelEdgeBisection
+( const WeightedGraph& graph, vector<Int>& part, std::mt19937& gen )
+{
+    const Int totalWeight = TotalWeight( graph.vertexWeights );
+    const Int maxWeight = MaxPartWeight( totalWeight );
+    const Int maxVertexWeight =
+      Max( Int(1), Int(1.5*totalWeight/coarsestSize) );
+
+    vector<WeightedGraph> levels;
+    vector<vector<Int>> coarseMaps;
+    while( true )
+    {
+        const WeightedGraph& fine = ( levels.empty() ? graph : levels.back() );
+        if( fine.numVertices <= coarsestSize )
+            break;
+        WeightedGraph coarse;
+        vector<Int> coarseMap;
+        Coarsen( fine, coarse, coarseMap, maxVertexWeight, gen );
+        if( coarse.numVertices > minCoarsening*fine.numVertices )
+            break;
+        levels.push_back( std::move(coarse) );
+        coarseMaps.push_back( std::move(coarseMap) );
+    }
+
+    // Bisect the coarsest graph
+    const WeightedGraph& coarsest = ( levels.empty() ? graph : levels.back() );
+    Int bestCut = -1;
+    vector<Int> trialPart;
+    for( Int trial=0; trial<numGrowTrials; ++trial )
+    {
+        GrowBisection( coarsest, trialPart, gen );
+        RefineBisection( coarsest, trialPart, maxWeight );
+        const Int cut = EdgeCut( coarsest, trialPart );
+        if( bestCut == -1 || cut < bestCut )
+        {
+            bestCut = cut;
+            part = trialPart;
+        }
+    }
+
+    // Project and refine
+    for( Int level=Int(levels.size())-1; level>=0; --level )
+    {
+        const WeightedGraph& fine = ( level == 0 ? graph : levels[level-1] );
+        const auto& coarseMap = coarseMaps[level];
+        vector<Int> finePart( fine.numVertices );
+        for( Int u=0; u<fine.numVertices; ++u )
+            finePart[u] = part[coarseMap[u]];
+        part.swap( finePart );
+        RefineBisection( fine, part, maxWeight );
+    }
+    return EdgeCut( graph, part );
+}
+
+// Overwrite the vertices of a minimum vertex cover of the cut edges with 2,
+// using Konig's theorem: if Z is the set of vertices reachable from the
+// unmatched vertices of part 0 by alternating paths of a maximum matching,
+// then the cover is (B_0 \ Z) union (B_1 intersect Z), where B_0 and B_1 are
+// the endpoints of the cut edges in parts 0 and 1.
+void EdgeToVertexSeparator( const WeightedGraph& graph, vector<Int>& part )
+{
+    const Int n = graph.numVertices;
+    vector<Int> index( n, -1 );
+    vector<Int> leftVerts, rightVerts;
+    vector<vector<Int>> leftAdj;
+    for( Int u=0; u<n; ++u )
+    {
+        for( Int e=graph.offsets[u]; e<graph.offsets[u+1]; ++e )
+        {
+            const Int v = graph.targets[e];
+            if( part[u] == part[v] )
+                continue;
+            const Int left = ( part[u] == 0 ? u : v );
+            const Int right = ( part[u] == 0 ? v : u );
+            if( index[left] == -1 )
+            {
+                index[left] = leftVerts.size();
+                leftVerts.push_back( left );
+                leftAdj.push_back( vector<Int>() );
+            }
+            if( index[right] == -1 )
+            {
+                index[right] = rightVerts.size();
+                rightVerts.push_back( right );
+            }
+            leftAdj[index[left]].push_back( index[right] );
+        }
+    }
+    const Int numLeft = leftVerts.size();
+    const Int numRight = rightVerts.size();
+
+    // Form a maximum matching with breadth-first augmenting paths
+    vector<Int> leftMatch( numLeft, -1 ), rightMatch( numRight, -1 );
+    vector<Int> rightParent( numRight ), rightStamp( numRight, -1 );
+    vector<Int> queue;
+    for( Int root=0; root<numLeft; ++root )
+    {
+        queue.assign( 1, root );
+        Int head=0, freeRight=-1;
+        while( head < Int(queue.size()) && freeRight == -1 )
+        {
+            const Int x = queue[head++];
+            for( Int y : leftAdj[x] )
+            {
+                if( rightStamp[y] == root )
+                    continue;
+                rightStamp[y] = root;
+                rightParent[y] = x;
+                if( rightMatch[y] == -1 )
+                {
+                    freeRight = y;
+                    break;
+                }
+                queue.push_back( rightMatch[y] );
+            }
+        }
+        // Augment
+        Int y = freeRight;
+        while( y != -1 )
+        {
+            const Int x = rightParent[y];
+            const Int nextY = leftMatch[x];
+            leftMatch[x] = y;
+            rightMatch[y] = x;
+            y = nextY;
+        }
+    }
+
+    // Find the alternating reachability from the unmatched left vertices
+    vector<bool> leftReached( numLeft, false ), rightReached( numRight, false );
+    queue.resize( 0 );
+    for( Int x=0; x<numLeft; ++x )
+    {
+        if( leftMatch[x] == -1 )
+        {
+            leftReached[x] = true;
+            queue.push_back( x );
+        }
+    }
+    for( Int head=0; head<Int(queue.size()); ++head )
+    {
+        const Int x = queue[head];
+        for( Int y : leftAdj[x] )
+        {
+            if( rightReached[y] )
+                continue;
+            rightReached[y] = true;
+            const Int xNext = rightMatch[y];
+            if( xNext != -1 && !leftReached[xNext] )
+            {
+                leftReached[xNext] = true;
+                queue.push_back( xNext );
+            }
+        }
+    }
+
+    for( Int x=0; x<numLeft; ++x )
+        if( !leftReached[x] )
+            part[leftVerts[x]] = 2;
+    for( Int y=0; y<numRight; ++y )
+        if( rightReached[y] )
+            part[rightVerts[y]] = 2;
+}
+
+// Returns the size of the best of several vertex separators of a graph with
+// unit vertex weights (the separator is labeled as part 2)
+Int VertexSeparator
+( const WeightedGraph& graph, vector<Int>& part, Int numTrials, Int seed )
+{
+    Int bestSepSize=-1, bestMaxSize=-1;
+    vector<Int> trialPart;
+    for( Int trial=0; trial<Max(numTrials,Int(1)); ++trial )
+    {
+        std::mt19937 gen( seed+trial );
+        MultilevelEdgeBisection( graph, trialPart, gen );
+        EdgeToVertexSeparator( graph, trialPart );
+        Int sizes[3] = { 0, 0, 0 };
+        for( Int u=0; u<graph.numVertices; ++u )
+            ++sizes[trialPart[u]];
+        const Int maxSize = Max( sizes[0], sizes[1] );
+        if( bestSepSize == -1 || sizes[2] < bestSepSize ||
+            (sizes[2] == bestSepSize && maxSize < bestMaxSize) )
+        {
+            bestSepSize = sizes[2];
+            bestMaxSize = maxSize;
+            part = trialPart;
+        }
+    }
+    return bestSepSize;
+}
+
+// The distributed graph of each level of the distributed coarsening, where
+// 'slots' maps each local edge to the index of its target in the
+// concatenation of the local vertices and the ghost vertices
+struct DistWeightedGraph
+{
+    mpi::Comm comm;
+    Int numVertices=0;
+    vector<Int> vertexDist; // the first vertex of each process (and the total)
+    Int firstLocal=0, numLocal=0;
+    vector<Int> offsets, targets, edgeWeights, vertexWeights;
+
+    vector<Int> ghosts, slots, ghostSendInds;
+    mpi::SparseAllToAllPlan ghostPlan;
+};
+
+int VertexOwner( const DistWeightedGraph& graph, Int i )
+{
+    const auto& dist = graph.vertexDist;
+    return int(std::upper_bound(dist.begin(),dist.end(),i)-dist.begin()) - 1;
+}
+
+void SetVertexDist( DistWeightedGraph& graph, Int numLocal )
+{
+    const int commSize = mpi::Size( graph.comm );
+    vector<Int> numLocals( commSize );
+    mpi::AllGather( &numLocal, 1, numLocals.data(), 1, graph.comm );
+    graph.vertexDist.resize( commSize+1 );
+    graph.vertexDist[0] = 0;
+    for( int q=0; q<commSize; ++q )
+        graph.vertexDist[q+1] = graph.vertexDist[q] + numLocals[q];
+    graph.numVertices = graph.vertexDist[commSize];
+    graph.firstLocal = graph.vertexDist[mpi::Rank(graph.comm)];
+    graph.numLocal = numLocal;
+}
+
+void FormGhosts( DistWeightedGraph& graph )
+{
+    const int commSize = mpi::Size( graph.comm );
+    const Int firstLocal = graph.firstLocal;
+    const Int numLocal = graph.numLocal;
+
+    graph.ghosts.resize( 0 );
+    for( Int j : graph.targets )
+        if( j < firstLocal || j >= firstLocal+numLocal )
+            graph.ghosts.push_back( j );
+    std::sort( graph.ghosts.begin(), graph.ghosts.end() );
+    graph.ghosts.erase
+    ( std::unique(graph.ghosts.begin(),graph.ghosts.end()),
+      graph.ghosts.end() );
+
+    const Int numEdges = graph.targets.size();
+    graph.slots.resize( numEdges );
+    for( Int e=0; e<numEdges; ++e )
+    {
+        const Int j = graph.targets[e];
+        if( j >= firstLocal && j < firstLocal+numLocal )
+            graph.slots[e] = j - firstLocal;
+        else
+            graph.slots[e] = numLocal +
+              (std::lower_bound(graph.ghosts.begin(),graph.ghosts.end(),j) -
+               graph.ghosts.begin());
+    }
+
+    // Request the ghosts from their owners (they are sorted by owner)
+    vector<int> requestSizes( commSize, 0 );
+    for( Int j : graph.ghosts )
+        ++requestSizes[VertexOwner(graph,j)];
+    vector<int> requestOffs;
+    Scan( requestSizes, requestOffs );
+    vector<int> sendSizes( commSize );
+    mpi::AllToAll( requestSizes.data(), 1, sendSizes.data(), 1, graph.comm );
+    vector<int> sendOffs;
+    const int numSends = Scan( sendSizes, sendOffs );
+    graph.ghostSendInds.resize( numSends );
+    mpi::AllToAll
+    ( graph.ghosts.data(), requestSizes.data(), requestOffs.data(),
+      graph.ghostSendInds.data(), sendSizes.data(), sendOffs.data(),
+      graph.comm );
+    for( Int& i : graph.ghostSendInds )
+        i -= firstLocal;
+    DEBUG_ONLY(
+      const Int numRequests = 
+        requestOffs[commSize-1] + requestSizes[commSize-1];
+      if( numRequests != Int(graph.ghosts.size()) )
+          LogicError("Ghost requests were miscounted");
+    )
+    graph.ghostPlan =
+      mpi::MakeSparseAllToAllPlan
+      ( sendSizes, sendOffs, requestSizes, requestOffs, graph.comm );
+}
+
+// Return the local values followed by those of the ghosts
+vector<Int> WithGhosts
+( const DistWeightedGraph& graph, const vector<Int>& localValues )
+{
+    const Int numSends = graph.ghostSendInds.size();
+    vector<Int> sendValues( numSends );
+    for( Int s=0; s<numSends; ++s )
+        sendValues[s] = localValues[graph.ghostSendInds[s]];
+    vector<Int> ghostValues( graph.ghosts.size() );
+    mpi::SparseAllToAll( sendValues, ghostValues, graph.ghostPlan );
+
+    vector<Int> values( localValues );
+    values.insert( values.end(), ghostValues.begin(), ghostValues.end() );
+    return values;
+}
+
+void CoarsenDist
+( const DistWeightedGraph& fine, DistWeightedGraph& coarse,
+  vector<Int>& coarseMap, Int maxVertexWeight, std::mt19937& gen )
+{
+    const Int numLocal = fine.numLocal;
+    vector<Int> order( numLocal );
+    for( Int u=0; u<numLocal; ++u )
+        order[u] = u;
+    std::shuffle( order.begin(), order.end(), gen );
+
+    // Only match pairs of local vertices
+    vector<Int> match( numLocal, -1 );
+    for( Int u : order )
+    {
+        if( match[u] != -1 )
+            continue;
+        Int best=-1, bestWeight=-1;
+        for( Int e=fine.offsets[u]; e<fine.offsets[u+1]; ++e )
+        {
+            const Int v = fine.slots[e];
+            if( v < numLocal && v != u && match[v] == -1 &&
+                fine.edgeWeights[e] > bestWeight &&
+                fine.vertexWeights[u]+fine.vertexWeights[v] <= maxVertexWeight )
+            {
+                best = v;
+                bestWeight = fine.edgeWeights[e];
+            }
+        }
+        if( best == -1 )
+            match[u] = u;
+        else
+        {
+            match[u] = best;
+            match[best] = u;
+        }
+    }
+
+    vector<Int> reps;
+    coarseMap.resize( numLocal );
+    for( Int u=0; u<numLocal; ++u )
+    {
+        if( match[u] >= u )
+        {
+            coarseMap[u] = reps.size();
+            coarseMap[match[u]] = reps.size();
+            reps.push_back( u );
+        }
+    }
+    const Int numCoarseLocal = reps.size();
+    coarse.comm = fine.comm;
+    SetVertexDist( coarse, numCoarseLocal );
+    for( Int u=0; u<numLocal; ++u )
+        coarseMap[u] += coarse.firstLocal;
+    const vector<Int> coarseSlots = WithGhosts( fine, coarseMap );
+
+    coarse.offsets.resize( numCoarseLocal+1 );
+    coarse.vertexWeights.resize( numCoarseLocal );
+    coarse.targets.resize( 0 );
+    coarse.edgeWeights.resize( 0 );
+    vector<std::pair<Int,Int>> connections;
+    for( Int c=0; c<numCoarseLocal; ++c )
+    {
+        coarse.offsets[c] = coarse.targets.size();
+        const Int cGlobal = c + coarse.firstLocal;
+        const Int u = reps[c];
+        const Int members[2] = { u, match[u] };
+        const Int numMembers = ( match[u] == u ? 1 : 2 );
+        coarse.vertexWeights[c] = 0;
+        connections.resize( 0 );
+        for( Int m=0; m<numMembers; ++m )
+        {
+            const Int v = members[m];
+            coarse.vertexWeights[c] += fine.vertexWeights[v];
+            for( Int e=fine.offsets[v]; e<fine.offsets[v+1]; ++e )
+            {
+                const Int d = coarseSlots[fine.slots[e]];
+                if( d != cGlobal )
+                    connections.push_back
+                    ( std::make_pair(d,fine.edgeWeights[e]) );
+            }
+        }
+        std::sort( connections.begin(), connections.end() );
+        for( const auto& connection : connections )
+        {
+            if( Int(coarse.targets.size()) > coarse.offsets[c] &&
+                coarse.targets.back() == connection.first )
+                coarse.edgeWeights.back() += connection.second;
+            else
+            {
+                coarse.targets.push_back( connection.first );
+                coarse.edgeWeights.push_back( connection.second );
+            }
+        }
+    }
+    coarse.offsets[numCoarseLocal] = coarse.targets.size();
+    FormGhosts( coarse );
+}
+
+WeightedGraph GatherGraph( const DistWeightedGraph& graph, int root=-1 )
+{
+    const int commSize = mpi::Size( graph.comm );
+    const int commRank = mpi::Rank( graph.comm );
+    const bool all = ( root == -1 );
+    const bool receiving = ( all || commRank == root );
+
+    vector<int> vertexSizes( commSize ), vertexOffs( commSize );
+    for( int q=0; q<commSize; ++q )
+    {
+        vertexOffs[q] = graph.vertexDist[q];
+        vertexSizes[q] = graph.vertexDist[q+1] - graph.vertexDist[q];
+    }
+    const Int numLocalEdges = graph.targets.size();
+    vector<Int> localEdgeSizes( commSize );
+    mpi::AllGather( &numLocalEdges, 1, localEdgeSizes.data(), 1, graph.comm );
+    vector<int> edgeSizes( localEdgeSizes.begin(), localEdgeSizes.end() );
+    vector<int> edgeOffs;
+    const Int numEdges = Scan( edgeSizes, edgeOffs );
+
+    WeightedGraph seqGraph;
+    vector<Int> degrees;
+    if( receiving )
+    {
+        seqGraph.numVertices = graph.numVertices;
+        seqGraph.vertexWeights.resize( graph.numVertices );
+        seqGraph.targets.resize( numEdges );
+        seqGraph.edgeWeights.resize( numEdges );
+        degrees.resize( graph.numVertices );
+    }
+    vector<Int> localDegrees( graph.numLocal );
+    for( Int u=0; u<graph.numLocal; ++u )
+        localDegrees[u] = graph.offsets[u+1] - graph.offsets[u];
+
+    auto gather = [&]( const vector<Int>& local, vector<Int>& global,
+                       const vector<int>& sizes, const vector<int>& offs )
+    {
+        if( all )
+            mpi::AllGather
+            ( local.data(), int(local.size()),
+              global.data(), sizes.data(), offs.data(), graph.comm );
+        else
+            mpi::Gather
+            ( local.data(), int(local.size()),
+              global.data(), sizes.data(), offs.data(), root, graph.comm );
+    };
+    gather( graph.vertexWeights, seqGraph.vertexWeights,
+            vertexSizes, vertexOffs );
+    gather( localDegrees, degrees, vertexSizes, vertexOffs );
+    gather( graph.targets, seqGraph.targets, edgeSizes, edgeOffs );
+    gather( graph.edgeWeights, seqGraph.edgeWeights, edgeSizes, edgeOffs );
+
+    if( receiving )
+    {
+        seqGraph.offsets.resize( graph.numVertices+1 );
+        seqGraph.offsets[0] = 0;
+        for( Int u=0; u<graph.numVertices; ++u )
+            seqGraph.offsets[u+1] = seqGraph.offsets[u] + degrees[u];
+    }
+    return seqGraph;
+}
+
+// Move the vertices of one part with a positive gain (or, if the part is too
+// heavy, any boundary vertices) into the other part, with each process
+// allowed a share of the slack in the balance proportional to the weight of
+// its candidates
+void RefineDistBisection
+( const DistWeightedGraph& graph, vector<Int>& part, Int maxWeight )
+{
+    const Int numLocal = graph.numLocal;
+    Int numIdlePasses = 0;
+    for( Int pass=0; pass<2*maxRefinePasses && numIdlePasses<2; ++pass )
+    {
+        const vector<Int> parts = WithGhosts( graph, part );
+        Int partWeights[2] = { 0, 0 };
+        for( Int u=0; u<numLocal; ++u )
+            partWeights[part[u]] += graph.vertexWeights[u];
+        mpi::AllReduce( partWeights, 2, graph.comm );
+
+        Int from = pass % 2;
+        if( partWeights[0] > maxWeight )
+            from = 0;
+        else if( partWeights[1] > maxWeight )
+            from = 1;
+        const bool overweight = ( partWeights[from] > maxWeight );
+        const Int slack = maxWeight - partWeights[1-from];
+
+        vector<std::pair<Int,Int>> candidates;
+        Int localCandidateWeight = 0;
+        for( Int u=0; u<numLocal; ++u )
+        {
+            if( part[u] != from )
+                continue;
+            Int internal=0, external=0;
+            for( Int e=graph.offsets[u]; e<graph.offsets[u+1]; ++e )
+            {
+                if( parts[graph.slots[e]] == from )
+                    internal += graph.edgeWeights[e];
+                else
+                    external += graph.edgeWeights[e];
+            }
+            const Int gain = external - internal;
+            if( gain > 0 || (overweight && external > 0) )
+            {
+                candidates.push_back( std::make_pair(-gain,u) );
+                localCandidateWeight += graph.vertexWeights[u];
+            }
+        }
+        const Int candidateWeight =
+          mpi::AllReduce( localCandidateWeight, graph.comm );
+        Int numMoves = 0;
+        if( slack > 0 && candidateWeight > 0 )
+        {
+            const double share = double(localCandidateWeight)/candidateWeight;
+            const Int allowance = Int(share*slack);
+            std::sort( candidates.begin(), candidates.end() );
+            Int movedWeight = 0;
+            for( const auto& candidate : candidates )
+            {
+                const Int u = candidate.second;
+                if( movedWeight+graph.vertexWeights[u] > allowance )
+                    break;
+                part[u] = 1-from;
+                movedWeight += graph.vertexWeights[u];
+                ++numMoves;
+            }
+        }
+        numMoves = mpi::AllReduce( numMoves, graph.comm );
+        numIdlePasses = ( numMoves == 0 ? numIdlePasses+1 : 0 );
+    }
+}
+
+// Set the parts of the local sources of the original graph
+void DistVertexSeparator
+( const DistWeightedGraph& graph, vector<Int>& part, const BisectCtrl& ctrl )
+{
+    DEBUG_ONLY(CSE cse("DistVertexSeparator"))
+    mpi::Comm comm = graph.comm;
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+    const Int maxWeight = MaxPartWeight( graph.numVertices );
+
+    // Coarsen until the graph is small enough to be gathered
+    vector<DistWeightedGraph> levels;
+    vector<vector<Int>> coarseMaps;
+    std::mt19937 gen( commRank );
+    const Int maxVertexWeight =
+      Max( Int(1), Int(1.5*graph.numVertices/coarsestSize) );
+    while( true )
+    {
+        const DistWeightedGraph& fine =
+          ( levels.empty() ? graph : levels.back() );
+        if( fine.numVertices <= distCoarsestSize )
+            break;
+        DistWeightedGraph coarse;
+        vector<Int> coarseMap;
+        CoarsenDist( fine, coarse, coarseMap, maxVertexWeight, gen );
+        if( coarse.numVertices > minCoarsening*fine.numVertices )
+            break;
+        levels.push_back( std::move(coarse) );
+        coarseMaps.push_back( std::move(coarseMap) );
+    }
+
+    // Each process bisects its own copy of the coarsest graph and the
+    // bisection with the smallest cut is kept
+    const DistWeightedGraph& coarsest =
+      ( levels.empty() ? graph : levels.back() );
+    const WeightedGraph seqCoarsest = GatherGraph( coarsest );
+    vector<Int> seqPart, trialPart;
+    Int bestCut = -1;
+    for( Int trial=0; trial<Max(ctrl.numDistSeps,Int(1)); ++trial )
+    {
+        std::mt19937 trialGen( commRank*ctrl.numDistSeps+trial );
+        const Int cut =
+          MultilevelEdgeBisection( seqCoarsest, trialPart, trialGen );
+        if( bestCut == -1 || cut < bestCut )
+        {
+            bestCut = cut;
+            seqPart = trialPart;
+        }
+    }
+    vector<Int> cuts( commSize );
+    mpi::AllGather( &bestCut, 1, cuts.data(), 1, comm );
+    const int bestRank =
+      int(std::min_element(cuts.begin(),cuts.end())-cuts.begin());
+    mpi::Broadcast( seqPart.data(), coarsest.numVertices, bestRank, comm );
+    part.resize( coarsest.numLocal );
+    for( Int u=0; u<coarsest.numLocal; ++u )
+        part[u] = seqPart[u+coarsest.firstLocal];
+
+    // Project and refine
+    for( Int level=Int(levels.size())-1; level>=0; --level )
+    {
+        const DistWeightedGraph& fine =
+          ( level == 0 ? graph : levels[level-1] );
+        const DistWeightedGraph& coarse = levels[level];
+        const auto& coarseMap = coarseMaps[level];
+        vector<Int> finePart( fine.numLocal );
+        for( Int u=0; u<fine.numLocal; ++u )
+            finePart[u] = part[coarseMap[u]-coarse.firstLocal];
+        part.swap( finePart );
+        RefineDistBisection( fine, part, maxWeight );
+    }
+
+    // Use the boundary of the side with the smaller boundary as the separator
+    const vector<Int> parts = WithGhosts( graph, part );
+    vector<bool> boundary( graph.numLocal, false );
+    Int boundarySizes[2] = { 0, 0 };
+    for( Int u=0; u<graph.numLocal; ++u )
+    {
+        for( Int e=graph.offsets[u]; e<graph.offsets[u+1]; ++e )
+        {
+            if( parts[graph.slots[e]] != part[u] )
+            {
+                boundary[u] = true;
+                ++boundarySizes[part[u]];
+                break;
+            }
+        }
+    }
+    mpi::AllReduce( boundarySizes, 2, comm );
+    const Int sepSide = ( boundarySizes[0] <= boundarySizes[1] ? 0 : 1 );
+    for( Int u=0; u<graph.numLocal; ++u )
+        if( boundary[u] && part[u] == sepSide )
+            part[u] = 2;
+}
+
+} // anonymous namespace
+
+Int MultilevelBisect
+( const Graph& graph,
+        Graph& leftChild,
+        Graph& rightChild,
+        vector<Int>& perm,
+  const BisectCtrl& ctrl )
+{
+    DEBUG_ONLY(CSE cse("MultilevelBisect"))
+    // Remove the self-connections and those outside of the sources
+    const Int numSources = graph.NumSources();
+    WeightedGraph seqGraph;
+    seqGraph.numVertices = numSources;
+    seqGraph.offsets.resize( numSources+1 );
+    seqGraph.vertexWeights.assign( numSources, 1 );
+    for( Int s=0; s<numSources; ++s )
+    {
+        seqGraph.offsets[s] = seqGraph.targets.size();
+        const Int off = graph.EdgeOffset( s );
+        const Int numConnections = graph.NumConnections( s );
+        for( Int t=0; t<numConnections; ++t )
+        {
+            const Int target = graph.Target( off+t );
+            if( target != s && target < numSources )
+                seqGraph.targets.push_back( target );
+        }
+    }
+    seqGraph.offsets[numSources] = seqGraph.targets.size();
+    seqGraph.edgeWeights.assign( seqGraph.targets.size(), 1 );
+
+    vector<Int> part;
+    VertexSeparator( seqGraph, part, ctrl.numSeqSeps, 0 );
+
+    Int sizes[3] = { 0, 0, 0 };
+    for( Int s=0; s<numSources; ++s )
+        ++sizes[part[s]];
+    Int offsets[3];
+    offsets[0] = 0;
+    offsets[1] = sizes[0];
+    offsets[2] = sizes[1] + offsets[1];
+    perm.resize( numSources );
+    for( Int s=0; s<numSources; ++s )
+        perm[s] = offsets[part[s]]++;
+
+    DEBUG_ONLY(EnsurePermutation( perm ))
+    BuildChildrenFromPerm
+    ( graph, perm, sizes[0], leftChild, sizes[1], rightChild );
+    return sizes[2];
+}
+
+Int MultilevelBisect
+( const DistGraph& graph,
+        DistGraph& child,
+        DistMap& perm,
+        bool& onLeft,
+  const BisectCtrl& ctrl )
+{
+    DEBUG_ONLY(CSE cse("MultilevelBisect"))
+    mpi::Comm comm = graph.Comm();
+    const int commSize = mpi::Size( comm );
+    if( commSize == 1 )
+        LogicError
+        ("This routine assumes at least two processes are used, "
+         "otherwise one child will be lost");
+
+    // Remove the self-connections and those outside of the sources
+    const Int numSources = graph.NumSources();
+    const Int numLocalSources = graph.NumLocalSources();
+    const Int firstLocalSource = graph.FirstLocalSource();
+    DistWeightedGraph distGraph;
+    distGraph.comm = comm;
+    SetVertexDist( distGraph, numLocalSources );
+    DEBUG_ONLY(
+      if( distGraph.firstLocal != firstLocalSource )
+          LogicError("Unexpected distribution of the sources");
+    )
+    distGraph.offsets.resize( numLocalSources+1 );
+    distGraph.vertexWeights.assign( numLocalSources, 1 );
+    for( Int s=0; s<numLocalSources; ++s )
+    {
+        distGraph.offsets[s] = distGraph.targets.size();
+        const Int source = s + firstLocalSource;
+        const Int off = graph.EdgeOffset( s );
+        const Int numConnections = graph.NumConnections( s );
+        for( Int t=0; t<numConnections; ++t )
+        {
+            const Int target = graph.Target( off+t );
+            if( target != source && target < numSources )
+                distGraph.targets.push_back( target );
+        }
+    }
+    distGraph.offsets[numLocalSources] = distGraph.targets.size();
+    distGraph.edgeWeights.assign( distGraph.targets.size(), 1 );
+
+    vector<Int> part;
+    if( ctrl.sequential )
+    {
+        // Compute the separator on the root process
+        const WeightedGraph seqGraph = GatherGraph( distGraph, 0 );
+        vector<Int> seqPart( numSources );
+        if( mpi::Rank(comm) == 0 )
+            VertexSeparator( seqGraph, seqPart, ctrl.numSeqSeps, 0 );
+        mpi::Broadcast( seqPart.data(), numSources, 0, comm );
+        part.resize( numLocalSources );
+        for( Int s=0; s<numLocalSources; ++s )
+            part[s] = seqPart[s+firstLocalSource];
+    }
+    else
+    {
+        FormGhosts( distGraph );
+        DistVertexSeparator( distGraph, part, ctrl );
+    }
+
+    // Number the left part, then the right part, and then the separator
+    Int localSizes[3] = { 0, 0, 0 };
+    for( Int s=0; s<numLocalSources; ++s )
+        ++localSizes[part[s]];
+    Int sizes[3], prefixes[3];
+    mpi::AllReduce( localSizes, sizes, 3, comm );
+    mpi::Scan( localSizes, prefixes, 3, comm );
+    Int offsets[3];
+    offsets[0] = prefixes[0] - localSizes[0];
+    offsets[1] = sizes[0] + prefixes[1] - localSizes[1];
+    offsets[2] = sizes[0] + sizes[1] + prefixes[2] - localSizes[2];
+    perm.SetComm( comm );
+    perm.Resize( numSources );
+    for( Int s=0; s<numLocalSources; ++s )
+        perm.SetLocal( s, offsets[part[s]]++ );
+
+    DEBUG_ONLY(EnsurePermutation( perm ))
+    BuildChildFromPerm( graph, perm, sizes[0], sizes[1], onLeft, child );
+    return sizes[2];
+}
+
+} // namespace El
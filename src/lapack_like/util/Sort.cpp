@@ -32,6 +32,168 @@ void Sort( Matrix<Real>& X, SortType sort )
     }
 }
 
+namespace sample_sort {
+
+// Ties in value are broken by the index so that every entry has a unique key,
+// which keeps the splitters (and hence the load balance) well-defined in the
+// presence of duplicated values
+
+template<typename Real>
+inline bool Lesser( const ValueInt<Real>& a, const ValueInt<Real>& b )
+{ return a.value < b.value || (a.value == b.value && a.index < b.index); }
+
+template<typename Real>
+inline bool Greater( const ValueInt<Real>& a, const ValueInt<Real>& b )
+{ return a.value > b.value || (a.value == b.value && a.index < b.index); }
+
+template<typename Real>
+inline bool IndexLesser( const ValueInt<Real>& a, const ValueInt<Real>& b )
+{ return a.index < b.index; }
+
+// Sort the union of the local pairs over the communicator so that, upon exit,
+// each process holds a contiguous (but not necessarily equally-sized) portion
+// of the sorted sequence, with the portions ordered by rank.
+//
+// This is a Parallel Sort by Regular Sampling: each process sorts its local
+// data and contributes p-1 evenly-spaced samples, p-1 splitters are chosen
+// from the sorted samples, and a single AllToAll routes each pair to the
+// process owning its bucket. No process receives more than roughly twice its
+// share of the data.
+template<typename Real>
+void Sort( vector<ValueInt<Real>>& pairs, SortType sort, mpi::Comm comm )
+{
+    DEBUG_ONLY(CSE cse("sample_sort::Sort"))
+    auto comp = ( sort == ASCENDING  ? &Lesser<Real> :
+                ( sort == DESCENDING ? &Greater<Real> : &IndexLesser<Real> ) );
+    std::sort( pairs.begin(), pairs.end(), comp );
+    const int commSize = mpi::Size( comm );
+    if( commSize == 1 )
+        return;
+
+    // Gather the regular samples from each process
+    const Int numLocal = pairs.size();
+    vector<ValueInt<Real>> samples;
+    if( numLocal > 0 )
+    {
+        samples.resize( commSize-1 );
+        for( Int q=0; q<commSize-1; ++q )
+            samples[q] = pairs[((q+1)*numLocal)/commSize];
+    }
+    const int numSamples = samples.size();
+    vector<int> sampleSizes( commSize ), sampleOffs( commSize );
+    mpi::AllGather( &numSamples, 1, sampleSizes.data(), 1, comm );
+    int totalSamples = 0;
+    for( int q=0; q<commSize; ++q )
+    {
+        sampleOffs[q] = totalSamples;
+        totalSamples += sampleSizes[q];
+    }
+    if( totalSamples == 0 )
+        return;
+    vector<ValueInt<Real>> allSamples( totalSamples );
+    mpi::AllGather
+    ( samples.data(), numSamples,
+      allSamples.data(), sampleSizes.data(), sampleOffs.data(), comm );
+    std::sort( allSamples.begin(), allSamples.end(), comp );
+
+    // Choose the splitters and count the number of pairs in each bucket
+    vector<ValueInt<Real>> splitters( commSize-1 );
+    for( Int q=0; q<commSize-1; ++q )
+        splitters[q] = allSamples[((q+1)*totalSamples)/commSize];
+    vector<int> sendSizes( commSize, 0 ), sendOffs( commSize );
+    Int bucket = 0;
+    for( Int k=0; k<numLocal; ++k )
+    {
+        while( bucket < commSize-1 && !comp(pairs[k],splitters[bucket]) )
+            ++bucket;
+        ++sendSizes[bucket];
+    }
+    int totalSend = 0;
+    for( int q=0; q<commSize; ++q )
+    {
+        sendOffs[q] = totalSend;
+        totalSend += sendSizes[q];
+    }
+
+    // Route each pair to the owner of its bucket and sort the received runs
+    pairs = mpi::AllToAll( pairs, sendSizes, sendOffs, comm );
+    std::sort( pairs.begin(), pairs.end(), comp );
+}
+
+// Extract the entries of the vector x into [VC,STAR] pairs tagged with their
+// (global) indices
+template<typename Real>
+vector<ValueInt<Real>>
+LocalPairs
+( const AbstractDistMatrix<Real>& x, DistMatrix<Real,VC,STAR>& x_VC_STAR )
+{
+    DEBUG_ONLY(CSE cse("sample_sort::LocalPairs"))
+    if( x.Width() == 1 )
+        x_VC_STAR = x;
+    else
+        Transpose( x, x_VC_STAR );
+    const Int numLocal = x_VC_STAR.LocalHeight();
+    vector<ValueInt<Real>> pairs( numLocal );
+    for( Int iLoc=0; iLoc<numLocal; ++iLoc )
+    {
+        pairs[iLoc].value = x_VC_STAR.GetLocal(iLoc,0);
+        pairs[iLoc].index = x_VC_STAR.GlobalRow(iLoc);
+    }
+    return pairs;
+}
+
+// Move the sorted pairs (as left by sample_sort::Sort) into the positions of
+// the [VC,STAR] column vectors y and p which correspond to their ranks in the
+// sorted sequence
+template<typename Real>
+void Scatter
+( const vector<ValueInt<Real>>& pairs,
+  DistMatrix<Real,VC,STAR>& y, DistMatrix<Int,VC,STAR>* p )
+{
+    DEBUG_ONLY(CSE cse("sample_sort::Scatter"))
+    mpi::Comm comm = y.ColComm();
+    const int commSize = mpi::Size( comm );
+    const Int numLocal = pairs.size();
+    const Int offset = mpi::Scan( numLocal, comm ) - numLocal;
+
+    vector<int> sendSizes( commSize, 0 ), sendOffs( commSize );
+    for( Int k=0; k<numLocal; ++k )
+        ++sendSizes[y.RowOwner(offset+k)];
+    int totalSend = 0;
+    for( int q=0; q<commSize; ++q )
+    {
+        sendOffs[q] = totalSend;
+        totalSend += sendSizes[q];
+    }
+    // Since the destination ranks are cyclic in the sorted position, the
+    // pairs are packed with their index replaced by their sorted position
+    vector<ValueInt<Real>> sendBuf( totalSend );
+    vector<Int> sendInd( totalSend );
+    auto offs = sendOffs;
+    for( Int k=0; k<numLocal; ++k )
+    {
+        const int owner = y.RowOwner(offset+k);
+        sendBuf[offs[owner]].value = pairs[k].value;
+        sendBuf[offs[owner]].index = offset+k;
+        sendInd[offs[owner]] = pairs[k].index;
+        ++offs[owner];
+    }
+    auto recvBuf = mpi::AllToAll( sendBuf, sendSizes, sendOffs, comm );
+    vector<Int> recvInd;
+    if( p != nullptr )
+        recvInd = mpi::AllToAll( sendInd, sendSizes, sendOffs, comm );
+    const Int numRecv = recvBuf.size();
+    for( Int k=0; k<numRecv; ++k )
+    {
+        const Int iLoc = y.LocalRow( recvBuf[k].index );
+        y.SetLocal( iLoc, 0, recvBuf[k].value );
+        if( p != nullptr )
+            p->SetLocal( iLoc, 0, recvInd[k] );
+    }
+}
+
+} // namespace sample_sort
+
 template<typename Real>
 void Sort( AbstractDistMatrix<Real>& X, SortType sort )
 {
@@ -45,15 +207,28 @@ void Sort( AbstractDistMatrix<Real>& X, SortType sort )
         if( X.Participating() )
             Sort( X.Matrix(), sort );
     }
+    else if( X.Width() == 1 )
+    {
+        // Sample sort the column vector over the entire process grid
+        const Grid& g = X.Grid();
+        const Int m = X.Height();
+        DistMatrix<Real,VC,STAR> x_VC_STAR(g), y_VC_STAR(g);
+        auto pairs = sample_sort::LocalPairs( X, x_VC_STAR );
+        x_VC_STAR.Empty();
+        y_VC_STAR.Resize( m, 1 );
+        if( y_VC_STAR.Participating() )
+        {
+            sample_sort::Sort( pairs, sort, y_VC_STAR.ColComm() );
+            sample_sort::Scatter( pairs, y_VC_STAR, nullptr );
+        }
+        Copy( y_VC_STAR, X );
+    }
     else
     {
-        // Get a copy on a single process, sort, and then redistribute
-        DistMatrix<Real,CIRC,CIRC> X_CIRC_CIRC( X );
-        if( X_CIRC_CIRC.Participating() )
-            Sort( X_CIRC_CIRC.Matrix(), sort );
-
-        // Refill the distributed X with the sorted values
-        Copy( X_CIRC_CIRC, X );
+        // Give each process entire columns, sort them, and redistribute
+        DistMatrix<Real,STAR,VR> X_STAR_VR( X );
+        Sort( X_STAR_VR.Matrix(), sort );
+        Copy( X_STAR_VR, X );
     }
 }
 
@@ -83,9 +258,9 @@ vector<ValueInt<Real>> TaggedSort
     }
 
     if( sort == ASCENDING )
-        std::sort( pairs.begin(), pairs.end(), ValueInt<Real>::Lesser );
+        std::sort( pairs.begin(), pairs.end(), sample_sort::Lesser<Real> );
     else if( sort == DESCENDING )
-        std::sort( pairs.begin(), pairs.end(), ValueInt<Real>::Greater );
+        std::sort( pairs.begin(), pairs.end(), sample_sort::Greater<Real> );
 
     return pairs;
 }
@@ -101,9 +276,63 @@ vector<ValueInt<Real>> TaggedSort
     }
     else
     {
-        DistMatrix<Real,STAR,STAR> x_STAR_STAR( x );
-        return TaggedSort( x_STAR_STAR.LockedMatrix(), sort );
+        if( x.Height() != 1 && x.Width() != 1 )
+            LogicError("TaggedSort is meant for a single vector");
+        const Grid& g = x.Grid();
+        const Int k = Max( x.Height(), x.Width() );
+        DistMatrix<Real,VC,STAR> x_VC_STAR(g);
+        auto pairs = sample_sort::LocalPairs( x, x_VC_STAR );
+
+        // The (sorted) portions are ordered by rank, so a single AllGather
+        // assembles the full sequence on every process
+        vector<ValueInt<Real>> allPairs;
+        if( x_VC_STAR.Participating() )
+        {
+            mpi::Comm comm = x_VC_STAR.ColComm();
+            sample_sort::Sort( pairs, sort, comm );
+            const int commSize = mpi::Size( comm );
+            const int numLocal = pairs.size();
+            vector<int> sizes( commSize ), offs( commSize );
+            mpi::AllGather( &numLocal, 1, sizes.data(), 1, comm );
+            int offset = 0;
+            for( int q=0; q<commSize; ++q )
+            {
+                offs[q] = offset;
+                offset += sizes[q];
+            }
+            allPairs.resize( k );
+            mpi::AllGather
+            ( pairs.data(), numLocal,
+              allPairs.data(), sizes.data(), offs.data(), comm );
+        }
+        return allPairs;
+    }
+}
+
+template<typename Real>
+void TaggedSort
+( const AbstractDistMatrix<Real>& x,
+        AbstractDistMatrix<Real>& y,
+        AbstractDistMatrix<Int>& p, SortType sort )
+{
+    DEBUG_ONLY(CSE cse("TaggedSort"))
+    if( x.Height() != 1 && x.Width() != 1 )
+        LogicError("TaggedSort is meant for a single vector");
+    const Grid& g = x.Grid();
+    const Int k = Max( x.Height(), x.Width() );
+    DistMatrix<Real,VC,STAR> x_VC_STAR(g), y_VC_STAR(g);
+    DistMatrix<Int,VC,STAR> p_VC_STAR(g);
+    auto pairs = sample_sort::LocalPairs( x, x_VC_STAR );
+    x_VC_STAR.Empty();
+    y_VC_STAR.Resize( k, 1 );
+    p_VC_STAR.Resize( k, 1 );
+    if( y_VC_STAR.Participating() )
+    {
+        sample_sort::Sort( pairs, sort, y_VC_STAR.ColComm() );
+        sample_sort::Scatter( pairs, y_VC_STAR, &p_VC_STAR );
     }
+    Copy( y_VC_STAR, y );
+    Copy( p_VC_STAR, p );
 }
 
 #define PROTO(Real) \
@@ -112,7 +341,11 @@ vector<ValueInt<Real>> TaggedSort
   template vector<ValueInt<Real>> TaggedSort \
   ( const Matrix<Real>& x, SortType sort ); \
   template vector<ValueInt<Real>> TaggedSort \
-  ( const AbstractDistMatrix<Real>& x, SortType sort );
+  ( const AbstractDistMatrix<Real>& x, SortType sort ); \
+  template void TaggedSort \
+  ( const AbstractDistMatrix<Real>& x, \
+          AbstractDistMatrix<Real>& y, \
+          AbstractDistMatrix<Int>& p, SortType sort );
 
 #define EL_NO_COMPLEX_PROTO
 #include "El/macros/Instantiate.h"
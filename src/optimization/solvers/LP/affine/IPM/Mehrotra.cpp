@@ -47,6 +47,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     DEBUG_ONLY(CSE cse("lp::affine::Mehrotra"))    
+    ProfileRegion profile("lp::affine::Mehrotra");
 
     const bool forceSameStep = false;
 
@@ -327,6 +328,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     DEBUG_ONLY(CSE cse("lp::affine::Mehrotra"))    
+    ProfileRegion profile("lp::affine::Mehrotra");
     const Grid& grid = APre.Grid();
     const int commRank = grid.Rank();
 
@@ -631,6 +633,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     DEBUG_ONLY(CSE cse("lp::affine::Mehrotra"))    
+    ProfileRegion profile("lp::affine::Mehrotra");
 
     const bool forceSameStep = false;
 
@@ -796,7 +799,10 @@ void Mehrotra
                 NestedDissection( J.LockedGraph(), map, rootSep, info );
                 InvertMap( map, invMap );
             }
-            JFront.Pull( J, map, info );
+            if( numIts == 0 )
+                JFront.Pull( J, map, info );
+            else
+                JFront.Refill( J );
 
             LDL( info, JFront, LDL_2D );
             reg_qsd_ldl::SolveAfter
@@ -944,6 +950,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     DEBUG_ONLY(CSE cse("lp::affine::Mehrotra"))    
+    ProfileRegion profile("lp::affine::Mehrotra");
     mpi::Comm comm = APre.Comm();
     const int commRank = mpi::Rank(comm);
     Timer timer;
@@ -1139,10 +1146,13 @@ void Mehrotra
                         cout << "  ND: " << timer.Stop() << " secs" << endl;
                     InvertMap( map, invMap );
                 }
+                JFront.Pull( J, map, rootSep, info );
             }
             else
+            {
                 J.multMeta = meta;
-            JFront.Pull( J, map, rootSep, info );
+                JFront.Refill( J );
+            }
 
             if( commRank == 0 && ctrl.time )
                 timer.Start();
@@ -43,6 +43,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     DEBUG_ONLY(CSE cse("lp::direct::Mehrotra"))    
+    ProfileRegion profile("lp::direct::Mehrotra");
 
     const bool forceSameStep = false;
 
@@ -393,6 +394,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     DEBUG_ONLY(CSE cse("lp::direct::Mehrotra"))    
+    ProfileRegion profile("lp::direct::Mehrotra");
     const Grid& grid = APre.Grid();
     const int commRank = grid.Rank();
 
@@ -769,6 +771,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     DEBUG_ONLY(CSE cse("lp::direct::Mehrotra"))    
+    ProfileRegion profile("lp::direct::Mehrotra");
 
     const bool forceSameStep = false;
 
@@ -954,8 +957,10 @@ void Mehrotra
                 {
                     NestedDissection( J.LockedGraph(), map, rootSep, info );
                     InvertMap( map, invMap );
+                    JFront.Pull( J, map, info );
                 }
-                JFront.Pull( J, map, info );
+                else
+                    JFront.Refill( J );
 
                 LDL( info, JFront, LDL_2D );
                 reg_qsd_ldl::SolveAfter
@@ -990,8 +995,10 @@ void Mehrotra
                 {
                     NestedDissection( J.LockedGraph(), map, rootSep, info );
                     InvertMap( map, invMap );
+                    JFront.Pull( J, map, info );
                 }
-                JFront.Pull( J, map, info );
+                else
+                    JFront.Refill( J );
 
                 LDL( info, JFront );
                 ldl::SolveWithIterativeRefinement
@@ -1174,6 +1181,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     DEBUG_ONLY(CSE cse("lp::direct::Mehrotra"))    
+    ProfileRegion profile("lp::direct::Mehrotra");
     mpi::Comm comm = APre.Comm();
     const int commRank = mpi::Rank(comm);
     Timer timer;
@@ -1388,10 +1396,13 @@ void Mehrotra
                     if( commRank == 0 && ctrl.time )
                         cout << "  ND: " << timer.Stop() << " secs" << endl;
                     InvertMap( map, invMap );
+                    JFront.Pull( J, map, rootSep, info );
                 }
                 else
+                {
                     J.multMeta = meta;
-                JFront.Pull( J, map, rootSep, info );
+                    JFront.Refill( J );
+                }
 
                 if( commRank == 0 && ctrl.time )
                     timer.Start();
@@ -1440,10 +1451,13 @@ void Mehrotra
                     if( commRank == 0 && ctrl.time )
                         cout << "  ND: " << timer.Stop() << " secs" << endl;
                     InvertMap( map, invMap );
+                    JFront.Pull( J, map, rootSep, info );
                 }
                 else
+                {
                     J.multMeta = meta;
-                JFront.Pull( J, map, rootSep, info );
+                    JFront.Refill( J );
+                }
 
                 if( commRank == 0 && ctrl.time )
                     timer.Start();
@@ -48,6 +48,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     DEBUG_ONLY(CSE cse("qp::affine::Mehrotra"))    
+    ProfileRegion profile("qp::affine::Mehrotra");
 
     const bool forceSameStep = true;
 
@@ -327,6 +328,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     DEBUG_ONLY(CSE cse("qp::affine::Mehrotra"))    
+    ProfileRegion profile("qp::affine::Mehrotra");
     const Grid& grid = APre.Grid();
     const int commRank = grid.Rank();
 
@@ -647,6 +649,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     DEBUG_ONLY(CSE cse("qp::affine::Mehrotra"))    
+    ProfileRegion profile("qp::affine::Mehrotra");
 
     const bool forceSameStep = true;
 
@@ -820,7 +823,10 @@ void Mehrotra
                 NestedDissection( J.LockedGraph(), map, rootSep, info );
                 InvertMap( map, invMap );
             }
-            JFront.Pull( J, map, info );
+            if( numIts == 0 )
+                JFront.Pull( J, map, info );
+            else
+                JFront.Refill( J );
 
             LDL( info, JFront, LDL_2D );
             reg_qsd_ldl::SolveAfter
@@ -970,6 +976,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     DEBUG_ONLY(CSE cse("qp::affine::Mehrotra"))    
+    ProfileRegion profile("qp::affine::Mehrotra");
     mpi::Comm comm = APre.Comm();
     const int commRank = mpi::Rank(comm);
     Timer timer;
@@ -1174,10 +1181,13 @@ void Mehrotra
                         cout << "  ND: " << timer.Stop() << " secs" << endl;
                     InvertMap( map, invMap );
                 }
+                JFront.Pull( J, map, rootSep, info );
             }
             else
+            {
                 J.multMeta = meta;
-            JFront.Pull( J, map, rootSep, info );
+                JFront.Refill( J );
+            }
 
             if( commRank == 0 && ctrl.time )
                 timer.Start();
@@ -44,6 +44,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     DEBUG_ONLY(CSE cse("qp::direct::Mehrotra"))    
+    ProfileRegion profile("qp::direct::Mehrotra");
 
     const bool forceSameStep = false;
 
@@ -367,6 +368,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     DEBUG_ONLY(CSE cse("qp::direct::Mehrotra"))    
+    ProfileRegion profile("qp::direct::Mehrotra");
     const Grid& grid = APre.Grid();
     const int commRank = grid.Rank();
 
@@ -717,6 +719,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     DEBUG_ONLY(CSE cse("qp::direct::Mehrotra"))    
+    ProfileRegion profile("qp::direct::Mehrotra");
 
     const bool forceSameStep = false;
 
@@ -912,8 +915,10 @@ void Mehrotra
                 {
                     NestedDissection( J.LockedGraph(), map, rootSep, info );
                     InvertMap( map, invMap );
+                    JFront.Pull( J, map, info );
                 }
-                JFront.Pull( J, map, info );
+                else
+                    JFront.Refill( J );
 
                 LDL( info, JFront, LDL_2D );
                 reg_qsd_ldl::SolveAfter
@@ -1093,6 +1098,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     DEBUG_ONLY(CSE cse("qp::direct::Mehrotra"))    
+    ProfileRegion profile("qp::direct::Mehrotra");
     mpi::Comm comm = APre.Comm();
     const int commRank = mpi::Rank(comm);
     Timer timer;
@@ -1318,10 +1324,13 @@ void Mehrotra
                     if( commRank == 0 && ctrl.time )
                         cout << "  ND: " << timer.Stop() << " secs" << endl;
                     InvertMap( map, invMap );
+                    JFront.Pull( J, map, rootSep, info );
                 }
                 else
+                {
                     J.multMeta = meta;
-                JFront.Pull( J, map, rootSep, info );
+                    JFront.Refill( J );
+                }
 
                 if( commRank == 0 && ctrl.time )
                     timer.Start();
@@ -50,6 +50,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     DEBUG_ONLY(CSE cse("socp::affine::Mehrotra"))    
+    ProfileRegion profile("socp::affine::Mehrotra");
     const bool forceSameStep = true;
 
     // Equilibrate the SOCP by diagonally scaling [A;G]
@@ -334,6 +335,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     DEBUG_ONLY(CSE cse("socp::affine::Mehrotra"))    
+    ProfileRegion profile("socp::affine::Mehrotra");
     const Grid& grid = APre.Grid();
     const int commRank = grid.Rank();
     const bool onlyLower = true;
@@ -669,6 +671,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     DEBUG_ONLY(CSE cse("socp::affine::Mehrotra"))    
+    ProfileRegion profile("socp::affine::Mehrotra");
 
     const bool forceSameStep = true;
 
@@ -842,7 +845,10 @@ void Mehrotra
                 NestedDissection( J.LockedGraph(), map, rootSep, info );
                 InvertMap( map, invMap );
             }
-            JFront.Pull( J, map, info );
+            if( numIts == 0 )
+                JFront.Pull( J, map, info );
+            else
+                JFront.Refill( J );
 
             LDL( info, JFront, LDL_2D );
             // It would be good to rigorously verify that solving the 
@@ -1023,6 +1029,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     DEBUG_ONLY(CSE cse("socp::affine::Mehrotra"))    
+    ProfileRegion profile("socp::affine::Mehrotra");
     mpi::Comm comm = APre.Comm();
     const int commRank = mpi::Rank(comm);
     const bool onlyLower = false;
@@ -1229,10 +1236,13 @@ void Mehrotra
                         cout << "  ND: " << timer.Stop() << " secs" << endl;
                     InvertMap( map, invMap );
                 }
+                JFront.Pull( J, map, rootSep, info );
             }
             else
+            {
                 J.multMeta = meta;
-            JFront.Pull( J, map, rootSep, info );
+                JFront.Refill( J );
+            }
 
             if( commRank == 0 && ctrl.time )
                 timer.Start();
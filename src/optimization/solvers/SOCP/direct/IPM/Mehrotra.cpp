@@ -44,6 +44,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     DEBUG_ONLY(CSE cse("socp::direct::Mehrotra"))    
+    ProfileRegion profile("socp::direct::Mehrotra");
     const Int n = c.Height();
 
     Matrix<Real> G;
@@ -87,6 +88,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     DEBUG_ONLY(CSE cse("socp::direct::Mehrotra"))    
+    ProfileRegion profile("socp::direct::Mehrotra");
     const Int n = c.Height();
     const Grid& grid = c.Grid();
 
@@ -131,6 +133,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     DEBUG_ONLY(CSE cse("socp::direct::Mehrotra"))    
+    ProfileRegion profile("socp::direct::Mehrotra");
     const Int n = c.Height();
 
     SparseMatrix<Real> G;
@@ -174,6 +177,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     DEBUG_ONLY(CSE cse("socp::direct::Mehrotra"))    
+    ProfileRegion profile("socp::direct::Mehrotra");
     const Int n = c.Height();
     mpi::Comm comm = c.Comm();
 
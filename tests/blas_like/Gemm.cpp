@@ -10,6 +10,8 @@
 using namespace std;
 using namespace El;
 
+// Check the result against a sequential Gemm on the root, which broadcasts
+// the relative error so that every process throws if it was too large
 template<typename T>
 void TestCorrectness
 ( Orientation orientA, Orientation orientB,
@@ -19,8 +21,11 @@ void TestCorrectness
   bool print )
 {
     DEBUG_ONLY(CallStackEntry cse("TestCorrectness"))
+    typedef Base<T> Real;
     DistMatrix<T,CIRC,CIRC> ARoot( A ), BRoot( B ), 
                             COrigRoot( COrig ), CFinalRoot( CFinal );
+    const Int k = ( orientA==NORMAL ? A.Width() : A.Height() );
+    Real relError = 0;
     if( ARoot.Root() == ARoot.CrossRank() )
     {
         Matrix<T> CSeq( COrigRoot.Matrix() );
@@ -28,12 +33,21 @@ void TestCorrectness
         ( orientA, orientB, 
           alpha, ARoot.Matrix(), BRoot.Matrix(),
           beta,  CSeq );
-        const Base<T> CNrm = FrobeniusNorm( CFinalRoot.Matrix() );
+        const Real CNrm = FrobeniusNorm( CFinalRoot.Matrix() );
         Axpy( T(-1), CSeq, CFinalRoot.Matrix() );
-        const Base<T> ENrm = FrobeniusNorm( CFinalRoot.Matrix() );
+        const Real ENrm = FrobeniusNorm( CFinalRoot.Matrix() );
         cout << " || E ||_F = " << ENrm << "\n"
              << " || C ||_F = " << CNrm << endl;
+        const Real scale =
+          Abs(alpha)*FrobeniusNorm(ARoot.Matrix())*
+          FrobeniusNorm(BRoot.Matrix()) +
+          Abs(beta)*FrobeniusNorm(COrigRoot.Matrix());
+        relError = ( scale == Real(0) ? ENrm : ENrm/scale );
     }
+    mpi::Broadcast( relError, ARoot.Root(), ARoot.CrossComm() );
+    const Real tol = 10*Max(k,Int(1))*lapack::MachineEpsilon<Real>();
+    if( relError > tol )
+        LogicError("Relative error of ",relError," exceeded ",tol);
 }
 
 template<typename T> 
@@ -173,6 +187,72 @@ void TestGemm
             TestCorrectness
             ( orientA, orientB, alpha, A, B, beta, COrig, C, print );
     }
+
+    // Test the 2.5D variant of Gemm (which falls back to SUMMA when only a
+    // single layer can be used)
+    if( g.Rank() == 0 )
+        cout << "2.5D Algorithm:" << endl;
+    C = COrig;
+    mpi::Barrier( g.Comm() );
+    startTime = mpi::Time();
+    Gemm( orientA, orientB, alpha, A, B, beta, C, GEMM_SUMMA_25D );
+    mpi::Barrier( g.Comm() );
+    runTime = mpi::Time() - startTime;
+    realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+    gFlops = ( IsComplex<T>::val ? 4*realGFlops : realGFlops );
+    if( g.Rank() == 0 )
+    {
+        cout << "DONE. " << endl
+             << "  Time = " << runTime << " seconds. GFlops = " 
+             << gFlops << endl;
+    }
+    if( print )
+    {
+        ostringstream msg;
+        msg << "C := " << alpha << " A B + " << beta << " C";
+        Print( C, msg.str() );
+    }
+    if( correctness )
+        TestCorrectness( orientA, orientB, alpha, A, B, beta, COrig, C, print );
+
+    // Test the default choice of variant (which is driven by the cost model of
+    // the grid if it was calibrated)
+    if( g.Rank() == 0 )
+    {
+        cout << "Default Algorithm";
+        GemmAlgorithm alg;
+        Int bsize;
+        if( gemm::PredictVariant<T>
+            ( g, m, n, k, orientA==NORMAL && orientB==NORMAL, alg, bsize ) )
+        {
+            const char* algNames[] = { "", "A", "B", "C", "Dot" };
+            cout << " (predicted SUMMA_" << algNames[alg] << " with blocksize "
+                 << bsize << ")";
+        }
+        cout << ":" << endl;
+    }
+    C = COrig;
+    mpi::Barrier( g.Comm() );
+    startTime = mpi::Time();
+    Gemm( orientA, orientB, alpha, A, B, beta, C );
+    mpi::Barrier( g.Comm() );
+    runTime = mpi::Time() - startTime;
+    realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+    gFlops = ( IsComplex<T>::val ? 4*realGFlops : realGFlops );
+    if( g.Rank() == 0 )
+    {
+        cout << "DONE. " << endl
+             << "  Time = " << runTime << " seconds. GFlops = " 
+             << gFlops << endl;
+    }
+    if( print )
+    {
+        ostringstream msg;
+        msg << "C := " << alpha << " A B + " << beta << " C";
+        Print( C, msg.str() );
+    }
+    if( correctness )
+        TestCorrectness( orientA, orientB, alpha, A, B, beta, COrig, C, print );
 }
 
 int 
@@ -193,6 +273,10 @@ main( int argc, char* argv[] )
         const Int n = Input("--n","width of result",100);
         const Int k = Input("--k","inner dimension",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
+        const Int numLayers = Input
+          ("--numLayers","number of layers for 2.5D (0 for automatic)",0);
+        const bool calibrate =
+          Input("--calibrate","calibrate the Gemm cost model?",false);
         const bool print = Input("--print","print matrices?",false);
         const bool correctness = Input("--correctness","correctness?",true);
         const Int colAlignA = Input("--colAlignA","column align of A",0);
@@ -211,11 +295,28 @@ main( int argc, char* argv[] )
         const Orientation orientA = CharToOrientation( transA );
         const Orientation orientB = CharToOrientation( transB );
         SetBlocksize( nb );
+        SetGemmNumLayers( numLayers );
 
         ComplainIfDebug();
         if( commRank == 0 )
             cout << "Will test Gemm" << transA << transB << endl;
 
+        if( calibrate )
+        {
+            const GemmCostModel model = CalibrateGemm( g );
+            if( commRank == 0 )
+            {
+                cout << "Calibrated Gemm cost model:\n"
+                     << "  latency = " << model.latency << " seconds\n"
+                     << "  inverse bandwidth = " << model.inverseBandwidth
+                     << " seconds per byte" << endl;
+                for( size_t j=0; j<model.blocksizes.size(); ++j )
+                    cout << "  blocksize " << model.blocksizes[j]
+                         << ": " << model.flopTimes[j] << " seconds per flop"
+                         << endl;
+            }
+        }
+
         if( commRank == 0 )
             cout << "Testing with doubles:" << endl;
         TestGemm<double>
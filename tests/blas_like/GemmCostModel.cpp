@@ -0,0 +1,173 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+#include <algorithm>
+#include <cstdio>
+using namespace std;
+using namespace El;
+
+// A synthetic model, so that the test does not depend upon timings
+GemmCostModel SyntheticModel()
+{
+    GemmCostModel model;
+    model.latency = 1.25e-6;
+    model.inverseBandwidth = 1./3e9;
+    model.blocksizes = { 16, 48, 80 };
+    model.flopTimes = { 3e-10, 1e-10, 2e-10 };
+    return model;
+}
+
+void CheckEqual( const GemmCostModel& A, const GemmCostModel& B )
+{
+    if( A.latency != B.latency ||
+        A.inverseBandwidth != B.inverseBandwidth ||
+        A.blocksizes != B.blocksizes ||
+        A.flopTimes != B.flopTimes )
+        LogicError("The loaded Gemm cost model did not match the saved one");
+}
+
+// Save the registered models, clear them, and load them back
+void TestRoundTrip( const Grid& g, const string& filename )
+{
+    const GemmCostModel model = SyntheticModel();
+    GemmCostModel otherModel = model;
+    otherModel.latency = 1./3;
+    otherModel.blocksizes = { 128 };
+    otherModel.flopTimes = { 1./7 };
+
+    ClearGemmCostModels();
+    SetGemmCostModel( g.Height(), g.Width(), model );
+    SetGemmCostModel( g.Height()+1, g.Width(), otherModel );
+    SaveGemmCostModels( filename );
+    ClearGemmCostModels();
+    if( HaveGemmCostModel( g.Height(), g.Width() ) )
+        LogicError("The Gemm cost models were not cleared");
+    if( !LoadGemmCostModels( filename ) )
+        LogicError("Could not find the saved Gemm cost models");
+    CheckEqual( model, GetGemmCostModel( g.Height(), g.Width() ) );
+    CheckEqual( otherModel, GetGemmCostModel( g.Height()+1, g.Width() ) );
+    if( g.Rank() == 0 )
+    {
+        std::remove( filename.c_str() );
+        cout << "Saved and loaded the Gemm cost models" << endl;
+    }
+    mpi::Barrier( mpi::COMM_WORLD );
+
+    // A missing file is only an error if it must exist
+    if( LoadGemmCostModels( filename, false ) )
+        LogicError("Loaded a Gemm cost model from a missing file");
+    bool caught = false;
+    try { LoadGemmCostModels( filename ); }
+    catch( std::exception& e ) { caught = true; }
+    if( !caught )
+        LogicError("Loading a missing file did not throw");
+
+    // Every process should throw if the file cannot be written
+    caught = false;
+    try { SaveGemmCostModels( filename+".missing/models" ); }
+    catch( std::exception& e ) { caught = true; }
+    if( !caught )
+        LogicError("Saving to an unwritable file did not throw");
+    if( g.Rank() == 0 )
+        cout << "Missing and unwritable files were reported" << endl;
+}
+
+// Run each orientation with the default variant, which is now chosen by the
+// registered model, and compare against an explicitly chosen variant
+template<typename T>
+void TestPredictedGemm( const Grid& g, Int m, Int n, Int k )
+{
+    typedef Base<T> Real;
+    ClearGemmCostModels();
+    SetGemmCostModel( g.Height(), g.Width(), SyntheticModel() );
+    const Int blocksize = Blocksize();
+    const Real tol = 10*k*lapack::MachineEpsilon<Real>();
+    for( auto orientA : { NORMAL, TRANSPOSE } )
+    {
+        for( auto orientB : { NORMAL, ADJOINT } )
+        {
+            DistMatrix<T> A(g), B(g), C(g), CRef(g);
+            if( orientA == NORMAL )
+                Uniform( A, m, k );
+            else
+                Uniform( A, k, m );
+            if( orientB == NORMAL )
+                Uniform( B, k, n );
+            else
+                Uniform( B, n, k );
+            Uniform( C, m, n );
+            CRef = C;
+
+            GemmAlgorithm alg;
+            Int bsize;
+            if( !gemm::PredictVariant<T>
+                ( g, m, n, k, orientA==NORMAL && orientB==NORMAL,
+                  alg, bsize ) )
+                LogicError("No variant was predicted");
+            const vector<Int> blocksizes = SyntheticModel().blocksizes;
+            if( std::find(blocksizes.begin(),blocksizes.end(),bsize) ==
+                blocksizes.end() )
+                LogicError("Predicted a blocksize of ",bsize,
+                           " which was not in the model");
+
+            Gemm( orientA, orientB, T(2), A, B, T(-1), C );
+            if( Blocksize() != blocksize )
+                LogicError("The blocksize stack was not restored");
+            Gemm( orientA, orientB, T(2), A, B, T(-1), CRef, GEMM_SUMMA_C );
+            const Real CNorm = FrobeniusNorm( CRef );
+            Axpy( T(-1), C, CRef );
+            const Real relError = FrobeniusNorm( CRef ) / CNorm;
+            const char* algNames[] = { "", "A", "B", "C", "Dot" };
+            if( g.Rank() == 0 )
+                cout << "  " << OrientationToChar(orientA)
+                     << OrientationToChar(orientB) << ": predicted SUMMA_"
+                     << algNames[alg] << " with blocksize " << bsize
+                     << ", relative error = " << relError << endl;
+            if( relError > tol )
+                LogicError("Relative error of ",relError," exceeded ",tol);
+        }
+    }
+    ClearGemmCostModels();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+
+    try
+    {
+        const Int m = Input("--m","height of result",100);
+        const Int n = Input("--n","width of result",90);
+        const Int k = Input("--k","inner dimension",110);
+        const string filename = Input
+          ("--filename","file for the cost models",
+           string("GemmCostModelTest.txt"));
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        ComplainIfDebug();
+
+        TestRoundTrip( g, filename );
+        if( commRank == 0 )
+            cout << "Testing predicted Gemm with doubles:" << endl;
+        TestPredictedGemm<double>( g, m, n, k );
+        if( commRank == 0 )
+            cout << "Testing predicted Gemm with double-precision complex:"
+                 << endl;
+        TestPredictedGemm<Complex<double>>( g, m, n, k );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,263 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace std;
+using namespace El;
+
+// Measure the sustainable memory bandwidth (in bytes/second) with a
+// STREAM-like triad so that the sparse products can be compared against the
+// bandwidth roofline
+double TriadBandwidth( Int n, Int numReps )
+{
+    vector<double> a(n), b(n,1.), c(n,2.);
+    const double scalar = 3.;
+    Timer timer;
+    double bestTime = 0;
+    for( Int rep=0; rep<numReps; ++rep )
+    {
+        timer.Start();
+        EL_PARALLEL_FOR
+        for( Int i=0; i<n; ++i )
+            a[i] = b[i] + scalar*c[i];
+        const double time = timer.Stop();
+        bestTime = ( rep==0 ? time : Min(bestTime,time) );
+    }
+    if( a[n/2] != 7. )
+        LogicError("Triad produced an incorrect result");
+    return 3*n*sizeof(double)/bestTime;
+}
+
+template<typename T>
+void Report
+( string label, double time, Int numNonzeros, Int m, Int n, Int numRHS,
+  double bandwidth )
+{
+    // The minimal traffic streams the matrix once and touches each entry of
+    // X and Y once
+    const double flops = 
+      ( IsComplex<T>::val ? 8. : 2. )*double(numNonzeros)*numRHS;
+    const double bytes = 
+      double(numNonzeros)*(sizeof(T)+sizeof(Int)) + double(m+1)*sizeof(Int) + 
+      double(m+n)*numRHS*sizeof(T);
+    const double gFlops = flops/(1.e9*time);
+    const double roofline = (flops/bytes)*bandwidth/1.e9;
+    cout << "  " << label << ": " << time << " seconds, " 
+         << gFlops << " GFlop/s, " << bytes/(1.e9*time) << " GB/s ("
+         << 100.*gFlops/roofline << "% of the bandwidth roofline of " 
+         << roofline << " GFlop/s)" << endl;
+}
+
+// A nonsymmetric 7-point stencil whose off-diagonal coefficients are complex
+// (for complex T), so that confusing A, A^T, and A^H cannot go unnoticed
+template<typename T>
+void QueueStencilRow
+( Int i, Int nx, Int ny, Int nz, function<void(Int,Int,T)> queueUpdate )
+{
+    typedef Base<T> Real;
+    auto coeff = []( Real realPart, Real imagPart )
+    {
+        T alpha = realPart;
+        if( IsComplex<T>::val )
+            SetImagPart( alpha, imagPart );
+        return alpha;
+    };
+    const Int x = i % nx;
+    const Int y = (i/nx) % ny;
+    const Int z = i/(nx*ny);
+    queueUpdate( i, i, coeff(Real(10),Real(1)) );
+    if( x != 0 )
+        queueUpdate( i, i-1, coeff(Real(-1),Real(2)) );
+    if( x != nx-1 )
+        queueUpdate( i, i+1, coeff(Real(-2),Real(-1)) );
+    if( y != 0 )
+        queueUpdate( i, i-nx, coeff(Real(-3),Real(1)) );
+    if( y != ny-1 )
+        queueUpdate( i, i+nx, coeff(Real(-1),Real(-3)) );
+    if( z != 0 )
+        queueUpdate( i, i-nx*ny, coeff(Real(-4),Real(2)) );
+    if( z != nz-1 )
+        queueUpdate( i, i+nx*ny, coeff(Real(-2),Real(-2)) );
+}
+
+template<typename T>
+void Stencil( SparseMatrix<T>& A, Int nx, Int ny, Int nz )
+{
+    const Int n = nx*ny*nz;
+    Zeros( A, n, n );
+    A.Reserve( 7*n );
+    auto queueUpdate = [&]( Int i, Int j, T value )
+      { A.QueueUpdate( i, j, value ); };
+    for( Int i=0; i<n; ++i )
+        QueueStencilRow<T>( i, nx, ny, nz, queueUpdate );
+    A.ProcessQueues();
+}
+
+template<typename T>
+void Stencil( DistSparseMatrix<T>& A, Int nx, Int ny, Int nz )
+{
+    const Int n = nx*ny*nz;
+    Zeros( A, n, n );
+    const Int localHeight = A.LocalHeight();
+    A.Reserve( 7*localHeight );
+    auto queueUpdate = [&]( Int i, Int j, T value )
+      { A.QueueUpdate( i, j, value ); };
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        QueueStencilRow<T>( A.GlobalRow(iLoc), nx, ny, nz, queueUpdate );
+    A.ProcessQueues();
+}
+
+string OrientationName( Orientation orientation )
+{
+    switch( orientation )
+    {
+    case NORMAL:    return "A X  ";
+    case TRANSPOSE: return "A^T X";
+    default:        return "A^H X";
+    }
+}
+
+template<typename T,class MatrixType>
+void CheckError
+( Orientation orientation, const MatrixType& Y, MatrixType& YRef )
+{
+    typedef Base<T> Real;
+    const Real tol = 100*lapack::MachineEpsilon<Real>();
+    const Real YRefNrm = FrobeniusNorm( YRef );
+    Axpy( T(-1), Y, YRef );
+    const Real relError = FrobeniusNorm( YRef ) / YRefNrm;
+    if( mpi::WorldRank() == 0 )
+        cout << "  " << OrientationName(orientation) 
+             << ": relative error against a dense Gemm = " << relError 
+             << endl;
+    if( relError > tol )
+        LogicError
+        ("Relative error of ",OrientationName(orientation)," was ",relError,
+         " > ",tol);
+}
+
+template<typename T> 
+void TestSparseMultiply
+( Int nx, Int ny, Int nz, Int numRHS, Int numReps, bool print )
+{
+    const Int commRank = mpi::Rank( mpi::COMM_WORLD );
+    const Int n = nx*ny*nz;
+    const T alpha = T(2);
+    const T beta = T(-1);
+    const Orientation orientations[3] = { NORMAL, TRANSPOSE, ADJOINT };
+    Timer timer;
+
+    // Compare the local products against a dense Gemm
+    // ===============================================
+    if( commRank == 0 )
+    {
+        SparseMatrix<T> A;
+        Stencil( A, nx, ny, nz );
+        Matrix<T> ADense, X, Y, YOrig, YRef;
+        Copy( A, ADense );
+        Uniform( X, n, numRHS );
+        Uniform( YOrig, n, numRHS );
+        const Int numNonzeros = A.NumEntries();
+        const double bandwidth = TriadBandwidth( 4*n*numRHS, 5 );
+        cout << "Sequential products with " << numNonzeros << " nonzeros and "
+             << numRHS << " right-hand sides (triad bandwidth of " 
+             << bandwidth/1.e9 << " GB/s)" << endl;
+
+        for( auto orientation : orientations )
+        {
+            Y = YOrig;
+            timer.Start();
+            for( Int rep=0; rep<numReps; ++rep )
+                Multiply( orientation, T(1), A, X, T(0), Y );
+            Report<T>
+            ( OrientationName(orientation), timer.Stop()/numReps, 
+              numNonzeros, n, n, numRHS, bandwidth );
+
+            Y = YOrig;
+            Multiply( orientation, alpha, A, X, beta, Y );
+            YRef = YOrig;
+            Gemm( orientation, NORMAL, alpha, ADense, X, beta, YRef );
+            if( print && orientation == NORMAL )
+                Print( Y, "alpha A X + beta Y" );
+            CheckError<T>( orientation, Y, YRef );
+        }
+    }
+
+    // Distributed products
+    // ====================
+    DistSparseMatrix<T> A;
+    Stencil( A, nx, ny, nz );
+    DistMultiVec<T> X, Y, YOrig;
+    Uniform( X, n, numRHS );
+    Uniform( YOrig, n, numRHS );
+    const Int numNonzeros = mpi::AllReduce( A.NumLocalEntries(), A.Comm() );
+    // Form the metadata outside of the timed region
+    Y = YOrig;
+    Multiply( NORMAL, T(1), A, X, T(0), Y );
+
+    DistMatrix<T> ADense, XDense, YDense, YRef;
+    Copy( A, ADense );
+    Copy( X, XDense );
+    if( commRank == 0 )
+        cout << "Distributed products:" << endl;
+    for( auto orientation : orientations )
+    {
+        Y = YOrig;
+        mpi::Barrier( A.Comm() );
+        timer.Start();
+        for( Int rep=0; rep<numReps; ++rep )
+            Multiply( orientation, T(1), A, X, T(0), Y );
+        mpi::Barrier( A.Comm() );
+        const double time = timer.Stop()/numReps;
+        if( commRank == 0 )
+        {
+            const double flops = 
+              ( IsComplex<T>::val ? 8. : 2. )*double(numNonzeros)*numRHS;
+            cout << "  " << OrientationName(orientation) << ": " << time 
+                 << " seconds, " << flops/(1.e9*time) << " GFlop/s" << endl;
+        }
+
+        Y = YOrig;
+        Multiply( orientation, alpha, A, X, beta, Y );
+        Copy( Y, YDense );
+        Copy( YOrig, YRef );
+        Gemm( orientation, NORMAL, alpha, ADense, XDense, beta, YRef );
+        CheckError<T>( orientation, YDense, YRef );
+    }
+}
+
+int 
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    try
+    {
+        const Int nx = Input("--nx","size of grid in x dimension",10);
+        const Int ny = Input("--ny","size of grid in y dimension",10);
+        const Int nz = Input("--nz","size of grid in z dimension",10);
+        // Cover both the register-blocked kernel and its remainder
+        const Int numRHS = Input("--numRHS","number of right-hand sides",6);
+        const Int numReps = Input("--numReps","number of repetitions",10);
+        const bool print = Input("--print","print result?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( mpi::WorldRank() == 0 )
+            cout << "Testing with doubles" << endl;
+        TestSparseMultiply<double>( nx, ny, nz, numRHS, numReps, print );
+
+        if( mpi::WorldRank() == 0 )
+            cout << "Testing with double-precision complex" << endl;
+        TestSparseMultiply<Complex<double>>
+        ( nx, ny, nz, numRHS, numReps, print );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,150 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace std;
+using namespace El;
+
+string MethodName( SignMethod method )
+{
+    switch( method )
+    {
+    case SIGN_NEWTON:        return "Newton";
+    case SIGN_NEWTON_SCHULZ: return "Newton-Schulz";
+    default:                 return "Zolotarev";
+    }
+}
+
+string ScalingName( SignScaling scaling )
+{
+    switch( scaling )
+    {
+    case SIGN_SCALE_NONE: return "no scaling";
+    case SIGN_SCALE_DET:  return "determinant scaling";
+    default:              return "Frobenius scaling";
+    }
+}
+
+// Solve X K X - A^H X - X A = L with every sign method and scaling and check
+// that the residual, relative to ||X||_F^2 ||K||_F + 2 ||A||_F ||X||_F +
+// ||L||_F, is small
+template<typename F,class MatrixType>
+void TestRicatti
+( const string& label,
+  const MatrixType& A, const MatrixType& K, const MatrixType& L,
+  Int commRank )
+{
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    const Real tol = 100*n*lapack::MachineEpsilon<Real>();
+    const Real ANorm = FrobeniusNorm( A );
+    const Real KNorm = FrobeniusNorm( K );
+    const Real LNorm = FrobeniusNorm( L );
+
+    if( commRank == 0 )
+        cout << " " << label << ":" << endl;
+    for( auto method : { SIGN_NEWTON, SIGN_NEWTON_SCHULZ, SIGN_ZOLOTAREV } )
+    {
+        for( auto scaling :
+             { SIGN_SCALE_NONE, SIGN_SCALE_DET, SIGN_SCALE_FROB } )
+        {
+            SignCtrl<Real> ctrl;
+            ctrl.method = method;
+            ctrl.scaling = scaling;
+
+            MatrixType X( L );
+            Ricatti( LOWER, A, K, L, X, ctrl );
+
+            // E := L - X K X + A^H X + X A
+            MatrixType XK( L ), E( L );
+            Gemm( NORMAL, NORMAL, F(1), X, K, F(0), XK );
+            Gemm( NORMAL, NORMAL, F(-1), XK, X, F(1), E );
+            Gemm( ADJOINT, NORMAL, F(1), A, X, F(1), E );
+            Gemm( NORMAL, NORMAL, F(1), X, A, F(1), E );
+            const Real XNorm = FrobeniusNorm( X );
+            const Real relResid =
+              FrobeniusNorm( E ) / (XNorm*XNorm*KNorm + 2*ANorm*XNorm + LNorm);
+
+            const string name = MethodName(method)+" with "+
+                                ScalingName(scaling);
+            if( commRank == 0 )
+                cout << "  " << name << ": relative residual = "
+                     << relResid << endl;
+            if( relResid > tol )
+                LogicError
+                (label,", ",name,": relative residual ",relResid,
+                 " exceeded ",tol);
+        }
+    }
+}
+
+template<typename F>
+void TestRicattis( Int n, const Grid& g )
+{
+    typedef Base<F> Real;
+
+    // Shift A so that its spectrum lies in the open right half-plane and
+    // form Hermitian positive-definite K and L
+    DistMatrix<F> A(g), K(g), L(g), T(g);
+    Uniform( A, n, n );
+    ShiftDiagonal( A, F(2*n) );
+    Uniform( T, n, n );
+    Herk( LOWER, NORMAL, Real(1), T, K );
+    MakeHermitian( LOWER, K );
+    ShiftDiagonal( K, F(1) );
+    Uniform( T, n, n );
+    Herk( LOWER, NORMAL, Real(1), T, L );
+    MakeHermitian( LOWER, L );
+    ShiftDiagonal( L, F(1) );
+
+    TestRicatti<F>( "Distributed", A, K, L, g.Rank() );
+
+    DistMatrix<F,STAR,STAR> A_STAR_STAR( A ), K_STAR_STAR( K ),
+                            L_STAR_STAR( L );
+    if( g.Rank() == 0 )
+        TestRicatti<F>
+        ( "Sequential",
+          A_STAR_STAR.Matrix(), K_STAR_STAR.Matrix(), L_STAR_STAR.Matrix(),
+          0 );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+
+    try
+    {
+        const Int n = Input("--n","size of matrices",60);
+        const Int nb = Input("--nb","algorithmic blocksize",32);
+        const bool testCpx = Input("--testCpx","test complex matrices?",true);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        if( commRank == 0 )
+            cout << "Testing Ricatti with doubles:" << endl;
+        TestRicattis<double>( n, g );
+        if( testCpx )
+        {
+            if( commRank == 0 )
+                cout << "Testing Ricatti with double-precision complex:"
+                     << endl;
+            TestRicattis<Complex<double>>( n, g );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,139 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace std;
+using namespace El;
+
+string MethodName( SignMethod method )
+{
+    switch( method )
+    {
+    case SIGN_NEWTON:        return "Newton";
+    case SIGN_NEWTON_SCHULZ: return "Newton-Schulz";
+    default:                 return "Zolotarev";
+    }
+}
+
+string ScalingName( SignScaling scaling )
+{
+    switch( scaling )
+    {
+    case SIGN_SCALE_NONE: return "no scaling";
+    case SIGN_SCALE_DET:  return "determinant scaling";
+    default:              return "Frobenius scaling";
+    }
+}
+
+// Solve A X + X B = C with every sign method and scaling and check that
+// || A X + X B - C ||_F / ((||A||_F + ||B||_F) ||X||_F + ||C||_F) is small
+template<typename F,class MatrixType>
+void TestSylvester
+( const string& label,
+  const MatrixType& A, const MatrixType& B, const MatrixType& C,
+  Int commRank )
+{
+    typedef Base<F> Real;
+    const Int m = A.Height();
+    const Int n = B.Height();
+    const Real tol = 100*(m+n)*lapack::MachineEpsilon<Real>();
+    const Real ANorm = FrobeniusNorm( A );
+    const Real BNorm = FrobeniusNorm( B );
+    const Real CNorm = FrobeniusNorm( C );
+
+    if( commRank == 0 )
+        cout << " " << label << ":" << endl;
+    for( auto method : { SIGN_NEWTON, SIGN_NEWTON_SCHULZ, SIGN_ZOLOTAREV } )
+    {
+        for( auto scaling :
+             { SIGN_SCALE_NONE, SIGN_SCALE_DET, SIGN_SCALE_FROB } )
+        {
+            SignCtrl<Real> ctrl;
+            ctrl.method = method;
+            ctrl.scaling = scaling;
+
+            MatrixType X( C );
+            Sylvester( A, B, C, X, ctrl );
+            MatrixType E( C );
+            Gemm( NORMAL, NORMAL, F(-1), A, X, F(1), E );
+            Gemm( NORMAL, NORMAL, F(-1), X, B, F(1), E );
+            const Real relResid =
+              FrobeniusNorm( E ) /
+              ((ANorm+BNorm)*FrobeniusNorm( X ) + CNorm);
+
+            const string name = MethodName(method)+" with "+
+                                ScalingName(scaling);
+            if( commRank == 0 )
+                cout << "  " << name << ": relative residual = "
+                     << relResid << endl;
+            if( relResid > tol )
+                LogicError
+                (label,", ",name,": relative residual ",relResid,
+                 " exceeded ",tol);
+        }
+    }
+}
+
+template<typename F>
+void TestSylvesters( Int m, Int n, const Grid& g )
+{
+    // Shift A and B so that their spectra lie in the open right half-plane
+    DistMatrix<F> A(g), B(g), C(g);
+    Uniform( A, m, m );
+    ShiftDiagonal( A, F(2*m) );
+    Uniform( B, n, n );
+    ShiftDiagonal( B, F(2*n) );
+    Uniform( C, m, n );
+
+    TestSylvester<F>( "Distributed", A, B, C, g.Rank() );
+
+    DistMatrix<F,STAR,STAR> A_STAR_STAR( A ), B_STAR_STAR( B ),
+                            C_STAR_STAR( C );
+    if( g.Rank() == 0 )
+        TestSylvester<F>
+        ( "Sequential",
+          A_STAR_STAR.Matrix(), B_STAR_STAR.Matrix(), C_STAR_STAR.Matrix(),
+          0 );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+
+    try
+    {
+        const Int m = Input("--m","height of X",60);
+        const Int n = Input("--n","width of X",40);
+        const Int nb = Input("--nb","algorithmic blocksize",32);
+        const bool testCpx = Input("--testCpx","test complex matrices?",true);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        if( commRank == 0 )
+            cout << "Testing Sylvester with doubles:" << endl;
+        TestSylvesters<double>( m, n, g );
+        if( testCpx )
+        {
+            if( commRank == 0 )
+                cout << "Testing Sylvester with double-precision complex:"
+                     << endl;
+            TestSylvesters<Complex<double>>( m, n, g );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
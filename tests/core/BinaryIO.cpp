@@ -0,0 +1,134 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+template<typename T,Dist U,Dist V>
+void RoundTrip
+( const DistMatrix<T>& A, string basename, FileFormat format,
+  const string& label )
+{
+    const Grid& g = A.Grid();
+    DistMatrix<T,U,V> AWrite( A );
+    Write( AWrite, basename, format );
+
+    DistMatrix<T,U,V> ARead( g );
+    if( format == BINARY_FLAT )
+        ARead.Resize( A.Height(), A.Width() );
+    Read( ARead, basename+"."+FileExtension(format), format );
+
+    DistMatrix<T> E( ARead );
+    Axpy( T(-1), A, E );
+    const Base<T> errNorm = FrobeniusNorm( E );
+    if( g.Rank() == 0 )
+        std::cout << label << " error: " << errNorm << std::endl;
+    if( errNorm != Base<T>(0) )
+        LogicError("Round trip through ",label," was not exact");
+}
+
+template<typename T>
+void TestFormat( const Grid& g, Int m, Int n, FileFormat format, bool print )
+{
+    string basename = "BinaryIO";
+    DistMatrix<T> A(g);
+    Uniform( A, m, n );
+    if( print )
+        Print( A, "A" );
+
+    const string ext = FileExtension(format);
+    RoundTrip<T,MC,  MR  >( A, basename, format, "[MC,MR] "+ext );
+    RoundTrip<T,MR,  MC  >( A, basename, format, "[MR,MC] "+ext );
+    RoundTrip<T,VC,  STAR>( A, basename, format, "[VC,* ] "+ext );
+    RoundTrip<T,STAR,VR  >( A, basename, format, "[* ,VR] "+ext );
+    RoundTrip<T,MC,  STAR>( A, basename, format, "[MC,* ] "+ext );
+    RoundTrip<T,STAR,STAR>( A, basename, format, "[* ,* ] "+ext );
+    RoundTrip<T,CIRC,CIRC>( A, basename, format, "[o ,o ] "+ext );
+}
+
+void TestSparse( mpi::Comm comm, Int n, bool print )
+{
+    const int commRank = mpi::Rank( comm );
+    DistSparseMatrix<double> A(comm);
+    Laplacian( A, n, n );
+    if( print )
+        Print( A, "A" );
+
+    // Have the root store the lower triangle in the symmetric Matrix Market
+    // format so that the parallel reader is forced to mirror the entries
+    const string mmName = "BinaryIO-sparse.mm";
+    if( commRank == 0 )
+    {
+        SparseMatrix<double> ASeq;
+        Laplacian( ASeq, n, n );
+        Int numLower = 0;
+        for( Int e=0; e<ASeq.NumEntries(); ++e )
+            if( ASeq.Row(e) >= ASeq.Col(e) )
+                ++numLower;
+        std::ofstream file( mmName.c_str() );
+        file << "%%MatrixMarket matrix coordinate real symmetric\n"
+             << "% Lower triangle of a 2D Laplacian\n"
+             << ASeq.Height() << " " << ASeq.Width() << " " << numLower << "\n";
+        file.precision( 17 );
+        for( Int e=0; e<ASeq.NumEntries(); ++e )
+            if( ASeq.Row(e) >= ASeq.Col(e) )
+                file << ASeq.Row(e)+1 << " " << ASeq.Col(e)+1 << " "
+                     << ASeq.Value(e) << "\n";
+    }
+    mpi::Barrier( comm );
+
+    DistSparseMatrix<double> AMM(comm);
+    Read( AMM, mmName );
+    Axpy( -1., A, AMM );
+    const double mmError = FrobeniusNorm( AMM );
+    if( commRank == 0 )
+        std::cout << "Matrix Market error: " << mmError << std::endl;
+    if( mmError != 0. )
+        LogicError("Parallel Matrix Market read was not exact");
+
+    Write( A, "BinaryIO-sparse", BINARY_CSR );
+    DistSparseMatrix<double> ACSR(comm);
+    Read( ACSR, "BinaryIO-sparse."+FileExtension(BINARY_CSR) );
+    Axpy( -1., A, ACSR );
+    const double csrError = FrobeniusNorm( ACSR );
+    if( commRank == 0 )
+        std::cout << "Binary CSR error: " << csrError << std::endl;
+    if( csrError != 0. )
+        LogicError("Binary CSR round trip was not exact");
+
+    DistGraph graph(comm);
+    Read( graph, "BinaryIO-sparse."+FileExtension(BINARY_CSR) );
+    if( graph.NumLocalEdges() != A.NumLocalEntries() )
+        LogicError("Binary CSR graph read had the wrong number of edges");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--height","height of matrix",100);
+        const Int n = Input("--width","width of matrix",70);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        TestFormat<double>( g, m, n, BINARY, print );
+        TestFormat<double>( g, m, n, BINARY_FLAT, print );
+        TestFormat<Complex<float>>( g, m, n, BINARY, print );
+        TestSparse( comm, Int(sqrt(double(m*n))), print );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
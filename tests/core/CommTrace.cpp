@@ -0,0 +1,110 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+
+    try
+    {
+        const Int n = Input("--size","size of matrix",100);
+        const Int count = Input("--count","entries per AllGather",1000);
+        ProcessInput();
+        PrintInputReport();
+
+        EnableProfiling();
+        mpi::EnableTracing();
+        mpi::ResetTracing();
+
+        // A collective with a known volume
+        {
+            ProfileRegion region("KnownVolume");
+            vector<double> sendBuf(count,commRank), recvBuf(count*commSize);
+            mpi::AllGather
+            ( sendBuf.data(), count, recvBuf.data(), count, comm );
+        }
+
+        // A redistribution whose cost we would like to know
+        {
+            ProfileRegion region("Redistribute");
+            DistMatrix<double> A;
+            Uniform( A, n, n );
+            DistMatrix<double,STAR,VR> A_STAR_VR( A );
+        }
+
+        // Nonblocking messages on a separate communicator, whose wait should
+        // be charged to that communicator
+        mpi::Comm evenOddComm;
+        mpi::Split( comm, commRank % 2, commRank, evenOddComm );
+        {
+            ProfileRegion region("NonblockingRing");
+            const int evenOddRank = mpi::Rank( evenOddComm );
+            const int evenOddSize = mpi::Size( evenOddComm );
+            const int to = (evenOddRank+1) % evenOddSize;
+            const int from = (evenOddRank+evenOddSize-1) % evenOddSize;
+            vector<double> sendBuf(count,commRank), recvBuf(count);
+            mpi::Request requests[2];
+            mpi::IRecv( recvBuf.data(), count, from, evenOddComm, requests[0] );
+            mpi::ISend( sendBuf.data(), count, to, evenOddComm, requests[1] );
+            mpi::WaitAll( 2, requests );
+        }
+
+        const double expectedBytes = double(count)*sizeof(double)*(commSize-1);
+        bool found = false;
+        for( const auto& s : mpi::GetTraceStats() )
+        {
+            if( s.routine == "AllGather" && s.site == "KnownVolume" )
+            {
+                found = true;
+                if( s.numCalls != 1 || s.sendBytes != expectedBytes ||
+                    s.recvBytes != expectedBytes )
+                    LogicError("Unexpected AllGather statistics");
+            }
+        }
+        if( !found )
+            LogicError("AllGather was not traced");
+
+        string sendComm, waitComm;
+        for( const auto& s : mpi::GetTraceStats() )
+        {
+            if( s.site != "NonblockingRing" )
+                continue;
+            if( s.routine == "ISend" )
+                sendComm = s.comm;
+            else if( s.routine == "WaitAll" )
+                waitComm = s.comm;
+        }
+        if( sendComm.empty() || waitComm != sendComm )
+            LogicError
+            ("WaitAll was charged to ",waitComm," rather than ",sendComm);
+
+        auto volumes = mpi::GetTraceVolumes();
+        for( int q=0; q<commSize; ++q )
+            if( q != commRank && volumes[q] < count*sizeof(double) )
+                LogicError("Communication matrix is missing the AllGather");
+
+        mpi::PrintTrace( comm );
+        mpi::WriteTrace( "CommTrace", comm );
+        if( commRank == 0 )
+            cout << "Wrote CommTrace.txt and CommTrace-matrix.txt" << endl;
+        mpi::DisableTracing();
+        DisableProfiling();
+        mpi::Free( evenOddComm );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -9,6 +9,24 @@
 #include "El.hpp"
 using namespace El;
 
+// Copy A into a [U,V] distribution over another grid and back, checking that
+// the result is exact
+template<Dist U,Dist V>
+void RoundTrip
+( const DistMatrix<double>& A, const Grid& otherGrid, const string& label )
+{
+    DistMatrix<double,U,V> AOther(otherGrid);
+    Copy( A, AOther );
+    DistMatrix<double> ACopy(A.Grid());
+    Copy( AOther, ACopy );
+    Axpy( -1., A, ACopy );
+    const double errNorm = FrobeniusNorm( ACopy );
+    if( A.Grid().Rank() == 0 )
+        std::cout << label << " round trip error: " << errNorm << std::endl;
+    if( errNorm != 0. )
+        LogicError("Round trip through ",label," was not exact");
+}
+
 int 
 main( int argc, char* argv[] )
 {
@@ -63,6 +81,37 @@ main( int argc, char* argv[] )
         if( print )
             Print( A, "A := ASqrt" );
 
+        // Test the general redistributions between the two grids
+        DistMatrix<double> B(grid);
+        Uniform( B, m, n );
+        RoundTrip<MC,  MR  >( B, sqrtGrid, "[MC,MR] " );
+        RoundTrip<MR,  MC  >( B, sqrtGrid, "[MR,MC] " );
+        RoundTrip<VC,  STAR>( B, sqrtGrid, "[VC,* ] " );
+        RoundTrip<STAR,VR  >( B, sqrtGrid, "[* ,VR] " );
+        RoundTrip<MC,  STAR>( B, sqrtGrid, "[MC,* ] " );
+        RoundTrip<STAR,MR  >( B, sqrtGrid, "[* ,MR] " );
+        RoundTrip<MD,  STAR>( B, sqrtGrid, "[MD,* ] " );
+        RoundTrip<STAR,STAR>( B, sqrtGrid, "[* ,* ] " );
+        RoundTrip<CIRC,CIRC>( B, sqrtGrid, "[o ,o ] " );
+
+        // Reuse a single plan for several translations
+        DistMatrix<double,VR,STAR> BSqrt(sqrtGrid);
+        BSqrt.Resize( m, n );
+        auto plan = MakeTranslatePlan( B, BSqrt );
+        for( Int k=0; k<3; ++k )
+        {
+            TranslateBetweenGrids( B, BSqrt, plan );
+            Scale( 2., B );
+        }
+        DistMatrix<double> BCopy(grid);
+        Copy( BSqrt, BCopy );
+        Axpy( -0.5, B, BCopy );
+        const double planError = FrobeniusNorm( BCopy );
+        if( grid.Rank() == 0 )
+            std::cout << "Reused plan error: " << planError << std::endl;
+        if( planError != 0. )
+            LogicError("Translation with a reused plan was not exact");
+
         const Grid newGrid( comm, order );
         A.SetGrid( newGrid );
         if( print )
@@ -0,0 +1,136 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+#include <atomic>
+#include <thread>
+using namespace El;
+
+template<typename T> 
+void TestMemory( Int m, Int n, Int numReps )
+{
+    const size_t alignment = MemoryAlignment();
+    const MemoryStats statsBefore = GetMemoryStats();
+    for( Int rep=0; rep<numReps; ++rep )
+    {
+        // Mimic the panel temporaries of a blocked algorithm
+        Matrix<T> A, B;
+        Uniform( A, m, n );
+        Uniform( B, m/2+rep, n );
+        if( size_t(A.Buffer()) % alignment != 0 ||
+            size_t(B.Buffer()) % alignment != 0 )
+            LogicError("Buffer was not aligned to ",alignment," bytes");
+
+        Matrix<T> C( A );
+        for( Int j=0; j<n; ++j )
+            for( Int i=0; i<m; ++i )
+                if( C.Get(i,j) != A.Get(i,j) )
+                    LogicError("Copy of a pooled buffer was corrupted");
+    }
+    const MemoryStats statsAfter = GetMemoryStats();
+    if( GetMemoryMode() == MEMORY_POOLED && numReps > 1 &&
+        statsAfter.numPoolHits == statsBefore.numPoolHits )
+        LogicError("Pooled buffers were never reused");
+    if( statsAfter.highWaterBytes < statsAfter.currentBytes )
+        LogicError("High-water mark was below the current usage");
+
+    if( mpi::WorldRank() == 0 )
+        cout << "passed" << endl;
+}
+
+// Cache a buffer on both the calling thread and a second thread, release the
+// pools while the second thread's cache is still alive, and check that the
+// pooled-byte counter only drops by what was actually freed
+void TestThreadCaches( Int m, Int n )
+{
+    SetMemoryMode( MEMORY_POOLED );
+    ReleaseMemoryPools();
+    const size_t pooledBase = GetMemoryStats().pooledBytes;
+
+    { Matrix<double> A( m, n ); }
+    const size_t mainBytes = GetMemoryStats().pooledBytes - pooledBase;
+
+    std::atomic<bool> cached(false), released(false);
+    std::thread worker
+    ( [&]()
+      {
+          { Matrix<double> B( m, n ); }
+          cached = true;
+          while( !released )
+              std::this_thread::yield();
+      } );
+    while( !cached )
+        std::this_thread::yield();
+    const size_t workerBytes = 
+      GetMemoryStats().pooledBytes - pooledBase - mainBytes;
+    if( mainBytes == 0 || workerBytes == 0 )
+        LogicError("Freed buffers were not cached");
+
+    ReleaseMemoryPools();
+    const size_t pooledReleased = GetMemoryStats().pooledBytes;
+    released = true;
+    worker.join();
+    const size_t pooledJoined = GetMemoryStats().pooledBytes;
+    if( pooledReleased != pooledBase + workerBytes )
+        LogicError
+        ("Pooled bytes after the release were ",pooledReleased,
+         " rather than ",pooledBase+workerBytes);
+    if( pooledJoined != pooledBase )
+        LogicError
+        ("Pooled bytes after the worker exited were ",pooledJoined,
+         " rather than ",pooledBase);
+
+    // Pooling must still be enabled
+    const size_t hitsBefore = GetMemoryStats().numPoolHits;
+    { Matrix<double> A( m, n ); }
+    { Matrix<double> A( m, n ); }
+    if( GetMemoryStats().numPoolHits == hitsBefore )
+        LogicError("Pooling was disabled after releasing the pools");
+
+    if( mpi::WorldRank() == 0 )
+        cout << "passed" << endl;
+}
+
+int 
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    try 
+    {
+        const Int m = Input("--height","height of matrix",100);
+        const Int n = Input("--width","width of matrix",100);
+        const Int numReps = Input("--numReps","number of repetitions",10);
+        const bool print = Input("--print","print statistics?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        for( Int mode=0; mode<2; ++mode )
+        {
+            SetMemoryMode( mode == 0 ? MEMORY_SYSTEM : MEMORY_POOLED );
+            if( mpi::WorldRank() == 0 )
+                cout << "Testing " << ( mode==0 ? "system" : "pooled" )
+                     << " allocations with doubles" << endl;
+            TestMemory<double>( m, n, numReps );
+
+            if( mpi::WorldRank() == 0 )
+                cout << "Testing " << ( mode==0 ? "system" : "pooled" )
+                     << " allocations with double-precision complex" << endl;
+            TestMemory<Complex<double>>( m, n, numReps );
+            if( print )
+                PrintMemoryStats();
+        }
+
+        if( mpi::WorldRank() == 0 )
+            cout << "Testing the release of multiple thread caches" << endl;
+        TestThreadCaches( m, n );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
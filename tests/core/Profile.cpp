@@ -0,0 +1,80 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank( comm );
+
+    try
+    {
+        const Int n = Input("--size","size of matrices",200);
+        const Int numReps = Input("--numReps","number of repetitions",3);
+        const bool trace = Input("--trace","record a trace?",true);
+        ProcessInput();
+        PrintInputReport();
+
+        EnableProfiling( trace );
+        ResetProfile();
+
+        DistMatrix<double> A, B, C;
+        Uniform( A, n, n );
+        Uniform( B, n, n );
+        for( Int rep=0; rep<numReps; ++rep )
+        {
+            ProfileRegion outer("Test");
+            {
+                ProfileRegion inner("Multiply");
+                Gemm( NORMAL, NORMAL, 1., A, B, C );
+            }
+            ProfileRegion inner("Communicate");
+            AddProfileBytes( 1024 );
+        }
+
+        auto stats = GetProfileStats();
+        bool foundTest=false, foundGemm=false;
+        for( const auto& s : stats )
+        {
+            if( s.exclusive < 0 || s.exclusive > s.inclusive*(1+1e-10) )
+                LogicError("Invalid exclusive time for ",s.path);
+            if( s.path == "Test" )
+            {
+                foundTest = true;
+                if( s.numCalls != numReps || s.depth != 0 )
+                    LogicError("Unexpected statistics for Test");
+            }
+            else if( s.path == "Test/Multiply/Gemm" )
+            {
+                foundGemm = true;
+                if( s.numCalls != numReps || s.depth != 2 )
+                    LogicError("Unexpected statistics for Gemm");
+                if( s.flops <= 0 && A.Participating() )
+                    LogicError("No flops were recorded for Gemm");
+            }
+            else if( s.path == "Test/Communicate" && s.bytes != 1024.*numReps )
+                LogicError("Unexpected number of bytes for Communicate");
+        }
+        if( !foundTest || !foundGemm )
+            LogicError("Missing profile regions");
+
+        PrintProfile( comm );
+        WriteProfile( "Profile", comm );
+        if( commRank == 0 )
+            cout << "Wrote Profile.txt and Profile.json" << endl;
+        DisableProfiling();
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
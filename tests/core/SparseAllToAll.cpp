@@ -0,0 +1,95 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// Each process sends a random number of entries to a random subset of the
+// processes, where each entry encodes its origin, destination, and position
+void TestPlan
+( mpi::Comm comm, Int maxCount, double density, int width, int ranksPerNode )
+{
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+
+    vector<int> sendCounts(commSize), recvCounts(commSize);
+    for( int q=0; q<commSize; ++q )
+        sendCounts[q] =
+          ( SampleUniform<double>(0,1) < density ?
+            SampleUniform<Int>(1,maxCount+1) : 0 );
+    mpi::AllToAll( sendCounts.data(), 1, recvCounts.data(), 1, comm );
+    vector<int> sendOffs, recvOffs;
+    const int sendSize = Scan( sendCounts, sendOffs );
+    const int recvSize = Scan( recvCounts, recvOffs );
+
+    auto plan =
+      mpi::MakeSparseAllToAllPlan
+      ( sendCounts, sendOffs, recvCounts, recvOffs, comm, ranksPerNode );
+    const bool hierarchical = plan.hierarchical;
+
+    // The plan should match the counts it was formed from, but not others
+    mpi::VerifyPlan( plan, sendCounts, sendOffs, recvCounts, recvOffs );
+    vector<int> badCounts( sendCounts );
+    ++badCounts[commRank];
+    bool caught = false;
+    try { mpi::VerifyPlan( plan, badCounts, sendOffs, recvCounts, recvOffs ); }
+    catch( std::exception& e ) { caught = true; }
+    if( !caught )
+        LogicError("The plan was not checked against modified counts");
+
+    vector<double> sendBuf( sendSize*width );
+    for( int q=0; q<commSize; ++q )
+        for( Int k=0; k<sendCounts[q]*width; ++k )
+            sendBuf[sendOffs[q]*width+k] = (commRank*commSize+q)*1e6 + k;
+
+    // Reuse the plan a few times
+    const Int numReuses = 3;
+    for( Int reuse=0; reuse<numReuses; ++reuse )
+    {
+        vector<double> recvBuf( recvSize*width, -1 );
+        mpi::SparseAllToAll( sendBuf, recvBuf, plan, width );
+        for( int q=0; q<commSize; ++q )
+            for( Int k=0; k<recvCounts[q]*width; ++k )
+                if( recvBuf[recvOffs[q]*width+k] !=
+                    (q*commSize+commRank)*1e6 + k )
+                    LogicError
+                    ("Entry ",k," from process ",q," was incorrect for a ",
+                     (hierarchical?"hierarchical":"direct")," plan");
+    }
+    if( commRank == 0 )
+        cout << "Passed with ranksPerNode=" << ranksPerNode
+             << ", width=" << width << ", density=" << density << " ("
+             << (hierarchical?"hierarchical":"direct") << ")" << endl;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int maxCount = Input("--maxCount","max entries per message",20);
+        const int width = Input("--width","entries per unit",3);
+        ProcessInput();
+        PrintInputReport();
+
+        // The shared-memory layout of the machine
+        TestPlan( comm, maxCount, 0.5, width, 0 );
+        // Force a single process per node (and hence a direct exchange)
+        TestPlan( comm, maxCount, 1., width, 1 );
+        // Force pairs of processes to act as nodes
+        TestPlan( comm, maxCount, 1., width, 2 );
+        TestPlan( comm, maxCount, 0.7, 1, 2 );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -34,11 +34,16 @@ void TestCorrectness
     const Real oneNormY = OneNorm( Y );
     const Real infNormY = InfinityNorm( Y );
     const Real frobNormY = FrobeniusNorm( Y );
+    DistMatrix<F> R( Y );
 
     if( pivot )
         cholesky::SolveAfter( uplo, NORMAL, A, p, Y );
     else
         cholesky::SolveAfter( uplo, NORMAL, A, Y );
+    // R := AOrig inv(A) Y - Y
+    Hemm( LEFT, uplo, F(1), AOrig, Y, F(-1), R );
+    const Real relResid = 
+      FrobeniusNorm( R ) / (frobNormA*FrobeniusNorm( Y ));
     Axpy( F(-1), Y, X );
     const Real oneNormE = OneNorm( X );
     const Real infNormE = InfinityNorm( X );
@@ -55,14 +60,19 @@ void TestCorrectness
              << "||Y||_F              = " << frobNormY << "\n"
              << "||X - inv(A) X||_1  = " << oneNormE << "\n"
              << "||X - inv(A) X||_oo = " << infNormE << "\n"
-             << "||X - inv(A) X||_F  = " << frobNormE << endl;
+             << "||X - inv(A) X||_F  = " << frobNormE << "\n"
+             << "||A inv(A) Y - Y||_F / (||A||_F ||inv(A) Y||_F) = " 
+             << relResid << endl;
     }
+    const Real tol = 10*m*lapack::MachineEpsilon<Real>();
+    if( relResid > tol )
+        LogicError("Relative residual of ",relResid," exceeded ",tol);
 }
 
 template<typename F,Dist UPerm> 
 void TestCholesky
 ( bool testCorrectness, bool pivot, bool print, bool printDiag,
-  UpperOrLower uplo, Int m, const Grid& g )
+  UpperOrLower uplo, Int m, const Grid& g, const CholeskyCtrl& ctrl )
 {
     DistMatrix<F> A(g), AOrig(g);
     DistMatrix<Int,UPerm,STAR> p(g);
@@ -92,7 +102,7 @@ void TestCholesky
     if( pivot )
         Cholesky( uplo, A, p );
     else
-        Cholesky( uplo, A );
+        Cholesky( uplo, A, ctrl );
     mpi::Barrier( g.Comm() );
     const double runTime = mpi::Time() - startTime;
     const double realGFlops = 1./3.*Pow(double(m),3.)/(1.e9*runTime);
@@ -129,9 +139,11 @@ main( int argc, char* argv[] )
         const bool colMajor = Input("--colMajor","column-major ordering?",true);
         const char uploChar = Input("--uplo","upper or lower storage: L/U",'L');
         const Int m = Input("--m","height of matrix",100);
-        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const Int nb = Input("--nb","algorithmic blocksize",32);
         const Int nbLocal = Input("--nbLocal","local blocksize",32);
         const bool pivot = Input("--pivot","use pivoting?",false);
+        const Int numUpdateBlocks = Input
+            ("--numUpdateBlocks","number of blocks of trailing update",4);
         const bool testCorrectness = Input
             ("--correctness","test correctness?",true);
         const bool print = Input("--print","print matrices?",false);
@@ -151,15 +163,25 @@ main( int argc, char* argv[] )
         if( commRank == 0 )
             cout << "Will test Cholesky" << uploChar << endl;
 
-        if( commRank == 0 )
-            cout << "Testing with doubles:" << endl;
-        TestCholesky<double,VC>
-        ( testCorrectness, pivot, print, printDiag, uplo, m, g );
+        for( const bool lookahead : { false, true } )
+        {
+            CholeskyCtrl ctrl;
+            ctrl.lookahead = lookahead;
+            ctrl.numUpdateBlocks = numUpdateBlocks;
+            if( commRank == 0 )
+                cout << (lookahead ? "With lookahead:" : "Without lookahead:")
+                     << endl;
 
-        if( commRank == 0 )
-            cout << "Testing with double-precision complex:" << endl;
-        TestCholesky<Complex<double>,VC>
-        ( testCorrectness, pivot, print, printDiag, uplo, m, g );
+            if( commRank == 0 )
+                cout << "Testing with doubles:" << endl;
+            TestCholesky<double,VC>
+            ( testCorrectness, pivot, print, printDiag, uplo, m, g, ctrl );
+
+            if( commRank == 0 )
+                cout << "Testing with double-precision complex:" << endl;
+            TestCholesky<Complex<double>,VC>
+            ( testCorrectness, pivot, print, printDiag, uplo, m, g, ctrl );
+        }
     }
     catch( exception& e ) { ReportException(e); }
 
@@ -119,6 +119,8 @@ main( int argc, char* argv[] )
         const Int m = Input("--height","height of matrix",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
         const Int nbLocal = Input("--nbLocal","local blocksize",32);
+        const Int bandwidth = Input
+            ("--bandwidth","bandwidth of the two-stage reduction",0);
         const bool avoidTrmv = 
             Input("--avoidTrmv","avoid Trmv based Symv",true);
         const bool testCorrectness = Input
@@ -212,6 +214,23 @@ main( int argc, char* argv[] )
             ( testCorrectness, print, onlyEigvals, clustered, 
               uplo, m, sort, g, subset, ctrl_z );
 
+        if( commRank == 0 )
+            cout << "Two-stage tridiag algorithms:" << endl;
+        ctrl_d.tridiagCtrl.twoStage = true;
+        ctrl_z.tridiagCtrl.twoStage = true;
+        ctrl_d.tridiagCtrl.bandwidth = bandwidth;
+        ctrl_z.tridiagCtrl.bandwidth = bandwidth;
+        if( testReal )
+            TestHermitianEig<double>
+            ( testCorrectness, print, onlyEigvals, clustered, 
+              uplo, m, sort, g, subset, ctrl_d );
+        if( testCpx )
+            TestHermitianEig<Complex<double>>
+            ( testCorrectness, print, onlyEigvals, clustered, 
+              uplo, m, sort, g, subset, ctrl_z );
+        ctrl_d.tridiagCtrl.twoStage = false;
+        ctrl_z.tridiagCtrl.twoStage = false;
+
         // Also test with non-standard distributions
         if( commRank == 0 )
             cout << "Nonstandard distributions:" << endl;
@@ -16,7 +16,7 @@ void TestCorrectness
   const DistMatrix<F>& A,
   const DistMatrix<Int,UPerm,STAR>& p,
   const DistMatrix<Int,UPerm,STAR>& q,
-  Int pivoting, bool print )
+  Int pivoting, bool forceGrowth, bool print )
 {
     typedef Base<F> Real;
     const Grid& g = A.Grid();
@@ -47,6 +47,7 @@ void TestCorrectness
     const Real oneNormOfA = OneNorm( AOrig );
     const Real infNormOfA = InfinityNorm( AOrig );
     const Real frobNormOfA = FrobeniusNorm( AOrig );
+    const Real relResid = frobNormOfError / (frobNormOfA*FrobeniusNorm( Y ));
 
     if( g.Rank() == 0 )
     {
@@ -58,14 +59,20 @@ void TestCorrectness
              << "||X||_F             = " << frobNormOfX << "\n"
              << "||A A^-1 X - X||_1  = " << oneNormOfError << "\n"
              << "||A A^-1 X - X||_oo = " << infNormOfError << "\n"
-             << "||A A^-1 X - X||_F  = " << frobNormOfError << endl;
+             << "||A A^-1 X - X||_F  = " << frobNormOfError << "\n"
+             << "||A A^-1 X - X||_F / (||A||_F ||A^-1 X||_F) = " 
+             << relResid << endl;
     }
+    // Forced element growth voids the backward stability of partial pivoting
+    const Real tol = 10*m*lapack::MachineEpsilon<Real>();
+    if( !forceGrowth && relResid > tol )
+        LogicError("Relative residual of ",relResid," exceeded ",tol);
 }
 
 template<typename F,Dist UPerm> 
 void TestLU
 ( Int m, const Grid& g, Int pivoting, 
-  bool testCorrectness, bool forceGrowth, bool print )
+  bool testCorrectness, bool forceGrowth, bool print, const LUCtrl& ctrl )
 {
     DistMatrix<F> A(g), AOrig(g);
     DistMatrix<Int,UPerm,STAR> p(g), q(g);
@@ -99,7 +106,7 @@ void TestLU
     if( pivoting == 0 )
         LU( A );
     else if( pivoting == 1 )
-        LU( A, p );
+        LU( A, p, ctrl );
     else if( pivoting == 2 )
         LU( A, p, q );
 
@@ -132,7 +139,7 @@ void TestLU
         }
     }
     if( testCorrectness )
-        TestCorrectness( AOrig, A, p, q, pivoting, print );
+        TestCorrectness( AOrig, A, p, q, pivoting, forceGrowth, print );
 }
 
 int 
@@ -148,10 +155,12 @@ main( int argc, char* argv[] )
         Int r = Input("--gridHeight","height of process grid",0);
         const bool colMajor = Input("--colMajor","column-major ordering?",true);
         const Int m = Input("--height","height of matrix",100);
-        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const Int nb = Input("--nb","algorithmic blocksize",32);
         const Int pivot = Input("--pivot","0: none, 1: partial, 2: full",1);
         const bool forceGrowth = Input
             ("--forceGrowth","force element growth?",false);
+        const Int numUpdateBlocks = Input
+            ("--numUpdateBlocks","number of blocks of trailing update",4);
         const bool testCorrectness = Input
             ("--correctness","test correctness?",true);
         const bool print = Input("--print","print matrices?",false);
@@ -177,14 +186,28 @@ main( int argc, char* argv[] )
                 cout << "full pivoting" << std::endl;
         }
 
-        if( commRank == 0 )
-            cout << "Testing with doubles:" << endl;
-        TestLU<double,VC>( m, g, pivot, testCorrectness, forceGrowth, print );
-
-        if( commRank == 0 )
-            cout << "Testing with double-precision complex:" << endl;
-        TestLU<Complex<double>,VC>
-        ( m, g, pivot, testCorrectness, forceGrowth, print );
+        // Lookahead is only supported with partial pivoting
+        for( const bool lookahead : { false, true } )
+        {
+            if( lookahead && pivot != 1 )
+                break;
+            LUCtrl ctrl;
+            ctrl.lookahead = lookahead;
+            ctrl.numUpdateBlocks = numUpdateBlocks;
+            if( commRank == 0 )
+                cout << (lookahead ? "With lookahead:" : "Without lookahead:")
+                     << endl;
+
+            if( commRank == 0 )
+                cout << "Testing with doubles:" << endl;
+            TestLU<double,VC>
+            ( m, g, pivot, testCorrectness, forceGrowth, print, ctrl );
+
+            if( commRank == 0 )
+                cout << "Testing with double-precision complex:" << endl;
+            TestLU<Complex<double>,VC>
+            ( m, g, pivot, testCorrectness, forceGrowth, print, ctrl );
+        }
     }
     catch( exception& e ) { ReportException(e); }
 
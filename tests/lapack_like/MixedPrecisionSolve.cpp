@@ -0,0 +1,186 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace std;
+using namespace El;
+
+template<typename F>
+Base<F> RelativeResidual
+( const Matrix<F>& A, bool hermitian, const Matrix<F>& X, const Matrix<F>& B )
+{
+    Matrix<F> E( B );
+    if( hermitian )
+        Hemm( LEFT, LOWER, F(-1), A, X, F(1), E );
+    else
+        Gemm( NORMAL, NORMAL, F(-1), A, X, F(1), E );
+    return FrobeniusNorm( E ) / (FrobeniusNorm( A )*FrobeniusNorm( X ));
+}
+
+template<typename F>
+Base<F> RelativeResidual
+( const DistMatrix<F>& A, bool hermitian, 
+  const DistMatrix<F>& X, const DistMatrix<F>& B )
+{
+    DistMatrix<F> E( B );
+    if( hermitian )
+        Hemm( LEFT, LOWER, F(-1), A, X, F(1), E );
+    else
+        Gemm( NORMAL, NORMAL, F(-1), A, X, F(1), E );
+    return FrobeniusNorm( E ) / (FrobeniusNorm( A )*FrobeniusNorm( X ));
+}
+
+// Solve with the mixed-precision overload and check both the residual and
+// whether the solve was refined or fell back to working precision
+template<typename F,class MatrixType>
+void CheckSolve
+( const string& label, bool hermitian, bool expectFallback,
+  const MatrixType& A, const MatrixType& B, Int commRank,
+  const MixedPrecisionCtrl<Base<F>>& ctrl )
+{
+    typedef Base<F> Real;
+    const Real tol = 10*A.Height()*lapack::MachineEpsilon<Real>();
+
+    MatrixType X( B );
+    const Int numIts = 
+      ( hermitian ? HPDSolve( LOWER, NORMAL, A, X, ctrl )
+                  : LinearSolve( A, X, ctrl ) );
+    const Real relResid = RelativeResidual( A, hermitian, X, B );
+    if( commRank == 0 )
+    {
+        cout << "  " << label << ": ";
+        if( numIts >= 0 )
+            cout << numIts << " refinement iterations, ";
+        else
+            cout << "fell back to working precision, ";
+        cout << "||A X - B||_F / (||A||_F ||X||_F) = " << relResid << endl;
+    }
+    if( relResid > tol )
+        LogicError
+        (label,": relative residual ",relResid," exceeded ",tol);
+    if( expectFallback && numIts >= 0 )
+        LogicError(label,": expected a fallback to working precision");
+    if( !expectFallback && numIts < 0 )
+        LogicError(label,": refinement unexpectedly fell back");
+}
+
+template<typename F,class MatrixType>
+void TestSolve
+( bool hermitian, MatrixType& A, MatrixType& B, Int commRank,
+  const MixedPrecisionCtrl<Base<F>>& ctrl )
+{
+    typedef Base<F> Real;
+    for( auto alg : { MIXED_REFINE_IR, MIXED_REFINE_GMRES } )
+    {
+        auto algCtrl( ctrl );
+        algCtrl.alg = alg;
+        CheckSolve<F>
+        ( alg==MIXED_REFINE_IR ? "mixed precision IR" : 
+                                 "mixed precision GMRES-IR",
+          hermitian, false, A, B, commRank, algCtrl );
+    }
+
+    // A matrix whose entries overflow single precision must be solved
+    // entirely in working precision
+    const Real scale = Real(1)/lapack::MachineSafeMin<float>();
+    Scale( 100*scale, A );
+    Scale( 100*scale, B );
+    CheckSolve<F>
+    ( "overflowing matrix", hermitian, true, A, B, commRank, ctrl );
+
+    // Likewise when the refinement is not allowed to make progress
+    Scale( Real(1)/(100*scale), A );
+    Scale( Real(1)/(100*scale), B );
+    auto stalledCtrl( ctrl );
+    stalledCtrl.maxRefineIts = 0;
+    CheckSolve<F>
+    ( "no refinement iterations", hermitian, true, A, B, commRank, 
+      stalledCtrl );
+}
+
+template<typename F>
+void TestSolve
+( bool hermitian, Int m, Int numRHS, Base<F> cond, const Grid& g,
+  const MixedPrecisionCtrl<Base<F>>& ctrl )
+{
+    typedef Base<F> Real;
+    const Int commRank = g.Rank();
+
+    if( commRank == 0 )
+    {
+        cout << " Sequential:" << endl;
+        Matrix<F> A, B;
+        if( hermitian )
+            HermitianUniformSpectrum( A, m, Real(1)/cond, Real(1) );
+        else
+            Uniform( A, m, m );
+        Uniform( B, m, numRHS );
+        TestSolve<F>( hermitian, A, B, commRank, ctrl );
+    }
+
+    if( commRank == 0 )
+        cout << " Distributed:" << endl;
+    DistMatrix<F> A(g), B(g);
+    if( hermitian )
+        HermitianUniformSpectrum( A, m, Real(1)/cond, Real(1) );
+    else
+        Uniform( A, m, m );
+    Uniform( B, m, numRHS );
+    TestSolve<F>( hermitian, A, B, commRank, ctrl );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+
+    try
+    {
+        const Int m = Input("--height","height of matrix",500);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",10);
+        const double cond = Input
+          ("--cond","condition number of the HPD matrices",1e3);
+        const Int maxRefineIts = Input
+          ("--maxRefineIts","maximum number of refinement iterations",30);
+        const Int maxGMRESIts = Input
+          ("--maxGMRESIts","maximum number of GMRES iterations",20);
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const bool progress = Input("--progress","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        MixedPrecisionCtrl<double> ctrl;
+        ctrl.maxRefineIts = maxRefineIts;
+        ctrl.maxGMRESIts = maxGMRESIts;
+        ctrl.progress = progress;
+
+        if( commRank == 0 )
+            cout << "Testing LinearSolve with doubles:" << endl;
+        TestSolve<double>( false, m, numRHS, cond, g, ctrl );
+        if( commRank == 0 )
+            cout << "Testing HPDSolve with doubles:" << endl;
+        TestSolve<double>( true, m, numRHS, cond, g, ctrl );
+        if( commRank == 0 )
+            cout << "Testing LinearSolve with double-precision complex:"
+                 << endl;
+        TestSolve<Complex<double>>( false, m, numRHS, cond, g, ctrl );
+        if( commRank == 0 )
+            cout << "Testing HPDSolve with double-precision complex:" << endl;
+        TestSolve<Complex<double>>( true, m, numRHS, cond, g, ctrl );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
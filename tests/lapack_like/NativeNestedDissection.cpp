@@ -0,0 +1,95 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// Solve against a 3D Laplacian using orderings from the built-in multilevel
+// bisection, with the leaves of the dissection ordered by approximate 
+// minimum degree, and check the residuals of the sequential and distributed
+// solves
+
+double MaxRelativeResidual
+( const Matrix<double>& residNorms, const Matrix<double>& BNorms )
+{
+    double maxRelResid = 0;
+    for( Int j=0; j<BNorms.Height(); ++j )
+        maxRelResid = 
+          Max( maxRelResid, residNorms.Get(j,0)/BNorms.Get(j,0) );
+    return maxRelResid;
+}
+
+int main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank( comm );
+
+    try
+    {
+        const Int n1 = Input("--n1","first grid dimension",20);
+        const Int n2 = Input("--n2","second grid dimension",20);
+        const Int n3 = Input("--n3","third grid dimension",20);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",3);
+        const Int cutoff = Input("--cutoff","cutoff for nested dissection",64);
+        const double tol = Input("--tol","relative residual tolerance",1e-10);
+        ProcessInput();
+        PrintInputReport();
+
+        BisectCtrl ctrl;
+        ctrl.cutoff = cutoff;
+        ctrl.native = true;
+        ctrl.orderLeaves = true;
+
+        const Int N = n1*n2*n3;
+
+        // Sequential
+        // ==========
+        if( commRank == 0 )
+        {
+            SparseMatrix<double> A;
+            Laplacian( A, n1, n2, n3 );
+            Matrix<double> B, X;
+            Uniform( B, N, numRHS );
+            X = B;
+            HermitianSolve( A, X, false, ctrl );
+            Matrix<double> BNorms, residNorms;
+            ColumnNorms( B, BNorms );
+            Multiply( NORMAL, -1., A, X, 1., B );
+            ColumnNorms( B, residNorms );
+            const double seqResid = MaxRelativeResidual( residNorms, BNorms );
+            cout << "Sequential: max || B - A X ||_2 / || B ||_2 = " 
+                 << seqResid << endl;
+            if( seqResid > tol )
+                LogicError("Sequential residual of ",seqResid," exceeds ",tol);
+        }
+
+        // Distributed
+        // ===========
+        DistSparseMatrix<double> A(comm);
+        Laplacian( A, n1, n2, n3 );
+        DistMultiVec<double> B(comm), X(comm);
+        Uniform( B, N, numRHS );
+        X = B;
+        HermitianSolve( A, X, false, ctrl );
+        Matrix<double> BNorms, residNorms;
+        ColumnNorms( B, BNorms );
+        Multiply( NORMAL, -1., A, X, 1., B );
+        ColumnNorms( B, residNorms );
+        const double distResid = MaxRelativeResidual( residNorms, BNorms );
+        if( commRank == 0 )
+            cout << "Distributed: max || B - A X ||_2 / || B ||_2 = " 
+                 << distResid << endl;
+        if( distResid > tol )
+            LogicError("Distributed residual of ",distResid," exceeds ",tol);
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
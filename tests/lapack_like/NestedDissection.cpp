@@ -11,6 +11,133 @@
 #include "El.hpp"
 using namespace El;
 
+// Append the (offset,size,parent offset) triples of the sequential subtree
+void PackNodes
+( const ldl::NodeInfo& node, Int parentOff, vector<Int>& triples )
+{
+    triples.push_back( node.off );
+    triples.push_back( node.size );
+    triples.push_back( parentOff );
+    for( const ldl::NodeInfo* child : node.children )
+        PackNodes( *child, node.off, triples );
+}
+
+// Append the triples of the nodes of the elimination tree which are known to 
+// this process, i.e., its path through the distributed tree and its local 
+// subtree
+void PackNodes( const ldl::DistNodeInfo& info, vector<Int>& triples )
+{
+    Int parentOff = -1;
+    const ldl::DistNodeInfo* node = &info;
+    while( true )
+    {
+        triples.push_back( node->off );
+        triples.push_back( node->size );
+        triples.push_back( parentOff );
+        parentOff = node->off;
+        if( node->child == nullptr )
+            break;
+        node = node->child;
+    }
+    for( const ldl::NodeInfo* child : node->duplicate->children )
+        PackNodes( *child, parentOff, triples );
+}
+
+template<typename T>
+vector<T> AllGatherVector( const vector<T>& local, mpi::Comm comm )
+{
+    const int commSize = mpi::Size( comm );
+    const int localSize = local.size();
+    vector<int> sizes( commSize ), offs( commSize );
+    mpi::AllGather( &localSize, 1, sizes.data(), 1, comm );
+    const int totalSize = Scan( sizes, offs );
+    vector<T> global( totalSize );
+    mpi::AllGather
+    ( local.data(), localSize, global.data(), sizes.data(), offs.data(), 
+      comm );
+    return global;
+}
+
+// Check that the reordering is a permutation, that the nodes of the 
+// elimination tree partition the reordered indices, and that every edge of the
+// n x n x n 7-point stencil connects a node to one of its ancestors (i.e.,
+// that every separator separates the subtrees of its children)
+void CheckOrdering
+( Int n, const DistMap& map, const ldl::DistNodeInfo& info, mpi::Comm comm )
+{
+    const Int numVertices = n*n*n;
+    vector<Int> localMap( map.NumLocalSources() );
+    for( Int iLocal=0; iLocal<map.NumLocalSources(); ++iLocal )
+        localMap[iLocal] = map.GetLocal( iLocal );
+    const vector<Int> fullMap = AllGatherVector( localMap, comm );
+    if( Int(fullMap.size()) != numVertices )
+        LogicError("The reordering has ",fullMap.size()," entries");
+    vector<Int> invMap( numVertices, -1 );
+    for( Int i=0; i<numVertices; ++i )
+    {
+        const Int p = fullMap[i];
+        if( p < 0 || p >= numVertices || invMap[p] != -1 )
+            LogicError("The reordering is not a permutation");
+        invMap[p] = i;
+    }
+
+    // Gather the nodes of the elimination tree, which several processes may
+    // hold copies of, and find the node owning each reordered index
+    vector<Int> triples;
+    PackNodes( info, triples );
+    triples = AllGatherVector( triples, comm );
+    std::map<Int,std::pair<Int,Int>> nodes;
+    for( size_t k=0; k<triples.size(); k+=3 )
+        nodes[triples[k]] = std::make_pair( triples[k+1], triples[k+2] );
+    vector<Int> owner( numVertices, -1 );
+    for( const auto& node : nodes )
+    {
+        const Int off = node.first;
+        const Int size = node.second.first;
+        if( off < 0 || off+size > numVertices )
+            LogicError("Node at offset ",off," is out of bounds");
+        for( Int p=off; p<off+size; ++p )
+        {
+            if( owner[p] != -1 )
+                LogicError("Index ",p," belongs to multiple nodes");
+            owner[p] = off;
+        }
+    }
+    for( Int p=0; p<numVertices; ++p )
+        if( owner[p] == -1 )
+            LogicError("Index ",p," does not belong to a node");
+
+    auto IsAncestor = [&]( Int ancOff, Int off )
+    {
+        while( off != -1 )
+        {
+            if( off == ancOff )
+                return true;
+            off = nodes[off].second;
+        }
+        return false;
+    };
+    for( Int i=0; i<numVertices; ++i )
+    {
+        const Int x = i % n;
+        const Int y = (i/n) % n;
+        const Int z = i/(n*n);
+        const Int neighbors[3] = 
+          { x+1<n ? i+1 : -1, y+1<n ? i+n : -1, z+1<n ? i+n*n : -1 };
+        for( Int j : neighbors )
+        {
+            if( j == -1 )
+                continue;
+            const Int iNode = owner[fullMap[i]];
+            const Int jNode = owner[fullMap[j]];
+            if( !IsAncestor(iNode,jNode) && !IsAncestor(jNode,iNode) )
+                LogicError
+                ("Edge (",i,",",j,") connects the disjoint subtrees of nodes ",
+                 iNode," and ",jNode);
+        }
+    }
+}
+
 int main( int argc, char* argv[] )
 {
     Initialize( argc, argv );
@@ -29,6 +156,16 @@ int main( int argc, char* argv[] )
             ("--numSeqSeps",
              "number of separators to try per sequential partition",1);
         const Int cutoff = Input("--cutoff","cutoff for nested dissection",128);
+        const bool native = Input
+            ("--native","use the built-in multilevel bisection?",false);
+        const bool orderLeaves = Input
+            ("--orderLeaves","order the leaves with minimum degree?",true);
+        const bool amalgamate = Input
+            ("--amalgamate","amalgamate small supernodes?",true);
+        const Int relaxSize = Input
+            ("--relaxSize","supernode size which is always relaxed",16);
+        const double relaxFill = Input
+            ("--relaxFill","fraction of explicit zeros in relaxed fronts",0.1);
         const bool print = Input("--print","print graph?",false);
         const bool display = Input("--display","display graph?",false);
         ProcessInput();
@@ -38,6 +175,11 @@ int main( int argc, char* argv[] )
         ctrl.numSeqSeps = numSeqSeps;
         ctrl.numDistSeps = numDistSeps;
         ctrl.cutoff = cutoff;
+        ctrl.native = native;
+        ctrl.orderLeaves = orderLeaves;
+        ctrl.amalgamate = amalgamate;
+        ctrl.relaxSize = relaxSize;
+        ctrl.relaxFill = relaxFill;
 
         const Int numVertices = n*n*n;
         DistGraph graph( numVertices, comm );
@@ -96,10 +238,18 @@ int main( int argc, char* argv[] )
         if( commRank == 0 )
             cout << "done" << endl;
 
+        CheckOrdering( n, map, info, comm );
+        if( commRank == 0 )
+            cout << "The ordering and separators are valid" << endl;
+
         const int rootSepSize = info.size;
-        // TODO: Print more than just the root separator size
+        const auto stats = ldl::GetAnalysisStats( info );
         if( commRank == 0 )
+        {
             cout << rootSepSize << " vertices in root separator\n" << endl;
+            ldl::PrintAnalysisStats( stats );
+            cout << endl;
+        }
     }
     catch( exception& e ) { ReportException(e); }
 
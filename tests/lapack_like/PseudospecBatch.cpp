@@ -0,0 +1,96 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace std;
+using namespace El;
+
+void CheckBatchSize( const string& label, Int batchSize, Int expected )
+{
+    if( batchSize != expected )
+        LogicError
+        (label,": chose a batch size of ",batchSize," rather than ",expected);
+}
+
+// The shifts should fill the cache left over after the n x n triangular
+// matrix, with each shift requiring rowBytes*n bytes
+void TestSequential( Int commRank )
+{
+    const Int KB = 1024;
+    const Int MB = KB*KB;
+
+    // An explicit batch size is always respected
+    CheckBatchSize
+    ("Explicit",pspec::SequentialBatchSize(7,1000,100,16,16,MB),7);
+
+    // (1 MB - 16*100*101/2 bytes) / (16*100 bytes) = 604 shifts
+    CheckBatchSize
+    ("Complex n=100 with 1 MB",
+     pspec::SequentialBatchSize(0,1000,100,16,16,MB),604);
+    // ...which is truncated to the number of shifts
+    CheckBatchSize
+    ("Complex n=100 with 1 MB and few shifts",
+     pspec::SequentialBatchSize(0,100,100,16,16,MB),100);
+    // Real quasi-triangular matrices use two real columns per shift:
+    // (256 KB - 8*200*201/2 bytes) / (16*200 bytes) = 31 shifts
+    CheckBatchSize
+    ("Real n=200 with 256 KB",
+     pspec::SequentialBatchSize(0,1000,200,8,16,256*KB),31);
+    // If less than one shift fits, each batch is still a single shift
+    CheckBatchSize
+    ("Complex n=361 with 1 MB",
+     pspec::SequentialBatchSize(0,1000,361,16,16,MB),1);
+    // If the matrix does not fit in the cache, all of the shifts are batched
+    CheckBatchSize
+    ("Complex n=1000 with 1 MB",
+     pspec::SequentialBatchSize(0,1000,1000,16,16,MB),1000);
+    CheckBatchSize
+    ("No shifts",pspec::SequentialBatchSize(0,0,100,16,16,MB),1);
+
+    if( commRank == 0 )
+        cout << "Sequential batch sizes were correct" << endl;
+}
+
+// The batch size counts the local shifts of each of the process columns
+void TestDistributed( Int commRank )
+{
+    CheckBatchSize
+    ("Default with width 4",pspec::DistBatchSize(0,1000,4),1000);
+    CheckBatchSize
+    ("Batches of 5 with width 1",pspec::DistBatchSize(5,1000,1),5);
+    CheckBatchSize
+    ("Batches of 5 with width 4",pspec::DistBatchSize(5,1000,4),20);
+    CheckBatchSize
+    ("Batches of 5 with width 4 and few shifts",
+     pspec::DistBatchSize(5,10,4),10);
+    CheckBatchSize("No shifts",pspec::DistBatchSize(5,0,4),1);
+
+    if( commRank == 0 )
+        cout << "Distributed batch sizes were correct" << endl;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+
+    try
+    {
+        ProcessInput();
+        PrintInputReport();
+
+        TestSequential( commRank );
+        TestDistributed( commRank );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,138 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace std;
+using namespace El;
+
+template<typename F>
+void TestCorrectness
+( const DistMatrix<F>& AOrig, const DistMatrix<F>& U,
+  const DistMatrix<Base<F>,VR,STAR>& s, const DistMatrix<F>& V )
+{
+    typedef Base<F> Real;
+    const Grid& g = U.Grid();
+    const Int m = AOrig.Height();
+    const Int n = AOrig.Width();
+    const Real tol = 50*Max(m,n)*lapack::MachineEpsilon<Real>();
+
+    DistMatrix<F> E(g);
+    Identity( E, n, n );
+    Herk( LOWER, ADJOINT, Real(-1), U, Real(1), E );
+    const Real UOrthogError = HermitianFrobeniusNorm( LOWER, E );
+    Identity( E, n, n );
+    Herk( LOWER, ADJOINT, Real(-1), V, Real(1), E );
+    const Real VOrthogError = HermitianFrobeniusNorm( LOWER, E );
+
+    // E := A - U diag(s) V^H
+    DistMatrix<F> US( U );
+    DiagonalScale( RIGHT, NORMAL, s, US );
+    E = AOrig;
+    Gemm( NORMAL, ADJOINT, F(-1), US, V, F(1), E );
+    const Real relResid = FrobeniusNorm( E ) / FrobeniusNorm( AOrig );
+    if( g.Rank() == 0 )
+        cout << "    ||U^H U - I||_F = " << UOrthogError << "\n"
+             << "    ||V^H V - I||_F = " << VOrthogError << "\n"
+             << "    ||A - U S V^H||_F / ||A||_F = " << relResid << endl;
+    if( UOrthogError > tol )
+        LogicError("||U^H U - I||_F = ",UOrthogError," exceeded ",tol);
+    if( VOrthogError > tol )
+        LogicError("||V^H V - I||_F = ",VOrthogError," exceeded ",tol);
+    if( relResid > tol )
+        LogicError("Relative residual of ",relResid," exceeded ",tol);
+    for( Int j=1; j<n; ++j )
+        if( s.Get(j,0) > s.Get(j-1,0) )
+            LogicError("Singular values were not sorted");
+}
+
+template<typename F>
+void TestSVD
+( const string& label, Int m, Int n, Int rank, const Grid& g,
+  const SVDCtrl<Base<F>>& ctrl )
+{
+    DistMatrix<F> A(g), AOrig(g), V(g);
+    DistMatrix<Base<F>,VR,STAR> s(g);
+    if( rank < Min(m,n) )
+    {
+        // A rank-deficient matrix has (numerically) zero singular values
+        DistMatrix<F> X(g), Y(g);
+        Uniform( X, m, rank );
+        Uniform( Y, rank, n );
+        Zeros( A, m, n );
+        Gemm( NORMAL, NORMAL, F(1), X, Y, F(0), A );
+    }
+    else
+        Uniform( A, m, n );
+    AOrig = A;
+
+    if( g.Rank() == 0 )
+        cout << "  " << label << endl;
+    const bool usedMRRR = SVD( A, s, V, ctrl );
+    TestCorrectness( AOrig, A, s, V );
+
+    // The singular values of a full-rank uniform matrix are well-separated,
+    // so PMRRR should not need to fall back to the QR algorithm, which is
+    // only expected for the zero singular values of rank-deficient matrices
+    if( ctrl.distMRRR && rank == Min(m,n) && !usedMRRR )
+        LogicError("PMRRR unexpectedly fell back to the QR algorithm");
+    if( g.Rank() == 0 && ctrl.distMRRR )
+        cout << "    " << (usedMRRR ? "used PMRRR" : "fell back to QR")
+             << endl;
+}
+
+template<typename F>
+void TestSVDs( Int m, Int n, const Grid& g )
+{
+    for( const bool distMRRR : { false, true } )
+    {
+        if( g.Rank() == 0 )
+            cout << (distMRRR ? " PMRRR on the Golub-Kahan tridiagonal:" :
+                                " Redundant bidiagonal QR:") << endl;
+        SVDCtrl<Base<F>> ctrl;
+        ctrl.distMRRR = distMRRR;
+        TestSVD<F>( "square", n, n, n, g, ctrl );
+        TestSVD<F>( "tall", m, n, n, g, ctrl );
+        TestSVD<F>( "rank-deficient", m, n, n/2, g, ctrl );
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+
+    try
+    {
+        const Int m = Input("--height","height of tall matrices",300);
+        const Int n = Input("--width","width of matrices",100);
+        const Int nb = Input("--nb","algorithmic blocksize",32);
+        const bool testCpx = Input("--testCpx","test complex matrices?",true);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        if( commRank == 0 )
+            cout << "Testing SVD with doubles:" << endl;
+        TestSVDs<double>( m, n, g );
+        if( testCpx )
+        {
+            if( commRank == 0 )
+                cout << "Testing SVD with double-precision complex:" << endl;
+            TestSVDs<Complex<double>>( m, n, g );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
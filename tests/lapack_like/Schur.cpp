@@ -0,0 +1,158 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace std;
+using namespace El;
+
+template<typename F>
+void TestCorrectness
+( const DistMatrix<F>& A, const DistMatrix<F>& T, const DistMatrix<F>& Q,
+  bool print, bool display )
+{
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+    const Real frobNormA = FrobeniusNorm( A );
+    if( g.Rank() == 0 )
+        cout << "Testing error..." << endl;
+
+    // Form || A - Q T Q^H ||_F
+    DistMatrix<F> G(g), E( A );
+    Gemm( NORMAL, NORMAL, F(1), Q, T, G );
+    Gemm( NORMAL, ADJOINT, F(-1), G, Q, F(1), E );
+    if( print )
+        Print( E, "A - Q T Q^H" );
+    if( display )
+        Display( E, "A - Q T Q^H" );
+    const Real frobNormError = FrobeniusNorm( E );
+
+    // Form || I - Q^H Q ||_F
+    Identity( E, n, n );
+    Herk( LOWER, ADJOINT, Real(-1), Q, Real(1), E );
+    const Real frobNormOrthog = HermitianFrobeniusNorm( LOWER, E );
+
+    if( g.Rank() == 0 )
+    {
+        cout << "    ||A||_F = " << frobNormA << "\n"
+             << "    ||A - Q T Q^H||_F / ||A||_F = "
+             << frobNormError/frobNormA << "\n"
+             << "    ||I - Q^H Q||_F = " << frobNormOrthog << endl;
+    }
+
+    const Real tol = 50*n*lapack::MachineEpsilon<Real>();
+    if( frobNormError > tol*frobNormA )
+        LogicError
+        ("||A - Q T Q^H||_F / ||A||_F = ",frobNormError/frobNormA,
+         " exceeded ",tol);
+    if( frobNormOrthog > tol )
+        LogicError("||I - Q^H Q||_F = ",frobNormOrthog," exceeded ",tol);
+}
+
+template<typename F>
+void TestSchur
+( Int n, const Grid& g, const HessQRCtrl& qrCtrl, bool testCorrectness,
+  bool print, bool display )
+{
+    DistMatrix<F> A(g), T(g), Q(g);
+    DistMatrix<Complex<Base<F>>,VR,STAR> w(g);
+
+    Uniform( A, n, n );
+    T = A;
+    if( print )
+        Print( A, "A" );
+    if( display )
+        Display( A, "A" );
+
+    SchurCtrl<Base<F>> ctrl;
+    ctrl.qrCtrl = qrCtrl;
+    if( g.Rank() == 0 )
+    {
+        cout << "  Starting Schur decomposition...";
+        cout.flush();
+    }
+    mpi::Barrier( g.Comm() );
+    const double startTime = mpi::Time();
+    Schur( T, w, Q, true, ctrl );
+    mpi::Barrier( g.Comm() );
+    const double runTime = mpi::Time() - startTime;
+    if( g.Rank() == 0 )
+    {
+        cout << "DONE. " << endl
+             << "  Time = " << runTime << " seconds." << std::endl;
+    }
+    if( print )
+    {
+        Print( T, "T" );
+        Print( w, "w" );
+    }
+    if( display )
+    {
+        Display( T, "T" );
+        Display( w, "w" );
+    }
+    if( testCorrectness )
+        TestCorrectness( A, T, Q, print, display );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+    const Int commSize = mpi::Size( comm );
+
+    try
+    {
+        Int r = Input("--gridHeight","height of process grid",0);
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int n = Input("--height","height of matrix",200);
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const bool distAED = Input("--distAED","distributed AED?",false);
+        const Int numShifts = Input("--numShifts","shifts per sweep",0);
+        const Int deflationSize = Input("--deflationSize","AED window",0);
+        const Int minMultiBulgeSize =
+          Input("--minMultiBulgeSize","redundant QR cutoff",75);
+        const Int chaseAdvance = Input
+          ("--chaseAdvance","rows per bulge chase window (0 for default)",0);
+        const bool testCorrectness = Input
+            ("--correctness","test correctness?",true);
+        const bool print = Input("--print","print matrices?",false);
+        const bool display = Input("--display","display matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid g( comm, r, order );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        HessQRCtrl qrCtrl;
+        qrCtrl.distAED = distAED;
+        qrCtrl.numShifts = numShifts;
+        qrCtrl.deflationSize = deflationSize;
+        qrCtrl.minMultiBulgeSize = minMultiBulgeSize;
+        qrCtrl.chaseAdvance = chaseAdvance;
+
+        if( commRank == 0 )
+            cout << "Double-precision:" << endl;
+        TestSchur<double>( n, g, qrCtrl, testCorrectness, print, display );
+
+        if( commRank == 0 )
+            cout << "Double-precision complex:" << endl;
+        TestSchur<Complex<double>>
+        ( n, g, qrCtrl, testCorrectness, print, display );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,135 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace std;
+using namespace El;
+
+template<typename Real>
+void TestSort( Int n, Int numDistinct, const Grid& g, bool print )
+{
+    // Draw the entries from a small set of values so that there are many ties
+    DistMatrix<Real> x(g);
+    Uniform( x, n, 1, Real(numDistinct)/2, Real(numDistinct)/2 );
+    auto roundEntries = []( Real alpha ) { return std::round(alpha); };
+    EntrywiseMap( x, function<Real(Real)>(roundEntries) );
+    if( print )
+        Print( x, "x" );
+
+    // The sequential reference
+    DistMatrix<Real,STAR,STAR> x_STAR_STAR( x );
+    auto xRef = x_STAR_STAR.Matrix();
+    Sort( xRef, ASCENDING );
+    const auto medianRef = Median( x_STAR_STAR.Matrix() );
+    auto pairsRef = TaggedSort( x_STAR_STAR.Matrix(), DESCENDING );
+
+    // Sort
+    DistMatrix<Real> y( x );
+    if( g.Rank() == 0 )
+    {
+        cout << "  Starting sample sort...";
+        cout.flush();
+    }
+    mpi::Barrier( g.Comm() );
+    double startTime = mpi::Time();
+    Sort( y, ASCENDING );
+    mpi::Barrier( g.Comm() );
+    double runTime = mpi::Time() - startTime;
+    if( g.Rank() == 0 )
+        cout << "DONE. " << endl
+             << "  Time = " << runTime << " seconds." << endl;
+    if( print )
+        Print( y, "sorted x" );
+    DistMatrix<Real,STAR,STAR> y_STAR_STAR( y );
+    Int numSortErrors = 0;
+    for( Int i=0; i<n; ++i )
+        if( y_STAR_STAR.GetLocal(i,0) != xRef.Get(i,0) )
+            ++numSortErrors;
+
+    // Median
+    if( g.Rank() == 0 )
+    {
+        cout << "  Starting distributed selection...";
+        cout.flush();
+    }
+    mpi::Barrier( g.Comm() );
+    startTime = mpi::Time();
+    const auto median = Median( x );
+    mpi::Barrier( g.Comm() );
+    runTime = mpi::Time() - startTime;
+    if( g.Rank() == 0 )
+        cout << "DONE. " << endl
+             << "  Time = " << runTime << " seconds." << endl;
+    const bool medianMatches =
+      median.value == medianRef.value && median.index == medianRef.index;
+
+    // Tagged sort
+    auto pairs = TaggedSort( x, DESCENDING );
+    DistMatrix<Real> z(g);
+    DistMatrix<Int> p(g);
+    TaggedSort( x, z, p, DESCENDING );
+    DistMatrix<Real,STAR,STAR> z_STAR_STAR( z );
+    DistMatrix<Int,STAR,STAR> p_STAR_STAR( p );
+    Int numTaggedErrors = 0;
+    for( Int i=0; i<n; ++i )
+    {
+        if( pairs[i].value != pairsRef[i].value ||
+            pairs[i].index != pairsRef[i].index )
+            ++numTaggedErrors;
+        if( z_STAR_STAR.GetLocal(i,0) != pairsRef[i].value ||
+            p_STAR_STAR.GetLocal(i,0) != pairsRef[i].index )
+            ++numTaggedErrors;
+    }
+
+    if( g.Rank() == 0 )
+    {
+        cout << "  # of misplaced sorted entries: " << numSortErrors << "\n"
+             << "  median matches:                " << medianMatches << "\n"
+             << "  # of misplaced tagged entries: " << numTaggedErrors
+             << endl;
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+    const Int commSize = mpi::Size( comm );
+
+    try
+    {
+        Int r = Input("--gridHeight","height of process grid",0);
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int n = Input("--height","length of vector",100000);
+        const Int numDistinct =
+          Input("--numDistinct","number of distinct values",1000);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid g( comm, r, order );
+        ComplainIfDebug();
+
+        if( commRank == 0 )
+            cout << "Single-precision:" << endl;
+        TestSort<float>( n, numDistinct, g, print );
+
+        if( commRank == 0 )
+            cout << "Double-precision:" << endl;
+        TestSort<double>( n, numDistinct, g, print );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -47,6 +47,10 @@ int main( int argc, char* argv[] )
         const Int nbFact = Input("--nbFact","factorization blocksize",96);
         const Int nbSolve = Input("--nbSolve","solve blocksize",96);
         const Int cutoff = Input("--cutoff","cutoff for nested dissection",128);
+        const bool native = Input
+            ("--native","use the built-in multilevel bisection?",false);
+        const bool orderLeaves = Input
+            ("--orderLeaves","order the leaves with minimum degree?",true);
         const bool print = Input("--print","print matrix?",false);
         const bool display = Input("--display","display matrix?",false);
         ProcessInput();
@@ -56,6 +60,8 @@ int main( int argc, char* argv[] )
         ctrl.numSeqSeps = numSeqSeps;
         ctrl.numDistSeps = numDistSeps;
         ctrl.cutoff = cutoff;
+        ctrl.native = native;
+        ctrl.orderLeaves = orderLeaves;
 
         const int N = n1*n2*n3;
         DistSparseMatrix<double> A(comm);
@@ -11,26 +11,6 @@
 #include "El.hpp"
 using namespace El;
 
-template<typename F>
-void MakeFrontsUniform( ldl::Front<F>& front )
-{
-    ldl::ChangeFrontType( front, SYMM_2D );
-    MakeUniform( front.L );
-    for( ldl::Front<F>* child : front.children )
-        MakeFrontsUniform( *child );
-}
-
-template<typename F>
-void MakeFrontsUniform( ldl::DistFront<F>& front )
-{
-    ldl::ChangeFrontType( front, SYMM_2D );
-    MakeUniform( front.L2D );
-    if( front.child != nullptr )
-        MakeFrontsUniform( *front.child );
-    else
-        MakeFrontsUniform( *front.duplicate );
-}
-
 int main( int argc, char* argv[] )
 {
     Initialize( argc, argv );
@@ -110,7 +90,20 @@ int main( int argc, char* argv[] )
         for( Int repeat=0; repeat<numRepeats; ++repeat )
         {
             if( repeat != 0 )
-                MakeFrontsUniform( front );
+            {
+                // Change the values (but not the pattern) of A and refill
+                // the existing fronts in place
+                ShiftDiagonal( A, -1. );
+                if( commRank == 0 )
+                    cout << "Refilling the fronts..." << endl;
+                mpi::Barrier( comm );
+                const double refillStart = mpi::Time();
+                front.Refill( A );
+                mpi::Barrier( comm );
+                const double refillStop = mpi::Time();
+                if( commRank == 0 )
+                    cout << refillStop-refillStart << " seconds" << endl;
+            }
 
             if( commRank == 0 )
                 cout << "Running LDL^T and redistribution..." << endl;
@@ -130,13 +123,21 @@ int main( int argc, char* argv[] )
             const double solveStart = mpi::Time();
             DistMultiVec<double> y( N, 1, comm );
             MakeUniform( y );
-            ldl::SolveAfter( invMap, info, front, y );
+            DistMultiVec<double> x( y );
+            ldl::SolveAfter( invMap, info, front, x );
             mpi::Barrier( comm );
             const double solveStop = mpi::Time();
             if( commRank == 0 )
                 cout << "done, " << solveStop-solveStart << " seconds" << endl;
 
-            // TODO: Check residual error
+            const double yNorm = FrobeniusNorm( y );
+            Multiply( NORMAL, -1., A, x, 1., y );
+            const double relError = FrobeniusNorm( y ) / yNorm;
+            if( commRank == 0 )
+                cout << "|| y - A x ||_2 / || y ||_2 = " << relError << "\n"
+                     << endl;
+            if( relError > 1e-8 )
+                LogicError("Relative residual was too large");
         }
     }
     catch( exception& e ) { ReportException(e); }
@@ -0,0 +1,230 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace std;
+using namespace El;
+
+template<typename F>
+void TestCholesky( UpperOrLower uplo, Int n, Int tileSize, bool print )
+{
+    typedef Base<F> Real;
+    Matrix<F> A, AOrig;
+    HermitianUniformSpectrum( A, n, 1, 10 );
+    AOrig = A;
+
+    TileMatrix<F> ATile( A, tileSize );
+    const double startTime = mpi::Time();
+    Cholesky( uplo, ATile );
+    const double runTime = mpi::Time() - startTime;
+    ATile.Export( A );
+    MakeTrapezoidal( uplo, A );
+    if( print )
+        Print( A, "Tiled Cholesky factor" );
+
+    // || A - L L^H ||_F / || A ||_F (or U^H U)
+    Matrix<F> E( AOrig );
+    if( uplo == LOWER )
+        Herk( LOWER, NORMAL, Real(-1), A, Real(1), E );
+    else
+        Herk( UPPER, ADJOINT, Real(-1), A, Real(1), E );
+    MakeTrapezoidal( uplo, E );
+    const Real relError = FrobeniusNorm( E ) / FrobeniusNorm( AOrig );
+    cout << "  Cholesky (" << (uplo==LOWER ? "lower" : "upper") << "): "
+         << runTime << " seconds, ||A - F^H F||_F / ||A||_F = "
+         << relError << endl;
+    const Real tol = 100*n*lapack::MachineEpsilon<Real>();
+    if( relError > tol )
+        LogicError("Cholesky error of ",relError," exceeded ",tol);
+}
+
+template<typename F>
+void TestLU( Int m, Int n, Int tileSize, bool print )
+{
+    typedef Base<F> Real;
+    const Int minDim = Min(m,n);
+    const Real tol = 100*Max(m,n)*lapack::MachineEpsilon<Real>();
+    Matrix<F> A, AOrig;
+    Uniform( A, m, n );
+    AOrig = A;
+
+    TileMatrix<F> ATile( A, tileSize );
+    Matrix<Int> p;
+    const double startTime = mpi::Time();
+    LU( ATile, p );
+    const double runTime = mpi::Time() - startTime;
+    ATile.Export( A );
+    if( print )
+    {
+        Print( A, "Tiled LU factors" );
+        Print( p, "p" );
+    }
+
+    // || P A - L U ||_F / || A ||_F, where row i of P A is row p(i) of A
+    auto L = A( ALL, IR(0,minDim) );
+    auto U = A( IR(0,minDim), ALL );
+    Matrix<F> LUnit( L ), UTrap( U ), E;
+    MakeTrapezoidal( LOWER, LUnit, -1 );
+    FillDiagonal( LUnit, F(1) );
+    MakeTrapezoidal( UPPER, UTrap );
+    E.Resize( m, n );
+    for( Int i=0; i<m; ++i )
+        for( Int j=0; j<n; ++j )
+            E.Set( i, j, AOrig.Get(p.Get(i,0),j) );
+    Gemm( NORMAL, NORMAL, F(-1), LUnit, UTrap, F(1), E );
+    const Real relError = FrobeniusNorm( E ) / FrobeniusNorm( AOrig );
+
+    // The entries of L are bounded by (the growth of) tournament pivoting
+    Real maxL = 0;
+    for( Int j=0; j<minDim; ++j )
+        for( Int i=j+1; i<m; ++i )
+            maxL = Max( maxL, Abs(A.Get(i,j)) );
+    cout << "  LU (" << m << " x " << n << "): " << runTime << " seconds, "
+         << "||P A - L U||_F / ||A||_F = " << relError << ", max |L_ij| = "
+         << maxL << endl;
+    if( relError > tol )
+        LogicError("LU error of ",relError," exceeded ",tol);
+
+    if( m == n )
+    {
+        // Solve against random right-hand sides
+        Matrix<F> X, Y;
+        Uniform( X, m, 10 );
+        Y = X;
+        lu::SolveAfter( NORMAL, A, p, Y );
+        Gemm( NORMAL, NORMAL, F(-1), AOrig, Y, F(1), X );
+        const Real relResid = FrobeniusNorm( X ) /
+          (FrobeniusNorm( AOrig )*FrobeniusNorm( Y ));
+        cout << "    ||A X - B||_F / (||A||_F ||X||_F) = " << relResid << endl;
+        if( relResid > tol )
+            LogicError("LU solve residual of ",relResid," exceeded ",tol);
+    }
+}
+
+template<typename F>
+void TestQR( Int m, Int n, Int tileSize, bool print )
+{
+    typedef Base<F> Real;
+    Matrix<F> A, AOrig;
+    Uniform( A, m, n );
+    AOrig = A;
+
+    TileMatrix<F> ATile( A, tileSize ), T;
+    const double startTime = mpi::Time();
+    QR( ATile, T );
+    const double runTime = mpi::Time() - startTime;
+    Matrix<F> R;
+    ATile.Export( R );
+    MakeTrapezoidal( UPPER, R );
+    if( print )
+        Print( R, "Tiled R" );
+
+    // || Q^H A - R ||_F / || A ||_F
+    TileMatrix<F> BTile( AOrig, tileSize );
+    qr::ApplyQ( ADJOINT, ATile, T, BTile );
+    Matrix<F> E;
+    BTile.Export( E );
+    Axpy( F(-1), R, E );
+    const Real relError = FrobeniusNorm( E ) / FrobeniusNorm( AOrig );
+
+    // || Q Q^H A - A ||_F / || A ||_F
+    qr::ApplyQ( NORMAL, ATile, T, BTile );
+    BTile.Export( E );
+    Axpy( F(-1), AOrig, E );
+    const Real relOrthError = FrobeniusNorm( E ) / FrobeniusNorm( AOrig );
+    cout << "  QR: " << runTime << " seconds, ||Q^H A - R||_F / ||A||_F = "
+         << relError << ", ||Q Q^H A - A||_F / ||A||_F = " << relOrthError
+         << endl;
+    const Real tol = 100*Max(m,n)*lapack::MachineEpsilon<Real>();
+    if( relError > tol || relOrthError > tol )
+        LogicError("QR errors of ",relError," and ",relOrthError,
+                   " exceeded ",tol);
+}
+
+template<typename F>
+void TestTriangular
+( LeftOrRight side, UpperOrLower uplo, Orientation orientation,
+  Int m, Int n, Int tileSize )
+{
+    typedef Base<F> Real;
+    const Int k = ( side==LEFT ? m : n );
+    Matrix<F> A, B, X;
+    Uniform( A, k, k );
+    ShiftDiagonal( A, F(k) );
+    Uniform( B, m, n );
+    const F alpha = F(3);
+
+    // X := alpha op(A)^{-1} B, then compare alpha^{-1} op(A) X with B
+    TileMatrix<F> ATile( A, tileSize ), XTile( B, tileSize );
+    Trsm( side, uplo, orientation, NON_UNIT, alpha, ATile, XTile );
+    XTile.Export( X );
+    Matrix<F> XRef( B );
+    Trsm( side, uplo, orientation, NON_UNIT, alpha, A, XRef );
+    Axpy( F(-1), X, XRef );
+    const Real trsmError = FrobeniusNorm( XRef ) / FrobeniusNorm( X );
+
+    Trmm( side, uplo, orientation, NON_UNIT, F(1)/alpha, ATile, XTile );
+    XTile.Export( X );
+    Axpy( F(-1), B, X );
+    const Real trmmError = FrobeniusNorm( X ) / FrobeniusNorm( B );
+    cout << "  " << (side==LEFT ? "L" : "R") << (uplo==LOWER ? "L" : "U")
+         << OrientationToChar(orientation) << ": Trsm error = " << trsmError
+         << ", Trmm round-trip error = " << trmmError << endl;
+    const Real tol = 100*k*lapack::MachineEpsilon<Real>();
+    if( trsmError > tol || trmmError > tol )
+        LogicError("Trsm and Trmm errors of ",trsmError," and ",trmmError,
+                   " exceeded ",tol);
+}
+
+template<typename F>
+void TestTiled( Int m, Int n, Int tileSize, bool print )
+{
+    TestCholesky<F>( LOWER, m, tileSize, print );
+    TestCholesky<F>( UPPER, m, tileSize, print );
+    TestLU<F>( m, m, tileSize, print );
+    TestLU<F>( m, n, tileSize, print );
+    TestLU<F>( n, m, tileSize, print );
+    TestQR<F>( m, n, tileSize, print );
+    TestQR<F>( n, m, tileSize, print );
+    const Orientation orients[] = { NORMAL, ADJOINT };
+    for( auto side : { LEFT, RIGHT } )
+        for( auto uplo : { LOWER, UPPER } )
+            for( auto orientation : orients )
+                TestTriangular<F>( side, uplo, orientation, m, n, tileSize );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+
+    try
+    {
+        const Int m = Input("--height","height of matrix",300);
+        const Int n = Input("--width","width of matrix",200);
+        const Int tileSize = Input("--tileSize","tile size",64);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        ComplainIfDebug();
+        if( commRank == 0 )
+        {
+            cout << "Testing with doubles:" << endl;
+            TestTiled<double>( m, n, tileSize, print );
+            cout << "Testing with double-precision complex:" << endl;
+            TestTiled<Complex<double>>( m, n, tileSize, print );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}